@@ -49,6 +49,13 @@ void loop() {
     #endif
 
     com::update();
+
+    // The rest of the last packet waits for a DELAY, com keeps running meanwhile
+    if (duckparser::pending()) {
+        if (duckparser::resume()) com::sendDone();
+        return;
+    }
+
     if (com::hasData()) {
         const buffer_t& buffer = com::getBuffer();
 
@@ -76,6 +83,16 @@ void loop() {
 
                 duckparser::reset();      
             }
+
+            else if (duckparser::getDelayTime() > 0) {
+                // A DELAY is running, the packet is parsed once it is over
+                return;
+            }
+
+            else if (buffer.len > 0 && buffer.data[0] == CMD_BYTECODE) {
+                // A line the ESP8266 compiled, no parsing needed
+                duckparser::exec((const uint8_t*)buffer.data + 1, buffer.len - 1);
+            }
             
             else {
                 //debugs("Interpreting: ");
@@ -91,6 +108,12 @@ void loop() {
                 //debugln("Duckparser reset");
                 
                 duckparser::reset();
+            } else if (duckparser::getDelayTime() > 0) {
+                // A DELAY is running, the packet is parsed once it is over
+                return;
+            } else if (buffer.len > 0 && buffer.data[0] == CMD_BYTECODE) {
+                // A line the ESP8266 compiled, no parsing needed
+                duckparser::exec((const uint8_t*)buffer.data + 1, buffer.len - 1);
             } else {
                 //debugs("Interpreting: ");
 
@@ -101,6 +124,9 @@ void loop() {
             
         #endif
 
+        // Lines after a DELAY are still in the buffer, see resume() above
+        if (duckparser::pending()) return;
+
         com::sendDone();
     }
 }
\ No newline at end of file
@@ -22,16 +22,45 @@
 // #define DEBUG_BAUD 115200
 
 /*! ===== Communication Settings ===== */
+// -DENABLE_I2C on the command line selects I2C instead, like the host simulator's I2C build
+#ifndef ENABLE_I2C
 #define ENABLE_SERIAL
+#endif
 #define SERIAL_COM Serial1
 #define SERIAL_BAUD 9600
 
+// Fastest rate the ESP8266 may switch the link to after connecting (115200, 250000 or 500000).
+// Set it to SERIAL_BAUD to keep the link at SERIAL_BAUD.
+#define SERIAL_BAUD_MAX 500000
+
+// Command the ESP8266 negotiates the baud rate with.
+// It must be the same as the one the sender (ESP8266) has.
+#define CMD_BAUD 0x1C
+
+// Command the ESP8266 asks for a status with when it hasn't heard from the ATmega in a while.
+// It must be the same as the one the sender (ESP8266) has.
+#define CMD_STATUS 0x1D
+
+// Byte after CMD_STATUS the ESP8266 asks for the link counters with, see com::getStats().
+// CMD_LINK_RESET starts them over once they are sent.
+// It must be the same as the one the sender (ESP8266) has.
+#define CMD_LINK_STATS 0x01
+#define CMD_LINK_RESET 0x02
+
+// First byte of a line the ESP8266 compiled to bytecode, see duckparser::exec().
+// It must be the same as the one the sender (ESP8266) has.
+#define CMD_BYTECODE 0x1E
+
 // #define ENABLE_I2C
 // #define I2C_ADDR 0x31
 
 #define BUFFER_SIZE 128
 #define PACKET_SIZE 32
 
+// Bytes of earlier STRING text the ESP8266 may refer to when it compresses a line.
+// Takes LZ_WINDOW + BUFFER_SIZE bytes of RAM, 0 turns compression off.
+#define LZ_WINDOW 128
+
 /*! ===== SDCARD Settings ===== */
 #define USE_SD_CARD
 
@@ -40,6 +69,14 @@
 #define SD_SPEED SD_SCK_MHZ(8)
 #define AUTORUN_SCRIPT "AUTORUN.DS"
 #define MAX_NAME 32
+
+// Bytes of RAM that keep the lines of a LOOP body, or the line a REPEAT repeats, so they run
+// again without reading the SD card. Lines that don't fit are read again. 0 turns it off.
+#define SCRIPT_CACHE_SIZE 128
+
+// Keeps NAME.IDX next to every script that runs, with where its lines start, so LOOP_END and REPEAT
+// seek to them and the status can tell how far a script got. The first run after it changed writes it.
+#define USE_SCRIPT_INDEX
 #endif
 
 /*! ===== LED Settings ===== */
@@ -68,6 +105,15 @@
 // *! ===== Color Modes ===== */
 #define COLOR_ESP_UNFLASHED 0, 0, 255
 
+/*! ===== Keyboard Settings ===== */
+// Type STRING text with as few HID reports as possible: no release report between
+// different keys, modifiers stay held. Set to false for a press and a release report per key.
+#define HID_COALESCE true
+
+// Reports wait until the USB host has read the previous one, plus at least this many
+// microseconds since the previous report. Scripts can change it with TYPING_RATE.
+#define HID_INTERVAL 0
+
 /*! ===== Parser Settings ===== */
 #define CASE_SENSETIVE false
 #define DEFAULT_SLEEP 5
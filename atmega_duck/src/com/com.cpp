@@ -13,124 +13,424 @@
 #include "../../include/debug.h"
 #include "../duckparser/duckparser.h"
 #include "../sdcard/sdcard.h"
+#include "../sdcard/script_runner.h"
 
 // ===== Framing control bytes ===== 
-// These bytes mark the boundaries of each packet on the wire. They are never
-// part of the actual command payload.
+// These bytes mark the boundaries of each packet on the wire. A payload byte
+// with one of their values is sent as REQ_ESC followed by the byte XORed with
+// REQ_ESC_XOR, so payloads can hold any byte. Must be the same as the ESP's.
 #define REQ_SOT    0x01     // !< Start of transmission
 #define REQ_EOT    0x04     // !< End of transmission
 #define REQ_SD_SOT 0x02     // !< Start of SD Transmission
 #define REQ_SD_EOT 0x03     // !< End of SD Transmission
+#define REQ_ESC    0x05     // !< The next byte is payload
+#define REQ_ESC_XOR 0x20
 
 /**
 * @brief Protocol version sent to the other device with each status update.
 * The receiving device uses this to verify it is connected to compatible firmware.
+* Version 5 added baud rate negotiation (CMD_BAUD).
+* Version 6 added sequence numbers to packets and ack/window to the status.
+* Version 7 added a CRC-16 to packets and status, and nack to the status.
+* Version 8 escapes framing bytes in payloads (REQ_ESC).
+* Version 9 replaced the status struct with events, sent when their value changes.
+* Version 10 added lines compiled to bytecode (CMD_BYTECODE).
+* Version 11 added STRING text sent as keys (OP_KEYS).
+* Version 12 added compressed text (OP_LZ) and EVENT_LZ_WINDOW.
+* Version 13 added EVENT_PROGRESS.
+* Version 14 added a CRC-16 to SD packets, an empty chunk that ends an SD read
+* and sequence numbers to SD writes and listings.
+* Version 15 added EVENT_LINK_STATS.
 */
-#define COM_VERSION 4
+#define COM_VERSION 15
+
+// ===== Status events =====
+// A status is a list of events, each a type byte followed by its value.
+// Only the events whose value changed since the last status go out, see
+// status_events(). Must be the same as the ESP's.
+#define EVENT_VERSION     0x10 // !< COM_VERSION
+#define EVENT_WINDOW      0x11 // !< COM_WINDOW_BYTES, so the ESP knows how far it may send ahead
+#define EVENT_DONE        0x12 // !< Sequence byte of the last packet executed
+#define EVENT_REPEAT      0x13 // !< Repetitions still pending in duckparser, capped at 255
+#define EVENT_LOOP        0x14 // !< Loop iterations left in duckparser, signed, capped at 127
+#define EVENT_SD_STATE    0x15 // !< SD card state
+#define EVENT_DELAY_UNTIL 0x16 // !< ms left of a delay that started, 2 bytes, the low one first. 0 once it is over
+#define EVENT_NACK        0x17 // !< Sequence byte of a packet to send again. Sent once
+#define EVENT_LZ_WINDOW   0x18 // !< LZ_WINDOW / 16, how far back compressed text may refer. 0 for no compression
+#define EVENT_PROGRESS    0x19 // !< Percent of the SD script's lines read, 255 if none runs or it has no index
+#define EVENT_LINK_STATS  0x1A // !< The link counters, see stats_event(). Only when the ESP asks with CMD_LINK_STATS
 
 /**
- * @brief Packed status struct
+ * @brief Bytes the ESP may send ahead of the packet that is executing
  *
- * Using __attribute__((packed)) ensures no padding bytes are inserted between
- * fields.
+ * While a line is typed loop() doesn't run, whatever arrives meanwhile
+ * waits in the UART's receive buffer, the ring the core's USART RX
+ * interrupt fills. It can't hold more than that.
+ */
+#ifdef SERIAL_RX_BUFFER_SIZE
+    #define COM_WINDOW_BYTES SERIAL_RX_BUFFER_SIZE
+#else
+    #define COM_WINDOW_BYTES 64
+#endif
+
+/**
+ * @brief Bytes rx_buf has on top of a packet's payload
  *
- * Fields:
- *   version         — Protocol version (COM_VERSION). Allows you to check compatibility.
- *   wait            — How busy the ATmega is right now.
- *   repeat          — Number of repetitions still pending in duckparser, capped at 255.
- *   sdcard_status   — Current SD card state (only present when USE_SD_CARD is defined).
- *   loop            — Current loop iteration count from duckparser, signed, capped at 127.
+ * Sequence byte and length in front of it, a NUL after it.
+ */
+#define RECORD_OVERHEAD 3
+
+/**
+ * @brief Size of rx_buf
+ *
+ * The packet at the parser plus what the ESP sends ahead of it. Packets are
+ * smaller in rx_buf than on the wire, framing and escapes are gone.
+ */
+#define RX_SIZE (BUFFER_SIZE + RECORD_OVERHEAD + COM_WINDOW_BYTES)
+
+/**
+ * @brief Bytes of a status with every event, the most a status can have
+ *
+ * Every event takes two bytes, EVENT_DELAY_UNTIL three.
  */
 #ifdef USE_SD_CARD
-    typedef struct status_t {
-        unsigned int version : 8;
-        unsigned int wait    : 16;
-        unsigned int repeat  : 8;
-        unsigned int sdcard_status : 8;
-        int          loop    : 8;
-    } __attribute__((packed)) status_t;
+    #define STATUS_SIZE 21
 #else
-    typedef struct status_t {
-        unsigned int version : 8;
-        unsigned int wait    : 16;
-        unsigned int repeat  : 8;
-        int          loop    : 8;
-    } __attribute__((packed)) status_t;
+    #define STATUS_SIZE 17
 #endif
 
+/**
+ * @brief Bytes of EVENT_LINK_STATS
+ *
+ * Only a status over Serial carries it, the one over I2C is read with a
+ * fixed size and already close to what the Wire buffer holds.
+ */
+#define STATS_SIZE 29
+
+/**
+ * @brief What the status events tell the receiving device
+ *
+ * Fields:
+ *   ack           — Sequence byte of the last packet executed, 0 before the first.
+ *   repeat        — Number of repetitions still pending in duckparser, capped at 255.
+ *   loop          — Current loop iteration count from duckparser, signed, capped at 127.
+ *   sdcard_status — Current SD card state (only present when USE_SD_CARD is defined).
+ *   progress      — Percent of the SD script that ran, see script_runner::getProgress()
+ *                   (only present when USE_SD_CARD is defined).
+ *   delay         — ms left of the current delay when it was last looked at, capped at 65535.
+ *   delay_end     — millis() the current delay ends at, 0 if there is none. It only
+ *                   changes when another delay starts, not while one runs down.
+ */
+typedef struct status_t {
+    uint8_t       ack;
+    uint8_t       repeat;
+    int8_t        loop;
+    #ifdef USE_SD_CARD
+    uint8_t       sdcard_status;
+    uint8_t       progress;
+    #endif
+    uint16_t      delay;
+    unsigned long delay_end;
+} status_t;
+
 
 namespace com {
     // =========== PRIVATE ========= //
     
     /**
-     * @brief Raw bytes as they arrive from I2C or Serial
+     * @brief Every packet the ATmega holds, as records one after the other
+     *
+     * Bytes from I2C or Serial go through frame() one at a time, it writes
+     * the payload of the packet arriving right behind the last record,
+     * without framing bytes and escapes. Once the packet is complete and its
+     * CRC matches it becomes a record: sequence byte (REQ_SD_SOT for SD
+     * packets, 0 for control packets), length, payload and a NUL.
      *
-     * This is the first place data lands. It still contains framing bytes
-     * (SOT, EOT) that have not been stripped yet. update() processes this
-     * buffer and moves the clean payload into data_buf.
+     * The packet at the parser is always the first record, getBuffer() points
+     * into it. The ones after it were sent ahead or wait for a missing one.
      */
-    buffer_t receive_buf;
+    char rx_buf[RX_SIZE];
 
     /**
-     * @brief Clean payload ready to be read by duckparser
+     * @brief End of the last record, the packet arriving is written behind it
      *
-     * Framing bytes have been removed. The main loop checks hasData() and
-     * reads this buffer via getBuffer() when a complete packet is available.
+     * frame() may move it on in the I2C interrupt, see rx_end().
      */
-    buffer_t data_buf;
+    volatile unsigned int rx_len = 0;
+
+    /** End of the records settle() looked at */
+    unsigned int rx_checked   = 0;
+
+    /** The payload of the first record while it is at the parser */
+    buffer_t view = { rx_buf + 2, 0 };
+
+    /** Link counters, fill levels and losses of the receive path, see getStats() */
+    rx_stats_t stats = { 0, 0, 0, 0, 0, 0, 0, 0 };
 
     /**
-     * @brief True when data_buf contains a complete packet ready to parse
+     * @brief True when the first record is at the parser
      *
-     * Set to true when either an EOT marker is found or data_buf fills up
-     * entirely (whichever comes first). The main loop uses hasData() to
-     * check this before reading.
+     * The main loop uses hasData() to check this before reading.
      */
     bool start_parser         = false;
 
     /**
-     * @brief True while we are in the middle of receiving a packet
+     * @brief True if the packet at the parser came in with SD framing (SD_SOT/SD_EOT)
      *
-     * Stays true from the moment a SOT is found until the matching EOT
-     * arrives or the buffer fills. Bytes that arrive before any SOT is
-     * seen are discarded.
+     * Exposed via isSdPacket() so the main loop knows how to handle the payload.
      */
-    bool ongoing_transmission = false;
+    bool is_sd_packet         = false;
 
     /**
-     * @brief True if the current packet came in with SD framing (SD_SOT/SD_EOT)
+     * @brief Sequence byte of the packet at the parser, 0 if it has none
      *
-     * Determines which EOT marker to look for while scanning. Also exposed
-     * via isSdPacket() so the main loop knows how to handle the payload.
+     * The ESP puts a sequence byte with the high bit set right after SOT.
+     * Control packets (CMD_BAUD, CMD_STATUS) start with their payload
+     * instead. Becomes status.ack once the packet is done, see sendDone().
      */
-    bool is_sd_packet         = false;
+    uint8_t data_seq          = 0;
 
     /**
-     * @brief The state structure sent back to the connected device via I2C or Serial
+     * @brief Sequence byte of the packet the parser gets next
+     *
+     * Packets are executed in the order the ESP numbered them, no matter
+     * in which order they arrive.
+     */
+    uint8_t next_seq          = 0x80;
+
+    /** next_seq when a gap before a parked packet was reported, 0 if none */
+    uint8_t gap_seq           = 0;
+
+    /** What frame() is in the middle of */
+    enum frame_state_t {
+        FRAME_IDLE, // !< Looking for SOT or SD_SOT
+        FRAME_SEQ,  // !< SOT arrived, a sequence byte may follow
+        FRAME_BODY, // !< Payload and CRC until EOT
+        FRAME_SD    // !< Payload until SD_EOT
+    };
+
+    uint8_t frame_state       = FRAME_IDLE;
+
+    /** Record sequence byte of the packet arriving, see rx_buf */
+    uint8_t frame_seq         = 0;
+
+    /** Payload bytes of the packet arriving written so far */
+    unsigned int frame_len    = 0;
+
+    /** CRC of the packet arriving, up to the last byte written */
+    uint16_t frame_crc        = 0;
+
+    /**
+     * @brief The last three bytes of the packet arriving
+     *
+     * They only turn out to be its CRC once EOT arrives, so they are held
+     * back from rx_buf until the next byte pushes them out.
+     */
+    uint8_t crc_tail[3];
+    uint8_t crc_tail_len      = 0;
+
+    /** True if the last byte of the packet arriving was REQ_ESC */
+    bool escaped              = false;
+
+    /**
+     * @brief Sequence byte of the last packet that arrived damaged or broke off, 0 if none
+     *
+     * frame() may run in the I2C interrupt, settle() takes it over
+     * together with lost_broken under lock().
+     */
+    volatile uint8_t lost_seq    = 0;
+
+    /** True if lost_seq broke off rather than arriving damaged */
+    volatile bool lost_broken    = false;
+
+    /** Bytes skipped outside of packets, see serial_noise() */
+    unsigned int discarded    = 0;
+
+    /**
+     * @brief The state the status events report
      *
      * Rebuilt by update_status() before each transmission.
      */
     status_t status;
 
+    /** status as of the last status sent, events only go out for what differs */
+    status_t reported;
+
+    /**
+     * @brief True if the next status has to carry every event
+     *
+     * Set when the receiving device may have missed a status: at startup,
+     * when it asks with CMD_STATUS, for CMD_BAUD and when it sends a packet
+     * again that was executed already.
+     */
+    bool report_all           = true;
+
+    /** True if the next status has to carry EVENT_LINK_STATS, set by CMD_LINK_STATS and CMD_LINK_RESET */
+    bool report_stats         = false;
+
+    /** Sequence byte of a packet to send again, 0 if none. Goes out with the next status */
+    uint8_t nack_seq          = 0;
+
     /**
      * @brief Reconstructs the state structure from the current state of the duck analyzer and the SD card.
-     * This is called just before the structure is sent back to the receiving device, so the
-     * values ​​are always as up-to-date as possible. The `wait` field is deliberately
-     * the sum of all pending work (pending bytes in both buffers plus any
-     * remaining delay), so the receiving device gets a single number representing the
-     * total backpressure.
+     * This is called just before the status is sent back to the receiving device, so the
+     * values ​​are always as up-to-date as possible. Packets held in rx_buf
+     * aren't part of it, the receiving device knows which ones it sent.
      */
     void update_status() {
-        status.wait = (uint16_t)receive_buf.len
-                      + (uint16_t)data_buf.len
-                      + (uint16_t)duckparser::getDelayTime();
+        unsigned int delay_left = duckparser::getDelayTime();
+
         status.repeat = (uint8_t)(duckparser::getRepeats() > 255 ? 255 : duckparser::getRepeats());
         status.loop   = (int8_t)(duckparser::getLoops() > 127 ? 127 : duckparser::getLoops());
         #ifdef USE_SD_CARD
         status.sdcard_status = sdcard::getStatus();
+        status.progress      = script_runner::getProgress();
+        #endif
+
+        status.delay = delay_left > 0xFFFF ? 0xFFFF : delay_left;
+
+        if (delay_left == 0) {
+            status.delay_end = 0;
+        } else {
+            unsigned long end = millis() + delay_left;
+            long diff         = (long)(end - status.delay_end);
+
+            // getDelayTime() rounds up, the same delay may end a ms later or earlier
+            if (!status.delay_end || (diff > 1) || (diff < -1)) status.delay_end = end ? end : 1;
+        }
+    }
+
+    /**
+     * @brief Writes the events of the next status to out
+     *
+     * Only the events whose value changed since the last status, or every
+     * event if all is set. Afterwards the status counts as reported.
+     *
+     * @param out Room for STATUS_SIZE bytes
+     * @param all True to write every event, EVENT_NACK with 0 if there is none
+     * @return Number of bytes written to out, 0 if nothing changed
+     */
+    size_t status_events(uint8_t* out, bool all) {
+        size_t n = 0;
+
+        if (all) {
+            out[n++] = EVENT_VERSION;
+            out[n++] = COM_VERSION;
+            out[n++] = EVENT_WINDOW;
+            out[n++] = COM_WINDOW_BYTES;
+            out[n++] = EVENT_LZ_WINDOW;
+            out[n++] = LZ_WINDOW / 16;
+        }
+
+        if (all || (status.ack != reported.ack)) {
+            out[n++] = EVENT_DONE;
+            out[n++] = status.ack;
+        }
+
+        if (all || (status.repeat != reported.repeat)) {
+            out[n++] = EVENT_REPEAT;
+            out[n++] = status.repeat;
+        }
+
+        if (all || (status.loop != reported.loop)) {
+            out[n++] = EVENT_LOOP;
+            out[n++] = (uint8_t)status.loop;
+        }
+
+        #ifdef USE_SD_CARD
+        if (all || (status.sdcard_status != reported.sdcard_status)) {
+            out[n++] = EVENT_SD_STATE;
+            out[n++] = status.sdcard_status;
+        }
+
+        if (all || (status.progress != reported.progress)) {
+            out[n++] = EVENT_PROGRESS;
+            out[n++] = status.progress;
+        }
         #endif
+
+        if (all || (status.delay_end != reported.delay_end)) {
+            out[n++] = EVENT_DELAY_UNTIL;
+            out[n++] = (uint8_t)status.delay;
+            out[n++] = (uint8_t)(status.delay >> 8);
+        }
+
+        if (all || nack_seq) {
+            out[n++] = EVENT_NACK;
+            out[n++] = nack_seq;
+        }
+
+        reported = status;
+        nack_seq = 0;
+
+        return n;
     }
 
+    /**
+     * @brief CRC-16 of every nibble value, polynomial x^16 + x^12 + x^5 + 1
+     *
+     * Must be the same as the ESP's.
+     */
+    const uint16_t crc_table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+    };
+
+    uint16_t crc16(uint16_t crc, const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; ++i) {
+            crc = (uint16_t)(crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] >> 4)];
+            crc = (uint16_t)(crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] & 0x0F)];
+        }
+
+        return crc;
+    }
+
+    bool crc_matches(uint16_t crc, const uint8_t* tail) {
+        return (tail[0] == (0x80 | (crc >> 9))) &&
+               (tail[1] == (0x80 | ((crc >> 2) & 0x7F))) &&
+               (tail[2] == (0x80 | (crc & 0x03)));
+    }
+
+    /** Sequence byte that follows seq, the high bit is always set */
+    uint8_t seq_after(uint8_t seq) {
+        return 0x80 | ((seq + 1) & 0x7F);
+    }
+
+    /**
+     * @brief True if the packet with sequence byte seq comes after next_seq
+     *
+     * Sequence bytes wrap after 128 packets, so the half ahead of next_seq
+     * counts as new and the half behind it as done.
+     */
+    bool seq_ahead(uint8_t seq) {
+        uint8_t d = (seq - next_seq) & 0x7F;
+
+        return (d > 0) && (d < 64);
+    }
+
+    /**
+     * @brief Keeps the I2C interrupt out while records in rx_buf move
+     *
+     * Over Serial frame() only runs from update(), nothing to keep out.
+     */
+    void lock() {
+        #ifdef ENABLE_I2C
+        noInterrupts();
+        #endif
+    }
+
+    void unlock() {
+        #ifdef ENABLE_I2C
+        interrupts();
+        #endif
+    }
+
+    // Defined after the transports
+    bool is_framing(uint8_t c);
+    void frame(uint8_t c);
+    void settle();
+    bool rx_full();
+
     // ========== PRIVATE I2C ========== //
 #ifdef ENABLE_I2C
 
@@ -138,30 +438,39 @@ namespace com {
      * @brief Wire onRequest callback — The receiving device reads the state.
      * The receiving device initiates an I2C read transaction. Wire calls this function
      * and expects us to put bytes on the bus immediately. We rebuild the state structure and write it in one go.
+     * The receiving device reads a fixed number of bytes, so it always gets every
+     * event (STATUS_SIZE bytes) followed by their CRC, the high byte first.
      * TIME-SENSITIVE — must not block.
      */
     void i2c_request() {
+        uint8_t events[STATUS_SIZE];
+
         update_status();
-        Wire.write((uint8_t*)&status, sizeof(status_t));
+
+        size_t   len = status_events(events, true);
+        uint16_t crc = crc16(0xFFFF, events, len);
+
+        Wire.write(events, len);
+        Wire.write((uint8_t)(crc >> 8));
+        Wire.write((uint8_t)crc);
+
+        stats.sent += len + 2;
     }
 
     /**
      * @brief Wire onReceive callback — the receiving device is writing command data to us
      *
      * The receiving device initiates an I2C write transaction and sends `len`
-     * bytes. We append them directly to receive_buf. If the incoming data would
-     * overflow the buffer, the entire chunk is silently dropped to avoid
-     * corruption.
+     * bytes. They go through frame() right here, update() picks up the
+     * packets they complete. A packet that doesn't fit into rx_buf is
+     * dropped, it is sent again.
      *
      * TIME SENSITIVE — must not block.
      *
      * @param len Number of bytes the receiving device is sending in this transaction
      */
     void i2c_receive(int len) {
-        if (receive_buf.len + (unsigned int)len <= BUFFER_SIZE) {
-            Wire.readBytes(&receive_buf.data[receive_buf.len], len);
-            receive_buf.len += len;
-        }
+        while (len-- > 0) frame(Wire.read());
     }
 
     /**
@@ -176,9 +485,6 @@ namespace com {
         Wire.begin(I2C_ADDR);
         Wire.onRequest(i2c_request);
         Wire.onReceive(i2c_receive);
-
-        data_buf.len    = 0;
-        receive_buf.len = 0;
     }
 
 #else // ifdef ENABLE_I2C
@@ -195,66 +501,277 @@ namespace com {
 
     // ========== PRIVATE SERIAL ========== //
 #ifdef ENABLE_SERIAL
+    /**
+     * @brief Time in ms the ESP has to prove a new baud rate works
+     *
+     * Must be the same as the ESP's BAUD_PROBATION.
+     */
+    #define BAUD_PROBATION 250
+
+    /** Rates the ESP can ask for, SERIAL_BAUD_MAX caps them */
+    const unsigned long baud_rates[] = { 115200, 250000, 500000 };
+
+    /**
+     * @brief Sent along with a new rate to prove it works
+     *
+     * Alternating bits, long runs of the same bit and every nibble edge,
+     * none of them a framing byte. Must be the same as the ESP's.
+     */
+    const uint8_t baud_pattern[] = { 0x55, 0xAA, 0xFF, 0x00, 0xF0, 0x0F, 0x33, 0xCC };
+
+    /** Rate both sides agreed on */
+    unsigned long baud_rate = SERIAL_BAUD;
+
+    /** Rate waiting for the test pattern, 0 if there is none */
+    unsigned long baud_trial = 0;
+
+    /** millis() the trial started */
+    unsigned long baud_trial_time = 0;
+
+    /**
+     * @brief Stray bytes that make the link look like it runs at another rate
+     *
+     * A packet that lost its SOT to a bit error leaves the rest of it
+     * outside of a packet, so it takes more than that, see serial_noise().
+     */
+    #define BAUD_NOISE 16
+
+    /** Bytes skipped outside of packets since the last intact one */
+    unsigned int noise = 0;
+
+    /** millis() the last intact packet arrived or the last packet was done */
+    unsigned long active_time = 0;
+
     /**
      * @brief Initializes the UART port used for serial communication
      */
     void serial_begin() {
         //debugsln("ENABLED SERIAL");
         SERIAL_COM.begin(SERIAL_BAUD);
+
+        baud_rate  = SERIAL_BAUD;
+        baud_trial = 0;
     }
 
     /**
-     * @brief Sends the current status struct to the receiving device over Serial
+     * @brief Goes back to SERIAL_BAUD, the rate the ESP starts every connection at
+     */
+    void serial_fallback() {
+        if (!baud_trial && (baud_rate == SERIAL_BAUD)) return;
+
+        debugsln("BAUD FALLBACK");
+
+        SERIAL_COM.begin(SERIAL_BAUD);
+
+        baud_rate  = SERIAL_BAUD;
+        baud_trial = 0;
+    }
+
+    bool serial_baud_supported(unsigned long rate) {
+        if (rate > SERIAL_BAUD_MAX) return false;
+
+        for (size_t i = 0; i < sizeof(baud_rates) / sizeof(baud_rates[0]); ++i) {
+            if (baud_rates[i] == rate) return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Writes data to the port, framing bytes escaped with REQ_ESC
+     */
+    void serial_write_escaped(const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; ++i) {
+            if (is_framing(data[i])) {
+                SERIAL_COM.write(REQ_ESC);
+                SERIAL_COM.write(data[i] ^ REQ_ESC_XOR);
+                ++stats.sent;
+            } else {
+                SERIAL_COM.write(data[i]);
+            }
+        }
+
+        stats.sent += len;
+    }
+
+    /**
+     * @brief Writes EVENT_LINK_STATS with the link counters to out
+     *
+     * uart_peak and peak take two bytes, the other counters of rx_stats_t
+     * four, in the order they are declared, each the low byte first.
+     *
+     * @param out Room for STATS_SIZE bytes
+     * @return Number of bytes written to out
+     */
+    size_t stats_event(uint8_t* out) {
+        const unsigned long counters[] = {
+            stats.overruns, stats.received, stats.sent, stats.packets, stats.dropped, stats.nacks
+        };
+        size_t n = 0;
+
+        out[n++] = EVENT_LINK_STATS;
+        out[n++] = (uint8_t)stats.uart_peak;
+        out[n++] = (uint8_t)(stats.uart_peak >> 8);
+        out[n++] = (uint8_t)stats.peak;
+        out[n++] = (uint8_t)(stats.peak >> 8);
+
+        for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); ++i) {
+            for (uint8_t shift = 0; shift < 32; shift += 8) out[n++] = (uint8_t)(counters[i] >> shift);
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Sends the status events that changed to the receiving device over Serial
      *
-     * The status is wrapped in SOT/EOT framing so the receiving device can
-     * reliably detect packet boundaries even if stray bytes are on the line.
-     * flush() is called afterward to ensure all bytes are actually
+     * The events and their CRC (two bytes, the high one first) are wrapped
+     * in SOT/EOT framing and escaped like a packet, so the receiving device
+     * can reliably detect where they end even if stray bytes are on the line.
+     * Nothing is sent if no event changed and EVENT_LINK_STATS wasn't asked
+     * for. flush() is called afterward to ensure all bytes are actually
      * transmitted before we continue.
      */
     void serial_send_status() {
+        // While a new rate is on trial the only status is the one that confirms
+        // it, anything else would look like the confirmation to the ESP
+        if (baud_trial) return;
+
+        uint8_t events[STATUS_SIZE + STATS_SIZE];
+
         update_status();
+
+        size_t len = status_events(events, report_all);
+
+        if (report_stats) len += stats_event(events + len);
+
+        report_all   = false;
+        report_stats = false;
+
+        if (len == 0) return;
+
 #ifdef ENABLE_DEBUG
-        debugs("Replying with status {");
-        debugs("wait: ");
-        debug(status.wait);
-        debugs(",repeat: ");
-        debug(status.repeat);
-        #ifdef USE_SD_CARD
-            debugs(",sdcard: ");
-            debug(status.sdcard_status);
-            debugs(", loop: ");
-            debug(status.loop);
-        #endif
-        debugs("} [");
+        debugs("Replying with status [");
 
-        for (int i = 0; i<sizeof(status_t); ++i) {
-            char b = ((uint8_t*)&status)[i];
-            if (b < 0x10) debug('0');
-            debug(String(b, HEX));
+        for (size_t i = 0; i < len; ++i) {
+            if (events[i] < 0x10) debug('0');
+            debug(String(events[i], HEX));
             debug(' ');
         }
         debugsln("]");
 #endif // ifdef ENABLE_DEBUG
 
+        uint16_t crc     = crc16(0xFFFF, events, len);
+        uint8_t  tail[2] = { (uint8_t)(crc >> 8), (uint8_t)crc };
+
         SERIAL_COM.write(REQ_SOT);
-        SERIAL_COM.write((uint8_t*)&status, sizeof(status_t));
+        serial_write_escaped(events, len);
+        serial_write_escaped(tail, sizeof(tail));
         SERIAL_COM.write(REQ_EOT);
         SERIAL_COM.flush();
+
+        stats.sent += 2;
     }
 
     /**
-     * @brief Polls the serial port and appends any available bytes to receive_buf
+     * @brief Takes the bytes waiting in the UART's receive buffer through frame()
      *
-     * Called every main loop tick. If the incoming bytes would overflow
-     * receive_buf, they are not read and remain in the UART hardware buffer
-     * until the next tick when there is room.
+     * Called every main loop tick. Every packet they complete is dealt with
+     * right away. While rx_buf is full and the packet at the parser has to
+     * finish first, the rest waits in the UART's receive buffer.
      */
     void serial_update() {
         unsigned int len = SERIAL_COM.available();
 
-        if ((len > 0) && (receive_buf.len+len <= BUFFER_SIZE)) {
-            SERIAL_COM.readBytes(&receive_buf.data[receive_buf.len], len);
-            receive_buf.len += len;
+        if (len > stats.uart_peak) stats.uart_peak = len;
+
+        // A CMD_BAUD packet reopens the port, what's left of len is gone
+        while (SERIAL_COM.available() > 0) {
+            if (start_parser && rx_full()) break;
+
+            frame(SERIAL_COM.read());
+            settle();
+        }
+
+        // The ESP never proved the new rate, it went back to SERIAL_BAUD by now
+        if (baud_trial && (millis() - baud_trial_time > BAUD_PROBATION)) serial_fallback();
+    }
+
+    /**
+     * @brief Handles a CMD_BAUD packet from the ESP
+     *
+     * "<CMD_BAUD><rate>" asks for a new rate. The status that answers it still
+     * goes out at the current rate, then the port switches and the rate is on
+     * trial: within BAUD_PROBATION ms the ESP has to send
+     * "<CMD_BAUD><rate><baud_pattern>" at the new rate. Only if that arrives
+     * intact the rate is kept and confirmed with a status, anything else goes
+     * back to SERIAL_BAUD. Rates this side doesn't support get no answer.
+     *
+     * @param data Payload of the packet, starting with CMD_BAUD
+     * @param len  Length of the payload
+     */
+    void serial_baud(const char* data, size_t len) {
+        unsigned long rate = 0;
+        size_t i           = 1;
+
+        while (i < len && data[i] >= '0' && data[i] <= '9') {
+            rate = rate * 10 + (data[i] - '0');
+            ++i;
+        }
+
+        if (i == len) {
+            if (!serial_baud_supported(rate)) return;
+
+            baud_trial = 0;
+            report_all = true;
+            serial_send_status();
+
+            SERIAL_COM.begin(rate);
+
+            baud_trial      = rate;
+            baud_trial_time = millis();
+        } else if ((rate == baud_trial) && (len - i == sizeof(baud_pattern)) &&
+                   (memcmp(&data[i], baud_pattern, sizeof(baud_pattern)) == 0)) {
+            baud_rate  = rate;
+            baud_trial = 0;
+            report_all = true;
+            serial_send_status();
+        } else {
+            serial_fallback();
+        }
+    }
+
+    /**
+     * @brief Marks the link as working: a packet arrived intact or one was done
+     */
+    void serial_active() {
+        noise       = 0;
+        active_time = millis();
+    }
+
+    /**
+     * @brief Reacts on bytes that arrived outside of a packet
+     *
+     * The ESP only ever sends whole packets, so at a negotiated rate stray
+     * bytes mean it is sending at another rate, most likely because it
+     * restarted or gave up on the rate. Go back to where it starts.
+     * Bit errors leave stray bytes too, but only between intact packets:
+     * it takes more than BAUD_NOISE of them once the link was quiet for
+     * BAUD_PROBATION ms, what arrived before doesn't count.
+     *
+     * @param discarded Number of bytes skipped while looking for a SOT
+     */
+    void serial_noise(unsigned int discarded) {
+        if (millis() - active_time <= BAUD_PROBATION) {
+            noise = 0;
+            return;
+        }
+
+        noise += discarded;
+
+        if (noise > BAUD_NOISE) {
+            noise = 0;
+            serial_fallback();
         }
     }
 
@@ -265,154 +782,538 @@ namespace com {
 
     void serial_update() {}
 
+    void serial_baud(const char* data, size_t len) {}
+
+    void serial_active() {}
+
+    void serial_noise(unsigned int discarded) {}
+
 #endif // ifdef ENABLE_SERIAL
 
-    // ========== PUBLIC ========== //
+    // ========== PRIVATE FRAMING ========== //
+
+    /** True if c has to be escaped in a payload */
+    bool is_framing(uint8_t c) {
+        return (c >= REQ_SOT) && (c <= REQ_ESC);
+    }
+
+    bool is_start(uint8_t c) {
+        #ifdef USE_SD_CARD
+        if (c == REQ_SD_SOT) return true;
+        #endif
+        return c == REQ_SOT;
+    }
+
+    /** Bytes the record at off takes up in rx_buf */
+    unsigned int record_size(unsigned int off) {
+        return (uint8_t)rx_buf[off + 1] + RECORD_OVERHEAD;
+    }
 
     /**
-     * @brief Initializes the communication module
+     * @brief True if the packet arriving can't grow any more
+     */
+    bool rx_full() {
+        return rx_len + frame_len + RECORD_OVERHEAD >= RX_SIZE;
+    }
+
+    /**
+     * @brief Starts a new packet at the SOT or SD_SOT c
+     */
+    void frame_start(uint8_t c) {
+        frame_len    = 0;
+        crc_tail_len = 0;
+        escaped      = false;
+        frame_crc    = 0xFFFF;
+
+        if (c == REQ_SD_SOT) {
+            frame_seq   = REQ_SD_SOT;
+            frame_state = FRAME_SD;
+        } else {
+            frame_seq   = 0;
+            frame_state = FRAME_SEQ;
+        }
+    }
+
+    /**
+     * @brief Gives up on the packet arriving
      *
-     * Sets the protocol version and starts whichever transports are enabled
-     * at compile time. Safe to call even if both I2C and Serial are enabled —
-     * both will be initialized.
+     * @param broken True if it broke off, false if it arrived damaged
      */
-    void begin() {
-        status.version = COM_VERSION;
-        i2c_begin();
-        serial_begin();
+    void frame_lost(bool broken) {
+        ++stats.dropped;
+
+        if (frame_seq & 0x80) {
+            lost_seq    = frame_seq;
+            lost_broken = broken;
+        }
+
+        frame_state = FRAME_IDLE;
     }
 
     /**
-     * @brief Main per-tick update — processes incoming bytes into a usable packet
+     * @brief Appends a payload byte to the packet arriving
      *
-     * This is called every iteration of the main loop. It does three things:
+     * A packet longer than BUFFER_SIZE broke off somewhere. One that doesn't
+     * fit into rx_buf is an overrun, it is sent again.
      *
-     * 1. Pulls any new bytes off the serial port (I2C bytes arrive via callback
-     *    and are already in receive_buf by the time we get here).
+     * @return false if the packet was given up on
+     */
+    bool frame_put(uint8_t c) {
+        if (frame_len == BUFFER_SIZE) {
+            frame_lost(true);
+            return false;
+        }
+
+        if (rx_full()) {
+            ++stats.overruns;
+            frame_lost(true);
+            return false;
+        }
+
+        rx_buf[rx_len + 2 + frame_len] = c;
+        ++frame_len;
+
+        if (rx_len + frame_len + RECORD_OVERHEAD > stats.peak) stats.peak = rx_len + frame_len + RECORD_OVERHEAD;
+
+        return true;
+    }
+
+    /**
+     * @brief Turns the packet arriving into a record, settle() looks at it
+     */
+    void frame_end() {
+        rx_buf[rx_len]                 = frame_seq;
+        rx_buf[rx_len + 1]             = frame_len;
+        rx_buf[rx_len + 2 + frame_len] = '\0';
+
+        rx_len     += frame_len + RECORD_OVERHEAD;
+        frame_state = FRAME_IDLE;
+
+        ++stats.packets;
+    }
+
+    /**
+     * @brief Takes the next byte from I2C or Serial
      *
-     * 2. Scans receive_buf for framing markers and extracts the payload into
-     *    data_buf. The scan works in two phases:
-     *      a. Skip forward until a SOT (or SD_SOT) marker is found. Any bytes
-     *         before the first SOT are discarded — they are noise or leftovers.
-     *      b. Copy every subsequent byte into data_buf until the matching EOT
-     *         (or SD_EOT) is found, or data_buf fills up entirely.
-     *    Once either condition is met, start_parser is set to true and the
-     *    main loop can read the packet via hasData() / getBuffer().
+     * Bytes outside of a packet are skipped. A packet's payload goes into
+     * rx_buf as it arrives, escaped bytes are payload no matter their value.
+     * The last three bytes before EOT are its CRC. A SOT before the EOT means
+     * the packet broke off, the SOT starts the next one. SD packets end with
+     * a CRC of two bytes instead, the high one first, like a status.
      *
-     * 3. Handles a subtle edge case: if the receiving device previously received
-     *    a status with wait > 0 and stopped sending, but the delay has since
-     *    finished, we proactively send a fresh status to unblock it. Without
-     *    this the receiving device would sit idle forever, waiting for a status
-     *    update that would never come.
+     * Never blocks, it runs in the I2C interrupt.
      */
-    void update() {
-        serial_update();
+    void frame(uint8_t c) {
+        ++stats.received;
 
-        if (!start_parser && (receive_buf.len > 0) && (data_buf.len < BUFFER_SIZE)) {
-            unsigned int i = 0;
-
-            debugs("RECEIVED ");
-
-            // Scan forward until we find a SOT marker
-            // Everything before the first SOT is discarded.
-            while (i < receive_buf.len && !ongoing_transmission) {
-                #ifdef USE_SD_CARD
-                    if (receive_buf.data[i] == REQ_SD_SOT) {
-                        is_sd_packet         = true;
-                        ongoing_transmission = true;
-                        debugs("[SD_SOT]");
-                    } else
-                #endif
-                if (receive_buf.data[i] == REQ_SOT) {
-                    is_sd_packet         = false;
-                    ongoing_transmission = true;
-                    debugs("[SOT] ");
-                }
-                ++i;
+        if (frame_state == FRAME_IDLE) {
+            if (is_start(c)) frame_start(c);
+
+            // An end marker is left over when a packet broke off, that's no noise
+            else if ((c != REQ_EOT) && (c != REQ_SD_EOT)) ++discarded;
+
+            return;
+        }
+
+        // The sequence byte, if the packet has one
+        if (frame_state == FRAME_SEQ) {
+            frame_state = FRAME_BODY;
+
+            if (c & 0x80) {
+                frame_seq = c;
+                frame_crc = crc16(frame_crc, &c, 1);
+                return;
             }
+        }
 
-            debugs("'");
-            
-            // Copy payload bytes until EOT or buffer full
-            while (i < receive_buf.len && ongoing_transmission) {
-                char c = receive_buf.data[i];
-                #ifdef USE_SD_CARD
-                    if (is_sd_packet && c == REQ_SD_EOT) {
-                        start_parser         = true;
-                        ongoing_transmission = false;
-                    } else
-                #endif
-
-                if (!is_sd_packet && c == REQ_EOT) {
-                    // Found the closing marker — packet is complete
-                    start_parser         = true;
-                    ongoing_transmission = false;
-                } else {
-                    // Regular payload byte — store it
-                    debug(c, BIN);
-                    debug(" ");
+        bool payload = escaped;
 
-                    data_buf.data[data_buf.len] = c;
-                    ++data_buf.len;
-                }
+        if (escaped) {
+            c      ^= REQ_ESC_XOR;
+            escaped = false;
+        } else if (c == REQ_ESC) {
+            escaped = true;
+            return;
+        } else if (is_start(c)) {
+            frame_lost(true);
+            frame_start(c);
+            return;
+        }
 
-                // Buffer full before EOT arrived — parse what we have
-                if (data_buf.len == BUFFER_SIZE) {
-                    start_parser         = true;
-                    ongoing_transmission = false;
-                }
+        if (frame_state == FRAME_SD) {
+            if (!payload && (c == REQ_SD_EOT)) {
+                if ((crc_tail_len == 2) && (frame_crc == (uint16_t)((crc_tail[0] << 8) | crc_tail[1]))) frame_end();
+                else frame_lost(false);
+            } else if (crc_tail_len < 2) {
+                crc_tail[crc_tail_len++] = c;
+            } else if (frame_put(crc_tail[0])) {
+                frame_crc = crc16(frame_crc, crc_tail, 1);
+
+                crc_tail[0] = crc_tail[1];
+                crc_tail[1] = c;
+            }
+        } else if (!payload && (c == REQ_EOT)) {
+            if ((crc_tail_len == sizeof(crc_tail)) && crc_matches(frame_crc, crc_tail)) frame_end();
+            else frame_lost(false);
+        } else if (crc_tail_len < sizeof(crc_tail)) {
+            crc_tail[crc_tail_len++] = c;
+        } else if (frame_put(crc_tail[0])) {
+            frame_crc = crc16(frame_crc, crc_tail, 1);
+
+            crc_tail[0] = crc_tail[1];
+            crc_tail[1] = crc_tail[2];
+            crc_tail[2] = c;
+        }
+    }
+
+    /**
+     * @brief Returns rx_len, read in one piece even if frame() runs in the I2C interrupt
+     */
+    unsigned int rx_end() {
+        lock();
+
+        unsigned int len = rx_len;
+
+        unlock();
+
+        return len;
+    }
+
+    /**
+     * @brief Removes the record at off, the ones after it and the packet arriving move up
+     */
+    void remove(unsigned int off) {
+        lock();
+
+        unsigned int size = record_size(off);
+        unsigned int end  = rx_len + ((frame_state == FRAME_IDLE) ? 0 : 2 + frame_len);
+
+        memmove(&rx_buf[off], &rx_buf[off + size], end - off - size);
+
+        rx_len -= size;
+        if (rx_checked > off) rx_checked -= size;
+
+        unlock();
+    }
+
+    /** Reverses rx_buf[from, to) */
+    void reverse(unsigned int from, unsigned int to) {
+        while (from + 1 < to) {
+            char c = rx_buf[from];
+
+            rx_buf[from]   = rx_buf[--to];
+            rx_buf[to]     = c;
+            ++from;
+        }
+    }
+
+    /**
+     * @brief Hands the record at off to the parser
+     *
+     * It moves to the front of rx_buf, the records before it move behind
+     * it. Nothing points into rx_buf while the parser is idle.
+     */
+    void make_current(unsigned int off) {
+        unsigned int size = record_size(off);
+
+        if (off > 0) {
+            reverse(0, off);
+            reverse(off, off + size);
+            reverse(0, off + size);
+        }
+
+        if (rx_checked < off + size) rx_checked = off + size;
+
+        uint8_t seq = rx_buf[0];
+
+        is_sd_packet = (seq == REQ_SD_SOT);
+        data_seq     = is_sd_packet ? 0 : seq;
+        view.len     = (uint8_t)rx_buf[1];
+        start_parser = true;
+
+        if (data_seq) {
+            next_seq = seq_after(data_seq);
+            gap_seq  = 0;
+        }
+
+        if (is_sd_packet) {
+            debugsln("[SD_EOT]");
+        } else {
+            debugsln("[EOT]");
+        }
+
+        // Nothing for the parser to do
+        if (view.len == 0) sendDone();
+    }
+
+    /**
+     * @brief True if a record with sequence byte seq is waiting in rx_buf
+     */
+    bool is_parked(uint8_t seq) {
+        for (unsigned int off = 0; off < rx_checked; off += record_size(off)) {
+            if ((uint8_t)rx_buf[off] == seq) return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Asks the ESP to send the packet with sequence byte seq again
+     *
+     * Over I2C the request goes out with the next status the ESP reads.
+     */
+    void nack(uint8_t seq) {
+        debugs("NACK ");
+        debugln(seq);
+
+        nack_seq = seq;
+        ++stats.nacks;
+        serial_send_status();
+    }
+
+    /**
+     * @brief Reports that next_seq is missing, once per gap
+     */
+    void nack_gap() {
+        if ((gap_seq == next_seq) || is_parked(next_seq)) return;
+
+        gap_seq = next_seq;
+        nack(next_seq);
+    }
 
-                ++i;
+    /**
+     * @brief Moves the record with sequence byte next_seq, or an SD packet, to the parser
+     *
+     * Records the parser is past already are dropped on the way.
+     */
+    void unpark() {
+        unsigned int off = 0;
+
+        while (off < rx_checked) {
+            uint8_t seq = rx_buf[off];
+
+            if ((seq == REQ_SD_SOT) || (seq == next_seq)) {
+                make_current(off);
+                return;
             }
 
-            debugs("' ");
+            if (!seq_ahead(seq)) remove(off);
+            else off += record_size(off);
+        }
+    }
 
-            if (start_parser && !ongoing_transmission) {
-                if (is_sd_packet) debugs("[SD_EOT]");
-                else debugs("[EOT]");
-            } else if (!start_parser && ongoing_transmission) {
-                debugs("...");
-            } else if (!start_parser && !ongoing_transmission) {
-                debugs("DROPPED");
+    /**
+     * @brief Handles a control packet, they never reach the parser
+     *
+     * CMD_BAUD is answered by serial_baud(), CMD_STATUS with a status that
+     * carries every event and asks for next_seq. The ESP only sends
+     * CMD_STATUS when it didn't hear from the ATmega for a while, so
+     * whatever is parked is coming again and gets dropped.
+     *
+     * CMD_STATUS followed by CMD_LINK_STATS or CMD_LINK_RESET only asks for
+     * EVENT_LINK_STATS with the next status, parked packets stay. Over I2C
+     * it isn't answered, see STATS_SIZE.
+     */
+    void control(unsigned int off) {
+        const char* data = &rx_buf[off + 2];
+        size_t len       = (uint8_t)rx_buf[off + 1];
+
+        if ((len > 0) && (data[0] == CMD_BAUD)) {
+            serial_baud(data, len);
+        } else if ((len == 1) && (data[0] == CMD_STATUS)) {
+            unsigned int keep = start_parser ? record_size(0) : 0;
+
+            while (off > keep) {
+                remove(keep);
+                off = rx_checked;
             }
 
-            debugln();
+            remove(off);
+
+            report_all = true;
+            nack(next_seq);
+
+            return;
+        } else if ((len == 2) && (data[0] == CMD_STATUS) &&
+                   ((data[1] == CMD_LINK_STATS) || (data[1] == CMD_LINK_RESET))) {
+            bool reset = (data[1] == CMD_LINK_RESET);
+
+            remove(off);
 
-            // receive_buf has been fully consumed — reset it
-            receive_buf.len = 0;
+            report_stats = true;
+            serial_send_status();
+
+            // Not if a baud trial held the counters back, they are still to go out
+            if (reset && !report_stats) resetStats();
+
+            return;
         }
-        
-        // If there is nothing to parse and no data sitting in the buffer, but
-        // the last status we sent had wait > 0, the receiving device may have
-        // stopped sending because it thinks we are still busy. If the delay has
-        // now finished, send a fresh status with wait = 0 to wake it up.
-        if (!start_parser && data_buf.len == 0 && status.wait > 0)
+
+        remove(off);
+    }
+
+    /**
+     * @brief Deals with the packets frame() completed or lost since the last call
+     *
+     * A packet that arrived damaged or broke off is asked for again. A
+     * damaged one right away, one that broke off when the packet after it
+     * reports the gap: a packet ahead of next_seq means the one before it is
+     * missing. A damaged packet ahead of next_seq only reports the gap, its
+     * sequence byte failed the CRC with the rest and may be any byte of the
+     * payload, asking for it could make the ESP number its packets anew and
+     * send the ones executed already again. Packets ahead of next_seq are
+     * parked until the missing one was sent again, as are the ones the ESP
+     * sent ahead while the parser is busy. Packets the parser is past
+     * already were sent again because a status got lost, the answer is a
+     * status with every event.
+     */
+    void settle() {
+        // A loss frame() reports between reading and clearing would be gone
+        lock();
+
+        uint8_t seq    = lost_seq;
+        bool    broken = lost_broken;
+
+        lost_seq = 0;
+
+        unlock();
+
+        if (seq) {
+            if (broken) {
+                debugsln(" BROKEN");
+            } else {
+                debugsln(" DAMAGED");
+            }
+
+            if (seq == next_seq) {
+                if (broken) {
+                    gap_seq = 0;
+                } else {
+                    gap_seq = seq;
+                    nack(seq);
+                }
+            } else if (seq_ahead(seq)) {
+                nack_gap();
+            }
+        }
+
+        while (rx_checked < rx_end()) {
+            unsigned int off = rx_checked;
+            uint8_t seq      = rx_buf[off];
+
+            if (seq == 0) {
+                serial_active();
+                control(off);
+            } else if (seq == REQ_SD_SOT) {
+                serial_active();
+
+                if (start_parser) rx_checked += record_size(off);
+                else make_current(off);
+            } else {
+                serial_active();
+
+                if (seq == next_seq) {
+                    if (start_parser) rx_checked += record_size(off);
+                    else make_current(off);
+                } else if (seq_ahead(seq)) {
+                    rx_checked += record_size(off);
+                    nack_gap();
+                } else {
+                    remove(off);
+
+                    report_all = true;
+                    serial_send_status();
+                }
+            }
+        }
+    }
+
+    // ========== PUBLIC ========== //
+
+    /**
+     * @brief Initializes the communication module
+     *
+     * Makes the first status carry every event and starts whichever transports are enabled
+     * at compile time. Safe to call even if both I2C and Serial are enabled —
+     * both will be initialized.
+     */
+    void begin() {
+        status.ack = 0;
+        report_all = true;
+        i2c_begin();
+        serial_begin();
+    }
+
+    /**
+     * @brief Main per-tick update — processes incoming bytes into a usable packet
+     *
+     * This is called every iteration of the main loop. It does four things:
+     *
+     * 1. Takes any new bytes off the serial port through frame(). I2C bytes
+     *    went through it in the interrupt already.
+     *
+     * 2. Hands the packets to the parser in the order the ESP numbered them,
+     *    see settle():
+     *      a. A parked packet that is next goes first, see unpark().
+     *      b. Bytes before the next SOT (or SD_SOT) are skipped — they are
+     *         noise or leftovers of a damaged packet.
+     *      c. The packet the parser needs next and SD packets go to it as
+     *         soon as it's idle, see make_current().
+     *      d. Any other packet is parked or dropped.
+     *    Once a packet is at the parser, start_parser is set to true and
+     *    the main loop can read the packet via hasData() / getBuffer().
+     *    Packets the ESP sent ahead keep arriving meanwhile.
+     *
+     * 3. Answers control packets (CMD_BAUD, CMD_STATUS) itself and asks for
+     *    damaged and missing packets with EVENT_NACK.
+     *
+     * 4. Reports the end of a delay: if the receiving device was told about
+     *    a delay with EVENT_DELAY_UNTIL and nothing is at the parser once it
+     *    is over, EVENT_DELAY_UNTIL 0 goes out. Without this the receiving
+     *    device would sit idle forever, waiting for a status update that
+     *    would never come. If a packet is at the parser its EVENT_DONE tells.
+     */
+    void update() {
+        if (!start_parser) unpark();
+
+        serial_update();
+        settle();
+
+        if (!start_parser) unpark();
+
+        serial_noise(discarded);
+        discarded = 0;
+
+        // If there is nothing to parse but the last status we sent reported a
+        // delay, the receiving device may be waiting for it to end. If it has
+        // now finished, send a fresh status with EVENT_DELAY_UNTIL 0.
+        if (!start_parser && reported.delay_end)
             if (duckparser::getDelayTime() == 0) sendDone(); 
     }
 
     /**
-     * @brief Returns true if data_buf holds a complete packet ready to parse
+     * @brief Returns true if a complete packet is at the parser
      *
      * The main loop calls this every tick. When it returns true, the loop
      * should read the buffer via getBuffer(), feed it to duckparser, and
      * then call sendDone() to acknowledge.
      *
-     * @return true if a complete packet is waiting in data_buf
+     * @return true if a complete packet is waiting
      */
     bool hasData() {
-        return data_buf.len > 0 && start_parser;
+        return view.len > 0 && start_parser;
     }
 
     /**
-     * @brief Returns a reference to the clean payload buffer
+     * @brief Returns the payload of the packet at the parser
      *
-     * The returned buffer contains only command bytes — all SOT/EOT framing
-     * has been stripped. The caller should not modify it.
+     * It points into rx_buf, all SOT/EOT framing has been stripped and a
+     * NUL follows it. It stays where it is until sendDone().
      *
-     * @return const reference to the payload buffer
+     * @return const reference to the payload
      */
     const buffer_t& getBuffer() {
-        return data_buf;
+        return view;
     }
 
     /**
@@ -428,19 +1329,46 @@ namespace com {
     }
 
     /**
-     * @brief Clears the buffers and sends a fresh status back to the receiving device
+     * @brief Drops the packet at the parser and sends a fresh status back to the receiving device
      *
      * Call this after the main loop has finished processing the current packet.
-     * It resets data_buf and start_parser so the module is ready for the next
-     * packet, and sends the updated status so the receiving device knows it can
-     * send more.
+     * It removes the packet from rx_buf and resets start_parser so the module
+     * is ready for the next packet, and sends the updated status so the
+     * receiving device knows it can send more. If the packet had a sequence
+     * byte the status acknowledges it with EVENT_DONE. If nothing changed
+     * no status goes out.
      */
     void sendDone() {
-        data_buf.len = 0;
-        start_parser = false;
+        if (start_parser) {
+            if (data_seq) status.ack = data_seq;
+
+            remove(0);
+
+            data_seq     = 0;
+            view.len     = 0;
+            start_parser = false;
+        }
+
+        serial_active();
         serial_send_status();
     }
 
+    /**
+     * @brief Returns what went over the link, how full the receive path got and what it lost
+     */
+    const rx_stats_t& getStats() {
+        return stats;
+    }
+
+    /**
+     * @brief Starts the peaks and counters over
+     */
+    void resetStats() {
+        lock();
+        memset(&stats, 0, sizeof(stats));
+        unlock();
+    }
+
     #ifdef USE_SD_CARD
     /**
      * @brief Pushes SD card file data back to the receiving device
@@ -449,10 +1377,12 @@ namespace com {
      * device to us, but when the receiving device requests a file from the SD
      * card this function sends the file contents back. The data is wrapped in
      * SD_SOT/SD_EOT framing so the receiving device can distinguish it from
-     * status packets.
+     * status packets, its CRC goes before SD_EOT like a status's. Framing
+     * bytes in the data are escaped with REQ_ESC.
      *
-     * A short delay after flush ensures the receiving device has time to
-     * process the packet before we send anything else.
+     * Returns once the packet is on the wire. Whatever the receiving device
+     * sends meanwhile, acks for read chunks or the next chunk of a write,
+     * waits in rx_buf behind the packet at the parser.
      *
      * @param data Pointer to the file data to send
      * @param len  Number of bytes to send (capped at BUFFER_SIZE)
@@ -464,24 +1394,27 @@ namespace com {
         
         for (size_t i = 0; i < len; i++) debug((char)data[i]); 
         
+        uint16_t crc     = crc16(0xFFFF, data, len);
+        uint8_t  tail[2] = { (uint8_t)(crc >> 8), (uint8_t)crc };
+
         SERIAL_COM.write(REQ_SD_SOT);
-        SERIAL_COM.write(data, len);
+
+        for (size_t i = 0; i < len + sizeof(tail); i++) {
+            uint8_t c = (i < len) ? data[i] : tail[i - len];
+
+            if (is_framing(c)) {
+                SERIAL_COM.write(REQ_ESC);
+                SERIAL_COM.write(c ^ REQ_ESC_XOR);
+                ++stats.sent;
+            } else {
+                SERIAL_COM.write(c);
+            }
+        }
+
         SERIAL_COM.write(REQ_SD_EOT);
         SERIAL_COM.flush();
-        delay(8);
-    }
 
-    /**
-     * @brief Returns a raw writable pointer to data_buf's internal array
-     *
-     * Used by the SD card path when it needs to write directly into the
-     * buffer (e.g., to fill it with file data before processing).
-     *
-     * Used to save memory
-     * @return Pointer to the start of data_buf's byte array
-     */
-    uint8_t* getRawBuffer() {
-        return data_buf.data;
+        stats.sent += len + sizeof(tail) + 2;
     }
     #endif
 }
\ No newline at end of file
@@ -13,13 +13,27 @@
  #include "../../include/config.h" // BUFFER_SIZE
 
 /*! \typedef buffer_t
- *  \brief A structure to buffer data and simplify access for the communication
+ *  \brief The payload of a received packet, where it lies in com's receive buffer
  */
 typedef struct buffer_t {
-    char   data[BUFFER_SIZE]; // !< Array to buffer incoming bytes
-    size_t len;               // !< How many bytes are currently in the buffer
+    char*  data; // !< First byte of the payload
+    size_t len;  // !< How many bytes the payload has
 } buffer_t;
 
+/*! \typedef rx_stats_t
+ *  \brief What went over the link, how full the receive path got and what it lost
+ */
+typedef struct rx_stats_t {
+    unsigned int  uart_peak; // !< Most bytes seen waiting in the UART's receive buffer
+    unsigned int  peak;      // !< Most bytes the receive buffer held
+    unsigned long overruns;  // !< Packets dropped because the receive buffer was full
+    unsigned long received;  // !< Bytes that came in over I2C or Serial
+    unsigned long sent;      // !< Bytes that went out, statuses and SD card data
+    unsigned long packets;   // !< Packets that arrived intact
+    unsigned long dropped;   // !< Packets that arrived damaged or broke off, overruns included
+    unsigned long nacks;     // !< Packets asked for again
+} rx_stats_t;
+
 /*! \namespace com
  *  \brief Communication module
  */
@@ -41,9 +55,6 @@ namespace com {
     /*! Sends file data from the SD card back to the controller.*/
     void sendSdData(const uint8_t* data, size_t len);
 
-    /*! Accesses the internal raw data array to save memory. */
-    uint8_t* getRawBuffer();
-
     #endif
 
     /*! Returns reference to buffer */
@@ -51,4 +62,10 @@ namespace com {
 
     /*! Sends acknowledgement that data was parsed and executed */
     void sendDone();
+
+    /*! Returns the link counters, fill levels and losses of the receive path */
+    const rx_stats_t& getStats();
+
+    /*! Starts the counters, fill levels and losses over */
+    void resetStats();
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+/*!
+    \file atmega_duck/src/duckparser/bytecode.h
+    \brief Ops of the lines the ESP8266 compiles, see duckparser::exec()
+    \copyright MIT License
+
+    A bytecode packet is CMD_BYTECODE and the ops of one line. Each op is
+    a byte, some are followed by an operand. Text and key ops take the rest
+    of the packet, so they come last.
+
+    The keys of OP_KEYS are what keyboard::write() would look up for each
+    character: its HID usage code, or the dead key, the key and
+    KEYS_DEAD_END for a character of the combinations table. Modifiers
+    change with KEYS_MODIFIERS and start at none in every packet, text
+    mostly switches between shifted keys and others, so those get
+    KEYS_SHIFT instead and take one byte each.
+ */
+
+#pragma once
+
+// Must be the same as the ESP8266's, see esp_duck/compiler.h
+#define OP_RELEASE       0x01 // !< Release all keys
+#define OP_CHAR          0x02 // !< Length and bytes of one UTF-8 character to press
+#define OP_DELAY         0x03 // !< Milliseconds to sleep, 16 bit little endian
+#define OP_DEFAULT_DELAY 0x04 // !< Milliseconds of the default delay, 16 bit little endian
+#define OP_REPEAT        0x05 // !< Times to repeat the previous line, 16 bit little endian
+#define OP_LOOP_BEGIN    0x06 // !< Loop iterations, 16 bit little endian and signed
+#define OP_LOOP_END      0x07
+#define OP_NO_DELAY      0x08 // !< No default delay after this line
+#define OP_PART          0x09 // !< The line continues in the next packet
+#define OP_MODE          0x0A // !< MODE_ bits of the parser from this line on
+#define OP_TEXT          0x0B // !< Type the rest of the packet
+#define OP_TEXT_LN       0x0C // !< Type the rest of the packet, then ENTER
+#define OP_TEXT_PART     0x0D // !< Type the rest of the packet, the line continues in the next one
+#define OP_KEYS          0x0E // !< Keys of text looked up in the layout already, the rest of the packet
+#define OP_KEYS_LN       0x0F // !< Keys of text like OP_KEYS, then ENTER
+#define OP_KEYS_PART     0x10 // !< Keys of text like OP_KEYS, the line continues in the next one
+#define OP_LZ            0x11 // !< One of the text or key ops, then its bytes compressed
+#define OP_MODIFIER      0x18 // !< 0x18 to 0x1F, press modifier bit (op - OP_MODIFIER)
+#define OP_ASCII         0x20 // !< 0x20 to 0x7F, press that character
+#define OP_KEY           0x80 // !< 0x80 to 0xFF, press HID usage code (op - OP_KEY)
+
+// OP_MODE bits, the lines of a STRING, LSTRING or REM that spans packets
+#define MODE_STRING   0x01 // !< inString
+#define MODE_STRINGLN 0x02 // !< isStringln
+#define MODE_LSTRING  0x04 // !< inLString
+#define MODE_COMMENT  0x08 // !< inComment
+
+// OP_KEYS bytes, HID usage codes of keys pressed with the modifiers last set
+#define KEYS_SHIFT     0x80 // !< Set in a usage code, pressed with left shift on top of the modifiers
+#define KEYS_MODIFIERS 0xFF // !< The next byte holds the modifiers of the keys after it
+#define KEYS_DEAD_END  0x00 // !< Ends a character typed with a dead key and the key after it
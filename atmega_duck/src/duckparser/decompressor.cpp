@@ -0,0 +1,152 @@
+/*!
+    \file atmega_duck/src/duckparser/decompressor.cpp
+    \brief Text of OP_LZ packets, see esp_duck/compressor.cpp
+    \copyright MIT License
+
+    The ESP8266 compresses the text and keys of a line against a static
+    dictionary and the text and keys of the lines before it, the last
+    LZ_WINDOW bytes of them. Every byte of code is one of:
+
+      0x00 to 0x7F  The next (code + 1) bytes as they are
+      0x80 to 0xBF  (code & 0x3F) + 3 bytes from earlier text, the next byte
+                    is how far back minus 1, or if its high bit is set, the
+                    high byte of that with the low byte after it
+      0xC0 to 0xFF  (code & 0x3F) + 3 bytes of the dictionary, the next byte
+                    is where in it they start
+
+    Both boards keep the text of every compiled line in the order the
+    ATmega executes them, from CMD_PARSER_RESET on. The text of a line is
+    decoded right behind the one before it, so it ends up in one piece for
+    keyboard::write(), and the window only slides before the next line.
+ */
+
+#include "decompressor.h"
+
+#include <Arduino.h>
+#include <string.h> // memcpy, memmove
+
+#include "../../include/config.h"
+
+namespace decompressor {
+    // ===== PRIVATE ===== //
+
+    /*! Must be the same as the ESP8266's, see esp_duck/compressor.cpp */
+    const char dictionary[] PROGMEM =
+        "powershell -NoProfile -ExecutionPolicy Bypass -Command "
+        "Invoke-WebRequest -Uri https://Start-Process cmd /c echo "
+        "%USERPROFILE%\\Desktop\\C:\\Windows\\System32\\ | Out-File "
+        "$env:TEMP\\ sudo apt-get install curl -fsSL http:// "
+        "> /dev/null 2>&1; chmod +x /tmp/.ps1 ";
+
+    #define DICTIONARY_SIZE (sizeof(dictionary) - 1)
+
+#if LZ_WINDOW > 0
+    /** The last LZ_WINDOW bytes of text and the line decoded behind them */
+    uint8_t history[LZ_WINDOW + BUFFER_SIZE];
+
+    /** Bytes in history */
+    size_t kept = 0;
+
+    /**
+     * @brief Makes room for the next line, only the last LZ_WINDOW bytes stay
+     */
+    void slide() {
+        if (kept > LZ_WINDOW) {
+            memmove(history, history + kept - LZ_WINDOW, LZ_WINDOW);
+            kept = LZ_WINDOW;
+        }
+    }
+#endif // LZ_WINDOW > 0
+
+    // ===== PUBLIC ===== //
+
+    void reset() {
+#if LZ_WINDOW > 0
+        kept = 0;
+#endif // LZ_WINDOW > 0
+    }
+
+    void append(const uint8_t* str, size_t len) {
+#if LZ_WINDOW > 0
+        slide();
+
+        if (len > BUFFER_SIZE) len = BUFFER_SIZE;
+
+        memcpy(history + kept, str, len);
+        kept += len;
+#endif // LZ_WINDOW > 0
+    }
+
+    /**
+     * @brief Decodes the text or keys of an OP_LZ packet
+     *
+     * A damaged or cut off code ends the text where it breaks.
+     *
+     * @param code Compressed text, the rest of the packet
+     * @param len  Bytes of code
+     * @param n    Receives the bytes of the text
+     * @return The text, valid until the next call
+     */
+    const uint8_t* decode(const uint8_t* code, size_t len, size_t* n) {
+#if LZ_WINDOW > 0
+        slide();
+
+        uint8_t* out  = history + kept;
+        uint8_t* p    = out;
+        uint8_t* last = history + sizeof(history);
+
+        size_t i = 0;
+
+        while (i < len) {
+            uint8_t c = code[i++];
+
+            if (c < 0x80) {
+                size_t run = c + 1;
+
+                if ((i + run > len) || (p + run > last)) break;
+
+                memcpy(p, code + i, run);
+                p += run;
+                i += run;
+                continue;
+            }
+
+            size_t length = (c & 0x3F) + 3;
+
+            if ((i >= len) || (p + length > last)) break;
+
+            size_t from = code[i++];
+
+            if (c & 0x40) {
+                if (from + length > DICTIONARY_SIZE) break;
+
+                for (size_t j = 0; j < length; ++j) *p++ = pgm_read_byte(dictionary + from + j);
+                continue;
+            }
+
+            if (from & 0x80) {
+                if (i >= len) break;
+
+                from = ((from & 0x7F) << 8) | code[i++];
+            }
+
+            ++from;
+
+            if (from > (size_t)(p - history)) break;
+
+            // Byte by byte, a match may run on into the bytes it writes
+            const uint8_t* src = p - from;
+
+            for (size_t j = 0; j < length; ++j) *p++ = *src++;
+        }
+
+        *n    = p - out;
+        kept += *n;
+
+        return out;
+#else // LZ_WINDOW > 0
+        *n = 0;
+        return code;
+#endif // LZ_WINDOW > 0
+    }
+}
@@ -0,0 +1,21 @@
+/*!
+    \file atmega_duck/src/duckparser/decompressor.h
+    \brief Text of OP_LZ packets, see esp_duck/compressor.cpp
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+namespace decompressor {
+    /*! Forgets the text of the previous script, with duckparser::reset() */
+    void reset();
+
+    /*! Keeps the text or keys of a packet that came uncompressed, later ones may refer to it */
+    void append(const uint8_t* str, size_t len);
+
+    /*! Decodes the text or keys of an OP_LZ packet, see decode() in decompressor.cpp */
+    const uint8_t* decode(const uint8_t* code, size_t len, size_t* n);
+}
@@ -8,6 +8,9 @@
  */
 
 #include "duckparser.h"
+#include "keywords.h"
+#include "bytecode.h"
+#include "decompressor.h"
 
 #include "../../include/config.h"
 // #include "../include/debug.h"
@@ -62,9 +65,13 @@ namespace duckparser {
      */
     int loopNum = 0;
 
-    unsigned long interpretTime  = 0; // millis() captured at the start of each parse() call
-    unsigned long sleepStartTime = 0; // millis() at the moment the current sleep actually began
-    unsigned long sleepTime      = 0; // How long (ms) the current sleep is supposed to last
+    unsigned long interpretTime = 0;     // micros() captured at the start of each line
+    unsigned long wakeTime      = 0;     // micros() at which the current sleep ends
+    bool          sleeping      = false; // True from sleep() until getDelayTime() sees the sleep is over
+
+    // Lines of the last buffer that come after a sleep, see resume()
+    const char* pendingStr = NULL;
+    size_t      pendingLen = 0;
 
     /**
      * @brief Types raw text directly via the keyboard
@@ -86,6 +93,7 @@ namespace duckparser {
      *   1. Single character  → pressed as a raw character
      *   2. Named key         → pressed via its HID scancode (ENTER, TAB, F1, etc.)
      *   3. Modifier key      → pressed as a modifier (CTRL, SHIFT, ALT, GUI)
+     *      Both are found with a single lookup in the table in keywords.cpp.
      *   4. Anything else     → passed to keyboard::press() which treats it as a
      *                           UTF-8 character
      *
@@ -94,68 +102,28 @@ namespace duckparser {
      */
     void press(const char* str, size_t len) {
         // character
-        if (len == 1) keyboard::press(str);
-
-        // Keys
-        else if (compare(str, len, "ENTER", CASE_SENSETIVE)) keyboard::pressKey(KEY_ENTER);
-        else if (compare(str, len, "MENU", CASE_SENSETIVE)) keyboard::pressKey(KEY_PROPS);
-        else if (compare(str, len, "DELETE", CASE_SENSETIVE)) keyboard::pressKey(KEY_DELETE);
-        else if (compare(str, len, "BACKSPACE", CASE_SENSETIVE)) keyboard::pressKey(KEY_BACKSPACE);
-        else if (compare(str, len, "HOME", CASE_SENSETIVE)) keyboard::pressKey(KEY_HOME);
-        else if (compare(str, len, "INSERT", CASE_SENSETIVE)) keyboard::pressKey(KEY_INSERT);
-        else if (compare(str, len, "PAGEUP", CASE_SENSETIVE)) keyboard::pressKey(KEY_PAGEUP);
-        else if (compare(str, len, "PAGEDOWN", CASE_SENSETIVE)) keyboard::pressKey(KEY_PAGEDOWN);
-        else if (compare(str, len, "UP", CASE_SENSETIVE)) keyboard::pressKey(KEY_UP);
-        else if (compare(str, len, "DOWN", CASE_SENSETIVE)) keyboard::pressKey(KEY_DOWN);
-        else if (compare(str, len, "LEFT", CASE_SENSETIVE)) keyboard::pressKey(KEY_LEFT);
-        else if (compare(str, len, "RIGHT", CASE_SENSETIVE)) keyboard::pressKey(KEY_RIGHT);
-        else if (compare(str, len, "TAB", CASE_SENSETIVE)) keyboard::pressKey(KEY_TAB);
-        else if (compare(str, len, "END", CASE_SENSETIVE)) keyboard::pressKey(KEY_END);
-        else if (compare(str, len, "ESC", CASE_SENSETIVE)) keyboard::pressKey(KEY_ESC);
-        else if (compare(str, len, "F1", CASE_SENSETIVE)) keyboard::pressKey(KEY_F1);
-        else if (compare(str, len, "F2", CASE_SENSETIVE)) keyboard::pressKey(KEY_F2);
-        else if (compare(str, len, "F3", CASE_SENSETIVE)) keyboard::pressKey(KEY_F3);
-        else if (compare(str, len, "F4", CASE_SENSETIVE)) keyboard::pressKey(KEY_F4);
-        else if (compare(str, len, "F5", CASE_SENSETIVE)) keyboard::pressKey(KEY_F5);
-        else if (compare(str, len, "F6", CASE_SENSETIVE)) keyboard::pressKey(KEY_F6);
-        else if (compare(str, len, "F7", CASE_SENSETIVE)) keyboard::pressKey(KEY_F7);
-        else if (compare(str, len, "F8", CASE_SENSETIVE)) keyboard::pressKey(KEY_F8);
-        else if (compare(str, len, "F9", CASE_SENSETIVE)) keyboard::pressKey(KEY_F9);
-        else if (compare(str, len, "F10", CASE_SENSETIVE)) keyboard::pressKey(KEY_F10);
-        else if (compare(str, len, "F11", CASE_SENSETIVE)) keyboard::pressKey(KEY_F11);
-        else if (compare(str, len, "F12", CASE_SENSETIVE)) keyboard::pressKey(KEY_F12);
-        else if (compare(str, len, "SPACE", CASE_SENSETIVE)) keyboard::pressKey(KEY_SPACE);
-        else if (compare(str, len, "PAUSE", CASE_SENSETIVE) || compare(str, len, "BREAK", CASE_SENSETIVE)) keyboard::pressKey(KEY_PAUSE);
-        else if (compare(str, len, "CAPSLOCK", CASE_SENSETIVE)) keyboard::pressKey(KEY_CAPSLOCK);
-        else if (compare(str, len, "NUMLOCK", CASE_SENSETIVE)) keyboard::pressKey(KEY_NUMLOCK);
-        else if (compare(str, len, "PRINTSCREEN", CASE_SENSETIVE)) keyboard::pressKey(KEY_SYSRQ);
-        else if (compare(str, len, "SCROLLLOCK", CASE_SENSETIVE)) keyboard::pressKey(KEY_SCROLLLOCK);
-
-        // NUMPAD KEYS
-        else if (compare(str, len, "NUM_0", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP0);
-        else if (compare(str, len, "NUM_1", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP1);
-        else if (compare(str, len, "NUM_2", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP2);
-        else if (compare(str, len, "NUM_3", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP3);
-        else if (compare(str, len, "NUM_4", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP4);
-        else if (compare(str, len, "NUM_5", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP5);
-        else if (compare(str, len, "NUM_6", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP6);
-        else if (compare(str, len, "NUM_7", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP7);
-        else if (compare(str, len, "NUM_8", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP8);
-        else if (compare(str, len, "NUM_9", CASE_SENSETIVE)) keyboard::pressKey(KEY_KP9);
-        else if (compare(str, len, "NUM_ASTERIX", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPASTERISK);
-        else if (compare(str, len, "NUM_ENTER", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPENTER);
-        else if (compare(str, len, "NUM_MINUS", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPMINUS);
-        else if (compare(str, len, "NUM_DOT", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPDOT);
-        else if (compare(str, len, "NUM_PLUS", CASE_SENSETIVE)) keyboard::pressKey(KEY_KPPLUS);
-
-        // Modifiers
-        else if (compare(str, len, "CTRL", CASE_SENSETIVE) || compare(str, len, "CONTROL", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LCTRL);
-        else if (compare(str, len, "SHIFT", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LSHIFT);
-        else if (compare(str, len, "ALT", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LALT);
-        else if (compare(str, len, "WINDOWS", CASE_SENSETIVE) || compare(str, len, "GUI", CASE_SENSETIVE)) keyboard::pressModifier(KEY_MOD_LMETA);
-
-        // Utf8 character
-        else keyboard::press(str);
+        if (len == 1) {
+            keyboard::press(str);
+            return;
+        }
+
+        uint8_t code;
+
+        switch (keywords::find(str, len, &code)) {
+            // Keys
+            case KEYWORD_KEY:
+                keyboard::pressKey(code);
+                break;
+
+            // Modifiers
+            case KEYWORD_MODIFIER:
+                keyboard::pressModifier(code);
+                break;
+
+            // Utf8 character
+            default:
+                keyboard::press(str);
+        }
     }
 
     /**
@@ -223,315 +191,670 @@ namespace duckparser {
     }
 
     /**
-     * @brief Sleeps for a specified duration, adjusted for interpretation time
+     * @brief Starts a sleep, adjusted for interpretation time
      *
      * A DELAY command says "wait X ms from the moment this line was supposed to
      * execute." By the time we get here some of that time has already passed
      * while parsing the line. This function subtracts that overhead so the
      * actual wall-clock delay matches what the script author intended.
      *
+     * Nothing blocks here, only the deadline is recorded. parse() stops at the
+     * next line and the caller goes back to loop() until getDelayTime() is 0.
+     *
      * @param time Desired delay in milliseconds
      */
     void sleep(unsigned long time) {
-        unsigned long offset = millis() - interpretTime;
+        unsigned long offset = micros() - interpretTime;
+
+        time *= 1000UL;
 
         if (time > offset) {
-            sleepStartTime = millis();
-            sleepTime      = time - offset;
+            wakeTime = interpretTime + time;
+            sleeping = true;
+        }
+    }
 
-            delay(sleepTime);
+    /**
+     * @brief Starts a loop of n iterations, a negative n loops forever
+     *
+     * A LOOP_BEGIN inside a loop is ignored, loops don't nest.
+     */
+    void loop_begin(int n) {
+        if (!inLoop) {
+            loopNum = n;
+            inLoop  = true;
+            if (loopNum < 0) loopNum = -1;
         }
     }
 
-    // ====== PUBLIC ===== //
+    /**
+     * @brief Counts down the iterations of the loop at LOOP_END
+     */
+    void loop_end() {
+        if (inLoop) {
+            if ((loopNum - 1) == 0) {
+                loopNum--;
+                inLoop = false;
+            }
+            else if (loopNum <= 0) loopNum = -1;
+            else loopNum--;
+        }
+    }
 
     /**
-     * @brief Parses and executes one chunk of DuckyScript
-     *
-     * This is the core of the entire system. The caller hands us a buffer that
-     * may contain one line, multiple lines, or a fragment of a line. We run
-     * parse_lines() to split it into a linked list, then walk through every
-     * line and dispatch the appropriate action.
+     * @brief What follows every line: the default delay and the REPEAT countdown
      *
-     * ── Per-line variables ──────────────────────────────────────────────────
-     *   cmd          — The first word on the line (the command keyword itself)
-     *   line_str     — Everything after the command keyword (the arguments)
-     *   line_str_len — Length of the argument portion
-     *   line_end     — True if the line ends with \r or \n. This is the key
-     *                  signal: if false, the line was cut short by the buffer
-     *                  boundary and the next parse() call will continue it.
-     *
-     * ── Post-command actions (run after every line) ────────────────────────
-     *   1. Default delay is applied unless the command set ignore_delay or we
-     *      are inside a string or comment block.
-     *   2. repeatNum is decremented if the line is complete and we are not
-     *      inside an LSTRING block.
+     * @param end          The line ended, it wasn't cut off by the buffer
+     * @param ignore_delay The command skips the default delay
+     */
+    void finish(bool end, bool ignore_delay) {
+        if (!inLString && !isStringln && !inString && !inComment && !ignore_delay) sleep(defaultDelay);
+
+        if (end && !inLString && (repeatNum > 0)) --repeatNum;
+
+        interpretTime = micros();
+    }
+
+    /**
+     * @brief One line of the script, as the command handlers see it
+     */
+    typedef struct line_t {
+        line_node*  node;
+        word_node*  cmd;          // The first word on the line (the command keyword itself)
+        const char* str;          // Everything after the command keyword (the arguments)
+        size_t      len;          // Length of the argument portion
+        bool        end;          // True if the line ends with \r or \n, see parse()
+        bool        ignore_delay; // Set by commands that skip the default delay
+    } line_t;
+
+    typedef void (* handler_t)(line_t* l);
+
+    // LSTRING_??? (-> type each character including linebreaks until LSTRING_END)
+    void cmd_lstring(line_t* l) {
+        word_node* cmd = l->cmd;
+
+        if (!inLString && cmd->len >= 13 && compare(&cmd->str[8], 5, "BEGIN", CASE_SENSETIVE)) {
+            l->ignore_delay = true;
+            inLString       = true;
+        }else if (inLString && compare(cmd->str, cmd->len, "LSTRING_END", CASE_SENSETIVE)) {
+            l->ignore_delay = true;
+            inLString       = false;
+        }else if(inLString) {
+            type(l->node->str, l->node->len);
+            if (l->end) {
+                keyboard::pressKey(KEY_ENTER);
+                release();
+            }
+        }
+    }
+
+    // STRING (-> type each character)
+    void cmd_string(line_t* l) {
+        line_node* n   = l->node;
+        word_node* cmd = l->cmd;
+
+        if (inString) {
+            type(n->str, n->len);
+        } else {
+            isStringln = cmd->str[cmd->len-1] == 'N' && cmd->str[cmd->len-2] == 'L';
+
+            #ifdef USE_SD_CARD
+                const char* text_ptr = n->str + (isStringln ? 9 : 7);
+                int text_len = (int)n->len - (isStringln ? 9 : 7);
+                if (text_len > 0) type(text_ptr, text_len);
+            #else
+                type(l->str, l->len);
+            #endif 
+
+        }
+
+        inString = !l->end;
+
+        if (l->end && isStringln) {
+            isStringln = false;
+            keyboard::pressKey(KEY_ENTER);
+            release();
+        }
+    }
+
+    // REM (= Comment -> do nothing)
+    void cmd_rem(line_t* l) {
+        inComment       = !l->end;
+        l->ignore_delay = true;
+    }
+
+    // LOCALE (-> change keyboard layout)
+    void cmd_locale(line_t* l) {
+        word_node* w = l->cmd->next;
+
+        keyboard::setLocale(locale::get(w->str, w->len));
+
+        l->ignore_delay = true;
+    }
+
+    // DELAY (-> sleep for x ms)
+    void cmd_delay(line_t* l) {
+        sleep(toInt(l->str, l->len));
+        l->ignore_delay = true;
+    }
+
+    // DEFAULTDELAY/DEFAULT_DELAY (set default delay per command)
+    void cmd_default_delay(line_t* l) {
+        defaultDelay    = toInt(l->str, l->len);
+        l->ignore_delay = true;
+    }
+
+    // REPEAT (-> repeat last command n times)
+    void cmd_repeat(line_t* l) {
+        repeatNum       = toInt(l->str, l->len) + 1;
+        l->ignore_delay = true;
+    }
+
+    // LOOP_BEGIN (-> Start of loop; if you enter a negative value,
+    // the loop will be infinite; if it is 0, it will not execute.)
+    void cmd_loop_begin(line_t* l) {
+        loop_begin(toSignedInt(l->str, l->len));
+        l->ignore_delay = true;
+    }
+
+    // LOOP_END (-> End of loop)
+    void cmd_loop_end(line_t* l) {
+        loop_end();
+        l->ignore_delay = true;
+    }
+
+    // LED
+    void cmd_led(line_t* l) {
+        word_node* w = l->cmd->next;
+
+        #ifdef LED_CJMCU3212
+            if (compare(w->str, w->len, "RIGHT", CASE_INSENSETIVE)) {
+                w = w->next;
+                led::right(toInt(w->str, w->len) == 0 ? false : true);
+            }
+            else if (compare(w->str, w->len, "LEFT", CASE_INSENSETIVE)) {
+                w = w->next;
+                led::left(toInt(w->str, w->len) == 0 ? false : true);
+            }
+        #else
+            int c[3];
+
+            for (uint8_t i = 0; i<3; ++i) {
+                if (w) {
+                    c[i] = toInt(w->str, w->len);
+                    w    = w->next;
+                } else {
+                    c[i] = 0;
+                }
+            }
+
+            led::setColor(c[0], c[1], c[2]);
+        #endif
+    }
+
+    // MOUSE MOVE
+    void cmd_m_move(line_t* l) {
+        word_node *w = l->cmd->next;
+
+        int x, y;
+
+        x = toSignedInt(w->str, w->len);
+        w = w->next;
+        y = toSignedInt(w->str, w->len);
+
+        Mouse.move(x, y);
+    }
+
+    // MOUSE CLICK
+    void cmd_m_click(line_t* l) {
+        word_node *w = l->cmd->next;
+
+        int b = toInt(w->str, w->len);
+
+        Mouse.click(b);
+    }
+
+    // MOUSE PRESS
+    void cmd_m_press(line_t* l) {
+        word_node *w = l->cmd->next;
+
+        int b = toInt(w->str, w->len);
+
+        Mouse.press(b);
+    }
+
+    // MOUSE RELEASE
+    void cmd_m_release(line_t* l) {
+        word_node *w = l->cmd->next;
+
+        int b = toInt(w->str, w->len);
+
+        Mouse.release(b);
+    }
+
+    // MOUSE SCROLL
+    void cmd_m_scroll(line_t* l) {
+        word_node *w = l->cmd->next;
+
+        int y = toSignedInt(w->str, w->len);
+
+        Mouse.move(0, 0, y);
+    }
+
+    // KEYCODE
+    void cmd_keycode(line_t* l) {
+        word_node* w = l->cmd->next;
+        if (w) {
+            keyboard::report k;
+
+            k.modifiers = (uint8_t)toInt(w->str, w->len);
+            k.reserved  = 0;
+            w           = w->next;
+
+            for (uint8_t i = 0; i<6; ++i) {
+                if (w) {
+                    k.keys[i] = (uint8_t)toInt(w->str, w->len);
+                    w         = w->next;
+                } else {
+                    k.keys[i] = 0;
+                }
+            }
+
+            keyboard::send(&k);
+            keyboard::release();
+        }
+    }
+
+    // TYPING_RATE (-> minimum time in microseconds between two keyboard reports)
+    void cmd_typing_rate(line_t* l) {
+        keyboard::setInterval(toInt(l->str, l->len));
+        l->ignore_delay = true;
+    }
+
+    // Otherwise go through words and look for keys to press
+    void cmd_keys(line_t* l) {
+        word_node* w = l->cmd;
+
+        while (w) {
+            press(w->str, w->len);
+            w = w->next;
+        }
+
+        if (l->end) release();
+    }
+
+    /** Handlers by COMMAND_ code, see keywords.h */
+    const handler_t handlers[] PROGMEM = {
+        cmd_keys,
+        cmd_lstring,
+        cmd_string,
+        cmd_rem,
+        cmd_locale,
+        cmd_delay,
+        cmd_default_delay,
+        cmd_repeat,
+        cmd_loop_begin,
+        cmd_loop_end,
+        cmd_led,
+        cmd_m_move,
+        cmd_m_click,
+        cmd_m_press,
+        cmd_m_release,
+        cmd_m_scroll,
+        cmd_keycode,
+        cmd_typing_rate,
+    };
+
+    static_assert(sizeof(handlers) / sizeof(handlers[0]) == COMMAND_TYPING_RATE + 1, "one handler per command");
+
+    /**
+     * @brief Finds the command of a line with a single table lookup
      *
-     * ── Memory note ─────────────────────────────────────────────────────────
-     *   When USE_SD_CARD is defined the line list points into the caller's
-     *   buffer — no allocation, no cleanup needed. When it is not defined,
-     *   parse_lines() allocates the list on the heap and we must free it.
+     * A line that continues an LSTRING, STRING or REM from the previous
+     * buffer stays in that mode. Words that start with LSTRING_ but are
+     * neither LSTRING_BEGIN nor LSTRING_END are LSTRING lines too, like
+     * they have always been.
      *
-     * @param str Buffer containing the script data to parse
-     * @param len Number of valid bytes in the buffer
+     * @param cmd First word of the line
+     * @return One of the COMMAND_ codes
      */
-    void parse(const char* str, size_t len) {
-        interpretTime = millis();
+    uint8_t classify(const word_node* cmd) {
+        if (inLString) return COMMAND_LSTRING;
+        if (inString) return COMMAND_STRING;
+        if (inComment) return COMMAND_REM;
+
+        uint8_t code;
+
+        switch (keywords::find(cmd->str, cmd->len, &code)) {
+            case KEYWORD_COMMAND:
+                return code;
 
+            case KEYWORD_KEY:
+            case KEYWORD_MODIFIER:
+                return COMMAND_KEYS;
+        }
+
+        if (compare(cmd->str, 8, "LSTRING_", CASE_SENSETIVE)) return COMMAND_LSTRING;
+
+        return COMMAND_KEYS;
+    }
+
+    /**
+     * @brief Runs the lines of a buffer until it ends or a sleep starts
+     *
+     * When a line starts a sleep and more lines follow, the rest of the
+     * buffer is kept in pendingStr for resume(). The lines point into the
+     * caller's buffer, so it has to stay untouched until then.
+     */
+    void run(const char* str, size_t len) {
         // Split str into a list of lines
-        line_list* l = parse_lines(str, len);
+        line_list* list = parse_lines(str, len);
 
         // Go through all lines
-        line_node* n = l->first;
+        line_node* n = list->first;
 
-        // Flag, no default delay after this command
-        bool ignore_delay;
+        line_t l;
 
         while (n) {
-            ignore_delay = false;
-
             #ifdef USE_SD_CARD
                 word_list* wl  = &n->words;
             #else
                 word_list* wl  = n->words;
             #endif
 
-            word_node* cmd = wl->first;
-
-            const char* line_str = cmd->str + cmd->len + 1;
-            size_t line_str_len  = n->len - cmd->len - 1;
+            l.node = n;
+            l.cmd  = wl->first;
+            l.str  = l.cmd->str + l.cmd->len + 1;
+            l.len  = n->len - l.cmd->len - 1;
 
             char last_char = n->str[n->len];
-            bool line_end  = last_char == '\r' || last_char == '\n';
+            l.end          = last_char == '\r' || last_char == '\n';
 
-            // LSTRING_??? (-> type each character including linebreaks until LSTRING_END) 
-            if (inLString || compare(cmd->str, 8, "LSTRING_", CASE_SENSETIVE)) {
-                if (!inLString && cmd->len >= 13 && compare(&cmd->str[8], 5, "BEGIN", CASE_SENSETIVE)) {
-                    ignore_delay = true;
-                    inLString    = true;
-                }else if (inLString && compare(cmd->str, cmd->len, "LSTRING_END", CASE_SENSETIVE)) {
-                    ignore_delay = true;
-                    inLString    = false;
-                }else if(inLString) {
-                    type(n->str, n->len);
-                    if (line_end) {
-                        keyboard::pressKey(KEY_ENTER);
-                        release();
-                    }
-                }
-                
-            }
-            
-            // STRING (-> type each character)
-            else if (inString || compare(cmd->str, cmd->len, "STRING", CASE_SENSETIVE) || compare(cmd->str, cmd->len, "STRINGLN", CASE_SENSETIVE)) {
-                if (inString) {
-                    type(n->str, n->len);
-                } else {
-                    isStringln = cmd->str[cmd->len-1] == 'N' && cmd->str[cmd->len-2] == 'L';
+            // Flag, no default delay after this command
+            l.ignore_delay = false;
 
-                    #ifdef USE_SD_CARD
-                        const char* text_ptr = n->str + (isStringln ? 9 : 7);
-                        int text_len = (int)n->len - (isStringln ? 9 : 7);
-                        if (text_len > 0) type(text_ptr, text_len);
-                    #else
-                        type(line_str, line_str_len);
-                    #endif 
+            handler_t handler = (handler_t)pgm_read_ptr(&handlers[classify(l.cmd)]);
 
-                }
+            handler(&l);
 
-                inString = !line_end;
+            n = n->next;
 
-                if (line_end && isStringln) {
-                    isStringln = false;
-                    keyboard::pressKey(KEY_ENTER);
-                    release();
-                }
-                    
-            }
+            finish(l.end, l.ignore_delay);
 
-            // REM (= Comment -> do nothing)
-            else if (inComment || compare(cmd->str, cmd->len, "REM", CASE_SENSETIVE)) {
-                inComment    = !line_end;
-                ignore_delay = true;
+            if (n && (getDelayTime() > 0)) {
+                pendingStr = n->str;
+                pendingLen = (str + len) - n->str;
+                break;
             }
+        }
 
-            // LOCALE (-> change keyboard layout)
-            else if (compare(cmd->str, cmd->len, "LOCALE", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
+        #if !defined(USE_SD_CARD)
+            line_list_destroy(list);
+        #endif
+    }
 
-                keyboard::setLocale(locale::get(w->str, w->len));
-                
-                ignore_delay = true;
-            }
+    /**
+     * @brief Bytes of the operand that follows op, see bytecode.h
+     *
+     * @param op   The op
+     * @param code The bytes after it
+     * @param left Number of bytes after it
+     * @return Operand size, larger than left if the packet is cut off
+     */
+    size_t operand(uint8_t op, const uint8_t* code, size_t left) {
+        switch (op) {
+            case OP_CHAR:
+                return left ? 1 + code[0] : 1;
+
+            case OP_DELAY:
+            case OP_DEFAULT_DELAY:
+            case OP_REPEAT:
+            case OP_LOOP_BEGIN:
+                return 2;
+
+            case OP_MODE:
+                return 1;
+        }
 
-            // DELAY (-> sleep for x ms)
-            else if (compare(cmd->str, cmd->len, "DELAY", CASE_SENSETIVE)) {
-                sleep(toInt(line_str, line_str_len));
-                ignore_delay = true;
-            }
+        return 0;
+    }
 
-            // DEFAULTDELAY/DEFAULT_DELAY (set default delay per command)
-            else if (compare(cmd->str, cmd->len, "DEFAULT_DELAY", CASE_SENSETIVE)) {
-                defaultDelay = toInt(line_str, line_str_len);
-                ignore_delay = true;
-            }
+    /**
+     * @brief Types the text of one of the text or key ops of exec()
+     *
+     * @param op  OP_TEXT to OP_KEYS_PART
+     * @param str Text or keys, the rest of the packet
+     * @param len Bytes of str
+     * @return false if the line continues in the next packet
+     */
+    bool text(uint8_t op, const uint8_t* str, size_t len) {
+        bool keys = op >= OP_KEYS;
 
-            // REPEAT (-> repeat last command n times)
-            else if (compare(cmd->str, cmd->len, "REPEAT", CASE_SENSETIVE)) {
-                repeatNum    = toInt(line_str, line_str_len) + 1;
-                ignore_delay = true;
-            }
+        // Like cmd_string(), a STRING without text types nothing
+        if (len > 0) {
+            if (keys) keyboard::writeKeys(str, len);
+            else type((const char*)str, len);
+        }
 
-            // LOOP_BEGIN (-> Start of loop; if you enter a negative value, 
-            // the loop will be infinite; if it is 0, it will not execute.)
-            else if (compare(cmd->str, cmd->len, "LOOP_BEGIN", CASE_SENSETIVE)) {
-                if (!inLoop) {
-                    loopNum      = toSignedInt(line_str, line_str_len);
-                    inLoop       = true;
-                    if (loopNum < 0) loopNum = -1;
-                }
-                ignore_delay = true;
-            }
+        if ((op == OP_TEXT_LN) || (op == OP_KEYS_LN)) {
+            keyboard::pressKey(KEY_ENTER);
+            release();
+        }
 
-            // LOOP_END (-> End of loop)
-            else if (compare(cmd->str, cmd->len, "LOOP_END", CASE_SENSETIVE)) {
-                if (inLoop) {
-                    if ((loopNum - 1) == 0) {
-                        loopNum--;
-                        inLoop = false;
-                    } 
-                    else if (loopNum <= 0) loopNum = -1;
-                    else loopNum--;
-                }
-                ignore_delay = true;
-            }
+        return (op != OP_TEXT_PART) && (op != OP_KEYS_PART);
+    }
 
-            // LED
-            else if (compare(cmd->str, cmd->len, "LED", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
+    // ====== PUBLIC ===== //
 
-                #ifdef LED_CJMCU3212
-                    if (compare(w->str, w->len, "RIGHT", CASE_INSENSETIVE)) {
-                        w = w->next;
-                        led::right(toInt(w->str, w->len) == 0 ? false : true);
-                    }
-                    else if (compare(w->str, w->len, "LEFT", CASE_INSENSETIVE)) {
-                        w = w->next;
-                        led::left(toInt(w->str, w->len) == 0 ? false : true);
-                    }
-                #else
-                    int c[3];
-
-                    for (uint8_t i = 0; i<3; ++i) {
-                        if (w) {
-                            c[i] = toInt(w->str, w->len);
-                            w    = w->next;
-                        } else {
-                            c[i] = 0;
-                        }
-                    }
+    /**
+     * @brief Parses and executes one chunk of DuckyScript
+     *
+     * This is the core of the entire system. The caller hands us a buffer that
+     * may contain one line, multiple lines, or a fragment of a line. We run
+     * parse_lines() to split it into a linked list, then walk through every
+     * line, classify its command word once and call the matching handler.
+     *
+     * ── Per-line variables (line_t) ─────────────────────────────────────────
+     *   cmd          — The first word on the line (the command keyword itself)
+     *   str          — Everything after the command keyword (the arguments)
+     *   len          — Length of the argument portion
+     *   end          — True if the line ends with \r or \n. This is the key
+     *                  signal: if false, the line was cut short by the buffer
+     *                  boundary and the next parse() call will continue it.
+     *
+     * ── Post-command actions (run after every line) ────────────────────────
+     *   1. Default delay is applied unless the command set ignore_delay or we
+     *      are inside a string or comment block.
+     *   2. repeatNum is decremented if the line is complete and we are not
+     *      inside an LSTRING block.
+     *   3. If a sleep is running now, parsing stops and the remaining lines
+     *      wait for resume().
+     *
+     * ── Memory note ─────────────────────────────────────────────────────────
+     *   When USE_SD_CARD is defined the line list points into the caller's
+     *   buffer — no allocation, no cleanup needed. When it is not defined,
+     *   parse_lines() allocates the list on the heap and we must free it.
+     *
+     * @param str Buffer containing the script data to parse
+     * @param len Number of valid bytes in the buffer
+     */
+    void parse(const char* str, size_t len) {
+        interpretTime = micros();
 
-                    led::setColor(c[0], c[1], c[2]);
-                #endif
-            }
+        pendingStr = NULL;
+        pendingLen = 0;
 
-            // MOUSE MOVE
-            else if (compare(cmd->str, cmd->len, "M_MOVE", CASE_SENSETIVE)) {
-                word_node *w = cmd->next;
+        run(str, len);
+    }
 
-                int x, y;
+    /**
+     * @brief Executes one line the ESP8266 compiled to bytecode
+     *
+     * Does what parse() would do with the text of the line, the words are
+     * already looked up and the numbers converted by the ESP8266, see
+     * esp_duck/compiler.cpp. STRING text often comes as its keys, looked up
+     * in the layout by the ESP8266 as well. The flags that carry STRING, LSTRING and REM
+     * over to the next packet are set by OP_MODE, and the line ends like
+     * every parsed line does, with the default delay and the REPEAT
+     * countdown. A packet holds a single line, so nothing waits for
+     * resume() once a sleep starts.
+     *
+     * An op the parser doesn't know, or one that is cut off, ends the line.
+     *
+     * @param code Ops of the line, without CMD_BYTECODE
+     * @param len  Number of bytes of code
+     */
+    void exec(const uint8_t* code, size_t len) {
+        interpretTime = micros();
 
-                x = toSignedInt(w->str, w->len);
-                w = w->next;
-                y = toSignedInt(w->str, w->len);
+        pendingStr = NULL;
+        pendingLen = 0;
 
-                Mouse.move(x, y);
-            }
+        const uint8_t* last = code + len;
 
-            // MOUSE CLICK
-            else if (compare(cmd->str, cmd->len, "M_CLICK", CASE_SENSETIVE)) {
-                word_node *w = cmd->next;
+        bool end          = true;
+        bool ignore_delay = false;
 
-                int b = toInt(w->str, w->len);
+        while (code < last) {
+            uint8_t op = *code++;
 
-                Mouse.click(b);
+            if (op >= OP_KEY) {
+                keyboard::pressKey(op - OP_KEY);
+                continue;
             }
 
-            // MOUSE PRESS
-            else if (compare(cmd->str, cmd->len, "M_PRESS", CASE_SENSETIVE)) {
-                word_node *w = cmd->next;
-
-                int b = toInt(w->str, w->len);
+            if (op >= OP_ASCII) {
+                keyboard::press((const char*)code - 1);
+                continue;
+            }
 
-                Mouse.press(b);
+            if (op >= OP_MODIFIER) {
+                keyboard::pressModifier(1 << (op - OP_MODIFIER));
+                continue;
             }
 
-            // MOUSE RELEASE
-            else if (compare(cmd->str, cmd->len, "M_RELEASE", CASE_SENSETIVE)) {
-                word_node *w = cmd->next;
+            size_t n = operand(op, code, last - code);
 
-                int b = toInt(w->str, w->len);
+            if (n > (size_t)(last - code)) break;
 
-                Mouse.release(b);
-            }
+            unsigned int val = (n == 2) ? code[0] | (code[1] << 8) : 0;
 
-            // MOUSE SCROLL
-            else if (compare(cmd->str, cmd->len, "M_SCROLL", CASE_SENSETIVE)) {
-                word_node *w = cmd->next;
+            switch (op) {
+                case OP_RELEASE:
+                    release();
+                    break;
 
-                int y = toSignedInt(w->str, w->len);
+                case OP_CHAR:
+                    keyboard::press((const char*)code + 1);
+                    break;
 
-                Mouse.move(0, 0, y);
-            }
+                case OP_DELAY:
+                    sleep(val);
+                    ignore_delay = true;
+                    break;
 
-            // KEYCODE
-            else if (compare(cmd->str, cmd->len, "KEYCODE", CASE_SENSETIVE)) {
-                word_node* w = cmd->next;
-                if (w) {
-                    keyboard::report k;
-
-                    k.modifiers = (uint8_t)toInt(w->str, w->len);
-                    k.reserved  = 0;
-                    w           = w->next;
-
-                    for (uint8_t i = 0; i<6; ++i) {
-                        if (w) {
-                            k.keys[i] = (uint8_t)toInt(w->str, w->len);
-                            w         = w->next;
-                        } else {
-                            k.keys[i] = 0;
-                        }
+                case OP_DEFAULT_DELAY:
+                    defaultDelay = val;
+                    ignore_delay = true;
+                    break;
+
+                case OP_REPEAT:
+                    repeatNum    = val + 1;
+                    ignore_delay = true;
+                    break;
+
+                case OP_LOOP_BEGIN:
+                    loop_begin((int16_t)val);
+                    ignore_delay = true;
+                    break;
+
+                case OP_LOOP_END:
+                    loop_end();
+                    ignore_delay = true;
+                    break;
+
+                case OP_NO_DELAY:
+                    ignore_delay = true;
+                    break;
+
+                case OP_PART:
+                    end = false;
+                    break;
+
+                case OP_MODE:
+                    inString   = code[0] & MODE_STRING;
+                    isStringln = code[0] & MODE_STRINGLN;
+                    inLString  = code[0] & MODE_LSTRING;
+                    inComment  = code[0] & MODE_COMMENT;
+                    break;
+
+                case OP_TEXT:
+                case OP_TEXT_LN:
+                case OP_TEXT_PART:
+                case OP_KEYS:
+                case OP_KEYS_LN:
+                case OP_KEYS_PART:
+                    decompressor::append(code, last - code);
+
+                    if (!text(op, code, last - code)) end = false;
+
+                    code = last;
+                    break;
+
+                case OP_LZ:
+                    if ((code < last) && (code[0] >= OP_TEXT) && (code[0] <= OP_KEYS_PART)) {
+                        size_t         len;
+                        const uint8_t* str = decompressor::decode(code + 1, last - code - 1, &len);
+
+                        if (!text(code[0], str, len)) end = false;
                     }
 
-                    keyboard::send(&k);
-                    keyboard::release();
-                }
+                    code = last;
+                    break;
+
+                default:
+                    code = last;
             }
 
-            // Otherwise go through words and look for keys to press
-            else {
-                word_node* w = wl->first;
+            code += n;
+        }
 
-                while (w) {
-                    press(w->str, w->len);
-                    w = w->next;
-                }
+        finish(end, ignore_delay);
+    }
 
-                if (line_end) release();
-            }
+    /**
+     * @brief Tells whether lines of the last buffer are waiting for a sleep to end
+     *
+     * @return true until resume() has run the rest of the buffer
+     */
+    bool pending() {
+        return pendingStr != NULL;
+    }
 
-            n = n->next;
+    /**
+     * @brief Runs the lines parse() left over once their sleep is over
+     *
+     * Called by the main loop on every pass while pending() is true. Does
+     * nothing while the sleep is still running, so it is cheap to call.
+     *
+     * @return true if the buffer is done, false if it still waits for a sleep
+     */
+    bool resume() {
+        if (!pendingStr) return true;
+        if (getDelayTime() > 0) return false;
 
-            if (!inLString && !isStringln && !inString && !inComment && !ignore_delay) sleep(defaultDelay);
+        const char* str = pendingStr;
+        size_t len      = pendingLen;
 
-            if (line_end && !inLString && (repeatNum > 0)) --repeatNum;
+        pendingStr = NULL;
+        pendingLen = 0;
 
-            interpretTime = millis();
-        }
+        // The next line was due when the sleep ended, not when loop() got here
+        interpretTime = wakeTime;
 
-        #if !defined(USE_SD_CARD)
-            line_list_destroy(l);
-        #endif
+        run(str, len);
+
+        return !pendingStr;
     }
 
     /**
@@ -539,6 +862,7 @@ namespace duckparser {
      *
      * Called by script_runner at the start of every new script. Clears all
      * continuation flags, resets the counters, and restores the default delay.
+     * A running sleep ends and lines waiting for it are dropped.
      */
     void reset() {
         isStringln = false;
@@ -550,6 +874,14 @@ namespace duckparser {
         defaultDelay = 5;
         repeatNum    = 0;
         loopNum      = 0;
+
+        sleeping   = false;
+        pendingStr = NULL;
+        pendingLen = 0;
+
+        keyboard::setInterval(HID_INTERVAL);
+
+        decompressor::reset();
     }
 
     /**
@@ -586,17 +918,22 @@ namespace duckparser {
      * back to the receiving device. When this returns 0 the device is free to
      * accept new data.
      *
-     * @return Remaining sleep time in milliseconds, or 0 if no sleep is active
+     * The deadline is kept in microseconds, so a sleep doesn't end up to a
+     * millisecond early. A sleep that is over is forgotten right here, before
+     * micros() comes around again after about 71 minutes.
+     *
+     * @return Remaining sleep time in milliseconds, rounded up, or 0 if no sleep is active
      */
     unsigned int getDelayTime() {
-        unsigned long finishTime  = sleepStartTime + sleepTime;
-        unsigned long currentTime = millis();
-        
-        if (currentTime > finishTime) {
+        if (!sleeping) return 0;
+
+        long remaining = (long)(wakeTime - micros());
+
+        if (remaining <= 0) {
+            sleeping = false;
             return 0;
-        } else {
-            unsigned long remainingTime = finishTime - currentTime;
-            return (unsigned int)remainingTime;
         }
+
+        return (unsigned int)((remaining + 999) / 1000);
     }
 }
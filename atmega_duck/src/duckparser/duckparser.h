@@ -10,6 +10,7 @@
 #pragma once
 
 #include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
 
 namespace duckparser {
     /**
@@ -17,10 +18,36 @@ namespace duckparser {
      * * Processes the input buffer line by line. This function is designed to
      * handle fragmented commands if the buffer ends in the middle of a line,
      * maintaining the state of strings, comments, and multiline blocks.
+     * * A DELAY or default delay does not block. Parsing stops after the line
+     * that started it and the remaining lines are run by resume(), so the
+     * buffer must stay untouched while pending() is true.
      * * @param str Pointer to the character buffer containing the script data.
      * @param len Length of the data in the buffer.
      */
     void parse(const char* str, size_t len);
+
+    /**
+     * @brief Executes a line the ESP8266 compiled to bytecode (CMD_BYTECODE).
+     * * Has the same effect as parse() with the text of the line, without
+     * splitting it into words or looking any of them up. See bytecode.h.
+     * * @param code Ops of the line, the bytes after CMD_BYTECODE.
+     * @param len Number of bytes of code.
+     */
+    void exec(const uint8_t* code, size_t len);
+
+    /**
+     * @brief Checks whether the last buffer still has lines waiting for a delay.
+     * * @return true while resume() has lines left to run.
+     */
+    bool pending();
+
+    /**
+     * @brief Runs the lines parse() stopped at, once the delay before them is over.
+     * * Meant to be called on every pass of the main loop while pending() is
+     * true. Returns at once while the delay is still running.
+     * * @return true if the whole buffer has been run.
+     */
+    bool resume();
     
     /**
      * @brief Completely resets the parser state.
@@ -0,0 +1,205 @@
+/*!
+    \file atmega_duck/src/duckparser/keywords.cpp
+    \brief Command and key names of DuckyScript
+    \copyright MIT License
+
+    Every name has a fixed place in a 256 slot index, given by a hash of
+    its first character, last character and length. The index is filled in by
+    the compiler from the table below, and the build fails if two names ever
+    land in the same slot. Looking up a word is then one hash, one byte read
+    from flash and one memcmp_P(), no matter which key it names.
+ */
+
+#include "keywords.h"
+
+#include <Arduino.h>
+
+#include "../locale/usb_hid_keys.h"
+
+namespace keywords {
+    // ========== PRIVATE ========== //
+
+    /*! Longest name (DEFAULT_DELAY) plus the terminator */
+    #define KEYWORD_NAME_SIZE 14
+
+    /*! Size of the slot index, a power of two */
+    #define KEYWORD_SLOTS 256
+
+    /*! Slot no name hashes to */
+    #define KEYWORD_EMPTY 0xFF
+
+    typedef struct keyword_t {
+        char    name[KEYWORD_NAME_SIZE];
+        uint8_t len;
+        uint8_t type; // !< KEYWORD_KEY, KEYWORD_MODIFIER or KEYWORD_COMMAND
+        uint8_t code;
+    } keyword_t;
+
+    #define KEYWORD(name, type, code) { name, sizeof(name) - 1, type, code }
+
+    constexpr keyword_t table[] PROGMEM = {
+        // Commands
+        KEYWORD("LSTRING_BEGIN", KEYWORD_COMMAND, COMMAND_LSTRING),
+        KEYWORD("LSTRING_END", KEYWORD_COMMAND, COMMAND_LSTRING),
+        KEYWORD("STRING", KEYWORD_COMMAND, COMMAND_STRING),
+        KEYWORD("STRINGLN", KEYWORD_COMMAND, COMMAND_STRING),
+        KEYWORD("REM", KEYWORD_COMMAND, COMMAND_REM),
+        KEYWORD("LOCALE", KEYWORD_COMMAND, COMMAND_LOCALE),
+        KEYWORD("DELAY", KEYWORD_COMMAND, COMMAND_DELAY),
+        KEYWORD("DEFAULT_DELAY", KEYWORD_COMMAND, COMMAND_DEFAULT_DELAY),
+        KEYWORD("REPEAT", KEYWORD_COMMAND, COMMAND_REPEAT),
+        KEYWORD("LOOP_BEGIN", KEYWORD_COMMAND, COMMAND_LOOP_BEGIN),
+        KEYWORD("LOOP_END", KEYWORD_COMMAND, COMMAND_LOOP_END),
+        KEYWORD("LED", KEYWORD_COMMAND, COMMAND_LED),
+        KEYWORD("M_MOVE", KEYWORD_COMMAND, COMMAND_M_MOVE),
+        KEYWORD("M_CLICK", KEYWORD_COMMAND, COMMAND_M_CLICK),
+        KEYWORD("M_PRESS", KEYWORD_COMMAND, COMMAND_M_PRESS),
+        KEYWORD("M_RELEASE", KEYWORD_COMMAND, COMMAND_M_RELEASE),
+        KEYWORD("M_SCROLL", KEYWORD_COMMAND, COMMAND_M_SCROLL),
+        KEYWORD("KEYCODE", KEYWORD_COMMAND, COMMAND_KEYCODE),
+        KEYWORD("TYPING_RATE", KEYWORD_COMMAND, COMMAND_TYPING_RATE),
+
+        // Keys
+        KEYWORD("ENTER", KEYWORD_KEY, KEY_ENTER),
+        KEYWORD("MENU", KEYWORD_KEY, KEY_PROPS),
+        KEYWORD("DELETE", KEYWORD_KEY, KEY_DELETE),
+        KEYWORD("BACKSPACE", KEYWORD_KEY, KEY_BACKSPACE),
+        KEYWORD("HOME", KEYWORD_KEY, KEY_HOME),
+        KEYWORD("INSERT", KEYWORD_KEY, KEY_INSERT),
+        KEYWORD("PAGEUP", KEYWORD_KEY, KEY_PAGEUP),
+        KEYWORD("PAGEDOWN", KEYWORD_KEY, KEY_PAGEDOWN),
+        KEYWORD("UP", KEYWORD_KEY, KEY_UP),
+        KEYWORD("DOWN", KEYWORD_KEY, KEY_DOWN),
+        KEYWORD("LEFT", KEYWORD_KEY, KEY_LEFT),
+        KEYWORD("RIGHT", KEYWORD_KEY, KEY_RIGHT),
+        KEYWORD("TAB", KEYWORD_KEY, KEY_TAB),
+        KEYWORD("END", KEYWORD_KEY, KEY_END),
+        KEYWORD("ESC", KEYWORD_KEY, KEY_ESC),
+        KEYWORD("F1", KEYWORD_KEY, KEY_F1),
+        KEYWORD("F2", KEYWORD_KEY, KEY_F2),
+        KEYWORD("F3", KEYWORD_KEY, KEY_F3),
+        KEYWORD("F4", KEYWORD_KEY, KEY_F4),
+        KEYWORD("F5", KEYWORD_KEY, KEY_F5),
+        KEYWORD("F6", KEYWORD_KEY, KEY_F6),
+        KEYWORD("F7", KEYWORD_KEY, KEY_F7),
+        KEYWORD("F8", KEYWORD_KEY, KEY_F8),
+        KEYWORD("F9", KEYWORD_KEY, KEY_F9),
+        KEYWORD("F10", KEYWORD_KEY, KEY_F10),
+        KEYWORD("F11", KEYWORD_KEY, KEY_F11),
+        KEYWORD("F12", KEYWORD_KEY, KEY_F12),
+        KEYWORD("SPACE", KEYWORD_KEY, KEY_SPACE),
+        KEYWORD("PAUSE", KEYWORD_KEY, KEY_PAUSE),
+        KEYWORD("BREAK", KEYWORD_KEY, KEY_PAUSE),
+        KEYWORD("CAPSLOCK", KEYWORD_KEY, KEY_CAPSLOCK),
+        KEYWORD("NUMLOCK", KEYWORD_KEY, KEY_NUMLOCK),
+        KEYWORD("PRINTSCREEN", KEYWORD_KEY, KEY_SYSRQ),
+        KEYWORD("SCROLLLOCK", KEYWORD_KEY, KEY_SCROLLLOCK),
+
+        // Numpad keys
+        KEYWORD("NUM_0", KEYWORD_KEY, KEY_KP0),
+        KEYWORD("NUM_1", KEYWORD_KEY, KEY_KP1),
+        KEYWORD("NUM_2", KEYWORD_KEY, KEY_KP2),
+        KEYWORD("NUM_3", KEYWORD_KEY, KEY_KP3),
+        KEYWORD("NUM_4", KEYWORD_KEY, KEY_KP4),
+        KEYWORD("NUM_5", KEYWORD_KEY, KEY_KP5),
+        KEYWORD("NUM_6", KEYWORD_KEY, KEY_KP6),
+        KEYWORD("NUM_7", KEYWORD_KEY, KEY_KP7),
+        KEYWORD("NUM_8", KEYWORD_KEY, KEY_KP8),
+        KEYWORD("NUM_9", KEYWORD_KEY, KEY_KP9),
+        KEYWORD("NUM_ASTERIX", KEYWORD_KEY, KEY_KPASTERISK),
+        KEYWORD("NUM_ENTER", KEYWORD_KEY, KEY_KPENTER),
+        KEYWORD("NUM_MINUS", KEYWORD_KEY, KEY_KPMINUS),
+        KEYWORD("NUM_DOT", KEYWORD_KEY, KEY_KPDOT),
+        KEYWORD("NUM_PLUS", KEYWORD_KEY, KEY_KPPLUS),
+
+        // Modifiers
+        KEYWORD("CTRL", KEYWORD_MODIFIER, KEY_MOD_LCTRL),
+        KEYWORD("CONTROL", KEYWORD_MODIFIER, KEY_MOD_LCTRL),
+        KEYWORD("SHIFT", KEYWORD_MODIFIER, KEY_MOD_LSHIFT),
+        KEYWORD("ALT", KEYWORD_MODIFIER, KEY_MOD_LALT),
+        KEYWORD("WINDOWS", KEYWORD_MODIFIER, KEY_MOD_LMETA),
+        KEYWORD("GUI", KEYWORD_MODIFIER, KEY_MOD_LMETA),
+    };
+
+    #define NUM_KEYWORDS (sizeof(table) / sizeof(table[0]))
+
+    static_assert(NUM_KEYWORDS < KEYWORD_EMPTY, "too many key names for a byte index");
+
+    /**
+     * @brief Slot of a name, from its first and last character and its length
+     *
+     * The multipliers were searched for so that every name in the table gets
+     * a slot of its own. Only the low 8 bits of each product matter, so it is
+     * three 8 bit multiplications on the AVR.
+     */
+    constexpr uint8_t hash(uint8_t first, uint8_t last, uint8_t len) {
+        return ((first * 13) ^ (last * 80) ^ (len * 29)) & (KEYWORD_SLOTS - 1);
+    }
+
+    // The functions below run at compile time only. C++11 constexpr allows
+    // nothing but a single return statement, hence the recursion.
+
+    constexpr uint8_t hash_of(size_t i) {
+        return hash(table[i].name[0], table[i].name[table[i].len - 1], table[i].len);
+    }
+
+    /** Index of the name that hashes to slot s, KEYWORD_EMPTY if there is none */
+    constexpr uint8_t slot(size_t s, size_t i = 0) {
+        return i == NUM_KEYWORDS ? KEYWORD_EMPTY : hash_of(i) == s ? i : slot(s, i + 1);
+    }
+
+    /** Number of names that hash to slot s */
+    constexpr size_t hits(size_t s, size_t i = 0) {
+        return i == NUM_KEYWORDS ? 0 : (hash_of(i) == s) + hits(s, i + 1);
+    }
+
+    constexpr bool perfect(size_t s = 0) {
+        return s == KEYWORD_SLOTS ? true : (hits(s) <= 1) && perfect(s + 1);
+    }
+
+    constexpr uint8_t smaller(uint8_t a, uint8_t b) {
+        return a < b ? a : b;
+    }
+
+    constexpr uint8_t larger(uint8_t a, uint8_t b) {
+        return a > b ? a : b;
+    }
+
+    constexpr uint8_t shortest(size_t i = 0) {
+        return i == NUM_KEYWORDS ? 0xFF : smaller(table[i].len, shortest(i + 1));
+    }
+
+    constexpr uint8_t longest(size_t i = 0) {
+        return i == NUM_KEYWORDS ? 0 : larger(table[i].len, longest(i + 1));
+    }
+
+    static_assert(perfect(), "two names share a slot, search new multipliers for hash()");
+
+    constexpr uint8_t min_len = shortest();
+    constexpr uint8_t max_len = longest();
+
+    #define SLOT4(s) slot(s), slot(s + 1), slot(s + 2), slot(s + 3)
+    #define SLOT16(s) SLOT4(s), SLOT4(s + 4), SLOT4(s + 8), SLOT4(s + 12)
+    #define SLOT64(s) SLOT16(s), SLOT16(s + 16), SLOT16(s + 32), SLOT16(s + 48)
+
+    /** Slot -> index into table */
+    constexpr uint8_t slots[KEYWORD_SLOTS] PROGMEM = { SLOT64(0), SLOT64(64), SLOT64(128), SLOT64(192) };
+
+    // ========== PUBLIC ========== //
+
+    uint8_t find(const char* str, size_t len, uint8_t* code) {
+        if ((len < min_len) || (len > max_len)) return KEYWORD_NONE;
+
+        uint8_t i = pgm_read_byte(&slots[hash(str[0], str[len - 1], len)]);
+
+        if (i == KEYWORD_EMPTY) return KEYWORD_NONE;
+
+        const keyword_t* k = &table[i];
+
+        if ((pgm_read_byte(&k->len) != len) || (memcmp_P(str, k->name, len) != 0)) return KEYWORD_NONE;
+
+        *code = pgm_read_byte(&k->code);
+
+        return pgm_read_byte(&k->type);
+    }
+}
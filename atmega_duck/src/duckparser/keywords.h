@@ -0,0 +1,52 @@
+/*!
+    \file atmega_duck/src/duckparser/keywords.h
+    \brief Command and key names of DuckyScript
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+#define KEYWORD_NONE     0 // !< Neither a command nor a key name
+#define KEYWORD_KEY      1 // !< HID usage code, press with keyboard::pressKey()
+#define KEYWORD_MODIFIER 2 // !< Modifier bit, press with keyboard::pressModifier()
+#define KEYWORD_COMMAND  3 // !< Script command, one of the COMMAND_ codes below
+
+// Commands, in the order of duckparser's handler table
+#define COMMAND_KEYS          0 // !< Not a command, the line is a key combination
+#define COMMAND_LSTRING       1 // !< LSTRING_BEGIN, LSTRING_END
+#define COMMAND_STRING        2 // !< STRING, STRINGLN
+#define COMMAND_REM           3
+#define COMMAND_LOCALE        4
+#define COMMAND_DELAY         5
+#define COMMAND_DEFAULT_DELAY 6
+#define COMMAND_REPEAT        7
+#define COMMAND_LOOP_BEGIN    8
+#define COMMAND_LOOP_END      9
+#define COMMAND_LED           10
+#define COMMAND_M_MOVE        11
+#define COMMAND_M_CLICK       12
+#define COMMAND_M_PRESS       13
+#define COMMAND_M_RELEASE     14
+#define COMMAND_M_SCROLL      15
+#define COMMAND_KEYCODE       16
+#define COMMAND_TYPING_RATE   17
+
+namespace keywords {
+    /**
+     * @brief Looks up a command such as STRING or DELAY, or a key name such
+     * as ENTER, F12, NUM_PLUS or CTRL
+     *
+     * Names are matched case sensitive, exactly like the compare() chains
+     * this replaces. The cost is one hash and at most one comparison,
+     * whichever name is looked up.
+     *
+     * @param str  Word from the script (not NULL terminated)
+     * @param len  Length of the word
+     * @param code Receives the usage code, modifier bit or COMMAND_ code on a match
+     * @return KEYWORD_KEY, KEYWORD_MODIFIER, KEYWORD_COMMAND or KEYWORD_NONE
+     */
+    uint8_t find(const char* str, size_t len, uint8_t* code);
+}
@@ -7,11 +7,17 @@
  */
 
 #include "keyboard.h"
+#include "../../include/config.h"
 #include "../../include/debug.h"
+#include "../duckparser/bytecode.h"
 
 namespace keyboard {
     // ====== PRIVATE ====== //
     hid_locale_t* locale      { locale::get_default() };
+    bool          coalescing  { HID_COALESCE };
+    unsigned int  interval    { HID_INTERVAL };
+    unsigned long last_report { 0 };
+    pacing_stats  stats;
     report prev_report = report { KEY_NONE, KEY_NONE, { KEY_NONE, KEY_NONE, KEY_NONE, KEY_NONE, KEY_NONE, KEY_NONE } };
 
     const uint8_t keyboardDescriptor[] PROGMEM {
@@ -65,6 +71,125 @@ namespace keyboard {
         return k;
     }
 
+    // HID() is the only pluggable USB module, it gets the first endpoint after the CDC serial
+    #define HID_ENDPOINT (CDC_FIRST_ENDPOINT + CDC_ENPOINT_COUNT)
+
+    /*! Poll step while the host has not read the previous report yet */
+    #define ENDPOINT_POLL_US 20
+
+    /*! Give up waiting after this, USB_Send() has its own timeout for unplugged hosts */
+    #define ENDPOINT_TIMEOUT_US 50000UL
+
+    /**
+     * @brief Holds the next report back until it can go out
+     *
+     * First the minimum interval since the previous report, then until the
+     * host has read the previous report out of the endpoint. USB_Send() would
+     * wait for the endpoint as well, but in steps of a whole millisecond.
+     */
+    void pace() {
+        unsigned long start = micros();
+        unsigned long since = start - last_report;
+
+        if (since < interval) {
+            delayMicroseconds(interval - since);
+            ++stats.interval_waits;
+        }
+
+        if (USB_SendSpace(HID_ENDPOINT) == 0) {
+            unsigned long waited = 0;
+
+            while (USB_SendSpace(HID_ENDPOINT) == 0 && waited < ENDPOINT_TIMEOUT_US) {
+                delayMicroseconds(ENDPOINT_POLL_US);
+                waited += ENDPOINT_POLL_US;
+            }
+            ++stats.endpoint_waits;
+        }
+
+        unsigned long wait = micros() - start;
+
+        stats.wait_us += wait;
+        if (wait > stats.max_wait_us) stats.max_wait_us = wait;
+    }
+
+    typedef struct stroke {
+        uint8_t modifiers;
+        uint8_t key;
+    } stroke;
+
+    /**
+     * @brief Looks up the keys that type the UTF-8 character at strPtr
+     *
+     * @param strokes Receives up to 2 keys, the dead key comes first for combinations
+     * @param n       Receives the number of keys, 0 if the layout can't type it
+     * @return Number of extra bytes used from the string pointer
+     */
+    uint8_t lookup(const char* strPtr, stroke* strokes, uint8_t* n) {
+        // Decode the character once, the tables are searched by codepoint
+        uint8_t  len;
+        uint32_t codepoint = locale::decode((const uint8_t*)strPtr, &len);
+
+        *n = 0;
+
+        // Stray or cut off UTF-8 byte, skip it
+        if (len == 0) return 0;
+
+        // Key combinations (accent keys)
+        // We have to check them first, because sometimes ASCII keys are in here
+        const uint8_t* row = locale::combination(locale, codepoint);
+
+        if (row) {
+            strokes[0].modifiers = pgm_read_byte(row + 4);
+            strokes[0].key       = pgm_read_byte(row + 5);
+            strokes[1].modifiers = pgm_read_byte(row + 6);
+            strokes[1].key       = pgm_read_byte(row + 7);
+
+            *n = 2;
+            return len-1;
+        }
+
+        // ASCII
+        if (codepoint < locale->ascii_len) {
+            strokes[0].modifiers = pgm_read_byte(locale->ascii + (codepoint * 2) + 0);
+            strokes[0].key       = pgm_read_byte(locale->ascii + (codepoint * 2) + 1);
+
+            *n = 1;
+            return 0;
+        }
+
+        // UTF8
+        row = locale::utf8(locale, codepoint);
+
+        if (row) {
+            strokes[0].modifiers = pgm_read_byte(row + 4);
+            strokes[0].key       = pgm_read_byte(row + 5);
+
+            *n = 1;
+            return len-1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Presses a key in place of the one that is down, coalescing engine only
+     *
+     * The host only types on a key going down. So the key has to go up first
+     * when it is pressed twice in a row, and a modifier that the next key
+     * must not get is let go in a report of its own, before that key.
+     */
+    void type(const stroke& s) {
+        if (s.key == KEY_NONE) return;
+
+        if ((prev_report.keys[0] == s.key) || (prev_report.modifiers & ~s.modifiers)) {
+            prev_report = makeReport(prev_report.modifiers & s.modifiers);
+            send(&prev_report);
+        }
+
+        prev_report = makeReport(s.modifiers, s.key);
+        send(&prev_report);
+    }
+
     // ====== PUBLIC ====== //
     void begin() {
         static HIDSubDescriptor node(keyboardDescriptor, sizeof(keyboardDescriptor));
@@ -76,6 +201,26 @@ namespace keyboard {
         keyboard::locale = locale;
     }
 
+    void setCoalescing(bool enable) {
+        coalescing = enable;
+    }
+
+    void setInterval(unsigned int us) {
+        interval = us;
+    }
+
+    unsigned int getInterval() {
+        return interval;
+    }
+
+    const pacing_stats& getStats() {
+        return stats;
+    }
+
+    void resetStats() {
+        memset(&stats, 0, sizeof(stats));
+    }
+
     void send(report* k) {
 #ifdef ENABLE_DEBUG
         debug("Sending Report [");
@@ -87,8 +232,11 @@ namespace keyboard {
         debug(String(prev_report.modifiers, HEX));
         debugln("]");
 #endif // ENABLE_DEBUG
+        pace();
         HID().SendReport(2, (uint8_t*)k, sizeof(report));
-        delayMicroseconds(2500); // Delay
+
+        last_report = micros();
+        ++stats.reports;
     }
 
     void release() {
@@ -114,104 +262,73 @@ namespace keyboard {
     }
 
     uint8_t press(const char* strPtr) {
-        // Convert string pointer into a byte pointer
-        uint8_t* b = (uint8_t*)strPtr;
+        stroke  strokes[2];
+        uint8_t n;
+        uint8_t res = lookup(strPtr, strokes, &n);
+
+        // Key combination, type the dead key first
+        if (n == 2) {
+            pressKey(strokes[0].key, strokes[0].modifiers);
+            release();
+            pressKey(strokes[1].key, strokes[1].modifiers);
+            release();
+        } else if (n == 1) {
+            pressKey(strokes[0].key, strokes[0].modifiers);
+        }
 
-        // Key combinations (accent keys)
-        // We have to check them first, because sometimes ASCII keys are in here
-        for (uint8_t i = 0; i<locale->combinations_len; ++i) {
-            uint8_t res = 0;
-
-            // Read utf8 code and match it with the given data
-            for (uint8_t j = 0; j<4; ++j) {
-                uint8_t key_code = pgm_read_byte(locale->combinations + (i * 8) + j);
-
-                if (key_code == 0) {
-                    break;
-                }
-
-                if (key_code == b[j]) {
-                    ++res;
-                } else {
-                    res = 0;
-                    break;
-                }
-            }
+        return res;
+    }
 
-            // If a match was found, read out the data and type it
-            if (res > 0) {
-                uint8_t comboModifiers = pgm_read_byte(locale->combinations + (i * 8) + 4);
-                uint8_t comboKey       = pgm_read_byte(locale->combinations + (i * 8) + 5);
+    uint8_t write(const char* c) {
+        uint8_t res = press(c);
 
-                uint8_t modifiers = pgm_read_byte(locale->combinations + (i * 8) + 6);
-                uint8_t key       = pgm_read_byte(locale->combinations + (i * 8) + 7);
+        release();
 
-                pressKey(comboKey, comboModifiers);
-                release();
-                pressKey(key, modifiers);
-                release();
+        return res;
+    }
 
-                // Return the number of extra bytes we used from the string pointer
-                return res-1;
+    void write(const char* str, size_t len) {
+        if (!coalescing) {
+            for (size_t i = 0; i<len; ++i) {
+                i += write(&str[i]);
             }
+            return;
         }
 
-        // ASCII
-        if (b[0] < locale->ascii_len) {
-            uint8_t modifiers = pgm_read_byte(locale->ascii + (b[0] * 2) + 0);
-            uint8_t key       = pgm_read_byte(locale->ascii + (b[0] * 2) + 1);
+        stroke  strokes[2];
+        uint8_t n;
 
-            pressKey(key, modifiers);
-
-            return 0;
-        }
-        
-        // UTF8
-        for (size_t i = 0; i<locale->utf8_len; ++i) {
-            uint8_t res = 0;
-
-            // Read utf8 code and match it with the given data
-            for (uint8_t j = 0; j<4; ++j) {
-                uint8_t key_code = pgm_read_byte(locale->utf8 + (i * 6) + j);
-
-                if (key_code == 0) {
-                    break;
-                }
-
-                if (key_code == b[j]) {
-                    ++res;
-                } else {
-                    res = 0;
-                    break;
-                }
-            }
-
-            // If a match was found, read out the data and type it
-            if (res > 0) {
-                uint8_t modifiers = pgm_read_byte(locale->utf8 + (i * 6) + 4);
-                uint8_t key       = pgm_read_byte(locale->utf8 + (i * 6) + 5);
-
-                pressKey(key, modifiers);
+        for (size_t i = 0; i<len; ++i) {
+            i += lookup(&str[i], strokes, &n);
 
-                // Return the number of extra bytes we used from the string pointer
-                return res-1;
-            }
+            for (uint8_t j = 0; j<n; ++j) type(strokes[j]);
         }
 
-        return 0;
+        release();
     }
 
-    uint8_t write(const char* c) {
-        uint8_t res = press(c);
+    void writeKeys(const uint8_t* keys, size_t len) {
+        uint8_t modifiers = KEY_NONE;
+        stroke  s;
 
-        release();
+        for (size_t i = 0; i<len; ++i) {
+            if (keys[i] == KEYS_MODIFIERS) {
+                if (++i < len) modifiers = keys[i];
+                continue;
+            }
 
-        return res;
-    }
+            s.modifiers = (keys[i] & KEYS_SHIFT) ? (modifiers | KEY_MOD_LSHIFT) : modifiers;
+            s.key       = keys[i] & ~KEYS_SHIFT;
 
-    void write(const char* str, size_t len) {
-        for (size_t i = 0; i<len; ++i) {
-            i += write(&str[i]);
+            if (coalescing) {
+                type(s);
+            } else {
+                // KEYS_DEAD_END is the release write(c) sends after the two keys of press()
+                if (s.key != KEY_NONE) pressKey(s.key, s.modifiers);
+                release();
+            }
         }
+
+        if (coalescing) release();
     }
 }
@@ -17,10 +17,46 @@ namespace keyboard {
         uint8_t keys[6];
     } report;
 
+    typedef struct pacing_stats {
+        uint32_t reports;        // !< Keyboard reports sent
+        uint32_t endpoint_waits; // !< Reports that waited for the host to read the previous one
+        uint32_t interval_waits; // !< Reports held back by the minimum interval
+        uint32_t wait_us;        // !< Time all reports waited in total
+        uint32_t max_wait_us;    // !< Longest wait of a single report
+    } pacing_stats;
+
     void begin();
 
     void setLocale(hid_locale_t* locale);
 
+    /**
+     * @brief Selects how write(str, len) types text
+     *
+     * Coalescing sends a report only when the pressed key changes: the next
+     * key replaces the previous one in the same report, and modifiers stay
+     * held as long as the following characters need them too. A release
+     * report is only sent between two presses of the same key and before
+     * a modifier is let go. The host types the same characters either way.
+     *
+     * @param enable true to coalesce, false for a press and a release report per key
+     */
+    void setCoalescing(bool enable);
+
+    /**
+     * @brief Sets the minimum time between two keyboard reports (TYPING_RATE)
+     *
+     * Every report waits until the USB host has read the previous one, so 0
+     * types as fast as the host polls. Slow or picky hosts that drop keys
+     * need a longer interval, 2500 is the fixed pace of older versions.
+     *
+     * @param us Microseconds from one report to the next
+     */
+    void setInterval(unsigned int us);
+    unsigned int getInterval();
+
+    const pacing_stats& getStats();
+    void resetStats();
+
     void send(report* k);
     void release();
 
@@ -31,4 +67,15 @@ namespace keyboard {
 
     uint8_t write(const char* c);
     void write(const char* str, size_t len);
+
+    /**
+     * @brief Types text the ESP8266 already looked up in the layout
+     *
+     * Sends the same reports as write(str, len) with the text the keys were
+     * looked up for, in either typing engine.
+     *
+     * @param keys HID usage codes and modifiers, see OP_KEYS in bytecode.h
+     * @param len  Number of bytes of keys
+     */
+    void writeKeys(const uint8_t* keys, size_t len);
 }
\ No newline at end of file
@@ -88,7 +88,111 @@ extern "C" {
 #define CASE_INSENSETIVE 0
 #define CASE_SENSETIVE 1
 
+/*! Bytes per row of the utf8 table: 4 byte character, modifiers, key */
+#define UTF8_ROW 6
+
+/*! Bytes per row of the combinations table: 4 byte character, dead key modifiers and key, modifiers, key */
+#define COMBINATION_ROW 8
+
 namespace locale {
+    // ===== PRIVATE ===== //
+
+    /**
+     * @brief Character of a table row, its UTF-8 bytes read as one big endian number
+     *
+     * Rows hold the UTF-8 bytes of their character, padded with zeros.
+     * UTF-8 sorts like the codepoints it encodes, so this number ascends
+     * with the codepoint and the rows can be compared without decoding them.
+     */
+    uint32_t key(const uint8_t* row) {
+        uint32_t res = 0;
+
+        for (uint8_t i = 0; i<4; ++i) res = (res << 8) | pgm_read_byte(row + i);
+
+        return res;
+    }
+
+    /**
+     * @brief Codepoint to the form key() reads from a row
+     */
+    uint32_t encode(uint32_t codepoint) {
+        if (codepoint < 0x80) return codepoint << 24;
+
+        if (codepoint < 0x800) {
+            return (0xC0UL | (codepoint >> 6)) << 24
+                   | (0x80UL | (codepoint & 0x3F)) << 16;
+        }
+
+        if (codepoint < 0x10000) {
+            return (0xE0UL | (codepoint >> 12)) << 24
+                   | (0x80UL | ((codepoint >> 6) & 0x3F)) << 16
+                   | (0x80UL | (codepoint & 0x3F)) << 8;
+        }
+
+        return (0xF0UL | (codepoint >> 18)) << 24
+               | (0x80UL | ((codepoint >> 12) & 0x3F)) << 16
+               | (0x80UL | ((codepoint >> 6) & 0x3F)) << 8
+               | (0x80UL | (codepoint & 0x3F));
+    }
+
+    bool ascending(const uint8_t* table, size_t rows, uint8_t width) {
+        for (size_t i = 1; i<rows; ++i) {
+            if (key(table + (i - 1) * width) >= key(table + i * width)) return false;
+        }
+        return true;
+    }
+
+    /** Layout sorted() looked at last */
+    hid_locale_t* checked = NULL;
+
+    /** Whether the tables of checked are in order */
+    bool checked_sorted = false;
+
+    /**
+     * @brief Finds out whether the tables of a layout can be binary searched
+     *
+     * All layouts in this folder are in order. A hand edited one that is not
+     * still works, it's just searched row by row like before. The answer is
+     * kept for the layout looked at last, here and not in hid_locale_t, so
+     * the layout files stay as they are. Only a LOCALE that switches to
+     * another layout checks again.
+     */
+    bool sorted(hid_locale_t* locale) {
+        if (locale != checked) {
+            checked_sorted = ascending(locale->utf8, locale->utf8_len, UTF8_ROW) &&
+                             ascending(locale->combinations, locale->combinations_len, COMBINATION_ROW);
+            checked = locale;
+        }
+
+        return checked_sorted;
+    }
+
+    const uint8_t* search(const uint8_t* table, size_t rows, uint8_t width, uint32_t codepoint, bool binary) {
+        uint32_t c = encode(codepoint);
+
+        if (!binary) {
+            for (size_t i = 0; i<rows; ++i) {
+                if (key(table + i * width) == c) return table + i * width;
+            }
+            return NULL;
+        }
+
+        size_t lo = 0;
+        size_t hi = rows;
+
+        while (lo < hi) {
+            size_t   mid = (lo + hi) / 2;
+            uint32_t k   = key(table + mid * width);
+
+            if (k == c) return table + mid * width;
+
+            if (k < c) lo = mid + 1;
+            else hi = mid;
+        }
+
+        return NULL;
+    }
+
     // ===== PUBLIC ===== //
     hid_locale_t* get_default() {
         return &locale_us_win;
@@ -173,4 +277,48 @@ namespace locale {
         //else if (compare(name, len, "UA", CASE_INSENSETIVE)) return &locale_ua_win;
         else return get_default();
     }
-}
\ No newline at end of file
+
+    uint32_t decode(const uint8_t* b, uint8_t* len) {
+        uint32_t codepoint;
+        uint8_t  n;
+
+        if (b[0] < 0x80) {
+            *len = 1;
+            return b[0];
+        }
+
+        if ((b[0] & 0xE0) == 0xC0) {
+            n         = 2;
+            codepoint = b[0] & 0x1F;
+        } else if ((b[0] & 0xF0) == 0xE0) {
+            n         = 3;
+            codepoint = b[0] & 0x0F;
+        } else if ((b[0] & 0xF8) == 0xF0) {
+            n         = 4;
+            codepoint = b[0] & 0x07;
+        } else {
+            *len = 0;
+            return b[0];
+        }
+
+        for (uint8_t i = 1; i<n; ++i) {
+            if ((b[i] & 0xC0) != 0x80) {
+                *len = 0;
+                return b[0];
+            }
+
+            codepoint = (codepoint << 6) | (b[i] & 0x3F);
+        }
+
+        *len = n;
+        return codepoint;
+    }
+
+    const uint8_t* combination(hid_locale_t* locale, uint32_t codepoint) {
+        return search(locale->combinations, locale->combinations_len, COMBINATION_ROW, codepoint, sorted(locale));
+    }
+
+    const uint8_t* utf8(hid_locale_t* locale, uint32_t codepoint) {
+        return search(locale->utf8, locale->utf8_len, UTF8_ROW, codepoint, sorted(locale));
+    }
+}
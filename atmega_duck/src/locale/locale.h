@@ -12,4 +12,31 @@
 namespace locale {
     hid_locale_t* get_default();
     hid_locale_t* get(const char* name, size_t len);
+
+    /**
+     * @brief Decodes the UTF-8 character at the start of b
+     *
+     * @param b   Bytes of the character, at least up to its last byte
+     * @param len Receives the length of the character in bytes,
+     *            0 if b does not start with a valid character
+     * @return Codepoint of the character
+     */
+    uint32_t decode(const uint8_t* b, uint8_t* len);
+
+    /*! True if the utf8 and combinations tables of the layout ascend by character and are binary searched */
+    bool sorted(hid_locale_t* locale);
+
+    /**
+     * @brief Finds a character in the combinations (dead key) table
+     *
+     * @return Pointer to its 8 byte row in PROGMEM, NULL if it's not in the table
+     */
+    const uint8_t* combination(hid_locale_t* locale, uint32_t codepoint);
+
+    /**
+     * @brief Finds a character in the utf8 table
+     *
+     * @return Pointer to its 6 byte row in PROGMEM, NULL if it's not in the table
+     */
+    const uint8_t* utf8(hid_locale_t* locale, uint32_t codepoint);
 }
\ No newline at end of file
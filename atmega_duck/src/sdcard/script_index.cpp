@@ -0,0 +1,242 @@
+#include "../../include/debug.h"
+#include "../../include/config.h"
+#include "sdcard.h"
+#include "script_index.h"
+#include <Arduino.h>
+
+#if defined(USE_SD_CARD) && defined(USE_SCRIPT_INDEX)
+
+/**
+ * @file script_index.cpp
+ * @brief Where the lines of a script on the SD card start, kept in a file next to it
+ *
+ * The index of SCRIPT.DS is SCRIPT.IDX, the extension replaced, so the name
+ * still fits 8.3 and the directory listing, which only shows scripts,
+ * doesn't show it. It starts with four numbers of 4 bytes, the low byte
+ * first: "DSI" and INDEX_VERSION, the size of the script, its modification
+ * time (see sdcard::modified()) and its number of lines. Then one entry of
+ * 4 bytes per line: the file position where it starts in the low 28 bits,
+ * the INDEX_* flags of the blocks it starts or ends in the high 4.
+ *
+ * Lines are what script_runner's get_line() makes of the file: a line ends
+ * at \n or \r, and \n right after that belongs to it.
+ *
+ * Without an index that matches the script's size and modification time,
+ * script_runner adds every line it reads for the first time, so the index
+ * is built as the script runs, without reading the script a second time.
+ * The header is written last, an index the script didn't get to the end of
+ * doesn't match and is built again on the next run. Files this device
+ * writes all get the same default time, sd_handler deletes the index before
+ * it writes a script for that reason.
+ */
+namespace script_index {
+
+    // Bytes of the header: magic, size, modification time, lines
+    #define INDEX_SIZE    16
+    #define INDEX_VERSION 3
+
+    // Bits of an entry that hold the position, the flags are above them
+    #define INDEX_POS_BITS 28
+    #define INDEX_POS_MASK 0x0FFFFFFFUL
+
+    /** Entries add() keeps before it writes them, one write per INDEX_STAGE lines */
+    #define INDEX_STAGE 8
+
+    static const uint8_t magic[4] = { 'D', 'S', 'I', INDEX_VERSION };
+
+    /**
+     * @brief The index of the script that runs
+     */
+    static struct {
+        uint32_t size;                // Size of the script
+        uint32_t mtime;               // Modification time of the script
+        uint32_t lines;               // Lines in the index, staged ones too
+        uint32_t stage[INDEX_STAGE];  // Entries of the last lines, not written yet
+        uint8_t  staged;              // Entries in stage
+        bool     open;                // The index is open on the second handle
+        bool     building;            // add() adds to it, the header isn't written yet
+    } index;
+
+    /**
+     * @brief Writes the name of the index of script f to out
+     *
+     * @param out Room for MAX_NAME + 5 bytes
+     * @return false if the name is too long, or f is an index itself
+     */
+    bool index_name(const char* f, char* out) {
+        size_t len = strlen(f);
+        size_t dot = len;
+
+        for (size_t i = len; i > 0 && f[i - 1] != '/'; --i) {
+            if (f[i - 1] == '.') {
+                dot = i - 1;
+                break;
+            }
+        }
+
+        if (dot > MAX_NAME) return false;
+
+        if ((len - dot == 4) && (toupper(f[dot + 1]) == 'I') &&
+            (toupper(f[dot + 2]) == 'D') && (toupper(f[dot + 3]) == 'X')) return false;
+
+        memcpy(out, f, dot);
+        memcpy(out + dot, ".IDX", 5);
+
+        return true;
+    }
+
+    uint32_t get32(const uint8_t* b) {
+        uint32_t v;
+
+        memcpy(&v, b, 4);
+        return v;
+    }
+
+    void put32(uint8_t* b, uint32_t v) {
+        memcpy(b, &v, 4);
+    }
+
+    /**
+     * @brief Writes the staged entries behind the ones written before
+     *
+     * A card that can't take them closes the index, the script runs on without it.
+     *
+     * @return false if the index was closed
+     */
+    bool flush() {
+        if (index.staged == 0) return true;
+
+        uint16_t len = index.staged * 4;
+
+        if (!sdcard::seekIndex(INDEX_SIZE + (index.lines - index.staged) * 4) ||
+            (sdcard::writeIndex((const uint8_t*)index.stage, len) != len)) {
+            close();
+            return false;
+        }
+
+        index.staged = 0;
+        return true;
+    }
+
+    uint32_t open(const char* f, uint32_t size) {
+        char name[MAX_NAME + 5];
+
+        close();
+
+        if (!index_name(f, name)) return 0;
+
+        index.mtime = sdcard::modified();
+        index.size  = size;
+
+        if (sdcard::beginIndex(name, false)) {
+            uint8_t header[INDEX_SIZE];
+
+            bool ok = (sdcard::readIndex(header, INDEX_SIZE) == INDEX_SIZE) &&
+                      (memcmp(header, magic, 4) == 0) &&
+                      (get32(header + 4) == size) && (get32(header + 8) == index.mtime);
+
+            if (ok) {
+                index.lines    = get32(header + 12);
+                index.staged   = 0;
+                index.open     = true;
+                index.building = false;
+
+                return index.lines;
+            }
+
+            sdcard::endIndex();
+        }
+
+        // A header that doesn't match until finish() writes the real one
+        uint8_t header[INDEX_SIZE] = { 0 };
+
+        if (!sdcard::beginIndex(name, true)) return 0;
+
+        index.lines    = 0;
+        index.staged   = 0;
+        index.open     = true;
+        index.building = true;
+
+        if (sdcard::writeIndex(header, INDEX_SIZE) != INDEX_SIZE) close();
+
+        return 0;
+    }
+
+    void add(uint32_t line, uint32_t pos, uint8_t block) {
+        if (!index.building || (line != index.lines)) return;
+
+        // Too far into the file for an entry
+        if (pos > INDEX_POS_MASK) {
+            close();
+            return;
+        }
+
+        if ((index.staged == INDEX_STAGE) && !flush()) return;
+
+        index.stage[index.staged++] = pos | ((uint32_t)block << INDEX_POS_BITS);
+        ++index.lines;
+    }
+
+    uint32_t finish(uint32_t lines) {
+        if (!index.building) return 0;
+
+        if ((lines != index.lines) || !flush()) {
+            close();
+            return 0;
+        }
+
+        uint8_t header[INDEX_SIZE];
+
+        memcpy(header, magic, 4);
+        put32(header + 4, index.size);
+        put32(header + 8, index.mtime);
+        put32(header + 12, index.lines);
+
+        if (!sdcard::seekIndex(0) || (sdcard::writeIndex(header, INDEX_SIZE) != INDEX_SIZE)) {
+            close();
+            return 0;
+        }
+
+        index.building = false;
+
+        debugs("Indexed lines ");
+        debugln(index.lines);
+
+        return index.lines;
+    }
+
+    bool find(uint32_t line, uint32_t* pos) {
+        if (!index.open || (line >= index.lines)) return false;
+
+        uint32_t entry;
+        uint32_t written = index.lines - index.staged;
+
+        if (line >= written) {
+            entry = index.stage[line - written];
+        } else if (!sdcard::seekIndex(INDEX_SIZE + line * 4) ||
+                   (sdcard::readIndex((uint8_t*)&entry, 4) != 4)) {
+            return false;
+        }
+
+        *pos = entry & INDEX_POS_MASK;
+        return true;
+    }
+
+    void close() {
+        if (index.open) {
+            sdcard::endIndex();
+            index.open     = false;
+            index.building = false;
+            index.lines    = 0;
+            index.staged   = 0;
+        }
+    }
+
+    void remove(const char* f) {
+        char name[MAX_NAME + 5];
+
+        if (index_name(f, name)) sdcard::removeFile(name);
+    }
+}
+
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+#include "../../include/config.h"
+
+// Blocks a line starts or ends, kept with the line in the index, see script_index::add()
+#define INDEX_LOOP_BEGIN    0x01
+#define INDEX_LOOP_END      0x02
+#define INDEX_LSTRING_BEGIN 0x04
+#define INDEX_LSTRING_END   0x08
+
+#if defined(USE_SD_CARD) && defined(USE_SCRIPT_INDEX)
+
+namespace script_index {
+
+    /**
+     * @brief Opens the index of the script open for reading
+     *
+     * If there is none, or it was made for another size or modification
+     * time of the script, a new one is started that add() fills as the
+     * script runs, and this returns 0.
+     *
+     * @param f    Path of the script, open with sdcard::beginFileRead()
+     * @param size Size of the script in bytes
+     * @return Lines of the script, 0 if they aren't known yet
+     */
+    uint32_t open(const char* f, uint32_t size);
+
+    /**
+     * @brief Adds a line script_runner read to a new index
+     *
+     * Lines the index already has are ignored, so a jump back doesn't
+     * add them again.
+     *
+     * @param line  Lines before this one
+     * @param pos   File position where it starts
+     * @param block INDEX_* flags of the blocks it starts or ends
+     */
+    void add(uint32_t line, uint32_t pos, uint8_t block);
+
+    /**
+     * @brief Completes a new index once script_runner read the end of the script
+     *
+     * @param lines Lines of the script
+     * @return lines if the index has every one of them, 0 otherwise
+     */
+    uint32_t finish(uint32_t lines);
+
+    /**
+     * @brief Looks up where a line starts
+     *
+     * @param line Lines before it
+     * @param pos  Set to its file position if the index has the line
+     * @return false if the index doesn't have it (yet)
+     */
+    bool find(uint32_t line, uint32_t* pos);
+
+    /**
+     * @brief Closes the index, one that isn't complete is built again next time
+     */
+    void close();
+
+    /**
+     * @brief Deletes the index of a script
+     *
+     * Called before the script is written or deleted, so a script that
+     * changes without a new modification time doesn't keep an old index.
+     * Needs the card idle, like sdcard::removeFile().
+     *
+     * @param f Path of the script
+     */
+    void remove(const char* f);
+}
+
+#endif
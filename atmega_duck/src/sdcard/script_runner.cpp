@@ -10,6 +10,7 @@
 #include "../duckparser/duckparser.h"
 #include "../led/led.h"
 #include "sdcard.h"
+#include "script_index.h"
 #include "script_runner.h"
 #include <Arduino.h>
 
@@ -37,6 +38,12 @@ namespace script_runner {
         uint32_t last_pos;      // Starting position of the last valid command line
         uint32_t after_repeat;  // Position immediately after a REPEAT command
         uint32_t cur_pos;       // Cursor position at the start of current read
+        uint32_t line;          // Lines read before the position get_line() reads next
+        uint32_t loop_line;     // line at loop_pos
+        uint32_t last_line;     // line at last_pos
+        uint32_t after_line;    // line at after_repeat
+        uint32_t cur_line;      // line at cur_pos
+        uint32_t lines;         // Lines of the script from its index, 0 until it has one
         uint8_t  flags;         // State flags (running, in loop, in string block, etc.)
         uint8_t repeat_count;   // Number of repetitions remaining for current command
     } state;
@@ -77,6 +84,158 @@ namespace script_runner {
     #define SET_FLAG(f)           (state.flags |= (f))
     #define CLR_FLAG(f)           (state.flags &= ~(f))
 
+    /** Jumps back to loop_pos and last_pos, see jump_back() */
+    static cache_stats_t stats = { 0, 0 };
+
+#if SCRIPT_CACHE_SIZE > 0
+    // Header of a record in the cache: file position (4 bytes), length, flags
+    #define RECORD_HEADER  6
+    #define RECORD_IN_LINE 0x01 // !< The line goes on in the next record
+    #define RECORD_EOF     0x02 // !< The file ended in this record
+
+    /**
+     * @brief The lines get_line() read last, so LOOP_END and REPEAT don't read them again
+     *
+     * Records of what get_line() made of the file from start on, one after
+     * the other: where it started reading, the bytes it read and what it
+     * did to the flags. get_line() always reads the same from the same
+     * position, so a jump to the start of a record can take the records
+     * from there on instead of the card.
+     *
+     * Outside a loop the records start at last_pos, the line a REPEAT
+     * repeats. At LOOP_BEGIN they start over at loop_pos and keep the
+     * body until the loop is done. Lines that don't fit are not kept, jumps
+     * to them seek and read the card as before.
+     */
+    static struct {
+        uint8_t  data[SCRIPT_CACHE_SIZE];
+        uint16_t used;      // Bytes of records in data
+        uint16_t next;      // Record get_line() takes next while replaying
+        uint32_t end;       // File position after the last record
+        bool     replaying; // get_line() takes the records from next on
+        bool     full;      // A line didn't fit, no more records until it starts over
+        bool     loop;      // Holds a loop body, last_pos doesn't move it
+    } cache;
+
+    /**
+     * @brief File position of the record at off
+     */
+    uint32_t record_pos(uint16_t off) {
+        uint32_t pos;
+
+        memcpy(&pos, cache.data + off, 4);
+        return pos;
+    }
+
+    /**
+     * @brief Offset of the record that starts at file position pos, or -1 if there is none
+     */
+    int16_t cache_find(uint32_t pos) {
+        for (uint16_t off = 0; off < cache.used; off += RECORD_HEADER + cache.data[off + 4]) {
+            if (record_pos(off) == pos) return off;
+        }
+
+        return -1;
+    }
+#endif // SCRIPT_CACHE_SIZE > 0
+
+    /**
+     * @brief Where in the file the next get_line() reads, like sdcard::tell()
+     */
+    uint32_t position() {
+#if SCRIPT_CACHE_SIZE > 0
+        if (cache.replaying) return cache.next < cache.used ? record_pos(cache.next) : cache.end;
+#endif // SCRIPT_CACHE_SIZE > 0
+
+        return sdcard::tell();
+    }
+
+    /**
+     * @brief Drops every record, new ones start at file position pos
+     *
+     * Only called while get_line() reads the card, or before it does.
+     */
+    void cache_clear(uint32_t pos) {
+#if SCRIPT_CACHE_SIZE > 0
+        cache.used      = 0;
+        cache.next      = 0;
+        cache.end       = pos;
+        cache.replaying = false;
+        cache.full      = false;
+        cache.loop      = false;
+#endif // SCRIPT_CACHE_SIZE > 0
+    }
+
+    /**
+     * @brief Drops the records before file position pos, the start of a line REPEAT may repeat
+     *
+     * A loop body stays until the loop is done.
+     */
+    void cache_keep(uint32_t pos) {
+#if SCRIPT_CACHE_SIZE > 0
+        if (cache.loop) return;
+
+        int16_t off = cache_find(pos);
+
+        if (off < 0) {
+            cache_clear(pos);
+        } else if (off > 0) {
+            memmove(cache.data, cache.data + off, cache.used - off);
+            cache.used -= off;
+            cache.next  = cache.next > (uint16_t)off ? cache.next - off : 0;
+        }
+#endif // SCRIPT_CACHE_SIZE > 0
+    }
+
+    /**
+     * @brief Keeps the records from cache_keep() while a loop body is in the cache
+     */
+    void cache_lock(bool loop) {
+#if SCRIPT_CACHE_SIZE > 0
+        cache.loop = loop;
+#endif // SCRIPT_CACHE_SIZE > 0
+    }
+
+    /**
+     * @brief Continues reading at file position pos, from the cache if a record starts there
+     *
+     * Otherwise the card seeks to where the index has the line start,
+     * pos is only taken for lines the index doesn't have yet.
+     *
+     * @param line Lines before pos, state.line from when get_line() was there
+     * @return true if the cache has it
+     */
+    bool jump(uint32_t pos, uint32_t line) {
+        state.line = line;
+
+#if SCRIPT_CACHE_SIZE > 0
+        int16_t off = cache_find(pos);
+
+        if (off >= 0) {
+            cache.next      = off;
+            cache.replaying = true;
+            return true;
+        }
+
+        cache.replaying = false;
+#endif // SCRIPT_CACHE_SIZE > 0
+
+#ifdef USE_SCRIPT_INDEX
+        script_index::find(line, &pos);
+#endif
+
+        sdcard::seek(pos);
+        return false;
+    }
+
+    /**
+     * @brief jump() for LOOP_END and REPEAT, counted in stats
+     */
+    void jump_back(uint32_t pos, uint32_t line) {
+        if (jump(pos, line)) ++stats.hits;
+        else ++stats.misses;
+    }
+
     /**
      * @brief Initializes the script runner and begins reading from the SD card
      * 
@@ -89,8 +248,10 @@ namespace script_runner {
      * @return true if file was successfully opened, false otherwise
      */
     bool start(const char* filename, uint8_t* buff) {
+        uint32_t size = 0;
+
         // Attempt to open the file for reading
-        if (!sdcard::beginFileRead(filename, nullptr)) return false;
+        if (!sdcard::beginFileRead(filename, &size)) return false;
         if (!buff) return false;
 
         // Store buffer pointer for later use
@@ -102,8 +263,21 @@ namespace script_runner {
         state.after_repeat = 0;
         state.last_pos     = 0;
         state.loop_pos     = 0;
+        state.line         = 0;
+        state.loop_line    = 0;
+        state.last_line    = 0;
+        state.after_line   = 0;
+        state.cur_line     = 0;
+        state.lines        = 0;
         read               = 0;
 
+#ifdef USE_SCRIPT_INDEX
+        // The number of lines for getProgress(), 0 until the first run read them all
+        state.lines        = script_index::open(filename, size);
+#endif
+
+        cache_clear(0);
+
         // Update SD card status
         sdcard::setStatus(sdcard::SDStatus::SD_EXECUTING);
 
@@ -128,12 +302,87 @@ namespace script_runner {
         // Close the file
         sdcard::endFileRead();
 
+#ifdef USE_SCRIPT_INDEX
+        script_index::close();
+#endif
+
+        debugs("Cache hits ");
+        debug(stats.hits);
+        debugs(", misses ");
+        debugln(stats.misses);
+
         // Update SD card status back to idle
         sdcard::setStatus(sdcard::SDStatus::SD_IDLE);
 
         led::left(false);
     }
 
+    /**
+     * @brief Adds what get_line() just read from file position pos to the cache
+     *
+     * Only if it continues the records, a line that doesn't fit stops them
+     * until they start over.
+     */
+    void cache_add(uint32_t pos, bool eof) {
+#if SCRIPT_CACHE_SIZE > 0
+        if (cache.full || (pos != cache.end)) return;
+
+        // Nothing but the end of the file, reading it again costs nothing
+        if (sdcard::tell() == pos) return;
+
+        if (cache.used + RECORD_HEADER + read > SCRIPT_CACHE_SIZE) {
+            cache.full = true;
+            return;
+        }
+
+        uint8_t* r = cache.data + cache.used;
+
+        memcpy(r, &pos, 4);
+        r[4] = read;
+        r[5] = (IS_IN_LINE ? RECORD_IN_LINE : 0) | (eof ? RECORD_EOF : 0);
+        memcpy(r + RECORD_HEADER, buffer, read);
+
+        cache.used += RECORD_HEADER + read;
+        cache.end   = sdcard::tell();
+#endif // SCRIPT_CACHE_SIZE > 0
+    }
+
+    /**
+     * @brief Takes the next record instead of reading the card, like get_line() would
+     *
+     * @return false if get_line() has to read the card
+     */
+    bool cache_next() {
+#if SCRIPT_CACHE_SIZE > 0
+        if (!cache.replaying) return false;
+
+        if (cache.next >= cache.used) {
+            // The card goes on after the last record
+            cache.replaying = false;
+
+            if (sdcard::tell() != cache.end) sdcard::seek(cache.end);
+
+            return false;
+        }
+
+        const uint8_t* r = cache.data + cache.next;
+
+        read = r[4];
+        memcpy(buffer, r + RECORD_HEADER, read);
+
+        if (r[5] & RECORD_IN_LINE) SET_FLAG(FLAG_IN_LINE);
+        else CLR_FLAG(FLAG_IN_LINE);
+
+        if (r[5] & RECORD_EOF) CLR_FLAG(FLAG_RUNNING);
+
+        cache.next += RECORD_HEADER + read;
+
+        return true;
+#else // SCRIPT_CACHE_SIZE > 0
+        return false;
+#endif // SCRIPT_CACHE_SIZE > 0
+    }
+
     /**
      * @brief Reads a single line from the SD card into the buffer
      * 
@@ -145,8 +394,20 @@ namespace script_runner {
      * The function sets FLAG_IN_LINE if the line exceeds BUFFER_SIZE and needs
      * to be read in multiple chunks. It normalizes line endings by converting
      * carriage returns (\r) to newlines (\n) and skips redundant newlines.
+     *
+     * After a jump() into the cache the lines come from there, until the
+     * records run out and the card goes on after them. What is read from
+     * the card is added to the cache, see cache_add().
      */
     void get_line() {
+        if (cache_next()) {
+            if (!IS_IN_LINE) ++state.line;
+            return;
+        }
+
+        uint32_t pos = sdcard::tell();
+        bool     eof = false;
+
         uint8_t c;
         uint8_t need = 1; // Number of bytes needed for current character
         read = 0;
@@ -176,6 +437,7 @@ namespace script_runner {
             for (uint8_t i = 0; i < need; i++) {
                 // Try to read one byte
                 if (sdcard::readFileChunk(&c, 1) <= 0) {
+                    eof = true;
                     CLR_FLAG(FLAG_RUNNING | FLAG_IN_LINE);
                     SET_FLAG(FLAG_STOP_READING);
                     buffer[read++] = '\n'; // Add newline to properly end last line
@@ -206,6 +468,11 @@ namespace script_runner {
             SET_FLAG(FLAG_IN_LINE);
             
         }
+
+        // A line ended, unless all there was is the newline added at the end
+        if (!IS_IN_LINE && (sdcard::tell() != pos)) ++state.line;
+
+        cache_add(pos, eof);
     }
 
     /**
@@ -224,17 +491,23 @@ namespace script_runner {
      * 
      * It also helps to work with REPEAT, allowing you to repeat an LSTRING 
      * the specified number of times.
+     *
+     * @return INDEX_LSTRING_BEGIN or INDEX_LSTRING_END if the line is one, 0 otherwise
      */
-    void check_lstring_block() { 
+    uint8_t check_lstring_block() { 
         // Check for LSTRING_BEGIN (13 characters)
         if (read >= 13 && !IS_IN_LSTRING_BLOCK &&  memcmp((char*)buffer, "LSTRING_BEGIN", 13) == 0) {
             SET_FLAG(FLAG_IN_LSTRING_BLOCK);
+            return INDEX_LSTRING_BEGIN;
         }
         
         // Check for LSTRING_END (11 characters)
         else if (read >= 11 && IS_IN_LSTRING_BLOCK && memcmp((char*)buffer, "LSTRING_END", 11) == 0) {
             CLR_FLAG(FLAG_IN_LSTRING_BLOCK);
+            return INDEX_LSTRING_END;
         }
+
+        return 0;
     }
 
     /**
@@ -251,33 +524,67 @@ namespace script_runner {
      * 
      * This function:
      * - On LOOP_BEGIN: Records the file position and checks for infinite loops
-     * - On LOOP_END: Seeks back to loop start if iterations remain
+     * - On LOOP_END: Goes back to loop start if iterations remain, the
+     *   body runs from the cache if it fit
      * 
      * The loop counter is managed by duckparser, which decrements it each iteration.
      * 
      * It does not allow repetition like in LSTRING
      * It does not support nested loops
+     *
+     * @return INDEX_LOOP_BEGIN or INDEX_LOOP_END if the line is one, 0 otherwise
      */
-    void check_loop_block() { 
+    uint8_t check_loop_block() { 
         // Check for LOOP_BEGIN (10 characters)
         if (read >= 10 && !IS_IN_LSTRING_BLOCK && !IS_IN_LOOP_BLOCK &&  memcmp((char*)buffer, "LOOP_BEGIN", 10) == 0) {
             SET_FLAG(FLAG_IN_LOOP_BLOCK);
             
             // Save current file position (right after LOOP_BEGIN line)
-            state.loop_pos = sdcard::tell();
+            state.loop_pos  = position();
+            state.loop_line = state.line;
+
+            // The cache keeps the body from here on until the loop is done
+            cache_clear(state.loop_pos);
+            cache_lock(true);
 
             // Check if this is an infinite loop
             if (duckparser::getLoops() <= 0) SET_FLAG(FLAG_IN_LOOP_INFINITE);
+
+            return INDEX_LOOP_BEGIN;
         }
 
         // Check for LOOP_END (8 characters)
         else if (read >= 8 && !IS_IN_LSTRING_BLOCK && IS_IN_LOOP_BLOCK && memcmp((char*)buffer, "LOOP_END", 8) == 0) {
             // If loop counter reached 0 and it's not infinite, exit the loop
-            if (duckparser::getLoops() == 0 && !IS_IN_LOOP_INFINITE) CLR_FLAG(FLAG_IN_LOOP_BLOCK);
+            if (duckparser::getLoops() == 0 && !IS_IN_LOOP_INFINITE) {
+                CLR_FLAG(FLAG_IN_LOOP_BLOCK);
+                cache_lock(false);
+            }
+
+            // Otherwise, go back to loop start to repeat, from RAM if the body fit
+            else jump_back(state.loop_pos, state.loop_line);
 
-            // Otherwise, seek back to loop start to repeat
-            else sdcard::seek(state.loop_pos);
+            return INDEX_LOOP_END;
         }
+
+        return 0;
+    }
+
+    /**
+     * @brief Adds the line that started at cur_pos to the index, if it ended
+     *
+     * Once the end of the script was read the index is complete, and
+     * getProgress() has the number of lines.
+     *
+     * @param line  state.line after the line was read, before a jump
+     * @param block INDEX_* flags of the line
+     */
+    void index_line(uint32_t line, uint8_t block) {
+#ifdef USE_SCRIPT_INDEX
+        if (line > state.cur_line) script_index::add(state.cur_line, state.cur_pos, block);
+
+        if (!IS_RUNNING && (state.lines == 0)) state.lines = script_index::finish(line);
+#endif
     }
 
     /**
@@ -291,13 +598,13 @@ namespace script_runner {
      * 
      * 1. REPEAT handling:
      *    When a REPEAT command is executed, repeat_count is set to N.
-     *    For each repetition, we seek back to last_pos and re-read/re-execute
-     *    the previous command. This avoids storing commands in RAM.
+     *    For each repetition, we go back to last_pos and re-read/re-execute
+     *    the previous command, from the cache if it fit into SCRIPT_CACHE_SIZE
+     *    and from the card otherwise.
      * 
      * 2. Normal line execution:
      *    - Read a new line from SD card
      *    - Parse and execute it via duckparser
-     *    - Wait for any delays to complete
      *    - Check if this command should be repeated
      * 
      * 3. Fragment handling:
@@ -308,10 +615,19 @@ namespace script_runner {
      *    - last_pos: Updated when a complete, non-REPEAT command finishes
      *    - after_repeat: Set to position after REPEAT for resuming execution
      *    - loop_pos: Set at LOOP_BEGIN for jumping back on LOOP_END
+     *    With an index the card seeks to where it has the line instead,
+     *    the positions are for lines it doesn't have yet, see jump().
+     * 
+     * 5. Delays:
+     *    DELAY and the default delay don't block. While one is running the
+     *    call returns true at once, so loop() keeps servicing com.
      * 
      * @return true if execution should continue, false if script finished or stopped
      */
     bool execute_next_line() {
+        // A DELAY is running, come back on the next pass of loop()
+        if (duckparser::getDelayTime() != 0) return true;
+
         // Exit if not running and no pending work
         if (!IS_RUNNING && !IS_IN_LOOP_BLOCK && state.repeat_count == 0) return false;
 
@@ -320,7 +636,7 @@ namespace script_runner {
         if (state.repeat_count > 0) {
             // We search again for the last valid command position 
             // (unless we are in the middle of the line and are inside an LSTRING)
-            if (!IS_IN_LINE && !IS_IN_LSTRING_BLOCK) sdcard::seek(state.last_pos);
+            if (!IS_IN_LINE && !IS_IN_LSTRING_BLOCK) jump_back(state.last_pos, state.last_line);
             
             // Read the line again
             get_line();
@@ -343,7 +659,7 @@ namespace script_runner {
 
             // WHere it checks if the repetitions have finished; if so, 
             // it skips the REPEAT command, going to the position after the REPEAT.
-            if (state.repeat_count == 0) sdcard::seek(state.after_repeat);
+            if (state.repeat_count == 0) jump(state.after_repeat, state.after_line);
             
             return true;
         }
@@ -352,7 +668,10 @@ namespace script_runner {
         
         // Save current file position before reading
         // (This will become last_pos after the line is fully processed)       
-        if (!IS_IN_LINE) state.cur_pos = sdcard::tell();
+        if (!IS_IN_LINE) {
+            state.cur_pos  = position();
+            state.cur_line = state.line;
+        }
 
         // Read next line from file
         get_line();
@@ -364,12 +683,9 @@ namespace script_runner {
         }
 
         // Parse and execute the line
+        // A delay it starts is waited for at the top of the next call
         duckparser::parse(buffer, read);
 
-        // Wait for any delays to complete before continuing
-        // This ensures proper timing between commands
-        while (duckparser::getDelayTime() != 0) delay(5);
-
         // Check if the last valid command before REPEAT should be repeated
         // The parser sets the number of repetitions when it encounters a REPEAT command
         state.repeat_count = (uint8_t)(duckparser::getRepeats() > 255 ? 255 : duckparser::getRepeats());
@@ -377,11 +693,14 @@ namespace script_runner {
         // If we need to repeat this command
         if (state.repeat_count > 0) {
             // Save position after REPEAT for later resumption
-            state.after_repeat = sdcard::tell();
+            state.after_repeat = position();
+            state.after_line   = state.line;
 
             // Clear the IN_LINE flag to force a fresh read on next iteration
             CLR_FLAG(FLAG_IN_LINE);
 
+            index_line(state.line, 0);
+
             return true;
         } 
 
@@ -396,19 +715,51 @@ namespace script_runner {
         // Update last_pos to point to this command for potential REPEAT
         // Exception: Don't update if we're inside an LSTRING block, because
         // LSTRING content is not a command and shouldn't be repeated
-        if (!IS_IN_LSTRING_BLOCK) state.last_pos = state.cur_pos;
+        if (!IS_IN_LSTRING_BLOCK) {
+            state.last_pos  = state.cur_pos;
+            state.last_line = state.cur_line;
+
+            // The cache only needs the line a REPEAT would repeat from here on
+            cache_keep(state.last_pos);
+        }
         
+        // LOOP_END may jump back, the line it ended on goes to the index
+        uint32_t line = state.line;
+
         // Check if this line starts or ends an LSTRING block
-        check_lstring_block();
+        uint8_t block = check_lstring_block();
 
         // Check if this line starts or ends a LOOP block
-        check_loop_block();
+        block |= check_loop_block();
+
+        index_line(line, block);
 
         return true;
 
     }
 
+    /**
+     * @brief How far the script got, by the lines read before the next one
+     *
+     * A LOOP or REPEAT that goes back takes it back too.
+     *
+     * @return Percent of the lines, 255 if no script runs or it has no index
+     */
+    uint8_t getProgress() {
+        if ((sdcard::getStatus() != sdcard::SD_EXECUTING) || (state.lines == 0)) return 255;
+        if (state.line >= state.lines) return 100;
+
+        return (uint8_t)(state.line * 100 / state.lines);
+    }
 
+    const cache_stats_t& getStats() {
+        return stats;
+    }
+
+    void resetStats() {
+        stats.hits   = 0;
+        stats.misses = 0;
+    }
 }
 
 #endif
\ No newline at end of file
@@ -5,6 +5,14 @@
 
 #ifdef USE_SD_CARD
 
+/*! \typedef cache_stats_t
+ *  \brief How often LOOP_END and REPEAT found the lines they go back to in RAM
+ */
+typedef struct cache_stats_t {
+    unsigned long hits;   // !< Jumps back that ran the lines from RAM
+    unsigned long misses; // !< Jumps back that had to seek and read the card again
+} cache_stats_t;
+
 namespace script_runner {
 
     /**
@@ -37,11 +45,22 @@ namespace script_runner {
      *  - Parsing and executing it
      *  - Handling REPEAT, LOOP, and LSTRING control flow
      *
+     * Returns at once while a DELAY is running, without blocking.
+     *
      * It must be called repeatedly (e.g. in loop()) until it returns false.
      *
      * @return true if execution should continue, false if the script has finished
      */
     bool execute_next_line();
+
+    /*! Returns the percent of the script's lines read so far, 255 if it has no index, see USE_SCRIPT_INDEX */
+    uint8_t getProgress();
+
+    /*! Returns how often jumps back found their lines in RAM, see SCRIPT_CACHE_SIZE */
+    const cache_stats_t& getStats();
+
+    /*! Starts the counters over */
+    void resetStats();
 }
 
 #endif
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "sd_handler.h"
 #include "sdcard.h"
+#include "script_index.h"
 #include "script_runner.h"
 
 #include <Mouse.h>
@@ -13,13 +14,14 @@
 #ifdef USE_SD_CARD
 
 /**
- * @brief Shorthand for com::getRawBuffer()
+ * @brief Scratch space of the SD card path
  *
- * Returns a writable pointer to com's internal data buffer. Used by sd_handler
- * as scratch space for building outgoing packets (file lists, read chunks) and
- * as the working buffer for script_runner.
+ * Outgoing packets (file lists, read chunks) are built here, and script_runner
+ * reads the lines of a script into it. Packets keep arriving in com's receive
+ * buffer meanwhile, acks for chunks still on their way among them, so this
+ * can't be a part of it.
  */
-#define _gb (com::getRawBuffer())
+static uint8_t sd_buf[BUFFER_SIZE + 1];
 
 /**
  * @brief Local copy of the SD card status, captured at the start of process()
@@ -31,113 +33,248 @@
 static sdcard::SDStatus sdcard_status;
 
 /**
- * @brief Single-byte acknowledgment value sent back after WRITE chunks
+ * @brief Acknowledgment sent back after WRITE packets, SD_ACK and the packet's sequence number
  *
- * After sd_handler writes a chunk to the SD card, it sends this byte back to
+ * After sd_handler writes a chunk to the SD card, it sends this back to
  * signal the receiving device that it is ready for the next chunk.
  */
-static uint8_t sd_ack_val = SD_ACK;
+static uint8_t write_ack[2] = { SD_ACK, 0 };
+
+/**
+ * @brief Sequence number of the last SD_CMD_WRITE packet processed
+ *
+ * The receiving device numbers the packets of a write, 0 is the one that
+ * opens the file, the chunks count from 1 to 255 and on with 1. A packet
+ * it sends again because the SD_ACK got lost has the number of the last
+ * one, it is acknowledged again but not written twice.
+ */
+static uint8_t write_seq = 0;
+
+/**
+ * @brief File data per SD_CMD_READ chunk, after its sequence number
+ *
+ * A chunk keeps BUFFER_SIZE - 12 bytes as before, the sequence number is one
+ * of them. Only the last chunk of a file is shorter, so chunk n starts at
+ * n * READ_CHUNK.
+ */
+#define READ_CHUNK (BUFFER_SIZE - 13)
+
+/**
+ * @brief Bytes of directory entries per SD_CMD_LS packet, after its sequence number
+ *
+ * Same size as READ_CHUNK.
+ */
+#define LIST_PACKET (BUFFER_SIZE - 13)
+
+/**
+ * @brief The SD_CMD_LS packet on its way
+ *
+ * list_seq is its sequence number, list_pos the position in the directory
+ * its first entry was read from, so it can be built again if it got lost.
+ * list_end is set if it holds the end of the directory.
+ */
+static uint8_t  list_seq = 0;
+static uint32_t list_pos = 0;
+static bool     list_end = false;
+
+/**
+ * @brief Window of the current SD_CMD_READ and the chunks sent and acknowledged
+ *
+ * read_seq is the sequence number of the next chunk, read_acked the one of
+ * the oldest chunk the receiving device hasn't acknowledged yet and
+ * read_base where that chunk starts in the file. Between them are the
+ * chunks on their way. read_end is set once the chunk that ends the file
+ * is among them, read_size is the size of the file.
+ */
+static uint8_t  read_window = 1;
+static uint8_t  read_seq    = 0;
+static uint8_t  read_acked  = 0;
+static uint32_t read_base   = 0;
+static uint32_t read_size   = 0;
+static bool     read_end    = false;
 
 namespace sd_handler {
 
+    /**
+     * @brief Aborts any ongoing SD card operation (list, read, write)
+     *
+     * Called when the receiving device sends SD_CMD_STOP, or when the main loop
+     * needs to forcibly halt an operation (e.g., because a new command arrived).
+     * Calls the appropriate end function based on the current status.
+     */
+    inline void stop() {
+        if (sdcard_status == sdcard::SD_READING) sdcard::endFileRead();
+        else if (sdcard_status == sdcard::SD_WRITING) sdcard::endFileWrite();
+        else if (sdcard_status == sdcard::SD_LISTING) sdcard::endList();
+    }
+
      /**
      * @brief Streams directory contents to the receiving device chunk by chunk
      *
      * Called once initially with a directory path, then repeatedly with a null
-     * path (via ack_received) to send subsequent entries. Each entry is packed as:
+     * path (via ack_received) to send the next packet, or the same one again.
+     * Each packet is its sequence number followed by as many entries as fit
+     * into LIST_PACKET bytes, each packed as:
      *   [4 bytes: file size, little-endian]
      *   [N bytes: filename, null-terminated]
      *
-     * When no more entries exist, endList() is called and the operation finishes.
+     * An entry with an empty name marks the end of the directory. The
+     * directory stays open until the packet holding it was acknowledged.
      *
      * @param path Directory path to list, or null to continue the current listing
      */
     void streamList(const char* path) {
         // If we are not already listing, start a new listing operation
-        if (sdcard_status == sdcard::SD_IDLE || sdcard_status == sdcard::SD_ERROR) 
+        if (sdcard_status == sdcard::SD_IDLE || sdcard_status == sdcard::SD_ERROR) {
             if (!sdcard::beginList(path[0] ? path : "/")) return;
+
+            list_seq = 0;
+        }
         
         // Verify we are actually in listing mode (beginList succeeded)
         if (sdcard::getStatus() != sdcard::SD_LISTING) return;
 
+        char     name[MAX_NAME + 1];
         uint32_t size;
+        uint8_t  len = 1;
+        bool     end = false;
 
-        // Try to get the next file in the directory
-        if (sdcard::getNextFile((char*)&_gb[4], BUFFER_SIZE - 5, &size)) {
-            // Pack the size as a little-endian 32-bit value at the start
-            _gb[0] = size; 
-            _gb[1] = size >> 8; 
-            _gb[2] = size >> 16; 
-            _gb[3] = size >> 24;
+        list_pos  = sdcard::tellList();
+        sd_buf[0] = list_seq;
 
-            // Ensure the filename is null-terminated (it should be already, but be safe)
-            _gb[BUFFER_SIZE - 1] = '\0';
+        while (true) {
+            end = !sdcard::getNextFile(name, sizeof(name), &size);
 
-            // Calculate the total packet length: 4 bytes size + filename length
-            uint8_t nameLen = strlen((char*)&_gb[4]);
-            
-            // Send this entry to the receiving device
-            com::sendSdData(_gb, nameLen + 4);
-            return;
+            // The end marker is an empty name
+            if (end) {
+                name[0] = '\0';
+                size    = 0;
+            }
+
+            uint8_t nameLen = strlen(name);
+
+            // Entry doesn't fit anymore, it goes first into the next packet
+            if (len + 4 + nameLen + 1 > LIST_PACKET + 1) {
+                if (!end) sdcard::ungetFile();
+                end = false;
+                break;
+            }
+
+            // Pack the size as a little-endian 32-bit value before the name
+            sd_buf[len++] = size;
+            sd_buf[len++] = size >> 8;
+            sd_buf[len++] = size >> 16;
+            sd_buf[len++] = size >> 24;
+
+            memcpy(&sd_buf[len], name, nameLen + 1);
+            len += nameLen + 1;
+
+            if (end) break;
         }
 
-        sdcard::endList();
+        list_end = end;
+        com::sendSdData(sd_buf, len);
     }
 
     /**
      * @brief Streams file contents to the receiving device chunk by chunk
      *
      * Called once initially with a file path, then repeatedly with a null path
-     * (via ack_received) to send subsequent chunks. Each chunk is raw file data,
-     * up to BUFFER_SIZE - 12 bytes (the -12 is headroom for framing overhead in
-     * com.cpp's SD_SOT/SD_EOT wrappers).
+     * (via ack_received) whenever chunks were acknowledged. Chunks are sent
+     * until window of them are unacknowledged. Each one is its sequence
+     * number followed by up to READ_CHUNK bytes of file data, a chunk with
+     * only the sequence number ends the file.
      *
-     * When EOF is reached, endFileRead() is called and the operation finishes.
+     * Once that chunk was acknowledged too, endFileRead() is called and the
+     * operation finishes. Until then a lost chunk can still be sent again.
+     * A file that can't be read any further ends the operation with SD_ERROR.
      *
-     * @param file File path to read, or null to continue reading the current file
+     * @param file   File path to read, or null to continue reading the current file
+     * @param window Chunks to send ahead, only used when file is opened
      */
-    void streamRead(const char* file) {
+    void streamRead(const char* file, uint8_t window) {
         // If we are not already reading, open the file
         if (sdcard_status == sdcard::SD_IDLE || sdcard_status == sdcard::SD_ERROR) {
-            if (!sdcard::beginFileRead(file, nullptr)) return;
+            if (!sdcard::beginFileRead(file, &read_size)) return;
+
+            read_window = window ? window : 1;
+            read_seq    = 0;
+            read_acked  = 0;
+            read_base   = 0;
+            read_end    = false;
         }
 
         // Verify we are actually in reading mode (beginFileRead succeeded)
         if (sdcard::getStatus() != sdcard::SD_READING) return;
 
-        int16_t read;
-
-        // Try to read a chunk. The -12 headroom ensures com::sendSdData() has
-        // room to add SD_SOT and SD_EOT framing bytes without overflow.
-        if ((read = sdcard::readFileChunk(_gb, BUFFER_SIZE - 12)) > 0) {
-            com::sendSdData(_gb, read);
+        // Every chunk arrived, the one ending the file too
+        if (read_end && (read_seq == read_acked)) {
+            sdcard::endFileRead();
             return;
         }
 
-        // EOF or error — close the file
-        sdcard::endFileRead();
+        while (!read_end && ((uint8_t)(read_seq - read_acked) < read_window)) {
+            int16_t read = sdcard::readFileChunk(&sd_buf[1], READ_CHUNK);
+
+            if (read < 0) {
+                sdcard::endFileRead();
+                sdcard::setStatus(sdcard::SD_ERROR);
+                return;
+            }
+
+            // EOF — the empty chunk goes out like any other
+            read_end  = (read == 0);
+            sd_buf[0] = read_seq++;
+            com::sendSdData(sd_buf, read + 1);
+        }
     }
 
     /**
      * @brief Receives file data from the receiving device and writes it to SD
      *
-     * The first packet contains:
-     *   byte 0: append flag (0 = overwrite, 1 = append)
-     *   byte 1+: filename (null-terminated)
+     * Every packet starts with its sequence number, see write_seq. The first
+     * packet contains:
+     *   byte 1: append flag (0 = overwrite, 1 = append)
+     *   byte 2+: filename (null-terminated)
      *
      * This opens the file. Subsequent packets contain raw file data. When the
      * receiving device is done it sends a zero-length chunk, which triggers
-     * endFileWrite().
+     * endFileWrite(). A chunk that can't be written ends the write with
+     * SD_ERROR.
      *
-     * After each chunk is written, SD_ACK is sent back to signal readiness for
-     * the next one.
+     * Once the file is open and after each chunk is written, SD_ACK is sent
+     * back. It is the receiving device's credit for the next chunk: com's
+     * receive buffer holds one, so it must not send another before.
      *
-     * @param data Packet data (either [append][filename] or raw file bytes)
+     * @param data Packet data (either [seq][append][filename] or [seq][raw file bytes])
      * @param len  Number of bytes in the packet
      */
     void streamWrite(uint8_t* data, size_t len) {
+        if (len == 0) return;
+
+        uint8_t seq = data[0];
+
+        // Written already, the SD_ACK for it got lost
+        if ((sdcard_status == sdcard::SD_WRITING) && (seq == write_seq)) {
+            write_ack[1] = seq;
+            com::sendSdData(write_ack, sizeof(write_ack));
+            return;
+        }
+
+        // A new file while the last one is still open, its SD_CMD_STOP got lost
+        if (seq == 0) {
+            stop();
+            sdcard_status = sdcard::getStatus();
+        }
+
+        ++data;
+        --len;
+
         // Opening a new file for writing
         if (sdcard_status == sdcard::SD_IDLE || sdcard_status == sdcard::SD_ERROR) {
+            // A chunk of a write that ended
+            if (seq != 0) return;
+
             // First packet must be at least: [append][1 char][null] = 3 bytes,
             // but we require 5 to ensure a meaningful filename exists
             if (len < 5) return;
@@ -150,8 +287,19 @@ namespace sd_handler {
             // Null-terminate the filename (should already be, but be safe)
             data[len] = '\0';
 
+            #ifdef USE_SCRIPT_INDEX
+            // The index of the old content is no good, the new one may
+            // have the same size and modification time
+            script_index::remove((char*)&data[1]);
+            #endif
+
             // Open the file. Filename starts at data[1], skipping the append byte.
-            sdcard::beginFileWrite((char*)&data[1], append);
+            // The first chunk may come once it is open.
+            if (sdcard::beginFileWrite((char*)&data[1], append)) {
+                write_seq    = 0;
+                write_ack[1] = 0;
+                com::sendSdData(write_ack, sizeof(write_ack));
+            }
 
             return;
         }
@@ -159,14 +307,23 @@ namespace sd_handler {
         // Writing data to an already-open file
         if (sdcard::getStatus() != sdcard::SD_WRITING) return;
 
-        // Write the chunk. If writeFileChunk returns 0, either an error occurred
-        // or this was a zero-length packet signaling completion.
-        if (sdcard::writeFileChunk(data, len) == 0)
+        // Only the chunk after the last one is taken, 0 is skipped
+        if (seq != ((write_seq == 255) ? 1 : write_seq + 1)) return;
+
+        // A zero-length packet signals completion
+        if (len == 0) {
             sdcard::endFileWrite();
+        } else if (sdcard::writeFileChunk(data, len) != len) {
+            sdcard::endFileWrite();
+            sdcard::setStatus(sdcard::SD_ERROR);
+            return;
+        }
 
         // Send acknowledgment back so the receiving device knows we are ready
         // for the next chunk
-        com::sendSdData(&sd_ack_val, 1);
+        write_seq    = seq;
+        write_ack[1] = seq;
+        com::sendSdData(write_ack, sizeof(write_ack));
     }
 
      /**
@@ -178,7 +335,7 @@ namespace sd_handler {
      */
     void autorun() {
         #ifdef AUTORUN_SCRIPT
-        script_runner::start(AUTORUN_SCRIPT, _gb);
+        script_runner::start(AUTORUN_SCRIPT, sd_buf);
         #endif
     }
 
@@ -226,30 +383,51 @@ namespace sd_handler {
         
     }
 
-    /**
-     * @brief Aborts any ongoing SD card operation (list, read, write)
-     *
-     * Called when the receiving device sends SD_CMD_STOP, or when the main loop
-     * needs to forcibly halt an operation (e.g., because a new command arrived).
-     * Calls the appropriate end function based on the current status.
-     */
-    inline void stop() {
-        if (sdcard_status == sdcard::SD_READING) sdcard::endFileRead();
-        else if (sdcard_status == sdcard::SD_WRITING) sdcard::endFileWrite();
-        else if (sdcard_status == sdcard::SD_LISTING) sdcard::endList();
-    }
-
     /**
      * @brief Handles acknowledgment (SD_ACK) from the receiving device
      *
      * When the receiving device sends SD_ACK it means it has processed the last
      * chunk and is ready for the next one. This function checks the current status
      * and calls the appropriate stream function with a null path to continue the
-     * operation.
+     * operation. While reading, the byte after SD_ACK is the sequence number of
+     * the last chunk processed. The same number again means the chunks after
+     * it got lost, they are read from the file again, the empty one ending it
+     * included. Listing works the same with one packet on its way, the one
+     * holding the end of the directory closes it once it was acknowledged.
+     *
+     * @param data Bytes after SD_ACK
+     * @param len  Number of bytes after SD_ACK
      */
-    inline void ack_received() {
-        if (sdcard_status == sdcard::SD_LISTING) streamList(0x00);
-        else if(sdcard_status == sdcard::SD_READING) streamRead(0x00);
+    inline void ack_received(const uint8_t* data, size_t len) {
+        if ((sdcard_status == sdcard::SD_LISTING) && (len > 0)) {
+            if (data[0] == list_seq) {
+                if (list_end) {
+                    sdcard::endList();
+                    return;
+                }
+
+                ++list_seq;
+            } else if (data[0] == (uint8_t)(list_seq - 1)) {
+                sdcard::seekList(list_pos);
+            } else {
+                return;
+            }
+
+            streamList(0x00);
+        } else if ((sdcard_status == sdcard::SD_READING) && (len > 0)) {
+            uint8_t acked     = data[0] - read_acked + 1;
+            uint8_t in_flight = read_seq - read_acked;
+
+            if ((acked > 0) && (acked <= in_flight)) {
+                read_base += (uint32_t)acked * READ_CHUNK;
+                read_acked = data[0] + 1;
+            } else if ((acked == 0) && (in_flight > 0) && sdcard::seek((read_base < read_size) ? read_base : read_size)) {
+                read_seq = read_acked;
+                read_end = false;
+            }
+
+            streamRead(0x00, 0);
+        }
     }
 
     /**
@@ -262,7 +440,8 @@ namespace sd_handler {
      *
      * Command format:
      *   byte 0:    Command opcode (SD_CMD_LS, SD_CMD_READ, etc.)
-     *   byte 1+:   Arguments (typically a null-terminated file/directory path)
+     *   byte 1+:   Arguments (typically a null-terminated file/directory path,
+     *              SD_CMD_READ adds the window after it)
      *
      * Supported commands:
      *   SD_ACK          — Receiving device is ready for the next chunk
@@ -274,6 +453,10 @@ namespace sd_handler {
      *   SD_CMD_STOP_RUN — Stop script execution
      *   SD_CMD_STOP     — Abort any ongoing SD operation
      *
+     * The SD_CMD_STOP that ended the last operation may have got lost, so
+     * SD_CMD_LS, SD_CMD_READ, SD_CMD_RM and SD_CMD_RUN end whatever still goes
+     * on first, as does the SD_CMD_WRITE that opens a file.
+     *
      * @param buffer Packet data received from com
      * @param len    Number of valid bytes in the buffer
      */
@@ -293,19 +476,28 @@ namespace sd_handler {
 
         // Special handling for ACK — it is not a command, it is a response
         if (cmd == SD_ACK) {
-            ack_received();
+            ack_received(&buffer[1], len - 1);
             return;
         }
 
+        if ((cmd == SD_CMD_LS) || (cmd == SD_CMD_READ) || (cmd == SD_CMD_RM) || (cmd == SD_CMD_RUN)) {
+            stop();
+            sdcard_status = sdcard::getStatus();
+        }
+
         // Dispatch based on the command opcode
         switch (cmd) {
             case SD_CMD_LS:
                 streamList(args);
                 break;
 
-            case SD_CMD_READ:
-                streamRead(args);
+            case SD_CMD_READ: {
+                size_t  name   = strnlen(args, len - 1);
+                uint8_t window = (name + 2 < len) ? args[name + 1] : 1;
+
+                streamRead(args, window);
                 break;
+            }
 
             case SD_CMD_WRITE:
                 streamWrite(&buffer[1], len - 1);
@@ -313,10 +505,13 @@ namespace sd_handler {
 
             case SD_CMD_RM:
                 sdcard::removeFile(args);
+                #ifdef USE_SCRIPT_INDEX
+                script_index::remove(args);
+                #endif
                 break;
 
             case SD_CMD_RUN:
-                script_runner::start(args, _gb);
+                script_runner::start(args, sd_buf);
                 break;
 
             case SD_CMD_STOP_RUN:
@@ -17,6 +17,19 @@ namespace sdcard {
      */
     static SdFile f;
 
+#ifdef USE_SCRIPT_INDEX
+    /**
+     * @brief Handle of the index script_index reads or writes
+     *
+     * Separate from f, so the script stays open for reading next to it.
+     * Only there with USE_SCRIPT_INDEX, it takes RAM of its own.
+     */
+    static SdFile idx;
+
+    /** True while idx is open, see beginIndex() */
+    static bool ix;
+#endif // USE_SCRIPT_INDEX
+
     /**
      * @brief True when the file handle is open for reading or listing
      *
@@ -52,6 +65,13 @@ namespace sdcard {
      */
     static uint32_t bytesSinceSync = 0;
 
+    /**
+     * @brief Directory position of the file getNextFile() returned last
+     *
+     * ungetFile() seeks back to it.
+     */
+    static uint32_t listPos = 0;
+
     /**
      * @brief Initializes the SD card and filesystem
      *
@@ -216,8 +236,75 @@ namespace sdcard {
         return r ? f.seekSet(p) : false;
     }
 
+    /**
+     * @brief Returns when the file open for reading was last modified
+     *
+     * Without a clock, SdFat stamps the files this device writes with the
+     * same default date, only files edited on a computer get a real one.
+     *
+     * @return FAT date << 16 | FAT time, or 0 if no file is open
+     */
+    uint32_t modified() {
+        uint16_t date, time;
+
+        if (!r || !f.getModifyDateTime(&date, &time)) return 0;
+
+        return ((uint32_t)date << 16) | time;
+    }
+
     #pragma endregion 
 
+    #pragma region INDEX
+
+#ifdef USE_SCRIPT_INDEX
+
+    /**
+     * @brief Opens the index of a script
+     *
+     * Works next to a file open for reading, not while one is written.
+     *
+     * @param n File path
+     * @param write If true, create or truncate it for reading and writing. If false, open it read-only.
+     * @return true if the index was opened
+     */
+    bool beginIndex(const char* n, bool write) {
+        if (ix || w || !available()) return false;
+
+        uint8_t mode = write ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY;
+
+        if (!idx.open(n, mode)) return false;
+
+        ix = true;
+        return true;
+    }
+
+    int16_t readIndex(uint8_t* b, uint16_t m) {
+        return ix ? idx.read(b, m) : 0;
+    }
+
+    uint16_t writeIndex(const uint8_t* b, uint16_t len) {
+        return ix ? idx.write(b, len) : 0;
+    }
+
+    bool seekIndex(uint32_t p) {
+        return ix ? idx.seekSet(p) : false;
+    }
+
+    /**
+     * @brief Closes the index
+     *
+     * close() syncs what was written, a read-only index has nothing to sync.
+     */
+    void endIndex() {
+        if (ix) {
+            idx.close();
+            ix = false;
+        }
+    }
+#endif // USE_SCRIPT_INDEX
+
+    #pragma endregion
+
     #pragma region WRITE
 
     /**
@@ -404,6 +491,7 @@ namespace sdcard {
         if (!r) return false;
         
         SdFile entry;
+        listPos = f.curPosition();
         while (entry.openNext(&f, O_RDONLY)) {
             // Skip directories — only return regular files 
             if (!entry.isDir()) {
@@ -427,10 +515,39 @@ namespace sdcard {
                 }
             }
             entry.close();
+            listPos = f.curPosition();
         }
         return false;
     }
 
+    /**
+     * @brief Puts the file getNextFile() returned last back into the directory
+     *
+     * Seeks the directory back to the entry it was read from, the next call
+     * to getNextFile() opens it again.
+     */
+    void ungetFile() {
+        if (r) f.seekSet(listPos);
+    }
+
+    /**
+     * @brief Returns the position of the directory, the entry getNextFile() reads next
+     *
+     * @return Position in the directory, or 0 if none is open
+     */
+    uint32_t tellList() {
+        return r ? f.curPosition() : 0;
+    }
+
+    /**
+     * @brief Moves the directory back to a position tellList() returned
+     *
+     * @param p Position in the directory
+     */
+    void seekList(uint32_t p) {
+        if (r) f.seekSet(p);
+    }
+
     /**
      * @brief Closes the currently open directory
      *
@@ -13,8 +13,8 @@
  * @{
  */
 #define SD_CMD_LS         0x10   // !< List directory contents (followed by null-terminated directory path)
-#define SD_CMD_READ       0x11   // !< Read file contents (followed by null-terminated file path)
-#define SD_CMD_WRITE      0x12   // !< Write file contents (followed by append flag + filename, then data chunks)
+#define SD_CMD_READ       0x11   // !< Read file contents (followed by null-terminated file path and the window)
+#define SD_CMD_WRITE      0x12   // !< Write file contents (followed by sequence number, append flag + filename, then data chunks)
 #define SD_CMD_RM         0x13   // !< Remove (delete) a file (followed by null-terminated file path)
 #define SD_CMD_RUN        0x14   // !< Execute a script from SD card (followed by null-terminated file path)
 #define SD_CMD_STOP_RUN   0x15   // !< Stop script execution (no arguments)
@@ -24,12 +24,26 @@
 /**
  * @brief Acknowledgment byte used in the streaming protocol
  *
- * For operations that return large amounts of data (SD_CMD_LS, SD_CMD_READ),
- * the receiving device sends this byte after processing each chunk to signal
- * that it is ready for the next one.
+ * SD_CMD_LS packs as many entries as fit into each packet, an entry with an
+ * empty name ends the directory. Every packet starts with its sequence
+ * number, counting from 0. The receiving device sends this byte followed by
+ * that number after processing each packet to signal that it is ready for
+ * the next, the directory is closed once the last one was acknowledged. The
+ * number of the packet before means this one got lost, it is sent again.
+ *
+ * SD_CMD_READ streams up to window chunks ahead, the byte after the file
+ * path (1 if it is missing). Every chunk starts with its sequence number,
+ * counting from 0. The receiving device answers with this byte followed by
+ * the sequence number of the last chunk it processed, which makes room for
+ * that chunk and all before it. A chunk with only the sequence number ends
+ * the file, the file stays open until it was acknowledged as well.
  *
  * For SD_CMD_WRITE, this device sends this byte after successfully writing
- * each chunk to signal readiness for the next one.
+ * each chunk to signal readiness for the next one. The receiving device
+ * numbers the packets of a write, the byte after SD_CMD_WRITE: 0 opens the
+ * file, the chunks count from 1 to 255 and on with 1. The byte after SD_ACK
+ * is the number of the packet it answers. A packet sent again because its
+ * SD_ACK got lost is answered again but not written twice.
  */
 #define SD_ACK        0x06  
 
@@ -183,7 +197,66 @@ namespace sdcard {
      * even if no file is open (does nothing in that case).
      */
     void endFileRead();
-    
+
+    /**
+     * @brief Returns when the file open for reading was last modified
+     *
+     * The FAT date in the high 16 bits and the time in the low ones, as
+     * the card's directory entry has them. Used by script_index to notice
+     * that a script was edited since its index was built.
+     *
+     * @return Modification date and time, or 0 if no file is open
+     */
+    uint32_t modified();
+
+#ifdef USE_SCRIPT_INDEX
+    /**
+     * @brief Opens the index of a script, a second file next to the one open for reading
+     *
+     * The index has a handle of its own, so script_index can look up and
+     * add lines while the script runs from the first one. Only one index
+     * is open at a time. With write set the file is created or truncated,
+     * and can be read back too.
+     *
+     * After opening, use readIndex(), writeIndex() and seekIndex(). Call
+     * endIndex() when done.
+     *
+     * @param n     Path of the index file
+     * @param write If true, open it to write a new index. If false, to read it.
+     * @return true if the index was opened, false if it does not exist, an
+     *         index is already open or the card is unavailable
+     */
+    bool beginIndex(const char* n, bool write);
+
+    /**
+     * @brief Reads from the open index, like readFileChunk()
+     *
+     * @return Number of bytes actually read, or 0 if no index is open
+     */
+    int16_t readIndex(uint8_t* b, uint16_t m);
+
+    /**
+     * @brief Writes to the open index, like writeFileChunk()
+     *
+     * @return Number of bytes actually written, or 0 if no index is open
+     */
+    uint16_t writeIndex(const uint8_t* b, uint16_t len);
+
+    /**
+     * @brief Moves the position in the open index, like seek()
+     *
+     * @return true if seek succeeded, false if no index is open or seek failed
+     */
+    bool seekIndex(uint32_t pos);
+
+    /**
+     * @brief Closes the open index, written data is synced first
+     *
+     * Safe to call even if no index is open (does nothing in that case).
+     */
+    void endIndex();
+#endif // USE_SCRIPT_INDEX
+
     /**
      * @brief Opens a file for writing
      *
@@ -301,6 +374,31 @@ namespace sdcard {
      */
     bool getNextFile(char* name, uint8_t maxLen, uint32_t* size);
 
+    /**
+     * @brief Puts the file getNextFile() returned last back into the directory
+     *
+     * The next call to getNextFile() returns it again. Used by sd_handler when
+     * a file doesn't fit into the packet anymore.
+     */
+    void ungetFile();
+
+    /**
+     * @brief Returns where in the directory the next call to getNextFile() reads
+     *
+     * @return Position to hand to seekList(), 0 if no directory is open
+     */
+    uint32_t tellList();
+
+    /**
+     * @brief Moves the directory back to a position tellList() returned
+     *
+     * getNextFile() goes on from there. Used by sd_handler to build a
+     * packet of the listing again when it got lost.
+     *
+     * @param pos Position from tellList()
+     */
+    void seekList(uint32_t pos);
+
     /**
      * @brief Closes the currently open directory
      *
@@ -21,12 +21,16 @@ extern "C" {
 #include "duckscript.h"
 #include "settings.h"
 #include "com.h"
+#include "compiler.h"
 #include "config.h"
 #include "sdcard.h"
 
 /*! \brief Maximum size for shared buffer used in SD card operations */
 #define SHARED_BUFFER_SIZE 1024
 
+/*! \brief Most bytes of a chunk of a streaming write, the packet also has SD_CMD_WRITE and the sequence number */
+#define SD_CHUNK_MAX (BUFFER_SIZE - 2)
+
 namespace cli {
     // ===== PRIVATE ===== //
     SimpleCLI cli;           // !< Instance of SimpleCLI library
@@ -45,6 +49,7 @@ namespace cli {
     static const char* duckycommands_blacklist[] = {
         "DELAY", 
         "DEFAULT_DELAY", 
+        "TYPING_RATE",
         "REPEAT",
         "LOOP_BEGIN",
         "LOOP_END",
@@ -126,6 +131,7 @@ namespace cli {
         }
 
         com::send(keyStr.c_str(), keyStr.length(), ack);
+        compiler::follow(keyStr.c_str(), keyStr.length());
         print("> key: " + keyStr);
     }
 
@@ -160,41 +166,61 @@ namespace cli {
     #ifdef USE_SD_CARD
 
     /*!
-     * \brief Handler for streaming data writes to SD card
-     * 
-     * Sends data chunks to the ATmega for writing to SD card.
-     * Must be preceded by 'sd_stream_write_begin' command.
-     * 
-     * \param input Data to write (max SHARED_BUFFER_SIZE - 1 bytes)
-     * 
-     * \note Only works when SD write mode is active
-     * \note Data is sent with SD_CMD_WRITE header byte
+     * \brief Sends a chunk of a streaming write to the ATmega
+     *
+     * The link escapes framing bytes, so data can hold any byte. A chunk
+     * longer than SD_CHUNK_MAX is rejected as a whole, cut short it would
+     * still be acknowledged and the file would end up without its end.
+     *
+     * \param data Data to write (max SD_CHUNK_MAX bytes)
+     * \param len  Number of bytes in data
      */
-    static void handleSDStreamWrite(const char* input) {
+    static void sendSDData(const uint8_t* data, size_t len) {
         if (com::get_mode() != sdcard::SD_WRITING) {
             print("SYS_ERROR: The write flow to SDCARD was not initiated.");
             return;
         }
         
-        size_t len = strlen(input);
         if (len == 0) {
             print("SD_ERROR: There is no information to send");
             return;
         }
+
+        if (len > SD_CHUNK_MAX) {
+            print("SD_ERROR: Chunk of " + String(len) + " bytes, at most " + String(SD_CHUNK_MAX) + " fit");
+            print("SD_ACK:ERROR");
+            return;
+        }
+
+        // The last chunk isn't written yet, the ATmega's receive buffer holds one
+        if (!com::sd_ready()) {
+            print("SD_ERROR: The SD card is not ready for more data");
+            return;
+        }
         
         uint8_t* buffer = (uint8_t*)shared_buffer;
-        size_t maxDataSize = min((size_t)SHARED_BUFFER_SIZE - 1, (size_t)BUFFER_SIZE - 1);
-        
-        buffer[0] = SD_CMD_WRITE;
 
-        size_t dataLen = min(len, maxDataSize);
-        memcpy(&buffer[1], input, dataLen);
+        buffer[0] = SD_CMD_WRITE;
+        memcpy(&buffer[1], data, len);
 
         print("> Sending data...");
 
-        com::send_sd(buffer, dataLen + 1);
-        
-        return;
+        com::send_sd(buffer, len + 1);
+    }
+
+    /*!
+     * \brief Handler for streaming data writes to SD card
+     * 
+     * Sends data chunks to the ATmega for writing to SD card.
+     * Must be preceded by 'sd_stream_write_begin' command.
+     * 
+     * \param input Data to write (max SD_CHUNK_MAX bytes)
+     * 
+     * \note Only works when SD write mode is active
+     * \note Data is sent with SD_CMD_WRITE header byte
+     */
+    static void handleSDStreamWrite(const char* input) {
+        sendSDData((const uint8_t*)input, strlen(input));
     }
 
     /*!
@@ -440,7 +466,7 @@ namespace cli {
          * \brief Create status command
          *
          * Prints the current system status including:
-         * - I2C connection to ATmega32u4
+         * - Connection to ATmega32u4 and the baud rate it negotiated
          * - Script execution state
          * - SD card operation state (if enabled)
          */
@@ -456,7 +482,10 @@ namespace cli {
                     String s = "SD_STATUS: ";
                     if (sdcard_status == sdcard::SD_READING) s += "reading...";
                     else if (sdcard_status == sdcard::SD_WRITING) s += "writting...";
-                    else if (sdcard_status == sdcard::SD_EXECUTING) s += "running...";
+                    else if (sdcard_status == sdcard::SD_EXECUTING) {
+                        s += "running...";
+                        if (com::get_sd_progress() <= 100) s += " " + String(com::get_sd_progress()) + "%";
+                    }
                     else if (sdcard_status == sdcard::SD_LISTING) s += "enumerating...";
                     print(s);
                     return;
@@ -466,13 +495,37 @@ namespace cli {
                     String s = "running " + duckscript::currentScript();
                     print(s);
                 } else {
-                    print("connected");
+                    String s = "connected";
+                    if (com::get_baud()) s += " at " + String(com::get_baud()) + " baud";
+                    print(s);
                 }
             } else {
                 print("Internal connection problem\n" + response);
             }
         });
 
+        /*!
+         * \brief Create link_stats command
+         *
+         * Prints the counters of the link to the ATmega32u4 as one
+         * "LINK_STATS:" line of name=value pairs, so the web interface can
+         * read them too. The ATmega's own counters follow, their names
+         * start with "atmega_". The line comes once the ATmega sent them,
+         * through the print callback like SD card answers.
+         * See com::print_link_stats().
+         *
+         * Usage: link_stats [reset]
+         * Example: link_stats reset
+         *
+         * \param * "reset" to start the counters of both sides over once they are printed
+         */
+        cli.addSingleArgCmd("link_stats", [](cmd* c) {
+            Command  cmd { c };
+            Argument arg { cmd.getArg(0) };
+
+            com::print_link_stats(arg.getValue() == "reset");
+        });
+
         /*!
          * \brief Create ls command
          *
@@ -729,6 +782,7 @@ namespace cli {
          */
         cli.addCommand("duckparser_reset", [](cmd* c) {
             com::send(CMD_PARSER_RESET);
+            compiler::reset(com::get_lz_window());
 
             print("Duckparser reset");
         });
@@ -766,7 +820,7 @@ namespace cli {
          * \param filename Name of file on SD card (max MAX_NAME characters)
          * 
          * \note File must exist on SD card
-         * \note Content is streamed back over I2C
+         * \note Content is streamed back SD_READ_WINDOW chunks ahead
          */
         cli.addSingleArgCmd("sd_cat", [](cmd* c) {
             Command cmd{c};
@@ -782,6 +836,9 @@ namespace cli {
             com::set_mode(sdcard::SD_READING);
             
             size_t size = prepareSDBuffer(SD_CMD_READ, file);
+
+            // Chunks the ATmega may send before the first is acknowledged
+            shared_buffer[size++] = SD_READ_WINDOW;
             
             com::send_sd((uint8_t*)shared_buffer, size);
             
@@ -1009,4 +1066,29 @@ namespace cli {
             cli.parse(input);
         }
     }
+
+    #ifdef USE_SD_CARD
+    /*!
+     * \brief Writes raw bytes to the SD card file of a streaming write
+     *
+     * Binary counterpart of sd_stream_write, used for binary WebSocket
+     * frames. Unlike the command the data may hold any byte, NUL included.
+     * A longer frame is answered with SD_ERROR and SD_ACK:ERROR, nothing
+     * of it is written.
+     *
+     * \param data      Data to write (max SD_CHUNK_MAX bytes)
+     * \param len       Number of bytes in data
+     * \param printfunc Function that prints the result
+     */
+    void write_sd(const uint8_t* data, size_t len, PrintFunction printfunc) {
+        cli::printfunc = printfunc;
+
+        if (duckscript::isRunning()) {
+            print("SYS_BUSY: A script is being executed from SPIFFS");
+            return;
+        }
+
+        sendSDData(data, len);
+    }
+    #endif
 }
\ No newline at end of file
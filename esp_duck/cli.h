@@ -9,6 +9,8 @@
 
 #include <Arduino.h> // String, bool
 
+#include "config.h"
+
 /*! \typedef PrintFunction
  *  \brief A function that outputs a given string, for example to std::out.
  *  \param s String to be printed
@@ -35,4 +37,17 @@ namespace cli {
      * \param echo      Flag to enable echo of input
      */
     void parse(const char* input, PrintFunction printfunc, bool echo = true);
+
+    #ifdef USE_SD_CARD
+    /*!
+     * \brief Writes raw bytes to the SD card file of a streaming write
+     *
+     * Must be preceded by 'sd_stream_write_begin', like 'sd_stream_write'.
+     *
+     * \param data      Data to write, at most BUFFER_SIZE - 2 bytes
+     * \param len       Number of bytes in data
+     * \param printfunc Function that prints the result
+     */
+    void write_sd(const uint8_t* data, size_t len, PrintFunction printfunc);
+    #endif
 }
\ No newline at end of file
@@ -14,6 +14,10 @@
 #include "debug.h"
 #include "sdcard.h"
 
+#if defined(ENABLE_I2C) && defined(BUFFER_LENGTH) && (PACKET_SIZE > BUFFER_LENGTH)
+#error PACKET_SIZE is more than one Wire transmission can hold
+#endif
+
 // ! Communication request codes
 #define REQ_SOT 0x01     // !< Start of transmission
 #define REQ_EOT 0x04     // !< End of transmission
@@ -21,86 +25,210 @@
 #define REQ_SD_SOT 0x02  // !< Start of SD Transmission
 #define REQ_SD_EOT 0x03  // !< End of SD Transmission
 
+// ! A payload byte with the value of a request code is sent as REQ_ESC
+// ! followed by the byte XORed with REQ_ESC_XOR, see escape()
+#define REQ_ESC 0x05     // !< The next byte is payload
+#define REQ_ESC_XOR 0x20
+
 /**
  * @brief Protocol version — must match the ATmega's COM_VERSION
  *
  * If the versions don't match, connection is set to false and the error callback fires.
+ * Version 5 added baud rate negotiation (CMD_BAUD).
+ * Version 6 added sequence numbers to packets and ack/window to the status.
+ * Version 7 added a CRC-16 to packets and status, and nack to the status.
+ * Version 8 escapes framing bytes in payloads (REQ_ESC).
+ * Version 9 replaced the status struct with events, sent when their value changes.
+ * Version 10 added lines compiled to bytecode (CMD_BYTECODE).
+ * Version 11 added STRING text sent as keys (OP_KEYS).
+ * Version 12 added compressed text (OP_LZ) and EVENT_LZ_WINDOW.
+ * Version 13 added EVENT_PROGRESS.
+ * Version 14 added a CRC-16 to SD packets, an empty chunk that ends an SD read
+ * and sequence numbers to SD writes and listings.
+ * Version 15 added EVENT_LINK_STATS.
  */
-#define COM_VERSION 4
+#define COM_VERSION 15
+
+// ! Status events, a type byte followed by the value. Must be the same as the ATmega's
+#define EVENT_VERSION     0x10 // !< COM_VERSION
+#define EVENT_WINDOW      0x11 // !< Bytes the ATmega can buffer, see can_send()
+#define EVENT_DONE        0x12 // !< Sequence byte of the last packet executed
+#define EVENT_REPEAT      0x13 // !< Repetitions still pending
+#define EVENT_LOOP        0x14 // !< Loop iterations left, signed
+#define EVENT_SD_STATE    0x15 // !< SD card state
+#define EVENT_DELAY_UNTIL 0x16 // !< ms left of a delay that started, 2 bytes, the low one first. 0 once it is over
+#define EVENT_NACK        0x17 // !< Sequence byte of a packet to send again
+#define EVENT_LZ_WINDOW   0x18 // !< How far back compressed text may refer, in 16 byte steps
+#define EVENT_PROGRESS    0x19 // !< Percent of the SD script that ran, 255 if unknown
+#define EVENT_LINK_STATS  0x1A // !< The ATmega's link counters, see read_link_stats(). Only after CMD_LINK_STATS
 
+/**
+ * @brief Bytes of a status with every event, the most a status can have
+ *
+ * Over I2C every status has them all.
+ */
 #ifdef USE_SD_CARD
+    #define STATUS_SIZE 21
+#else
+    #define STATUS_SIZE 17
+#endif
 
-    /**
-     * @brief Status struct received from the ATmega
-     *
-     * Layout matches atmega_duck/com.cpp's status_t exactly. The ESP reads this
-     * struct over I2C or Serial to learn what the ATmega is currently doing.
-     */
-    typedef struct status_t {
-        unsigned int version : 8;
-        unsigned int wait    : 16;
-        unsigned int repeat  : 8;
-        unsigned int sdcard_status : 8;
-        int          loop    : 8;
-    } __attribute__((packed)) status_t;
+/**
+ * @brief Bytes of EVENT_LINK_STATS
+ *
+ * It only comes over Serial, on top of the other events.
+ */
+#define STATS_SIZE 29
+
+/**
+ * @brief Bytes a packet has on top of its payload
+ *
+ * SOT, sequence byte, three CRC bytes and EOT, see frame_packet(). Escaped
+ * payload bytes come on top of it.
+ */
+#define PACKET_OVERHEAD 6
+
+/** Time in ms without a status, while packets are in flight, before asking for one */
+#define PROBE_TIMEOUT 250
+
+/** Longest time in ms between two requests for a status that go unanswered */
+#define PROBE_MAX 2000
+
+/** Requests for a status in a row that go unanswered before the serial link is set up again */
+#define PROBE_RECONNECT 5
+
+/** Time in ms without the next packet of an SD card operation before the ATmega is asked again */
+#define SD_TIMEOUT 250
+
+/** Times in a row the ATmega is asked again before the SD card operation ends with SD_END:ERROR */
+#define SD_TRIES 8
+
+/** Time in ms the LINK_STATS line waits for the ATmega's counters, it doesn't answer while it types a line */
+#define STATS_TIMEOUT 1000
+
+/** Time in ms between I2C polls: after a packet went out, then doubling while the ATmega is still at work */
+#define I2C_POLL_MIN 1
+#define I2C_POLL_MAX 16
+
+/**
+ * @brief What the ATmega's status events told so far
+ *
+ * Each field keeps its value until the event that carries it comes again
+ * with another one, see read_status().
+ *
+ * delay:    ms the delay had left when EVENT_DELAY_UNTIL came, 0 once it is over
+ * progress: Percent of the SD script that ran, 255 if none runs or the ATmega can't tell
+ * nack:  Sequence byte of a packet to send again, only for the status it came with
+ */
+typedef struct status_t {
+    uint8_t  version;
+    uint16_t delay;
+    uint8_t  repeat;
+    #ifdef USE_SD_CARD
+    uint8_t  sdcard_status;
+    uint8_t  progress;
+    #endif
+    int8_t   loop;
+    uint8_t  ack;
+    uint8_t  window;
+    uint8_t  lz_window;
+    uint8_t  nack;
+} status_t;
+
+#ifdef USE_SD_CARD
 
     /**
      * @brief Tracks the current SD streaming session
      *
      * current_mode: What the ATmega's SD card is doing (READING, WRITING, LISTING, etc.)
+     * op:           The operation set_mode() started, what packets from the ATmega are taken for
      * is_active:    Whether an SD streaming operation is in progress
+     * ready:        The ATmega has room for the next write chunk. Its SD_ACK is
+     *               the credit, every packet sent while writing takes it.
+     * end:          The packet that ends a read or listing came
+     * seq:          Sequence number of the next chunk of a read or packet of
+     *               a listing, or of the next packet of a write
+     * time:         millis() the ATmega last sent a packet or was asked again
+     * tries:        Times in a row it was asked again, see sd_timeout()
+     * read_again:   Chunks of a read got lost and were asked for again, the
+     *               ones still on their way are dropped without asking twice
+     * last:         The last request or packet of a write sent, for sending
+     *               it again. A read forgets it once the ATmega answered
      */
     typedef struct sd_session_t {
         sdcard::SDStatus current_mode;
+        sdcard::SDStatus op;
         bool is_active;
+        bool ready;
+        bool end;
+        uint8_t seq;
+        unsigned long time;
+        uint8_t tries;
+        bool read_again;
+        uint8_t last[BUFFER_SIZE];
+        size_t last_len;
     } sd_session_t;
 
     /**
      * @brief Buffers incoming SD data from the ATmega
      *
      * When SD_SOT is seen in serial_update(), bytes are accumulated here until
-     * SD_EOT is found. Once is_ready is true, process_sd_package() handles the data.
+     * SD_EOT is found. Once is_ready is true, process_sd_package() handles the
+     * data, the CRC at its end is checked and taken off by then.
      */
     typedef struct sd_packet_t {
-        uint8_t buff[BUFFER_SIZE];
+        uint8_t buff[BUFFER_SIZE + 2];
         size_t len;
         bool is_ready;
         bool reading;
+        bool escaped;
 
         void clear() {
             len      = 0;
             is_ready = false;
             reading  = false;
+            escaped  = false;
         }
     } sd_packet_t;
-#else
-    /**
-     * @brief Status struct without SD card fields (when USE_SD_CARD is not defined)
-     */
-    typedef struct status_t {
-        unsigned int version : 8;
-        unsigned int wait    : 16;
-        unsigned int repeat  : 8;
-        int          loop    : 8;
-    } __attribute__((packed)) status_t;
 #endif
 
+/**
+ * @brief A packet the ATmega hasn't acknowledged yet
+ *
+ * seq:   Sequence byte it was sent with, see send()
+ * bytes: Bytes it took on the wire, framing included
+ * len:   Payload bytes in data, kept to send it again
+ * time:  millis() it was sent the first time
+ */
+typedef struct in_flight_t {
+    uint8_t       seq;
+    uint8_t       bytes;
+    uint8_t       len;
+    unsigned long time;
+    char          data[BUFFER_SIZE];
+} in_flight_t;
+
 namespace com {
     // ========== PRIVATE ========== //
 
     /** True if the connection to the ATmega is healthy */
     bool connection = false;
 
-    com_callback callback_done   = NULL;  ///< Fired when ATmega finishes processing (wait == 0)
+    /** Rate the serial link runs at, 0 over I2C */
+    unsigned long baud = 0;
+
+    com_callback callback_done   = NULL;  ///< Fired when ATmega finishes processing (nothing in flight, no delay)
     com_callback callback_repeat = NULL;  ///< Fired when ATmega is repeating a command
     com_callback callback_error  = NULL;  ///< Fired on protocol version mismatch
     com_callback callback_loop   = NULL;  ///< Fired on loop iteration (called before done)
+    com_callback callback_ready  = NULL;  ///< Fired when an ack makes room for more packets
 
     /**
-     * @brief True when the status indicates something actionable
+     * @brief True when a status brought an event to act on
      *
-     * Set when wait == 0, repeat > 0, or wait LSB toggled. When true, update()
-     * fires the appropriate callbacks.
+     * Set by EVENT_DONE, EVENT_REPEAT, EVENT_LOOP, EVENT_DELAY_UNTIL and a
+     * status with every event. When true, update() fires the appropriate
+     * callbacks.
      */
     bool react_on_status  = false;
 
@@ -111,9 +239,209 @@ namespace com {
      */
     bool new_transmission = false;
 
-    /** Status struct received from the ATmega */
+    /** What the ATmega's status events told so far */
     status_t status;
 
+    /** millis() the last EVENT_DELAY_UNTIL came */
+    unsigned long delay_time = 0;
+
+    /** True if the last status carried every event */
+    bool status_complete = false;
+
+    /**
+     * @brief Packets sent but not acknowledged, oldest first
+     *
+     * The ATmega executes packets in the order they arrive and reports the
+     * sequence byte of the last one it finished in status.ack, so one ack
+     * covers every packet up to it.
+     */
+    in_flight_t in_flight_buf[COM_WINDOW];
+    uint8_t     in_flight_start = 0;
+    uint8_t     in_flight_len   = 0;
+
+    /** Wire bytes of all packets in in_flight_buf */
+    unsigned int in_flight_bytes = 0;
+
+    /** Link counters, see get_link_stats() */
+    link_stats_t stats;
+
+    /** millis() the first packet went out while nothing was in flight */
+    unsigned long wait_start = 0;
+
+    /** Sequence byte of the next packet, the high bit is always set */
+    uint8_t next_seq = 0x80;
+
+    /** millis() the probe timeout counts from: the last status, or the packet that ended a quiet link */
+    unsigned long probe_time = 0;
+
+    /** Time in ms before the next probe, doubles while they go unanswered */
+    unsigned long probe_timeout = PROBE_TIMEOUT;
+
+    /** Requests for a status since the last status */
+    uint8_t probes_unanswered = 0;
+
+    /** True from a probe until the next status, that status tells where the ATmega stands */
+    bool probe_pending = false;
+
+    /** next_seq when the last probe went out, packets from there on are behind it on the wire */
+    uint8_t probe_seq = 0;
+
+    /**
+     * @brief The ATmega's link counters, see rx_stats_t in its com.h
+     */
+    typedef struct atmega_stats_t {
+        unsigned int  uart_peak;
+        unsigned int  peak;
+        unsigned long overruns;
+        unsigned long received;
+        unsigned long sent;
+        unsigned long packets;
+        unsigned long dropped;
+        unsigned long nacks;
+    } atmega_stats_t;
+
+    /** The counters of the last EVENT_LINK_STATS */
+    atmega_stats_t atmega_stats;
+
+    /** True from print_link_stats() asking the ATmega for its counters until the line is printed */
+    bool stats_pending = false;
+
+    /** True once EVENT_LINK_STATS came in reply */
+    bool stats_arrived = false;
+
+    /** True to start the counters over once the line is printed */
+    bool stats_reset = false;
+
+    /** millis() print_link_stats() was called */
+    unsigned long stats_time = 0;
+
+    /** millis() the ATmega was last asked for its counters, the status with them may get lost */
+    unsigned long stats_asked = 0;
+
+    /**
+     * @brief Most packets in flight
+     *
+     * I2C stays at one: the ATmega drops an I2C write that doesn't fit into
+     * its receive buffer, the send window is sized for the serial one.
+     */
+    #ifdef ENABLE_I2C
+    const uint8_t window = 1;
+    #else
+    const uint8_t window = COM_WINDOW;
+    #endif
+
+    /** Sequence byte that follows seq, the high bit is always set */
+    uint8_t seq_after(uint8_t seq) {
+        return 0x80 | ((seq + 1) & 0x7F);
+    }
+
+    /** True if c is a request code, it has to be escaped in a payload */
+    bool is_framing(uint8_t c) {
+        return (c >= REQ_SOT) && (c <= REQ_ESC);
+    }
+
+    /** Wire bytes of a payload once it is escaped */
+    size_t escaped_len(const char* data, size_t len) {
+        size_t n = len;
+
+        for (size_t i = 0; i < len; ++i) {
+            if (is_framing(data[i])) ++n;
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Copies a payload to out, escaping request codes
+     *
+     * @param out Room for 2 * len bytes
+     * @return Number of bytes written to out
+     */
+    size_t escape(uint8_t* out, const uint8_t* data, size_t len) {
+        size_t n = 0;
+
+        for (size_t i = 0; i < len; ++i) {
+            if (is_framing(data[i])) {
+                out[n++] = REQ_ESC;
+                out[n++] = data[i] ^ REQ_ESC_XOR;
+            } else {
+                out[n++] = data[i];
+            }
+        }
+
+        return n;
+    }
+
+    in_flight_t& in_flight_at(uint8_t i) {
+        return in_flight_buf[(in_flight_start + i) % COM_WINDOW];
+    }
+
+    /**
+     * @brief Remembers a packet until it is acknowledged and gives it the next sequence byte
+     *
+     * If send() is called with the window full anyway, the oldest packet is
+     * forgotten to make room.
+     */
+    in_flight_t& track(const char* str, unsigned int len) {
+        if (in_flight_len == COM_WINDOW) {
+            in_flight_bytes -= in_flight_buf[in_flight_start].bytes;
+            in_flight_start  = (in_flight_start + 1) % COM_WINDOW;
+            --in_flight_len;
+        }
+
+        // Nothing was in flight, the ATmega has been quiet for a reason
+        if (in_flight_len == 0) {
+            probe_time = millis();
+            wait_start = millis();
+        }
+
+        in_flight_t& p = in_flight_at(in_flight_len);
+
+        p.seq   = next_seq;
+        p.len   = len;
+        p.bytes = escaped_len(str, len) + PACKET_OVERHEAD;
+        p.time  = millis();
+        memcpy(p.data, str, len);
+
+        next_seq = seq_after(next_seq);
+
+        ++in_flight_len;
+        in_flight_bytes += p.bytes;
+
+        return p;
+    }
+
+    /**
+     * @brief Drops every packet up to and including the one with sequence byte ack
+     *
+     * Their latency and, once nothing is in flight, the time the ATmega kept
+     * the ESP waiting go into stats.
+     *
+     * @return true if a packet was acknowledged
+     */
+    bool acknowledge(uint8_t ack) {
+        for (uint8_t i = 0; i < in_flight_len; ++i) {
+            if (in_flight_at(i).seq != ack) continue;
+
+            for (uint8_t j = 0; j <= i; ++j) {
+                unsigned long latency = millis() - in_flight_buf[in_flight_start].time;
+
+                if (latency > stats.latency_max) stats.latency_max = latency;
+
+                in_flight_bytes -= in_flight_buf[in_flight_start].bytes;
+                in_flight_start  = (in_flight_start + 1) % COM_WINDOW;
+            }
+
+            in_flight_len -= i + 1;
+
+            if (in_flight_len == 0) stats.wait_ms += millis() - wait_start;
+
+            return true;
+        }
+
+        return false;
+    }
+
     /**
      * @brief True when the web interface is waiting for a keyboard command ACK
      *
@@ -129,11 +457,16 @@ namespace com {
     /** Buffers incoming SD data from the ATmega */
     sd_packet_t  sd_packet;
 
-    /** SD_ACK byte sent to request the next chunk */
-    uint8_t sd_ack_val  = SD_ACK;
-
     /** SD_CMD_STOP byte sent to abort an SD operation */
     uint8_t sd_stop_val = SD_CMD_STOP;
+
+    /**
+     * @brief Buffer for the "SD_LS:" message of one listing packet
+     *
+     * An entry takes at least 9 bytes in the packet and at most 8 more as
+     * text (",", 10 digits and "\n" instead of 4 bytes size and the null).
+     */
+    char ls_buffer[6 + 2 * BUFFER_SIZE];
     #endif
     
     /** Buffer for formatting SD responses before sending to cli_print */
@@ -148,19 +481,20 @@ namespace com {
      */
     print_callback cli_print = NULL;
 
-    /**
-     * @brief Retry counter for deadlock detection
-     *
-     * Incremented when the ATmega's wait value doesn't change after sending a
-     * command. After 3 retries, connection is set to false (ERROR).
-     */
-    uint8_t transm_tries = 0;
+    // Defined after the transports
+    size_t frame_packet(uint8_t* out, uint8_t seq, const char* data, size_t len);
+    bool read_status(const uint8_t* raw, size_t len);
+    void probe();
+    uint16_t crc16(uint16_t crc, const uint8_t* data, size_t len);
 
     // ========= PRIVATE I2C ========= //
 
 #ifdef ENABLE_I2C
-    /** Timestamp of the last i2c_request() call, used for throttling */
-    unsigned long request_time = 0;
+    /** Time of the next poll, see i2c_update() */
+    unsigned long poll_time = 0;
+
+    /** Time from the next poll to the one after it if the ATmega is still at work */
+    unsigned long poll_step = I2C_POLL_MIN;
 
     /**
      * @brief Starts an I2C transmission to the ATmega
@@ -175,12 +509,13 @@ namespace com {
     /**
      * @brief Ends the current I2C transmission
      *
-     * Flushes buffered bytes to the ATmega and releases the I2C bus.
+     * Flushes buffered bytes to the ATmega and releases the I2C bus. The
+     * next transmission can follow right away, the ATmega stretches the
+     * clock until its receive interrupt took these bytes.
      */
     void i2c_stop_transmission() {
         Wire.endTransmission();
         debugln("' ");
-        delay(1);
     }
 
     /**
@@ -195,73 +530,39 @@ namespace com {
     /**
      * @brief Polls the ATmega for a fresh status update
      *
-     * Reads the status_t struct from the ATmega via Wire.requestFrom(). Sets
-     * react_on_status if the status indicates something actionable (wait == 0,
-     * repeat > 0, or wait LSB toggled).
-     *
-     * Includes deadlock detection: if wait doesn't change after a transmission,
-     * increments transm_tries. After 3 retries, sets connection = false.
+     * Reads a status with every event and its CRC from the ATmega via
+     * Wire.requestFrom(), see read_status(). A status with the wrong CRC
+     * is ignored, probe() asks again if it was needed.
      */
     void i2c_request() {
         debug("I2C Request");
 
-        uint16_t prev_wait = status.wait;
+        uint8_t raw[STATUS_SIZE + 2];
 
-        Wire.requestFrom(I2C_ADDR, sizeof(status_t));
+        Wire.requestFrom(I2C_ADDR, sizeof(raw));
 
-        if (Wire.available() == sizeof(status_t)) {
-            // Read the status struct byte-by-byte
-            status.version = Wire.read();
+        if (Wire.available() == sizeof(raw)) {
+            for (size_t i = 0; i < sizeof(raw); ++i) raw[i] = Wire.read();
 
-            status.wait  = Wire.read();
-            status.wait |= uint16_t(Wire.read()) << 8;
+            stats.received += sizeof(raw);
 
-            status.repeat = Wire.read();
-
-            debugf(" %u", status.wait);
+            if (read_status(raw, sizeof(raw))) debugf(" %u", status.delay);
+            else debug(" DAMAGED");
         } else {
             // I2C read failed — connection lost
             connection = false;
             debug(" ERROR");
         }
 
-        // Decide if the status is actionable
-        react_on_status = status.wait == 0 ||
-                          status.repeat > 0 ||
-                          ((prev_wait&1) ^ (status.wait&1));
-
         debugln();
-
-        // Deadlock detection: if wait didn't change, the ATmega might not have
-        // received the last command
-        if (!react_on_status && (status.wait == prev_wait)) {
-            debug("Last message was not processed");
-
-            if (transm_tries > 3) {
-                connection = false;
-                debugln("...LOOP ERROR");
-            } else {
-                debugln("...repeating last line");
-
-                // Artificially set repeat to trigger the repeat callback
-                status.repeat = 1;
-
-                react_on_status = true;
-
-                ++transm_tries;
-            }
-        } else {
-            transm_tries = 0;
-        }
-
-        request_time = millis();
     }
 
     /**
      * @brief Initializes the I2C bus and establishes connection with the ATmega
      *
-     * Sends MSG_CONNECTED to announce the ESP's presence, then calls update()
-     * to get the initial status.
+     * Asks the ATmega which sequence byte it expects, sends MSG_CONNECTED to
+     * announce the ESP's presence, then calls update() to get the initial
+     * status.
      */
     void i2c_begin() {
         unsigned long start_time = millis();
@@ -275,6 +576,11 @@ namespace com {
 
         connection = true;
 
+        // The ATmega answers the probe from its loop()
+        probe();
+        delay(10);
+        i2c_request();
+
         send(MSG_CONNECTED);
 
         update();
@@ -286,19 +592,33 @@ namespace com {
     /**
      * @brief Polls the ATmega for status updates when appropriate
      *
-     * Called from the main loop every tick. Polls when:
-     *   - new_transmission is true (just sent a command)
-     *   - processing is true and delay_over (wait period expired)
+     * Called from the main loop every tick. While packets are in flight, a
+     * delay runs or a probe waits for its answer, polls once poll_time is
+     * reached: I2C_POLL_MIN after a packet went out, at the end of a delay
+     * the ATmega announced, and after every poll that found it still at
+     * work twice as long as after the one before, up to I2C_POLL_MAX.
      */
     void i2c_update() {
         if (!connection) return;
 
-        bool processing = status.wait > 0;
-        bool delay_over = request_time + status.wait < millis();
-
-        if (new_transmission || (processing && delay_over)) {
+        if (new_transmission) {
             new_transmission = false;
-            i2c_request();
+            poll_step        = I2C_POLL_MIN;
+            poll_time        = millis() + I2C_POLL_MIN;
+        }
+
+        if ((in_flight_len == 0) && (status.delay == 0) && !probe_pending) return;
+
+        if ((long)(millis() - poll_time) < 0) return;
+
+        i2c_request();
+
+        if (status.delay > 0) {
+            poll_step = I2C_POLL_MIN;
+            poll_time = delay_time + status.delay;
+        } else {
+            poll_time = millis() + poll_step;
+            poll_step = poll_step * 2 < I2C_POLL_MAX ? poll_step * 2 : I2C_POLL_MAX;
         }
     }
 
@@ -317,11 +637,6 @@ namespace com {
 
 #endif // ifdef ENABLE_I2C
 
-    // ========= PRIVATE I2C ========= //
-
-#ifdef ENABLE_SERIAL
-    bool ongoing_transmission = false;
-
     /**
      * @brief Registers the callback for sending responses to the web interface
      *
@@ -331,6 +646,11 @@ namespace com {
         cli_print = cb;
     }
 
+    // ========= PRIVATE I2C ========= //
+
+#ifdef ENABLE_SERIAL
+    bool ongoing_transmission = false;
+
     void serial_start_transmission() {
         debug("Transmitting '");
     }
@@ -344,21 +664,253 @@ namespace com {
         SERIAL_PORT.write(b);
     }
 
+    /** Reads the next byte from the serial port, there has to be one */
+    uint8_t serial_read() {
+        ++stats.received;
+        return SERIAL_PORT.read();
+    }
+
     /**
-     * @brief Initializes the serial port and establishes connection with the ATmega
+     * @brief Time in ms the ATmega waits for the test pattern at a new rate
      *
-     * Sends MSG_CONNECTED to announce the ESP's presence, then calls update()
-     * to get the initial status.
+     * Must be the same as the ATmega's BAUD_PROBATION.
      */
-    void serial_begin() {
+    #define BAUD_PROBATION 250
+
+    /** Time in ms to wait for the status that answers a CMD_BAUD packet */
+    #define BAUD_TIMEOUT 100
+
+    /** How often a new rate is asked for before giving up on it */
+    #define BAUD_TRIES 3
+
+    /** Rates serial_negotiate() steps through, SERIAL_BAUD_MAX caps them */
+    const unsigned long baud_rates[] = { 115200, 250000, 500000 };
+
+    /**
+     * @brief Sent along with a new rate to prove it works
+     *
+     * Must be the same as the ATmega's baud_pattern.
+     */
+    const uint8_t baud_pattern[] = { 0x55, 0xAA, 0xFF, 0x00, 0xF0, 0x0F, 0x33, 0xCC };
+
+    /**
+     * @brief A status on its way in over the serial port
+     *
+     * Between SOT and EOT come the events and their CRC, escaped like a
+     * packet. Once EOT arrives read_status() takes them over.
+     */
+    typedef struct status_frame_t {
+        uint8_t buff[STATUS_SIZE + STATS_SIZE + 2];
+        size_t  len;
+        bool    reading;
+        bool    escaped;
+    } status_frame_t;
+
+    status_frame_t status_frame;
+
+    /**
+     * @brief Takes the next byte of a status, see status_frame
+     *
+     * Bytes outside of a status are skipped. A SOT before the EOT means the
+     * status broke off, the SOT starts the next one.
+     *
+     * @return true if b completed a status
+     */
+    bool serial_status_byte(uint8_t b) {
+        if (!status_frame.reading) {
+            if (b == REQ_SOT) {
+                status_frame.len     = 0;
+                status_frame.reading = true;
+                status_frame.escaped = false;
+            }
+
+            return false;
+        }
+
+        if (status_frame.escaped) {
+            b                    ^= REQ_ESC_XOR;
+            status_frame.escaped  = false;
+        } else if (b == REQ_ESC) {
+            status_frame.escaped = true;
+            return false;
+        } else if (b == REQ_SOT) {
+            status_frame.len = 0;
+            return false;
+        } else if (b == REQ_EOT) {
+            status_frame.reading = false;
+            return true;
+        } else if (is_framing(b)) {
+            status_frame.reading = false;
+            return false;
+        }
+
+        // Longer than any status, it broke off
+        if (status_frame.len == sizeof(status_frame.buff)) {
+            status_frame.reading = false;
+            return false;
+        }
+
+        status_frame.buff[status_frame.len++] = b;
+
+        return false;
+    }
+
+    /**
+     * @brief Waits for a complete status from the ATmega
+     *
+     * Stricter than serial_update(): the status has to carry every event
+     * and the version has to match, so noise received at the wrong rate is
+     * not taken for an answer. The ATmega answers CMD_BAUD and CMD_STATUS
+     * with such a status.
+     *
+     * @param timeout Time in ms to wait
+     * @return true if a valid status arrived in time
+     */
+    bool serial_wait_status(unsigned long timeout) {
+        unsigned long start = millis();
+
+        status_frame.reading = false;
+
+        do {
+            if (!SERIAL_PORT.available()) {
+                delay(1);
+            } else if (serial_status_byte(serial_read()) &&
+                       read_status(status_frame.buff, status_frame.len) &&
+                       status_complete && (status.version == COM_VERSION)) {
+                return true;
+            }
+        } while (millis() - start < timeout);
+
+        return false;
+    }
+
+    /**
+     * @brief Sends a CMD_BAUD packet: the rate in decimal, plus the test pattern if test is set
+     */
+    void serial_send_baud(unsigned long rate, bool test) {
+        char payload[1 + 10 + sizeof(baud_pattern)];
+        int  len = sprintf(&payload[1], "%lu", rate) + 1;
+
+        payload[0] = CMD_BAUD;
+
+        if (test) {
+            memcpy(&payload[len], baud_pattern, sizeof(baud_pattern));
+            len += sizeof(baud_pattern);
+        }
+
+        uint8_t packet[2 * sizeof(payload) + PACKET_OVERHEAD];
+        size_t  n = frame_packet(packet, 0, payload, len);
+
+        SERIAL_PORT.write(packet, n);
+        SERIAL_PORT.flush();
+
+        stats.sent += n;
+    }
+
+    /**
+     * @brief Moves the link to a new rate
+     *
+     * Asks the ATmega for the rate at the current one, switches once it
+     * answered and proves the new rate with the test pattern. On any failure
+     * both sides end up at SERIAL_BAUD: the ATmega drops a rate that isn't
+     * proven within BAUD_PROBATION ms, and drops a proven one as soon as it
+     * receives bytes sent at another rate.
+     *
+     * @param rate Rate to switch to
+     * @return true if the link runs at rate now
+     */
+    bool serial_switch(unsigned long rate) {
+        bool answered = false;
+
+        for (uint8_t i = 0; i < BAUD_TRIES && !answered; ++i) {
+            serial_send_baud(rate, false);
+            answered = serial_wait_status(BAUD_TIMEOUT);
+        }
+
+        if (answered) {
+            SERIAL_PORT.begin(rate);
+
+            while (SERIAL_PORT.available()) SERIAL_PORT.read();
+
+            serial_send_baud(rate, true);
+
+            if (serial_wait_status(BAUD_TIMEOUT)) {
+                baud = rate;
+                return true;
+            }
+        }
+
+        debugf("Baud rate %lu failed\n", rate);
+
         SERIAL_PORT.begin(SERIAL_BAUD);
+        baud = SERIAL_BAUD;
+
+        delay(BAUD_PROBATION);
 
         while (SERIAL_PORT.available()) SERIAL_PORT.read();
 
-        debug("Connecting via serial");
+        return false;
+    }
+
+    /**
+     * @brief Steps the link up through baud_rates as far as both sides get
+     *
+     * If a rate fails the link is back at SERIAL_BAUD, so it goes straight
+     * back to the last rate that worked and stays there.
+     */
+    void serial_negotiate() {
+        for (size_t i = 0; i < sizeof(baud_rates) / sizeof(baud_rates[0]); ++i) {
+            unsigned long rate = baud_rates[i];
+            unsigned long last = baud;
+
+            if ((rate <= baud) || (rate > SERIAL_BAUD_MAX)) continue;
+
+            if (serial_switch(rate)) continue;
+
+            if (last != SERIAL_BAUD) serial_switch(last);
+
+            break;
+        }
+    }
+
+    /**
+     * @brief Negotiates the rate from SERIAL_BAUD up and asks the ATmega which sequence byte it expects
+     *
+     * Packets in flight go out again once it answered, see resend().
+     */
+    void serial_connect() {
+        SERIAL_PORT.begin(SERIAL_BAUD);
+        baud          = SERIAL_BAUD;
+        probe_pending = false;
+
+        while (SERIAL_PORT.available()) SERIAL_PORT.read();
+
+        serial_negotiate();
+
+        debugf("Serial link at %lu baud\n", baud);
+
+        for (uint8_t i = 0; i < BAUD_TRIES; ++i) {
+            probe();
+            if (serial_wait_status(BAUD_TIMEOUT)) break;
+        }
+    }
+
+    /**
+     * @brief Initializes the serial port and establishes connection with the ATmega
+     *
+     * Negotiates the fastest baud rate both sides can do, asks the ATmega
+     * which sequence byte it expects, sends MSG_CONNECTED to announce the
+     * ESP's presence, then calls update() to get the initial status.
+     */
+    void serial_begin() {
+        debugln("Connecting via serial");
 
         connection = true;
 
+        SERIAL_PORT.setRxBufferSize(SERIAL_RX_BUFFER);
+
+        serial_connect();
+
         send(MSG_CONNECTED);
 
         update();
@@ -372,122 +924,490 @@ namespace com {
      *
      * Handles three types of incoming data:
      *   1. SD packets (SD_SOT...SD_EOT): accumulated in sd_packet until complete
-     *   2. Status updates (SOT...EOT): parsed into the status struct
+     *   2. Status updates (SOT...EOT): accumulated in status_frame until complete
      *   3. Garbage bytes: discarded
      *
-     * When an SD packet is complete, is_ready is set and process_sd_package()
-     * is called from update(). When a status update arrives, react_on_status
-     * is set if the status is actionable.
+     * When an SD packet is complete and its CRC matches, is_ready is set and
+     * process_sd_package() is called from update(). One that doesn't match,
+     * or that a SOT or SD_SOT breaks off, is dropped, sd_timeout() asks for
+     * it again. A status update is taken over by
+     * read_status() if its CRC matches. A damaged one may have carried an
+     * event, the ATmega is asked for a status with all of them.
      */
     void serial_update() {
         while (SERIAL_PORT.available() > 0) {
 
-            #ifndef USE_SD_CARD
-            uint8_t header = SERIAL_PORT.peek();
-            #endif
-
             #ifdef USE_SD_CARD
             if (sd_packet.reading) {
-                uint8_t b = SERIAL_PORT.read();
-                
-                if (b == REQ_SD_EOT) {
-                    // End of SD packet — mark it ready for processing
+                uint8_t p = SERIAL_PORT.peek();
+
+                if (!sd_packet.escaped && ((p == REQ_SOT) || (p == REQ_SD_SOT))) {
+                    ++stats.dropped;
+                    sd_packet.clear();
+                    continue;
+                }
+
+                uint8_t b = serial_read();
+
+                if (sd_packet.escaped) {
+                    b                 ^= REQ_ESC_XOR;
+                    sd_packet.escaped  = false;
+                } else if (b == REQ_ESC) {
+                    sd_packet.escaped = true;
+                    continue;
+                } else if (b == REQ_SD_EOT) {
+                    size_t   len = sd_packet.len - 2;
+                    uint16_t crc = (sd_packet.len >= 2) ? (uint16_t)((sd_packet.buff[len] << 8) | sd_packet.buff[len + 1]) : 0;
+
+                    if ((sd_packet.len < 2) || (crc16(0xFFFF, sd_packet.buff, len) != crc)) {
+                        ++stats.dropped;
+                        sd_packet.clear();
+                        continue;
+                    }
+
+                    // End of SD packet — mark it ready for processing. The
+                    // next chunk of a read may follow right away, it waits
+                    // in the UART buffer until this one is processed.
+                    sd_packet.len      = len;
                     sd_packet.is_ready = true;
                     sd_packet.reading  = false;
-                    continue;
+                    break;
                 }
                 
-                if (sd_packet.len < BUFFER_SIZE) {
+                if (sd_packet.len < sizeof(sd_packet.buff)) {
                     sd_packet.buff[sd_packet.len++] = b;
-                } else if (sd_packet.len == BUFFER_SIZE) {
-                    // handle it differently
+                } else {
+                    // Longer than any packet, it broke off
+                    ++stats.dropped;
                     sd_packet.clear();
                 }
 
                 continue;
             }
             
-            uint8_t header = SERIAL_PORT.peek();
-            
-            if (header == REQ_SD_SOT) {
-                SERIAL_PORT.read();
+            // Outside of a session it's a damaged status byte, taking it
+            // for an SD packet would swallow the statuses that follow
+            if ((SERIAL_PORT.peek() == REQ_SD_SOT) && sd_session.is_active) {
+                serial_read();
+                status_frame.reading = false;
                 sd_packet.clear();
                 sd_packet.reading = true;
+                continue;
+            }
+            #endif
+
+            if (serial_status_byte(serial_read()) && !read_status(status_frame.buff, status_frame.len)) {
+                debugln("Damaged status");
+                if (!probe_pending) probe();
+            }
+        }
+    }
+
+#else // ifdef ENABLE_SERIAL
+    void serial_start_transmission() {}
+
+    void serial_stop_transmission() {}
+
+    void serial_transmit(char b) {}
+
+    void serial_connect() {}
+
+    void serial_begin() {}
+
+    void serial_update() {}
+
+#endif // ifdef ENABLE_SERIAL
+
+    /**
+     * @brief Wrapper that calls both I2C and Serial start functions
+     *
+     * Only one transport is active at a time, so one of these is a no-op.
+     */
+    void start_transmission() {
+        i2c_start_transmission();
+        serial_start_transmission();
+    }
+
+    /**
+     * @brief Wrapper that calls both I2C and Serial stop functions
+     */
+    void stop_transmission() {
+        i2c_stop_transmission();
+        serial_stop_transmission();
+    }
+
+    /**
+     * @brief Wrapper that calls both I2C and Serial transmit functions
+     */
+    void transmit(char b) {
+        i2c_transmit(b);
+        serial_transmit(b);
+
+        ++stats.sent;
+    }
+
+    /**
+     * @brief CRC-16 of every nibble value, polynomial x^16 + x^12 + x^5 + 1
+     *
+     * Must be the same as the ATmega's.
+     */
+    const uint16_t crc_table[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+        0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+    };
+
+    uint16_t crc16(uint16_t crc, const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; ++i) {
+            crc = (uint16_t)(crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] >> 4)];
+            crc = (uint16_t)(crc << 4) ^ crc_table[(crc >> 12) ^ (data[i] & 0x0F)];
+        }
+
+        return crc;
+    }
+
+    /**
+     * @brief Frames a payload: SOT, sequence byte, payload, CRC, EOT
+     *
+     * The CRC covers the sequence byte and the payload. It goes out as three
+     * bytes, 7, 7 and 2 bits of it starting with the highest, each with the
+     * high bit set so they can't be taken for framing bytes. Control packets
+     * (CMD_BAUD, CMD_STATUS) have no sequence byte, seq is 0 for them.
+     * Payload bytes are escaped, the CRC is taken before.
+     *
+     * @param out Room for 2 * len + PACKET_OVERHEAD bytes
+     * @return Number of bytes written to out
+     */
+    size_t frame_packet(uint8_t* out, uint8_t seq, const char* data, size_t len) {
+        size_t   n   = 0;
+        uint16_t crc = seq ? crc16(0xFFFF, &seq, 1) : 0xFFFF;
+
+        crc = crc16(crc, (const uint8_t*)data, len);
+
+        out[n++] = REQ_SOT;
+        if (seq) out[n++] = seq;
+        n       += escape(&out[n], (const uint8_t*)data, len);
+        out[n++] = 0x80 | (crc >> 9);
+        out[n++] = 0x80 | ((crc >> 2) & 0x7F);
+        out[n++] = 0x80 | (crc & 0x03);
+        out[n++] = REQ_EOT;
+
+        return n;
+    }
+
+    /**
+     * @brief Transmits a packet in flight over I2C or Serial
+     *
+     * If the packet is longer than PACKET_SIZE, it is fragmented across
+     * multiple transmissions, the most the ATmega's I2C buffer takes at once.
+     */
+    void transmit_packet(const in_flight_t& p) {
+        uint8_t packet[2 * BUFFER_SIZE + PACKET_OVERHEAD];
+        size_t  len = frame_packet(packet, p.seq, p.data, p.len);
+
+        for (size_t i = 0; i < p.len; ++i) {
+            if (p.data[i] != '\n') debug(p.data[i]);
+        }
+
+        start_transmission();
+
+        for (size_t i = 0; i < len; ++i) {
+            transmit(packet[i]);
+
+            if (((i + 1) % PACKET_SIZE == 0) && (i + 1 < len)) {
+                stop_transmission();
+                start_transmission();
+            }
+        }
+
+        stop_transmission();
+
+        new_transmission = true;
+    }
+
+    /**
+     * @brief Asks the ATmega for a status with a CMD_STATUS packet
+     *
+     * Sent when packets are in flight but no status came for a while, the
+     * packet or its status got lost. The ATmega answers with the sequence
+     * byte it needs next in status.nack, see resend().
+     */
+    void probe() {
+        const char cmd = CMD_STATUS;
+        uint8_t packet[1 + PACKET_OVERHEAD];
+        size_t  len = frame_packet(packet, 0, &cmd, 1);
 
-            } else 
-            #endif
-            
-            if (header == REQ_SOT) {
-                // Wait for the full status_t struct + SOT + EOT
-                if (SERIAL_PORT.available() < sizeof(status_t)+2) break;
+        debugln("Probing");
+
+        start_transmission();
 
-                SERIAL_PORT.read();
+        for (size_t i = 0; i < len; ++i) transmit(packet[i]);
 
-                uint16_t prev_wait = status.wait;
+        stop_transmission();
+
+        ++stats.probes;
 
-                status.version = SERIAL_PORT.read();
+        probe_pending    = true;
+        probe_seq        = next_seq;
+        new_transmission = true;
+    }
 
-                status.wait  = SERIAL_PORT.read();
-                status.wait |= uint16_t(SERIAL_PORT.read()) << 8;
+    /**
+     * @brief Sends a packet again the ATmega asked for with status.nack
+     *
+     * The ATmega keeps the packets that arrived after a damaged or missing
+     * one, so only that one goes out again. In reply to a probe the ATmega
+     * dropped them, so the ones sent before the probe follow. Except for
+     * the one at its parser, which it still executes: a probe reply with
+     * the sequence byte after it has nothing to send again. A probe reply
+     * with a sequence byte that isn't in flight otherwise means one side
+     * started over: the packets in flight are numbered from where the
+     * ATmega is.
+     *
+     * @param seq    Sequence byte in status.nack
+     * @param probed True if the status answers a probe
+     */
+    void resend(uint8_t seq, bool probed) {
+        uint8_t i = 0;
 
-                status.repeat = SERIAL_PORT.read();
+        while ((i < in_flight_len) && (in_flight_at(i).seq != seq)) ++i;
 
-                #ifdef USE_SD_CARD
-                status.sdcard_status = SERIAL_PORT.read();
-                sd_session.current_mode = (sdcard::SDStatus) status.sdcard_status;
-                #endif
+        if (i == in_flight_len) {
+            if (!probed) return;
 
-                status.loop = (int8_t)SERIAL_PORT.read();
+            // The packet in flight is at the ATmega's parser
+            if ((in_flight_len == 1) && (seq_after(in_flight_at(0).seq) == seq)) return;
 
-                react_on_status = status.wait == 0 ||
-                                  status.repeat > 0 ||
-                                  ((prev_wait&1) ^ (status.wait&1));
+            next_seq = seq;
 
-                while (SERIAL_PORT.available() && SERIAL_PORT.read() != REQ_EOT) {}
-            } else {
-                SERIAL_PORT.read();
+            for (i = 0; i < in_flight_len; ++i) {
+                in_flight_at(i).seq = next_seq;
+                next_seq            = seq_after(next_seq);
             }
 
+            probe_seq = next_seq;
+            i         = 0;
         }
-    }
 
-#else // ifdef ENABLE_SERIAL
-    void serial_start_transmission() {}
+        for (; (i < in_flight_len) && (in_flight_at(i).seq != probe_seq); ++i) {
+            debugf("Resending %u\n", in_flight_at(i).seq);
+            transmit_packet(in_flight_at(i));
 
-    void serial_stop_transmission() {}
+            ++stats.resent;
 
-    void serial_transmit(char b) {}
+            if (!probed) break;
+        }
+    }
 
-    void serial_begin() {}
+    /**
+     * @brief Bytes an event takes, its type included, 0 if the type is unknown
+     */
+    size_t event_size(uint8_t type) {
+        if (type == EVENT_DELAY_UNTIL) return 3;
+        if (type == EVENT_LINK_STATS) return STATS_SIZE;
+        if ((type >= EVENT_VERSION) && (type <= EVENT_PROGRESS)) return 2;
+        return 0;
+    }
 
-    void serial_update() {}
+    /**
+     * @brief Takes over the value of EVENT_LINK_STATS
+     *
+     * uart_peak and peak take two bytes, the other counters four, in the
+     * order of atmega_stats_t, each the low byte first.
+     */
+    void read_link_stats(const uint8_t* raw) {
+        unsigned long* counters[] = {
+            &atmega_stats.overruns, &atmega_stats.received, &atmega_stats.sent,
+            &atmega_stats.packets, &atmega_stats.dropped, &atmega_stats.nacks
+        };
+
+        atmega_stats.uart_peak = raw[0] | (raw[1] << 8);
+        atmega_stats.peak      = raw[2] | (raw[3] << 8);
+        raw += 4;
+
+        for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); ++i, raw += 4) {
+            *counters[i] = raw[0] | ((unsigned long)raw[1] << 8) |
+                           ((unsigned long)raw[2] << 16) | ((unsigned long)raw[3] << 24);
+        }
 
-#endif // ifdef ENABLE_SERIAL
+        stats_arrived = true;
+    }
 
     /**
-     * @brief Wrapper that calls both I2C and Serial start functions
+     * @brief Takes over the events of a status if the CRC after them matches
      *
-     * Only one transport is active at a time, so one of these is a no-op.
+     * Events the status doesn't carry keep their last value. Acknowledges
+     * packets, sends again what EVENT_NACK asks for and sets react_on_status
+     * if the status carries an event to act on (EVENT_DONE, EVENT_REPEAT,
+     * EVENT_LOOP, EVENT_DELAY_UNTIL) or every event.
+     *
+     * @param raw Events followed by their CRC, the high byte first
+     * @param len Bytes in raw
+     * @return false if the status was damaged
      */
-    void start_transmission() {
-        i2c_start_transmission();
-        serial_start_transmission();
+    bool read_status(const uint8_t* raw, size_t len) {
+        if (len < 2) return false;
+
+        len -= 2;
+
+        uint16_t crc = crc16(0xFFFF, raw, len);
+
+        if ((raw[len] != (crc >> 8)) || (raw[len + 1] != (crc & 0xFF))) {
+            ++stats.dropped;
+            return false;
+        }
+
+        // A type that is unknown or cut off means the events can't be trusted
+        for (size_t i = 0; i < len; i += event_size(raw[i])) {
+            if ((event_size(raw[i]) == 0) || (i + event_size(raw[i]) > len)) {
+                ++stats.dropped;
+                return false;
+            }
+        }
+
+        ++stats.statuses;
+
+        bool event = false;
+
+        status.nack     = 0;
+        status_complete = false;
+
+        for (size_t i = 0; i < len; i += event_size(raw[i])) {
+            uint8_t value = raw[i + 1];
+
+            switch (raw[i]) {
+                case EVENT_VERSION:
+                    status.version  = value;
+                    status_complete = true;
+                    event           = true;
+                    break;
+                case EVENT_WINDOW:
+                    status.window = value;
+                    break;
+                case EVENT_DONE:
+                    status.ack = value;
+                    event      = true;
+                    break;
+                case EVENT_REPEAT:
+                    status.repeat = value;
+                    event         = true;
+                    break;
+                case EVENT_LOOP:
+                    status.loop = (int8_t)value;
+                    event       = true;
+                    break;
+                case EVENT_SD_STATE:
+                    #ifdef USE_SD_CARD
+                    status.sdcard_status    = value;
+                    sd_session.current_mode = (sdcard::SDStatus)value;
+                    #endif
+                    break;
+                case EVENT_DELAY_UNTIL:
+                    status.delay = value | (uint16_t(raw[i + 2]) << 8);
+                    delay_time   = millis();
+                    event        = true;
+                    break;
+                case EVENT_NACK:
+                    status.nack = value;
+                    break;
+                case EVENT_LZ_WINDOW:
+                    status.lz_window = value;
+                    break;
+                case EVENT_PROGRESS:
+                    #ifdef USE_SD_CARD
+                    status.progress = value;
+                    #endif
+                    break;
+                case EVENT_LINK_STATS:
+                    read_link_stats(&raw[i + 1]);
+                    break;
+            }
+        }
+
+        bool probed = probe_pending;
+
+        probe_pending = false;
+        probe_time        = millis();
+        probe_timeout     = PROBE_TIMEOUT;
+        probes_unanswered = 0;
+
+        bool acked = acknowledge(status.ack);
+
+        if (status.nack) {
+            ++stats.nacks;
+            resend(status.nack, probed);
+        }
+
+        // Another status may have arrived since update() looked at the last one
+        react_on_status = react_on_status || acked || event;
+
+        return true;
     }
 
     /**
-     * @brief Wrapper that calls both I2C and Serial stop functions
+     * @brief Sends CMD_STATUS followed by CMD_LINK_STATS or CMD_LINK_RESET
      */
-    void stop_transmission() {
-        i2c_stop_transmission();
-        serial_stop_transmission();
+    void ask_stats(char what) {
+        const char cmd[] = { CMD_STATUS, what };
+        uint8_t packet[sizeof(cmd) + PACKET_OVERHEAD];
+        size_t  len = frame_packet(packet, 0, cmd, sizeof(cmd));
+
+        start_transmission();
+
+        for (size_t i = 0; i < len; ++i) transmit(packet[i]);
+
+        stop_transmission();
+
+        stats_asked = millis();
     }
 
     /**
-     * @brief Wrapper that calls both I2C and Serial transmit functions
+     * @brief Prints the LINK_STATS line through cli_print
+     *
+     * The ESP's counters as name=value pairs, the ATmega's follow with
+     * "atmega_" in front of their names.
+     *
+     * @param atmega True if EVENT_LINK_STATS came, false leaves the ATmega's counters out
      */
-    void transmit(char b) {
-        i2c_transmit(b);
-        serial_transmit(b);
+    void print_stats(bool atmega) {
+        link_stats_t s = get_link_stats();
+
+        String res = "";
+        res.reserve(384);
+
+        res += "LINK_STATS:sent=" + String(s.sent);
+        res += ",received=" + String(s.received);
+        res += ",packets=" + String(s.packets);
+        res += ",resent=" + String(s.resent);
+        res += ",statuses=" + String(s.statuses);
+        res += ",dropped=" + String(s.dropped);
+        res += ",nacks=" + String(s.nacks);
+        res += ",probes=" + String(s.probes);
+        res += ",wait_ms=" + String(s.wait_ms);
+        res += ",latency_max=" + String(s.latency_max);
+        res += ",baud=" + String(baud);
+
+        if (atmega) {
+            res += ",atmega_sent=" + String(atmega_stats.sent);
+            res += ",atmega_received=" + String(atmega_stats.received);
+            res += ",atmega_packets=" + String(atmega_stats.packets);
+            res += ",atmega_dropped=" + String(atmega_stats.dropped);
+            res += ",atmega_nacks=" + String(atmega_stats.nacks);
+            res += ",atmega_overruns=" + String(atmega_stats.overruns);
+            res += ",atmega_peak=" + String(atmega_stats.peak);
+            res += ",atmega_uart_peak=" + String(atmega_stats.uart_peak);
+        }
+
+        // Only now, a reset that went out with the first request would be
+        // lost along with the counters if the status with them got damaged
+        if (stats_reset) {
+            reset_link_stats();
+
+            if (atmega) ask_stats(CMD_LINK_RESET);
+        }
+
+        stats_reset = false;
+
+        if (cli_print) cli_print(res.c_str());
     }
 
     // ===== PUBLIC ===== //
@@ -500,12 +1420,22 @@ namespace com {
      */
     void begin() {
         status.version = 0;
-        status.wait    = 0;
+        status.delay   = 0;
         status.repeat  = 0;
+        status.loop    = 0;
+        status.ack     = 0;
+        status.window  = 0;
         #ifdef USE_SD_CARD
         status.sdcard_status = sdcard::SD_NOT_PRESENT;
+        status.progress      = 255;
         #endif
 
+        status.nack    = 0;
+
+        in_flight_len   = 0;
+        in_flight_bytes = 0;
+        probe_pending   = false;
+
         i2c_begin();
         serial_begin();
     }
@@ -538,87 +1468,264 @@ namespace com {
         return out;
     }
 
+    /**
+     * @brief Asks for the chunks of a read after the last one processed
+     *
+     * Acknowledging the last chunk again tells the ATmega the ones after
+     * it got lost. It also answers for an acknowledgement that got lost.
+     */
+    void read_again() {
+        uint8_t ack[2] = { SD_ACK, (uint8_t)(sd_session.seq - 1) };
+
+        send_sd(ack, sizeof(ack));
+
+        sd_session.time       = millis();
+        sd_session.read_again = true;
+    }
+
+    /**
+     * @brief True while the ESP waits for a packet from the ATmega
+     *
+     * The next chunk of a read or listing, or the SD_ACK for the last packet
+     * of a write.
+     */
+    bool sd_waiting() {
+        return sd_session.is_active &&
+               ((sd_session.op == sdcard::SD_READING) || (sd_session.op == sdcard::SD_LISTING) ||
+                ((sd_session.op == sdcard::SD_WRITING) && !sd_session.ready));
+    }
+
+    /**
+     * @brief Asks the ATmega again when nothing came for SD_TIMEOUT
+     *
+     * A write sends its last packet again, the packet or its SD_ACK got
+     * lost. A read or listing that got no packet yet sends its request
+     * again, the request or the first packet may have got lost. Once packets
+     * came, the last one is acknowledged again, see read_again(). The chunks that come
+     * in answer are the first since, a lost one among them is asked for
+     * right away.
+     *
+     * After SD_TRIES times in a row without an answer the operation ends
+     * with SD_END:ERROR and the ATmega is told to stop. Times a probe
+     * went unanswered before don't count: the link is down, once update()
+     * set it up again the operation goes on.
+     */
+    void sd_timeout() {
+        bool link_down = probes_unanswered > 1;
+
+        if (!link_down && (++sd_session.tries > SD_TRIES)) {
+            if (cli_print) cli_print("SD_END:ERROR");
+            send_sd(&sd_stop_val, 1);
+            return;
+        }
+
+        if (sd_session.last_len > 0) {
+            send_sd(sd_session.last, sd_session.last_len);
+            sd_session.time = millis();
+        } else {
+            read_again();
+            sd_session.read_again = false;
+        }
+    }
+
+    /**
+     * @brief True if the directory entries of a listing packet hold together
+     *
+     * Every entry is [4 bytes size][name][null], the name 1 to MAX_NAME bytes
+     * without control characters. Only the last entry may have an empty name,
+     * it ends the directory. The packet ends with an entry.
+     *
+     * @param b   Entries, the packet after its sequence number
+     * @param len Number of bytes in b
+     */
+    bool list_valid(const uint8_t* b, size_t len) {
+        size_t i = 0;
+
+        while (i < len) {
+            if (i + 5 > len) return false;
+
+            const char* name    = (const char*)&b[i + 4];
+            size_t      nameLen = strnlen(name, len - i - 4);
+
+            // The null is missing, or the name too long
+            if ((i + 4 + nameLen == len) || (nameLen > MAX_NAME)) return false;
+
+            for (size_t k = 0; k < nameLen; ++k) {
+                if (((uint8_t)name[k] < 0x20) || (name[k] == 0x7F)) return false;
+            }
+
+            i += 4 + nameLen + 1;
+
+            if (nameLen == 0) return i == len;
+        }
+
+        return true;
+    }
+
     /**
      * @brief Processes a complete SD packet from the ATmega
      *
-     * Dispatches based on sd_session.current_mode:
-     *   - WRITING: Expects SD_ACK from ATmega, sends "SD_ACK:OK" to browser
-     *   - READING: Formats data as "SD_CAT:data", sends to browser, sends SD_ACK back
-     *   - LISTING: Parses [size][filename], formats as "SD_LS:filename,size", sends ACK
+     * Dispatches based on sd_session.op:
+     *   - WRITING: Expects SD_ACK and the sequence number of the last packet
+     *     from ATmega, takes it as credit for the next chunk and sends
+     *     "SD_ACK:OK" to browser. One for a packet sent again is ignored
+     *   - READING: Formats data as "SD_CAT:data", sends to browser, acknowledges
+     *     the chunk with SD_ACK and its sequence number. The empty chunk that
+     *     ends the file is acknowledged as well, the ATmega closes it then
+     *   - LISTING: Checks the [size][filename] entries of the packet with
+     *     list_valid(), turns them into one "SD_LS:filename,size" message, a
+     *     line per entry, and acknowledges the packet with SD_ACK and its
+     *     sequence number. The packet before, sent again, is acknowledged
+     *     again
      *
      * All responses are sent via cli_print. If cli_print is not set, the packet
      * is silently discarded.
      */
     void process_sd_package() {
+        // The ATmega is still at it, see the probe in update(). Chunks
+        // that come after others got lost hold off sd_timeout() as well,
+        // the ones sent again are behind them.
+        probe_time      = millis();
+        sd_session.time = millis();
+
         if (!cli_print) {
             sd_packet.clear();
             return;
         }
 
-        if (sd_session.current_mode == sdcard::SD_WRITING) {
+        if (sd_session.op == sdcard::SD_WRITING) {
 
-            if (sd_packet.len != 1 || sd_packet.buff[0] != SD_ACK) {
-                // Unexpected response — abort the write
+            if (sd_packet.len != 2 || sd_packet.buff[0] != SD_ACK) {
+                // Unexpected response — abort the write. cli_print() keeps
+                // the order of the messages, nothing has to wait between them.
                 cli_print(String(sd_packet.buff[0]).c_str());
-                delay(60);
                 cli_print("SD_ACK:ERROR");
-                delay(60);
-                
                 cli_print("SD_END:ERROR");
-                delay(60);
-                
+
                 send_sd(&sd_stop_val, 1);
                 return;
             }
             
-            delay(35);
+            // The answer to a packet that was sent again, or to one before
+            if (sd_session.ready || (sd_packet.buff[1] != sd_session.last[1])) {
+                sd_packet.clear();
+                return;
+            }
+
+            sd_session.ready = true;
+            sd_session.tries = 0;
             cli_print("SD_ACK:OK");
             sd_packet.clear();
             return;
         }
 
-        if (sd_session.current_mode == sdcard::SD_READING) {
-            if (sd_packet.len + 8 > CLI_BUFFER) {
+        if (sd_session.op == sdcard::SD_READING) {
+            if ((sd_packet.len == 0) || (sd_packet.len + 7 > CLI_BUFFER)) {
                 // Buffer too small for the response — skip this chunk
+                sd_packet.clear();
+                return;
+            }
+
+            uint8_t seq = sd_packet.buff[0];
+
+            // A chunk got lost, the ATmega sends it and the ones after it again
+            if (seq != sd_session.seq) {
+                if (!sd_session.read_again) read_again();
+                sd_packet.clear();
                 return;
             }
 
-            memcpy(cli_buffer, "SD_CAT:", 7);
-            memcpy(&cli_buffer[7], sd_packet.buff, sd_packet.len);
+            ++sd_session.seq;
+            sd_session.time       = millis();
+            sd_session.tries      = 0;
+            sd_session.read_again = false;
+            sd_session.last_len   = 0;
 
-            cli_buffer[sd_packet.len + 7] = '\0';
+            if (sd_packet.len == 1) {
+                sd_session.end = true;
+            } else {
+                memcpy(cli_buffer, "SD_CAT:", 7);
+                memcpy(&cli_buffer[7], &sd_packet.buff[1], sd_packet.len - 1);
+
+                cli_buffer[sd_packet.len + 6] = '\0';
+
+                cli_print(cli_buffer);
+            }
 
-            cli_print(cli_buffer);
-            delay(35);
+            // Makes room for this chunk and the ones before it
+            uint8_t ack[2] = { SD_ACK, seq };
 
-            if (sd_session.is_active) send_sd(&sd_ack_val, 1);
+            if (sd_session.is_active) send_sd(ack, sizeof(ack));
             sd_packet.clear();
             return;
         }
         
-        if (sd_packet.is_ready && sd_session.current_mode == sdcard::SD_LISTING) {
-            
-            if (sd_packet.len < 8 ) return;
+        if (sd_packet.is_ready && sd_session.op == sdcard::SD_LISTING) {
+            if (sd_packet.len == 0) {
+                sd_packet.clear();
+                return;
+            }
+
+            // The packet before came again, its SD_ACK got lost
+            if (sd_packet.buff[0] != sd_session.seq) {
+                if (!sd_session.read_again) read_again();
+                sd_packet.clear();
+                return;
+            }
 
-            // Parse the 4-byte little-endian file size
-            uint32_t fileSize = (uint32_t)sd_packet.buff[0] |
-                                ((uint32_t)sd_packet.buff[1] << 8) |
-                                ((uint32_t)sd_packet.buff[2] << 16) |
-                                ((uint32_t)sd_packet.buff[3] << 24);
+            // Nothing of it is printed, sd_timeout() asks for it again
+            if (!list_valid(&sd_packet.buff[1], sd_packet.len - 1)) {
+                ++stats.dropped;
+                sd_packet.clear();
+                return;
+            }
 
+            uint8_t seq = sd_packet.buff[0];
+            char*   p   = ls_buffer;
+            size_t  i   = 1;
 
-            char* p = cli_buffer;
+            ++sd_session.seq;
+            sd_session.tries      = 0;
+            sd_session.read_again = false;
+            sd_session.last_len   = 0;
 
             memcpy(p, "SD_LS:", 6); p += 6;
-            memcpy(p, &sd_packet.buff[4], sd_packet.len - 4); p += sd_packet.len - 4;
-            *p++ = ',';
 
-            u32_to_str(fileSize, p);
+            // Every entry is [4 bytes size][name][null], an empty name ends the directory
+            while (i < sd_packet.len) {
+                uint32_t fileSize = (uint32_t)sd_packet.buff[i] |
+                                    ((uint32_t)sd_packet.buff[i + 1] << 8) |
+                                    ((uint32_t)sd_packet.buff[i + 2] << 16) |
+                                    ((uint32_t)sd_packet.buff[i + 3] << 24);
+
+                const char* name    = (const char*)&sd_packet.buff[i + 4];
+                size_t      nameLen = strlen(name);
+
+                if (nameLen == 0) {
+                    sd_session.end = true;
+                    break;
+                }
+
+                // One entry per line
+                if (p > ls_buffer + 6) *p++ = '\n';
+
+                memcpy(p, name, nameLen); p += nameLen;
+                *p++ = ',';
 
-            cli_print(cli_buffer);
-            delay(35);
+                u32_to_str(fileSize, p);
+                p += strlen(p);
 
-            if (sd_session.is_active) send_sd(&sd_ack_val, 1);
+                i += 4 + nameLen + 1;
+            }
+
+            *p = '\0';
+
+            if (p > ls_buffer + 6) cli_print(ls_buffer);
+
+            // The last packet too, the ATmega closes the directory then
+            uint8_t ack[2] = { SD_ACK, seq };
+
+            if (sd_session.is_active) send_sd(ack, sizeof(ack));
             sd_packet.clear();
             return;
         }
@@ -628,11 +1735,11 @@ namespace com {
     /**
      * @brief Sends a final status message when an SD operation completes
      *
-     * Called when sd_session.current_mode returns to IDLE, ERROR, or NOT_PRESENT.
-     * Sends "SD_END:OK", "SD_END:ERROR", or "SD_END:NOT_PRESENT" to the browser.
+     * Called when sd_session.current_mode returns to IDLE, ERROR, or NOT_PRESENT
+     * after the operation, see update(). Sends "SD_END:OK", "SD_END:ERROR", or
+     * "SD_END:NOT_PRESENT" to the browser.
      */
     void process_sd_finish() {
-        delay(35);
         if (sd_session.current_mode == sdcard::SD_ERROR) cli_print("SD_END:ERROR");
         else if (sd_session.current_mode == sdcard::SD_NOT_PRESENT) cli_print("SD_END:NOT_PRESENT");
         else cli_print("SD_END:OK");
@@ -645,7 +1752,8 @@ namespace com {
      * @brief Main update function — polls for status and processes SD packets
      *
      * Called from the main loop every tick. Does three things:
-     *   1. Polls I2C or reads Serial to get fresh status from the ATmega
+     *   1. Polls I2C or reads Serial to get fresh status from the ATmega,
+     *      and probes it if packets are in flight but no status came
      *   2. Processes complete SD packets if is_ready is set
      *   3. Fires callbacks based on the status (error, repeat, done)
      *
@@ -656,6 +1764,45 @@ namespace com {
         i2c_update();
         serial_update();
 
+        // A packet or its status got lost, ask where the ATmega stands. That
+        // includes the EVENT_DELAY_UNTIL 0 that ends a delay. While it works
+        // through a DELAY it has nothing to say, nor does it while a read or
+        // listing waits for the next packet. If it doesn't answer either,
+        // it went back to SERIAL_BAUD or restarted.
+        unsigned long since = probe_time;
+
+        if ((status.delay > 0) && ((long)(delay_time + status.delay - since) > 0)) since = delay_time + status.delay;
+
+        bool waiting = (in_flight_len > 0) || (status.delay > 0);
+
+        #ifdef USE_SD_CARD
+        waiting = waiting || sd_waiting();
+        #endif
+
+        if (connection && waiting && ((long)(millis() - since) > (long)probe_timeout)) {
+            if (probes_unanswered < PROBE_RECONNECT) {
+                probe();
+
+                ++probes_unanswered;
+                probe_timeout = probe_timeout * 2 < PROBE_MAX ? probe_timeout * 2 : PROBE_MAX;
+            } else {
+                serial_connect();
+            }
+
+            probe_time = millis();
+        }
+
+        // The ATmega's counters came or didn't come in time. Until then it
+        // is asked again, the status with them may have been damaged.
+        if (stats_pending) {
+            if (stats_arrived || (millis() - stats_time > STATS_TIMEOUT)) {
+                stats_pending = false;
+                print_stats(stats_arrived);
+            } else if (millis() - stats_asked > PROBE_TIMEOUT) {
+                ask_stats(CMD_LINK_STATS);
+            }
+        }
+
         #ifdef USE_SD_CARD
 
         // Process SD packets before status events so the browser gets data
@@ -665,9 +1812,18 @@ namespace com {
             return;
         }
 
+        // Neither the next chunk or listing packet nor the end came, the
+        // ATmega didn't tell it closed the file or directory, or a chunk of
+        // a write wasn't acknowledged
+        if (sd_waiting() && (millis() - sd_session.time > SD_TIMEOUT)) {
+            sd_timeout();
+        }
+
         // If an SD session is active but the ATmega has returned to IDLE,
-        // the operation is complete
-        if (sd_session.is_active && !sd_packet.reading && sd_session.current_mode <= sdcard::SD_IDLE) {
+        // the operation is complete. A read or listing ends with its last
+        // packet, an IDLE before that one is from before it started.
+        if (sd_session.is_active && !sd_packet.reading && (sd_session.current_mode < sdcard::SD_READING) &&
+            (sd_session.end || (sd_session.op == sdcard::SD_EXECUTING) || (sd_session.current_mode != sdcard::SD_IDLE))) {
             process_sd_finish();
             return;
         }
@@ -688,12 +1844,13 @@ namespace com {
                     waiting_ack_cmd_key = false;
                 }
                 if (callback_error) callback_error();
-            } else if (status.wait > 0) {
-                debugf("PROCESSING %u\n", status.wait);
+            } else if ((in_flight_len > 0) || (status.delay > 0)) {
+                debugf("PROCESSING %u\n", status.delay);
+                if (callback_ready) callback_ready();
             } else if (status.repeat > 0) {
                 debugf("REPEAT %u\n", status.repeat);
                 if (callback_repeat) callback_repeat();
-            } else if ((status.wait == 0) && (status.repeat == 0)) {
+            } else if ((status.delay == 0) && (status.repeat == 0)) {
                 debugln("DONE");
 
                 if (waiting_ack_cmd_key) {
@@ -725,9 +1882,14 @@ namespace com {
     /**
      * @brief Sends a DuckyScript command to the ATmega
      *
-     * Wraps the command in SOT...EOT framing and transmits it over I2C or Serial.
-     * If the command is longer than PACKET_SIZE, it is fragmented across multiple
-     * transmissions to avoid overflowing I2C buffers.
+     * Wraps the command in SOT...EOT framing and transmits it over I2C or
+     * Serial, see frame_packet(). The first byte after SOT is the packet's
+     * sequence byte, it has the high bit set so it can't be taken for a
+     * framing byte. The packet stays in flight until a status acknowledges
+     * it, until then it can be sent again, see resend().
+     *
+     * The packet is sent even if can_send() says no, callers that send more
+     * than one packet at a time ask it first.
      *
      * Sets new_transmission = true to trigger an immediate status poll.
      *
@@ -735,52 +1897,49 @@ namespace com {
      * @param len Number of bytes to send
      * @param waiting_ack If true, sets waiting_ack_cmd_key so "KEY_ACK:OK" is
      *                    sent to the browser when the command completes
-     * @return Number of payload bytes sent (excludes SOT/EOT)
+     * @return Number of payload bytes sent (excludes framing)
      */
-    unsigned int send(const char* str, size_t len, bool waiting_ack) {
+    unsigned int send(const char* str, unsigned int len, bool waiting_ack) {
         waiting_ack_cmd_key = waiting_ack;
 
         // ! Truncate string to fit into buffer
         if (len > BUFFER_SIZE) len = BUFFER_SIZE;
 
-        size_t sent = 0; // byte sent overall
-        size_t i    = 0; // index of string
-        size_t j    = 0; // byte sent for current packet
-
-        start_transmission();
-
-        transmit(REQ_SOT);
-
-        ++sent;
-        ++j;
-
-        while (i < len) {
-            char b = str[i];
-            
-            if ((b != '\n') && (b != '\n')) debug(b);
-            transmit(b);
+        transmit_packet(track(str, len));
 
-            ++i;
-            ++j;
-            ++sent;
+        ++stats.packets;
 
-            if (j == PACKET_SIZE/*sent % PACKET_SIZE == 0*/) {
-                stop_transmission();
-                start_transmission();
-                j = 0;
-            }
-        }
+        return len;
+    }
 
-        transmit(REQ_EOT);
+    /**
+     * @brief Returns true if a packet of len bytes can be sent without waiting
+     *
+     * While the ATmega types a line its loop() doesn't run, so everything
+     * sent after the oldest packet in flight has to fit into what it can
+     * buffer meanwhile. It tells how much that is in status.window. A packet
+     * that doesn't fit even then is sent once nothing is in flight.
+     *
+     * @param str Payload of the packet
+     * @param len Payload bytes of the packet
+     */
+    bool can_send(const char* str, unsigned int len) {
+        if (in_flight_len == 0) return true;
+        if (in_flight_len >= window) return false;
 
-        ++sent;
+        unsigned int ahead = in_flight_bytes - in_flight_buf[in_flight_start].bytes;
 
-        stop_transmission();
+        if (len > BUFFER_SIZE) len = BUFFER_SIZE;
 
-        new_transmission = true;
+        // Leaves room for a probe, it has as much framing as a packet
+        return ahead + escaped_len(str, len) + PACKET_OVERHEAD + 1 + PACKET_OVERHEAD <= status.window;
+    }
 
-        // ! Return number of characters sent, minus 2 due to the signals
-        return sent-2;
+    /**
+     * @brief Returns the number of packets the ATmega hasn't acknowledged yet
+     */
+    uint8_t in_flight() {
+        return in_flight_len;
     }
 
     /**
@@ -811,6 +1970,15 @@ namespace com {
         callback_loop = c;
     }
 
+    /**
+     * @brief Registers the callback for when an ack makes room for more packets
+     *
+     * Fires while the ATmega is still busy, onDone fires once it is idle.
+     */
+    void onReady(com_callback c) {
+        callback_ready = c;
+    }
+
     /**
      * @brief Returns true if the connection to the ATmega is healthy
      */
@@ -827,6 +1995,13 @@ namespace com {
         return status.sdcard_status;
     }
 
+    /**
+     * @brief Returns the percent of the SD script that ran, 255 if the ATmega can't tell
+     */
+    uint8_t get_sd_progress() {
+        return status.progress;
+    }
+
     /**
      * @brief Sets the SD session mode
      *
@@ -839,6 +2014,14 @@ namespace com {
         if (s >= sdcard::SD_READING) sd_session.is_active = true;
         else sd_session.is_active = false;
         sd_session.current_mode = s;
+        sd_session.op           = s;
+        sd_session.ready        = false;
+        sd_session.end          = false;
+        sd_session.seq          = 0;
+        sd_session.time         = millis();
+        sd_session.tries        = 0;
+        sd_session.read_again   = false;
+        sd_session.last_len     = 0;
     }
 
     /**
@@ -855,11 +2038,21 @@ namespace com {
         return sd_session.is_active;
     }
 
+    /**
+     * @brief Returns true if the ATmega is ready for the next write chunk
+     */
+    bool sd_ready() {
+        return sd_session.ready;
+    }
+
     /**
      * @brief Sends an SD card command or data to the ATmega
      *
-     * Wraps the data in SD_SOT...SD_EOT framing. Auto-detects SD_CMD_STOP and
-     * SD_CMD_STOP_RUN to reset the session state.
+     * Wraps the data in SD_SOT...SD_EOT framing, its CRC goes before SD_EOT
+     * like the ATmega's. Auto-detects SD_CMD_STOP and SD_CMD_STOP_RUN to reset
+     * the session state. What isn't an SD_ACK is kept while the session is
+     * active, sd_timeout() may send it again. A packet of a write gets its
+     * sequence number after SD_CMD_WRITE, see SD_ACK.
      *
      * @param data Buffer containing the SD command or data
      * @param len  Number of bytes to send
@@ -876,13 +2069,44 @@ namespace com {
             sd_packet.clear();
         }
         
+        // The ATmega acknowledges every packet of a write with SD_ACK
+        if (sd_session.op == sdcard::SD_WRITING) sd_session.ready = false;
+
+        if (sd_session.is_active && (data[0] != SD_ACK) && (data != sd_session.last)) {
+            if ((sd_session.op == sdcard::SD_WRITING) && (data[0] == SD_CMD_WRITE)) {
+                if (len == BUFFER_SIZE) len = BUFFER_SIZE - 1;
+
+                sd_session.last[0] = SD_CMD_WRITE;
+                sd_session.last[1] = sd_session.seq;
+                memcpy(&sd_session.last[2], &data[1], len - 1);
+                sd_session.last_len = len + 1;
+
+                sd_session.seq  = (sd_session.seq == 255) ? 1 : sd_session.seq + 1;
+                sd_session.time = millis();
+
+                data = sd_session.last;
+                len  = sd_session.last_len;
+            } else {
+                memcpy(sd_session.last, data, len);
+                sd_session.last_len = len;
+            }
+        }
+
+        uint16_t crc     = crc16(0xFFFF, data, len);
+        uint8_t  tail[2] = { (uint8_t)(crc >> 8), (uint8_t)crc };
+
         start_transmission();
         transmit(REQ_SD_SOT);
 
-        // Small delay between bytes for Serial stability
-        for (size_t i = 0; i < len; i++) {
-            transmit(data[i]);
-            delay(5);
+        for (size_t i = 0; i < len + sizeof(tail); i++) {
+            uint8_t c = (i < len) ? data[i] : tail[i - len];
+
+            if (is_framing(c)) {
+                transmit(REQ_ESC);
+                transmit(c ^ REQ_ESC_XOR);
+            } else {
+                transmit(c);
+            }
         }
         
         transmit(REQ_SD_EOT);
@@ -915,6 +2139,13 @@ namespace com {
         return status.version;
     }
 
+    /**
+     * @brief Returns the rate the serial link negotiated, 0 over I2C
+     */
+    unsigned long get_baud() {
+        return baud;
+    }
+
     /**
      * @brief Returns the expected protocol version
      */
@@ -922,4 +2153,66 @@ namespace com {
         return COM_VERSION;
     }
 
+    /**
+     * @brief Returns the bytes of earlier text the ATmega keeps for compressed lines, 0 if none
+     */
+    size_t get_lz_window() {
+        return status.lz_window * 16;
+    }
+
+    /**
+     * @brief Returns the link counters
+     *
+     * wait_ms includes the packets in flight right now. Next to the time a
+     * script ran it tells whether the ATmega kept up: if it is close, the
+     * ESP waited for the keystrokes; if it is far off and sent, resent or
+     * dropped are high, it waited for the link.
+     */
+    link_stats_t get_link_stats() {
+        link_stats_t s = stats;
+
+        if (in_flight_len > 0) s.wait_ms += millis() - wait_start;
+
+        return s;
+    }
+
+    /**
+     * @brief Starts the link counters over
+     */
+    void reset_link_stats() {
+        memset(&stats, 0, sizeof(stats));
+        wait_start = millis();
+    }
+
+    /**
+     * @brief Prints the link counters of both sides as one LINK_STATS line
+     *
+     * The ATmega is asked for its counters with CMD_STATUS and
+     * CMD_LINK_STATS, the line goes out through the print callback once
+     * they come with a status, see update(). Over I2C, while not connected
+     * or if they don't come within STATS_TIMEOUT, the line only has the
+     * ESP's counters and the ATmega's aren't reset.
+     *
+     * @param reset True to start the counters of both sides over once they are printed
+     */
+    void print_link_stats(bool reset) {
+        stats_reset = stats_reset || reset;
+
+        if (stats_pending) return;
+
+        #ifdef ENABLE_SERIAL
+        if (connection) {
+            stats_pending = true;
+            stats_arrived = false;
+            stats_time    = millis();
+
+            ask_stats(CMD_LINK_STATS);
+
+            return;
+        }
+        #endif
+
+        print_stats(false);
+    }
+
 }
\ No newline at end of file
@@ -14,6 +14,22 @@ typedef void (* com_callback)();
 
 typedef void (*print_callback)(const char* str);
 
+/*! \typedef link_stats_t
+ *  \brief What went over the link to the ATmega and how long it kept the ESP waiting
+ */
+typedef struct link_stats_t {
+    unsigned long sent;        // !< Bytes that went out, framing included
+    unsigned long received;    // !< Bytes that came in, statuses and SD card data
+    unsigned long packets;     // !< Packets sent, not counting the ones sent again
+    unsigned long resent;      // !< Packets sent again
+    unsigned long statuses;    // !< Statuses that arrived intact
+    unsigned long dropped;     // !< Statuses and SD packets dropped because they arrived damaged
+    unsigned long nacks;       // !< Packets the ATmega asked for again
+    unsigned long probes;      // !< Times the ATmega was asked where it stands
+    unsigned long wait_ms;     // !< Time packets were in flight, the ATmega was at work
+    unsigned long latency_max; // !< Longest time in ms from sending a packet to the status that acknowledged it
+} link_stats_t;
+
 #include "sdcard.h"
 #include "config.h"
 
@@ -44,6 +60,15 @@ namespace com {
     /*! Sets callback for status loop */
     void onLoop(com_callback c);
 
+    /*! Sets callback for room in the send window */
+    void onReady(com_callback c);
+
+    /*! Returns true if a packet with str as payload can be sent ahead */
+    bool can_send(const char* str, unsigned int len);
+
+    /*! Returns the number of packets not acknowledged yet */
+    uint8_t in_flight();
+
     /*! Returns state of connection */
     bool connected();
 
@@ -56,6 +81,9 @@ namespace com {
     /*! Returns the current SD card status */
     int get_sdcard_status();
 
+    /*! Returns how far the SD script got in percent, 255 if unknown */
+    uint8_t get_sd_progress();
+
     /*! Returns the current SD card mode */
     sdcard::SDStatus get_mode();
 
@@ -64,6 +92,9 @@ namespace com {
 
     /*! Checks if an SD card session is active*/
     bool is_session_active();
+
+    /*! Returns true if the ATmega can take the next chunk of a write */
+    bool sd_ready();
     #endif
 
     /*! Returns the current loop counter */
@@ -75,6 +106,21 @@ namespace com {
     /*! Returns the communication protocol version */
     int get_com_version();
 
+    /*! Returns how far back compressed text may refer, see compressor.cpp */
+    size_t get_lz_window();
+
+    /*! Returns the baud rate of the serial link, 0 over I2C */
+    unsigned long get_baud();
+
     /*! Returns the firmware version */
     int get_version();
+
+    /*! Returns the link counters */
+    link_stats_t get_link_stats();
+
+    /*! Starts the link counters over */
+    void reset_link_stats();
+
+    /*! Prints the link counters of both sides through the print callback, see link_stats in cli.cpp */
+    void print_link_stats(bool reset);
 }
\ No newline at end of file
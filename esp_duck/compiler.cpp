@@ -0,0 +1,651 @@
+/*!
+    \file esp_duck/compiler.cpp
+    \brief DuckyScript lines to the ATmega's bytecode
+    \copyright MIT License
+
+    Every line duckscript sends goes through compile() first. It splits and
+    classifies the line the way duckparser::parse() on the ATmega does and
+    writes down what the ATmega would do with it: keys to press, text to
+    type, the numbers of DELAY, REPEAT and LOOP_BEGIN already converted.
+    The ATmega runs that with duckparser::exec() and never looks at the text.
+
+    STRING, REM and LSTRING blocks span lines and packets, so the compiler
+    keeps the same flags as the parser and every line has to go through it
+    in the order it is sent. Lines it leaves to the parser (LOCALE, LED,
+    mouse, KEYCODE, TYPING_RATE and anything unusual) are sent as text.
+
+    Once the script has set its layout with LOCALE, the text of STRING,
+    STRINGLN and LSTRING lines is looked up in a copy of that layout, see
+    layout.cpp, and sent as the keys that type it. Before that the ATmega
+    may still have the layout of an earlier script or key command, so the
+    text goes as it is and the ATmega looks it up.
+
+    Text and keys that come out shorter compressed go as OP_LZ, see
+    compressor.cpp. The ATmega says how much earlier text it keeps for
+    that, reset() takes it for every script.
+
+    It follows the parser of the USE_SD_CARD build, the one the ATmega's
+    config.h selects: words are split on spaces only, at most MAX_WORDS of
+    them, and STRING text starts right after the command.
+
+    The names are a copy of atmega_duck/src/duckparser/keywords.cpp, the
+    ESP8266 sketch can't include the ATmega's files.
+ */
+
+#include "compiler.h"
+
+#include "compressor.h"
+#include "config.h"
+#include "layout.h"
+
+#include <string.h> // memcmp, strlen
+
+namespace compiler {
+    // ===== PRIVATE ===== //
+
+    /*! Words the ATmega splits a line into, MAX_WORD_NODES of its parser */
+    #define MAX_WORDS 5
+
+    // Commands
+    #define COMMAND_KEYS          0 // !< Not a command, the line is a key combination
+    #define COMMAND_OTHER         1 // !< Left to the parser, the line is sent as text
+    #define COMMAND_LSTRING       2
+    #define COMMAND_STRING        3
+    #define COMMAND_STRINGLN      4
+    #define COMMAND_REM           5
+    #define COMMAND_DELAY         6
+    #define COMMAND_DEFAULT_DELAY 7
+    #define COMMAND_REPEAT        8
+    #define COMMAND_LOOP_BEGIN    9
+    #define COMMAND_LOOP_END      10
+    #define COMMAND_LOCALE        11 // !< Sent as text, the compiler only follows the layout
+
+    typedef struct keyword_t {
+        const char* name;
+        uint8_t     code; // !< COMMAND_ code, or the op that presses the key
+    } keyword_t;
+
+    const keyword_t commands[] = {
+        { "LSTRING_BEGIN", COMMAND_LSTRING },
+        { "LSTRING_END", COMMAND_LSTRING },
+        { "STRING", COMMAND_STRING },
+        { "STRINGLN", COMMAND_STRINGLN },
+        { "REM", COMMAND_REM },
+        { "DELAY", COMMAND_DELAY },
+        { "DEFAULT_DELAY", COMMAND_DEFAULT_DELAY },
+        { "REPEAT", COMMAND_REPEAT },
+        { "LOOP_BEGIN", COMMAND_LOOP_BEGIN },
+        { "LOOP_END", COMMAND_LOOP_END },
+        { "LOCALE", COMMAND_LOCALE },
+        { "LED", COMMAND_OTHER },
+        { "M_MOVE", COMMAND_OTHER },
+        { "M_CLICK", COMMAND_OTHER },
+        { "M_PRESS", COMMAND_OTHER },
+        { "M_RELEASE", COMMAND_OTHER },
+        { "M_SCROLL", COMMAND_OTHER },
+        { "KEYCODE", COMMAND_OTHER },
+        { "TYPING_RATE", COMMAND_OTHER },
+    };
+
+    #define KEY(code) (OP_KEY + (code))
+    #define MODIFIER(bit) (OP_MODIFIER + (bit))
+
+    const keyword_t keys[] = {
+        { "ENTER", KEY(0x28) },
+        { "MENU", KEY(0x76) },
+        { "DELETE", KEY(0x4c) },
+        { "BACKSPACE", KEY(0x2a) },
+        { "HOME", KEY(0x4a) },
+        { "INSERT", KEY(0x49) },
+        { "PAGEUP", KEY(0x4b) },
+        { "PAGEDOWN", KEY(0x4e) },
+        { "UP", KEY(0x52) },
+        { "DOWN", KEY(0x51) },
+        { "LEFT", KEY(0x50) },
+        { "RIGHT", KEY(0x4f) },
+        { "TAB", KEY(0x2b) },
+        { "END", KEY(0x4d) },
+        { "ESC", KEY(0x29) },
+        { "F1", KEY(0x3a) },
+        { "F2", KEY(0x3b) },
+        { "F3", KEY(0x3c) },
+        { "F4", KEY(0x3d) },
+        { "F5", KEY(0x3e) },
+        { "F6", KEY(0x3f) },
+        { "F7", KEY(0x40) },
+        { "F8", KEY(0x41) },
+        { "F9", KEY(0x42) },
+        { "F10", KEY(0x43) },
+        { "F11", KEY(0x44) },
+        { "F12", KEY(0x45) },
+        { "SPACE", KEY(0x2c) },
+        { "PAUSE", KEY(0x48) },
+        { "BREAK", KEY(0x48) },
+        { "CAPSLOCK", KEY(0x39) },
+        { "NUMLOCK", KEY(0x53) },
+        { "PRINTSCREEN", KEY(0x46) },
+        { "SCROLLLOCK", KEY(0x47) },
+
+        // Numpad keys
+        { "NUM_0", KEY(0x62) },
+        { "NUM_1", KEY(0x59) },
+        { "NUM_2", KEY(0x5a) },
+        { "NUM_3", KEY(0x5b) },
+        { "NUM_4", KEY(0x5c) },
+        { "NUM_5", KEY(0x5d) },
+        { "NUM_6", KEY(0x5e) },
+        { "NUM_7", KEY(0x5f) },
+        { "NUM_8", KEY(0x60) },
+        { "NUM_9", KEY(0x61) },
+        { "NUM_ASTERIX", KEY(0x55) },
+        { "NUM_ENTER", KEY(0x58) },
+        { "NUM_MINUS", KEY(0x56) },
+        { "NUM_DOT", KEY(0x63) },
+        { "NUM_PLUS", KEY(0x57) },
+
+        // Modifiers, by bit
+        { "CTRL", MODIFIER(0) },
+        { "CONTROL", MODIFIER(0) },
+        { "SHIFT", MODIFIER(1) },
+        { "ALT", MODIFIER(2) },
+        { "WINDOWS", MODIFIER(3) },
+        { "GUI", MODIFIER(3) },
+    };
+
+    // The parser's flags, as they are on the ATmega after the last line compiled
+    bool isStringln = false;
+    bool inString   = false;
+    bool inLString  = false;
+    bool inComment  = false;
+
+    /** Layout the ATmega types with, NULL while the script hasn't set it */
+    hid_locale_t* locale = NULL;
+
+    typedef struct word_t {
+        const char* str;
+        size_t      len;
+    } word_t;
+
+    /** Ops of the line being compiled, compile() puts them behind CMD_BYTECODE and OP_MODE */
+    uint8_t code[BUFFER_SIZE];
+    size_t  code_len = 0;
+    bool    fallback = false; // !< The line has to be sent as text
+
+    /** Bytes of text or keys of the line, the ATmega keeps them for the next compressed ones */
+    size_t text_len = 0;
+
+    void emit(uint8_t b) {
+        if (code_len < sizeof(code)) code[code_len++] = b;
+        else fallback = true;
+    }
+
+    void emit16(unsigned int v) {
+        emit(v & 0xFF);
+        emit((v >> 8) & 0xFF);
+    }
+
+    /**
+     * @brief Bytes the ATmega's locale::decode() takes for the character starting with b
+     */
+    uint8_t char_len(uint8_t b) {
+        if ((b & 0xE0) == 0xC0) return 2;
+        if ((b & 0xF0) == 0xE0) return 3;
+        if ((b & 0xF8) == 0xF0) return 4;
+        return 1;
+    }
+
+    /**
+     * @brief Tells whether decoding the characters of str stays within len bytes
+     *
+     * In a text packet a cut off character at the end runs into the line
+     * break, which ends it. In bytecode whatever follows could be taken for
+     * the rest of the character, so such text is sent as it is.
+     */
+    bool complete(const char* str, size_t len) {
+        for (size_t i = len > 3 ? len - 3 : 0; i < len; ++i) {
+            size_t need = char_len(str[i]);
+            size_t j    = i + 1;
+
+            while ((j < i + need) && (j < len) && (((uint8_t)str[j] & 0xC0) == 0x80)) ++j;
+
+            if ((j == len) && (i + need > len)) return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Looks up a name in one of the tables above
+     *
+     * @return true and the code of the name, or false if it isn't in the table
+     */
+    bool find(const keyword_t* table, size_t n, const word_t& w, uint8_t* code) {
+        for (size_t i = 0; i < n; ++i) {
+            if ((strlen(table[i].name) == w.len) && (memcmp(table[i].name, w.str, w.len) == 0)) {
+                *code = table[i].code;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief duckparser's toInt(), hex with 0x or decimal, other characters skipped
+     *
+     * The ATmega's unsigned int has 16 bits, values above that are left to it.
+     */
+    unsigned long to_int(const char* str, size_t len) {
+        unsigned long val = 0;
+
+        if ((len > 2) && (str[0] == '0') && (str[1] == 'x')) {
+            for (size_t i = 2; i < len; ++i) {
+                uint8_t b = str[i];
+
+                if ((b >= '0') && (b <= '9')) b = b - '0';
+                else if ((b >= 'a') && (b <= 'f')) b = b - 'a' + 10;
+                else if ((b >= 'A') && (b <= 'F')) b = b - 'A' + 10;
+
+                val = (val << 4) | (b & 0xF);
+            }
+        } else {
+            for (size_t i = 0; i < len; ++i) {
+                if ((str[i] >= '0') && (str[i] <= '9')) val = val * 10 + (str[i] - '0');
+            }
+        }
+
+        if (val > 0xFFFF) fallback = true;
+
+        return val;
+    }
+
+    /**
+     * @brief Looks up text in the layout, the bytes of an OP_KEYS op
+     *
+     * @param keys Receives the keys
+     * @param max  Size of keys
+     * @return Number of bytes in keys, 0 if the text doesn't fit or has a
+     *         character the layout can't type, the ATmega skips those itself
+     */
+    size_t translate(const char* str, size_t len, uint8_t* keys, size_t max) {
+        layout::stroke strokes[2];
+        uint8_t n;
+        uint8_t modifiers = 0;
+        size_t  k         = 0;
+
+        for (size_t i = 0; i < len; ++i) {
+            i += layout::lookup(locale, &str[i], strokes, &n);
+
+            if (n == 0) return 0;
+
+            for (uint8_t j = 0; j < n; ++j) {
+                uint8_t key = strokes[j].key;
+
+                // Usage codes that mean something else in OP_KEYS
+                if ((key == KEYS_DEAD_END) || (key & KEYS_SHIFT)) return 0;
+
+                if ((strokes[j].modifiers == (modifiers | KEY_MOD_LSHIFT)) && !(modifiers & KEY_MOD_LSHIFT)) {
+                    key |= KEYS_SHIFT;
+                } else if (strokes[j].modifiers != modifiers) {
+                    if (k + 2 > max) return 0;
+
+                    modifiers = strokes[j].modifiers;
+                    keys[k++] = KEYS_MODIFIERS;
+                    keys[k++] = modifiers;
+                }
+
+                if (k + 1 > max) return 0;
+
+                keys[k++] = key;
+            }
+
+            if (n == 2) {
+                if (k + 1 > max) return 0;
+
+                keys[k++] = KEYS_DEAD_END;
+            }
+        }
+
+        return k;
+    }
+
+    /**
+     * @brief Types text, the rest of the packet
+     *
+     * As keys if the layout is known and they fit in the packet, next to
+     * CMD_BYTECODE, OP_MODE and its bits.
+     *
+     * @param ln   ENTER after the text
+     * @param part The line continues in the next packet
+     */
+    void text(const char* str, size_t len, bool ln, bool part) {
+        if (!complete(str, len)) fallback = true;
+
+        uint8_t keys[BUFFER_SIZE];
+        size_t  max = BUFFER_SIZE - 4 - code_len;
+        size_t  n   = (locale && !fallback && (code_len + 4 < BUFFER_SIZE)) ? translate(str, len, keys, max) : 0;
+
+        uint8_t        op      = part ? OP_TEXT_PART : ln ? OP_TEXT_LN : OP_TEXT;
+        const uint8_t* payload = (const uint8_t*)str;
+
+        if (n > 0) {
+            op      = part ? OP_KEYS_PART : ln ? OP_KEYS_LN : OP_KEYS;
+            payload = keys;
+            len     = n;
+        }
+
+        // Compressed it takes OP_LZ on top, it has to be shorter by more than that.
+        // Text too short for it goes through compress() too, it keeps the text
+        // for commit() and the ATmega keeps it as well.
+        uint8_t lz[BUFFER_SIZE];
+        size_t  m = !fallback ? compressor::compress(payload, len, lz, len > 0 ? len - 1 : 0) : 0;
+
+        text_len = len;
+
+        if (m > 0) {
+            emit(OP_LZ);
+            emit(op);
+
+            for (size_t i = 0; i < m; ++i) emit(lz[i]);
+
+            return;
+        }
+
+        emit(op);
+
+        for (size_t i = 0; i < len; ++i) emit(payload[i]);
+    }
+
+    /**
+     * @brief Presses the key a word names, or its first character like duckparser's press()
+     */
+    void press(const word_t& w) {
+        uint8_t op;
+
+        if ((w.len > 1) && find(keys, sizeof(keys) / sizeof(keys[0]), w, &op)) {
+            emit(op);
+            return;
+        }
+
+        uint8_t b = w.str[0];
+
+        if ((b >= OP_ASCII) && (b < OP_KEY)) {
+            emit(b);
+            return;
+        }
+
+        // The character with the continuation bytes the word has of it
+        size_t n = 1;
+
+        while ((n < char_len(b)) && (n < w.len) && (((uint8_t)w.str[n] & 0xC0) == 0x80)) ++n;
+
+        // Cut off by the end of the word, decode() would read on into the next op
+        if ((n < char_len(b)) && (n == w.len)) fallback = true;
+
+        emit(OP_CHAR);
+        emit(n);
+
+        for (size_t i = 0; i < n; ++i) emit(w.str[i]);
+    }
+
+    /**
+     * @brief The argument of a command, what duckparser hands toInt()
+     */
+    word_t argument(const char* str, size_t len, const word_t& cmd) {
+        word_t arg = { NULL, 0 };
+
+        // Leading spaces shift what the parser reads, it gets the text
+        if ((cmd.str != str) || (len <= cmd.len)) fallback = true;
+        else {
+            arg.str = str + cmd.len + 1;
+            arg.len = len - cmd.len - 1;
+        }
+
+        return arg;
+    }
+
+    uint8_t mode() {
+        return (inString ? MODE_STRING : 0) |
+               (isStringln ? MODE_STRINGLN : 0) |
+               (inLString ? MODE_LSTRING : 0) |
+               (inComment ? MODE_COMMENT : 0);
+    }
+
+    /**
+     * @brief Splits a line into words like the ATmega's parse_words()
+     *
+     * @return Number of words, the parser drops the ones beyond MAX_WORDS
+     */
+    size_t split(const char* str, size_t len, word_t* words) {
+        size_t n = 0;
+        size_t j = 0;
+
+        for (size_t i = 0; i <= len; ++i) {
+            if ((i == len) || (str[i] == ' ')) {
+                if (i > j) {
+                    if (n == MAX_WORDS) break;
+
+                    words[n].str = &str[j];
+                    words[n].len = i - j;
+
+                    // The rest of a STRING line is its text
+                    if ((n++ == 0) && (i - j == 6) && (memcmp(&str[j], "STRING", 6) == 0)) break;
+                }
+                j = i + 1;
+            }
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Compiles a line that isn't part of a STRING, LSTRING or REM
+     */
+    void command(const char* str, size_t len, bool end, const word_t* words, size_t n) {
+        const word_t& cmd = words[0];
+
+        uint8_t c;
+
+        if (!find(commands, sizeof(commands) / sizeof(commands[0]), cmd, &c)) {
+            c = ((cmd.len >= 8) && (memcmp(cmd.str, "LSTRING_", 8) == 0)) ? COMMAND_LSTRING : COMMAND_KEYS;
+        }
+
+        switch (c) {
+            case COMMAND_LSTRING:
+                if ((cmd.len >= 13) && (memcmp(&cmd.str[8], "BEGIN", 5) == 0)) {
+                    inLString = true;
+                    emit(OP_NO_DELAY);
+                }
+                if (!end) emit(OP_PART);
+                return;
+
+            case COMMAND_STRING:
+            case COMMAND_STRINGLN: {
+                size_t skip = (c == COMMAND_STRINGLN) ? 9 : 7;
+
+                isStringln = c == COMMAND_STRINGLN;
+                inString   = !end;
+
+                if (end && isStringln) isStringln = false;
+
+                text(str + skip, len > skip ? len - skip : 0, end && (c == COMMAND_STRINGLN), !end);
+                return;
+            }
+
+            case COMMAND_REM:
+                inComment = !end;
+                emit(OP_NO_DELAY);
+                if (!end) emit(OP_PART);
+                return;
+
+            case COMMAND_LOCALE:
+                // A piece of the line selects who knows what
+                locale   = (end && (n > 1)) ? layout::get(words[1].str, words[1].len) : NULL;
+                fallback = true;
+                return;
+        }
+
+        // The rest need the whole line
+        if (!end || (c == COMMAND_OTHER)) {
+            fallback = true;
+            return;
+        }
+
+        switch (c) {
+            case COMMAND_DELAY:
+            case COMMAND_DEFAULT_DELAY:
+            case COMMAND_REPEAT: {
+                word_t arg      = argument(str, len, cmd);
+                unsigned long v = to_int(arg.str, arg.len);
+
+                // REPEAT n sets the parser's counter to n + 1
+                if ((c == COMMAND_REPEAT) && (v == 0xFFFF)) fallback = true;
+
+                emit(c == COMMAND_DELAY ? OP_DELAY : c == COMMAND_DEFAULT_DELAY ? OP_DEFAULT_DELAY : OP_REPEAT);
+                emit16(v);
+                return;
+            }
+
+            case COMMAND_LOOP_BEGIN: {
+                word_t arg = argument(str, len, cmd);
+                bool   neg = (arg.len > 1) && (arg.str[0] == '-');
+
+                unsigned long v = neg ? to_int(arg.str + 1, arg.len - 1) : to_int(arg.str, arg.len);
+
+                // An int on the ATmega
+                if (v > (neg ? 0x8000UL : 0x7FFFUL)) fallback = true;
+
+                emit(OP_LOOP_BEGIN);
+                emit16(neg ? 0x10000UL - v : v);
+                return;
+            }
+
+            case COMMAND_LOOP_END:
+                emit(OP_LOOP_END);
+                return;
+        }
+
+        for (size_t i = 0; i < n; ++i) press(words[i]);
+
+        emit(OP_RELEASE);
+    }
+
+    // ===== PUBLIC ===== //
+
+    void reset(size_t window) {
+        isStringln = false;
+        inString   = false;
+        inLString  = false;
+        inComment  = false;
+
+        locale = NULL;
+
+        compressor::reset(window);
+    }
+
+    /**
+     * @brief Follows the layout of a line sent as text without compile()
+     *
+     * @param str Line as it is sent, line break included
+     * @param len Bytes of the line
+     */
+    void follow(const char* str, size_t len) {
+        while ((len > 0) && ((str[len - 1] == '\n') || (str[len - 1] == '\r'))) --len;
+
+        // Several lines, one of them could be a LOCALE
+        if (memchr(str, '\n', len) || memchr(str, '\r', len)) {
+            locale = NULL;
+            return;
+        }
+
+        word_t  words[MAX_WORDS];
+        size_t  n = split(str, len, words);
+        uint8_t c;
+
+        if ((n > 0) && find(commands, sizeof(commands) / sizeof(commands[0]), words[0], &c) && (c == COMMAND_LOCALE)) {
+            locale = (n > 1) ? layout::get(words[1].str, words[1].len) : NULL;
+        }
+    }
+
+    /**
+     * @brief Compiles one packet duckscript is about to send
+     *
+     * A packet is one line with its line break, or a piece of a line that
+     * was too long for the buffer. The flags follow the line even when it
+     * is sent as text, the parser goes through the same steps with it.
+     *
+     * @param str Line as read from the script
+     * @param len Bytes of the line, the line break included
+     * @param out Receives the packet, BUFFER_SIZE bytes
+     * @return Bytes of the packet in out, 0 to send the text instead
+     */
+    size_t compile(const char* str, size_t len, uint8_t* out) {
+        bool end = (len > 0) && (str[len - 1] == '\n');
+
+        if (end) --len;
+
+        // Empty lines do nothing on the ATmega
+        if (len == 0) return 0;
+
+        // Several lines are not what get_line() reads, and one of them could be a LOCALE
+        if (memchr(str, '\n', len) || memchr(str, '\r', len)) {
+            locale = NULL;
+            return 0;
+        }
+
+        word_t words[MAX_WORDS];
+        size_t n = split(str, len, words);
+
+        // Nothing but spaces, the parser has no command to look at
+        if (n == 0) return 0;
+
+        uint8_t before = mode();
+
+        code_len = 0;
+        fallback = false;
+        text_len = 0;
+
+        if (inLString) {
+            if ((words[0].len == 11) && (memcmp(words[0].str, "LSTRING_END", 11) == 0)) {
+                inLString = false;
+                emit(OP_NO_DELAY);
+                if (!end) emit(OP_PART);
+            } else {
+                text(str, len, end, !end);
+            }
+        } else if (inString) {
+            inString = !end;
+
+            bool ln = end && isStringln;
+
+            if (ln) isStringln = false;
+
+            text(str, len, ln, !end);
+        } else if (inComment) {
+            inComment = !end;
+            emit(OP_NO_DELAY);
+            if (!end) emit(OP_PART);
+        } else {
+            command(str, len, end, words, n);
+        }
+
+        size_t size = 1 + (mode() != before ? 2 : 0) + code_len;
+
+        if (fallback || (size > BUFFER_SIZE)) return 0;
+
+        uint8_t* p = out;
+
+        *p++ = CMD_BYTECODE;
+
+        if (mode() != before) {
+            *p++ = OP_MODE;
+            *p++ = mode();
+        }
+
+        memcpy(p, code, code_len);
+
+        compressor::commit(text_len);
+
+        return size;
+    }
+}
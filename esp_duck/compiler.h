@@ -0,0 +1,61 @@
+/*!
+    \file esp_duck/compiler.h
+    \brief DuckyScript lines to the ATmega's bytecode
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+// ===== Opcodes ===== //
+// Must be the same as the ATmega's, see atmega_duck/src/duckparser/bytecode.h
+#define OP_RELEASE       0x01 // !< Release all keys
+#define OP_CHAR          0x02 // !< Length and bytes of one UTF-8 character to press
+#define OP_DELAY         0x03 // !< Milliseconds to sleep, 16 bit little endian
+#define OP_DEFAULT_DELAY 0x04 // !< Milliseconds of the default delay, 16 bit little endian
+#define OP_REPEAT        0x05 // !< Times to repeat the previous line, 16 bit little endian
+#define OP_LOOP_BEGIN    0x06 // !< Loop iterations, 16 bit little endian and signed
+#define OP_LOOP_END      0x07
+#define OP_NO_DELAY      0x08 // !< No default delay after this line
+#define OP_PART          0x09 // !< The line continues in the next packet
+#define OP_MODE          0x0A // !< MODE_ bits of the parser from this line on
+#define OP_TEXT          0x0B // !< Type the rest of the packet
+#define OP_TEXT_LN       0x0C // !< Type the rest of the packet, then ENTER
+#define OP_TEXT_PART     0x0D // !< Type the rest of the packet, the line continues in the next one
+#define OP_KEYS          0x0E // !< Keys of text looked up in the layout already, the rest of the packet
+#define OP_KEYS_LN       0x0F // !< Keys of text like OP_KEYS, then ENTER
+#define OP_KEYS_PART     0x10 // !< Keys of text like OP_KEYS, the line continues in the next one
+#define OP_LZ            0x11 // !< One of the text or key ops, then its bytes compressed
+#define OP_MODIFIER      0x18 // !< 0x18 to 0x1F, press modifier bit (op - OP_MODIFIER)
+#define OP_ASCII         0x20 // !< 0x20 to 0x7F, press that character
+#define OP_KEY           0x80 // !< 0x80 to 0xFF, press HID usage code (op - OP_KEY)
+
+// OP_MODE bits, the lines of a STRING, LSTRING or REM that spans packets
+#define MODE_STRING   0x01
+#define MODE_STRINGLN 0x02
+#define MODE_LSTRING  0x04
+#define MODE_COMMENT  0x08
+
+// OP_KEYS bytes, HID usage codes of keys pressed with the modifiers last set
+#define KEYS_SHIFT     0x80 // !< Set in a usage code, pressed with left shift on top of the modifiers
+#define KEYS_MODIFIERS 0xFF // !< The next byte holds the modifiers of the keys after it
+#define KEYS_DEAD_END  0x00 // !< Ends a character typed with a dead key and the key after it
+
+/*! \namespace compiler
+ *  \brief Turns the lines duckscript sends into bytecode, so the ATmega
+ *  doesn't have to split, look up and convert them
+ */
+namespace compiler {
+    /*! Forgets the state of the previous script, call it with CMD_PARSER_RESET.
+     *  window is how far back compressed text may refer, com::get_lz_window() */
+    void reset(size_t window);
+
+    /*! Keeps track of a LOCALE line sent as text, like the key command's */
+    void follow(const char* str, size_t len);
+
+    /*! Compiles one line or piece of a line into out (BUFFER_SIZE bytes),
+     *  returns the length or 0 if the line is better sent as text */
+    size_t compile(const char* str, size_t len, uint8_t* out);
+};
@@ -0,0 +1,193 @@
+/*!
+    \file esp_duck/compressor.cpp
+    \brief Compresses the text of compiled lines for the ATmega's decompressor
+    \copyright MIT License
+
+    Text and keys of a line are coded as runs of bytes as they are and
+    references, either to a static dictionary of what payloads often type
+    or back into the text of the lines sent before, see
+    atmega_duck/src/duckparser/decompressor.cpp for the format.
+
+    How far back a line may refer is what both boards can keep: the
+    ATmega announces its LZ_WINDOW with EVENT_LZ_WINDOW, and every script
+    starts with the smaller of that and this sketch's LZ_WINDOW. The text
+    of every compiled line goes into the window, compressed or not, the
+    ATmega keeps it the same way when it executes the line.
+
+    The search is a plain scan over the window and the dictionary, a line
+    has at most BUFFER_SIZE bytes and the ESP8266 has the time for it.
+ */
+
+#include "compressor.h"
+
+#include "config.h"
+
+#include <string.h> // memcpy, memmove
+
+namespace compressor {
+    // ===== PRIVATE ===== //
+
+    /*! Must be the same as the ATmega's, see atmega_duck/src/duckparser/decompressor.cpp */
+    const char dictionary[] =
+        "powershell -NoProfile -ExecutionPolicy Bypass -Command "
+        "Invoke-WebRequest -Uri https://Start-Process cmd /c echo "
+        "%USERPROFILE%\\Desktop\\C:\\Windows\\System32\\ | Out-File "
+        "$env:TEMP\\ sudo apt-get install curl -fsSL http:// "
+        "> /dev/null 2>&1; chmod +x /tmp/.ps1 ";
+
+    #define DICTIONARY_SIZE (sizeof(dictionary) - 1)
+
+    #define MIN_MATCH   3
+    #define MAX_MATCH   (0x3F + MIN_MATCH)
+    #define MAX_LITERAL 0x80
+    #define MAX_BACK    0x8000
+
+    /** The text the ATmega keeps and the line being compressed behind it */
+    uint8_t history[LZ_WINDOW + BUFFER_SIZE];
+
+    /** Bytes of earlier lines in history */
+    size_t kept = 0;
+
+    /** Bytes of earlier lines the ATmega keeps, 0 while there's no compression */
+    size_t window = 0;
+
+    /**
+     * @brief Drops what the ATmega doesn't keep either before the next line
+     */
+    void slide() {
+        if (kept > window) {
+            memmove(history, history + kept - window, window);
+            kept = window;
+        }
+    }
+
+    /**
+     * @brief Number of bytes a and b have in common from the start, at most max
+     */
+    size_t common(const uint8_t* a, const uint8_t* b, size_t max) {
+        size_t n = 0;
+
+        while ((n < max) && (a[n] == b[n])) ++n;
+
+        return n;
+    }
+
+    typedef struct match_t {
+        size_t  len;  // !< Bytes it stands for
+        size_t  from; // !< How far back, or where in the dictionary
+        uint8_t cost; // !< Bytes of its code
+        bool    dict; // !< From the dictionary
+    } match_t;
+
+    /**
+     * @brief Finds the reference that saves the most bytes for the text at str
+     *
+     * @param str  Text behind kept + i bytes of history
+     * @param back Bytes before str it may refer to
+     * @param left Bytes of the line from str on
+     */
+    match_t find(const uint8_t* str, size_t back, size_t left) {
+        match_t best = { 0, 0, 0, false };
+
+        if (left > MAX_MATCH) left = MAX_MATCH;
+        if (back > MAX_BACK) back = MAX_BACK;
+
+        for (size_t from = 1; from <= back; ++from) {
+            size_t  len  = common(str - from, str, left);
+            uint8_t cost = (from <= 0x80) ? 2 : 3;
+
+            if ((len >= MIN_MATCH) && (len > cost) && (len - cost > best.len - best.cost)) {
+                best = { len, from, cost, false };
+            }
+        }
+
+        for (size_t from = 0; from + MIN_MATCH <= DICTIONARY_SIZE; ++from) {
+            size_t max = DICTIONARY_SIZE - from;
+            size_t len = common((const uint8_t*)dictionary + from, str, left < max ? left : max);
+
+            if ((len >= MIN_MATCH) && (len > 2) && (len - 2 > best.len - best.cost)) {
+                best = { len, from, 2, true };
+            }
+        }
+
+        return best;
+    }
+
+    // ===== PUBLIC ===== //
+
+    void reset(size_t window) {
+        compressor::window = window < LZ_WINDOW ? window : LZ_WINDOW;
+        kept               = 0;
+    }
+
+    /**
+     * @brief Compresses the text or keys of a line
+     *
+     * The text is kept for commit(), call it for every line that is
+     * compiled while there is a window, whether it ends up compressed or not.
+     *
+     * @param str Text or keys of a text op
+     * @param len Bytes of str, at most BUFFER_SIZE
+     * @param out Receives the code
+     * @param max Most bytes the code may have
+     * @return Bytes of the code, 0 if there is no window or the code isn't shorter than max
+     */
+    size_t compress(const uint8_t* str, size_t len, uint8_t* out, size_t max) {
+        if ((window == 0) || (len > BUFFER_SIZE)) return 0;
+
+        slide();
+
+        uint8_t* text = history + kept;
+
+        memcpy(text, str, len);
+
+        size_t n   = 0;
+        size_t lit = 0; // !< Bytes before i not coded yet
+
+        for (size_t i = 0; i <= len; ) {
+            match_t m = { 0, 0, 0, false };
+
+            if (i < len) m = find(text + i, kept + i, len - i);
+
+            // Bytes as they are before the reference, the end or a full run
+            if (lit && ((m.len > 0) || (i == len) || (lit == MAX_LITERAL))) {
+                if (n + 1 + lit >= max) return 0;
+
+                out[n++] = lit - 1;
+                memcpy(out + n, text + i - lit, lit);
+                n  += lit;
+                lit = 0;
+            }
+
+            if (i == len) break;
+
+            if (m.len == 0) {
+                ++lit;
+                ++i;
+                continue;
+            }
+
+            if (n + m.cost >= max) return 0;
+
+            if (m.dict) {
+                out[n++] = 0xC0 | (m.len - MIN_MATCH);
+                out[n++] = m.from;
+            } else if (m.cost == 2) {
+                out[n++] = 0x80 | (m.len - MIN_MATCH);
+                out[n++] = m.from - 1;
+            } else {
+                out[n++] = 0x80 | (m.len - MIN_MATCH);
+                out[n++] = 0x80 | ((m.from - 1) >> 8);
+                out[n++] = (m.from - 1) & 0xFF;
+            }
+
+            i += m.len;
+        }
+
+        return n;
+    }
+
+    void commit(size_t len) {
+        if (window > 0) kept += len;
+    }
+}
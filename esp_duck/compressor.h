@@ -0,0 +1,24 @@
+/*!
+    \file esp_duck/compressor.h
+    \brief Compresses the text of compiled lines for the ATmega's decompressor
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+/*! \namespace compressor
+ *  \brief LZ coding of STRING text against a static dictionary and the text sent before it
+ */
+namespace compressor {
+    /*! Forgets the text of the previous script, window is com::get_lz_window(), 0 for none */
+    void reset(size_t window);
+
+    /*! Compresses text, see compress() in compressor.cpp */
+    size_t compress(const uint8_t* str, size_t len, uint8_t* out, size_t max);
+
+    /*! The text of the last compress() call went out, later lines may refer to it */
+    void commit(size_t len);
+};
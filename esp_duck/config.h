@@ -13,19 +13,41 @@
 // #define DEBUG_BAUD 115200
 
 /*! ===== Communication Settings ===== */
+// -DENABLE_I2C on the command line selects I2C instead, like the host simulator's I2C build
+#ifndef ENABLE_I2C
 #define ENABLE_SERIAL
+#endif
 #define SERIAL_PORT Serial
 #define SERIAL_BAUD 9600
 
+// Fastest rate to switch the link to after connecting (115200, 250000 or 500000).
+// Set it to SERIAL_BAUD to keep the link at SERIAL_BAUD.
+#define SERIAL_BAUD_MAX 500000
+
 // #define ENABLE_I2C
 #define I2C_ADDR 0x31
 // #define I2C_SDA 4
 // #define I2C_SCL 5
-#define I2C_CLOCK_SPEED 100000L
+// Fast mode, the ATmega32u4's TWI keeps up with 400 kHz
+#define I2C_CLOCK_SPEED 400000L
 
 #define BUFFER_SIZE 128
+
+// Most bytes of earlier STRING text a compressed line may refer to, the ATmega's
+// LZ_WINDOW caps it for each script. 0 sends all text uncompressed.
+#define LZ_WINDOW 4096
+
+// Bytes per I2C write, the most the ATmega's Wire library buffers (BUFFER_LENGTH of the AVR core)
 #define PACKET_SIZE 32
 
+// Bytes the serial port buffers while loop() is busy. Has to hold
+// SD_READ_WINDOW chunks of an SD card read, each up to 2 * BUFFER_SIZE escaped.
+#define SERIAL_RX_BUFFER 1024
+
+// Most lines sent ahead of the one the ATmega is executing.
+// 1 sends every line only after the previous one is done.
+#define COM_WINDOW 8
+
 #define MSG_CONNECTED "REM CONNECT ESP\n"
 #define MSG_STARTED "REM STARTED ESP\n"
 
@@ -35,10 +57,32 @@
 #define CLI_BUFFER (BUFFER_SIZE + 25)
 #define MAX_NAME 32
 
+// Chunks of an SD card read the ATmega sends ahead of the one being processed.
+// 1 waits for every chunk to be acknowledged before the next.
+#define SD_READ_WINDOW 4
+
 // Command to reset values ​​from previous executions. 
 // It must be the same as the one the receiver (ATmega32u4) has.
 #define CMD_PARSER_RESET  "\x1B"
 
+// Command to negotiate the baud rate with.
+// It must be the same as the one the receiver (ATmega32u4) has.
+#define CMD_BAUD 0x1C
+
+// Command to ask for a status with when the ATmega hasn't answered in a while.
+// It must be the same as the one the receiver (ATmega32u4) has.
+#define CMD_STATUS 0x1D
+
+// Byte after CMD_STATUS to ask for the ATmega's link counters with, see com::print_link_stats().
+// CMD_LINK_RESET has the ATmega start them over once they are sent.
+// It must be the same as the one the receiver (ATmega32u4) has.
+#define CMD_LINK_STATS 0x01
+#define CMD_LINK_RESET 0x02
+
+// First byte of a line compiled to bytecode, see compiler.h.
+// It must be the same as the one the receiver (ATmega32u4) has.
+#define CMD_BYTECODE 0x1E
+
 /*! ======EEPROM Settings ===== */
 #define EEPROM_SIZE       4095
 #define EEPROM_BOOT_ADDR  3210
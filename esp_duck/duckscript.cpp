@@ -14,6 +14,7 @@
 #include "debug.h"
 
 #include "com.h"
+#include "compiler.h"
 #include "spiffs.h"
 #include "sdcard.h"
 
@@ -27,7 +28,9 @@
  * responsibility belongs to the device on the other end of the connection.
  *
  * The execution loop, delay handling, and command interpretation all happen 
- * remotely once com::send() delivers each line.
+ * remotely once com::send() delivers each line. Most lines are compiled to
+ * bytecode on the way (see compiler.h), so the remote side doesn't have to
+ * parse them.
  *
  * The module supports three special constructs that require local state management:
  *   - REPEAT:       Re-sends the previous command N times by seeking back in the file
@@ -79,6 +82,19 @@ namespace duckscript {
      * parser knows exactly how many bytes to process.
      */
     unsigned int read =  0;
+
+    /**
+     * @brief The line in buffer compiled to bytecode, see compile_line()
+     */
+    static uint8_t code[BUFFER_SIZE];
+
+    /**
+     * @brief What goes to the remote parser for the line in buffer
+     *
+     * Points to code, or to buffer if the line is sent as text.
+     */
+    const char*  packet     = buffer;
+    unsigned int packet_len = 0;
     
     // Flag bit definitions for state.flags
     #define FLAG_RUNNING          0x01  // !< Script is currently active and being executed
@@ -87,6 +103,8 @@ namespace duckscript {
     #define FLAG_IN_LSTRING_BLOCK 0x08  // !< We are inside an LSTRING_BEGIN...LSTRING_END block
     #define FLAG_IN_LOOP_BLOCK    0x10  // !< We are inside a LOOP_BEGIN...LOOP_END block
     #define FLAG_IN_LOOP_INFINITE 0x20  // !< The current loop has no iteration limit
+    #define FLAG_LINE_READ        0x40  // !< buffer holds a line that waits for room in the send window
+    #define FLAG_WAIT_IDLE        0x80  // !< The last line sent needs the ATmega's answer before the next
 
     // Flag query macros
     #define IS_RUNNING            (state.flags & FLAG_RUNNING)
@@ -95,6 +113,8 @@ namespace duckscript {
     #define IS_IN_LSTRING_BLOCK   (state.flags & FLAG_IN_LSTRING_BLOCK)
     #define IS_IN_LOOP_BLOCK      (state.flags & FLAG_IN_LOOP_BLOCK)
     #define IS_IN_LOOP_INFINITE   (state.flags & FLAG_IN_LOOP_INFINITE)
+    #define IS_LINE_READ          (state.flags & FLAG_LINE_READ)
+    #define IS_WAIT_IDLE          (state.flags & FLAG_WAIT_IDLE)
 
     // Flag manipulation macros
     #define SET_FLAG(f)           (state.flags |= (f))
@@ -125,6 +145,7 @@ namespace duckscript {
         state.loop_pos     = 0;
         state.flags        = 0;
         read               = 0;
+        packet_len         = 0;
 
         if (fileName.length() > 0) {
             debugf("Run file %s\n", fileName.c_str());
@@ -134,6 +155,7 @@ namespace duckscript {
             // We send the CMD_PARSER_RESET command to reset all values 
             // ​​from previous executions and prevent conflicts. The next call executes nextLine().
             com::send(CMD_PARSER_RESET);
+            compiler::reset(com::get_lz_window());
             //nextLine();
         }
     }
@@ -183,6 +205,9 @@ namespace duckscript {
      * It does not allow repetition like in LSTRING
      */
     void check_loop_block() {
+        // buffer holds a line that wasn't sent yet, not the one the status is about
+        if (IS_LINE_READ) return;
+
         if (read >= 10 && !IS_IN_LSTRING_BLOCK && !IS_IN_LOOP_BLOCK &&  memcmp(buffer, "LOOP_BEGIN", 10) == 0) {
 
             SET_FLAG(FLAG_IN_LOOP_BLOCK);
@@ -287,83 +312,119 @@ namespace duckscript {
         buffer[read] = '\0';
     }
 
+    /**
+     * @brief Compiles the line get_line() read into packet
+     *
+     * Every line sent has to go through here exactly once and in order,
+     * the compiler follows the parser's state from line to line.
+     */
+    void compile_line() {
+        packet_len = compiler::compile(buffer, read, code);
+
+        if (packet_len > 0) {
+            packet = (const char*)code;
+        } else {
+            packet     = buffer;
+            packet_len = read;
+        }
+    }
+
      /**
      * @brief Reads the next line from the file and sends it to the remote parser
      *
-     * This is the main per-tick function. It is called repeatedly by the
-     * external event loop — once per cycle — and handles exactly one line
-     * (or one fragment of a long line) per call.
+     * Handles exactly one line (or one fragment of a long line) per call.
      *
      * The function performs the following steps:
      *   1. Guards: checks that the SD card is not busy, the file is valid,
-     *      and data is still available.
+     *      and data is still available. The end of the file only stops the
+     *      script once the ATmega is idle, lines sent ahead still run.
      *   2. Captures the current file position (for future REPEAT seeking),
      *      but only when we are at the start of a new line.
-     *   3. Reads a line via get_line().
-     *   4. Sends it to the remote parser via com::send().
+     *   3. Reads a line via get_line() and compiles it, unless one is still
+     *      waiting in the buffer for room in the send window.
+     *   4. Sends it to the remote parser via com::send(), or keeps it in the
+     *      buffer (FLAG_LINE_READ) if com::can_send() says no.
      *   5. If the line is a REPEAT command, saves the position immediately
-     *      after it (after_repeat) and returns — the external loop will call
-     *      repeat() for each repetition instead of nextLine().
-     *   6. If the line is still fragmented (FLAG_IN_LINE), returns immediately
-     *      so the next call finishes reading it.
+     *      after it (after_repeat) and waits for the ATmega — the external
+     *      loop will call repeat() for each repetition instead of nextLine().
+     *   6. If the line is still fragmented (FLAG_IN_LINE), returns so the
+     *      next call finishes reading it.
      *   7. Updates last_pos and checks for LSTRING block boundaries.
+     *   8. LOOP_BEGIN and LOOP_END wait for the ATmega as well, check_loop_block()
+     *      needs the loop counter it answers with.
      *
-     * Note: LOOP block detection (check_loop_block) is handled on the remote
-     * side through com, so it is not called here.
+     * @param idle True if the ATmega has nothing left to do
+     * @return true if the line was sent and the next one may follow right away
      */
-    void nextLine() {
+    bool send_line(bool idle) {
         #ifdef USE_SD_CARD
         // If the SD card has been claimed by another process while we were running,
         // abort immediately
         if (com::get_sdcard_status() >= sdcard::SD_READING && IS_RUNNING) {
             stopAll();
-            return;
+            return false;
         }
         #endif
 
         // Nothing to do if the script is not active and we are not inside a loop
-        if (!IS_RUNNING && !IS_IN_LOOP_BLOCK) return;
+        if (!IS_RUNNING && !IS_IN_LOOP_BLOCK) return false;
+
+        if (!IS_LINE_READ) {
+            // Validate the file handle — if it is gone, something went wrong
+            if (!f) {
+                debugln("File error");
+                stopAll();
+                return false;
+            }
 
-        // Validate the file handle — if it is gone, something went wrong
-        if (!f) {
-            debugln("File error");
-            stopAll();
-            return;
-        }
+            // No more data in the file — we have reached the end
+            if (!f.available()) {
+                if (!idle) {
+                    SET_FLAG(FLAG_WAIT_IDLE);
+                    return false;
+                }
+                debugln("Reached end of file");
+                stopAll();
+                return false;
+            }
 
-        // No more data in the file — we have reached the end
-        if (!f.available()) {
-            debugln("Reached end of file");
-            stopAll();
-            return;
-        }
+            // Snapshot the file position before reading. This will become last_pos
+            // once we confirm the line is complete and is a real command.
+            if (!IS_IN_LINE) state.cur_pos = f.position();
 
-        // Snapshot the file position before reading. This will become last_pos
-        // once we confirm the line is complete and is a real command.
-        if (!IS_IN_LINE) state.cur_pos = f.position();
+            get_line();
 
-        get_line();
+            // Nothing was read — treat as end of file
+            if (read == 0) {
+                stopAll();
+                return false;
+            }
 
-        // Nothing was read — treat as end of file
-        if (read == 0) {
-            stopAll();
-            return;
+            compile_line();
+
+            SET_FLAG(FLAG_LINE_READ);
         }
 
+        // The ATmega can't take it yet, the next ack brings us back here
+        if (!com::can_send(packet, packet_len)) return false;
+
         // Deliver the line to the remote parser
-        com::send(buffer, read);
+        com::send(packet, packet_len);
+
+        CLR_FLAG(FLAG_LINE_READ);
 
         // If this line is a REPEAT command, record where to resume after
         // all repetitions are done, then hand control to repeat()
         if(memcmp(buffer, "REPEAT", 6) == 0) {
             state.after_repeat = f.position();
             CLR_FLAG(FLAG_IN_LINE); // Force a clean start for the repeated line
-            return;
+            SET_FLAG(FLAG_WAIT_IDLE);
+            return false;
         }
 
-        // If we are still in the middle of a long line, return and wait for
-        // the next call to finish reading the rest
-        if (IS_IN_LINE) return;
+        // If we are still in the middle of a long line, the rest can follow
+        // right away
+        if (IS_IN_LINE) return true;
 
         // The line is complete. Update last_pos so that a future REPEAT can
         // seek back to it. Skip the update if we are inside an LSTRING block
@@ -374,6 +435,47 @@ namespace duckscript {
         // Check whether this line opens or closes an LSTRING block
         check_lstring_block();
 
+        if (!IS_IN_LSTRING_BLOCK &&
+            (((read >= 10) && (memcmp(buffer, "LOOP_BEGIN", 10) == 0)) ||
+             ((read >= 8) && (memcmp(buffer, "LOOP_END", 8) == 0)))) {
+            SET_FLAG(FLAG_WAIT_IDLE);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Sends lines until the send window is full
+     *
+     * @param idle True if the ATmega has nothing left to do
+     */
+    void send_lines(bool idle) {
+        while (send_line(idle)) idle = false;
+    }
+
+    /**
+     * @brief Continues the script once the ATmega is idle
+     *
+     * Registered as com's done callback. Also picks up after lines that
+     * had to wait for the ATmega (FLAG_WAIT_IDLE).
+     *
+     * Note: LOOP block detection (check_loop_block) is handled on the remote
+     * side through com, so it is not called here.
+     */
+    void nextLine() {
+        CLR_FLAG(FLAG_WAIT_IDLE);
+        send_lines(true);
+    }
+
+    /**
+     * @brief Sends the next lines while the ATmega is still busy
+     *
+     * Registered as com's ready callback, so the next lines are on their
+     * way while the current one executes.
+     */
+    void sendAhead() {
+        if (!IS_WAIT_IDLE) send_lines(false);
     }
 
     /**
@@ -383,7 +485,7 @@ namespace duckscript {
      * while repetitions are still pending. On each call it:
      *   1. Seeks back to last_pos (the start of the command to repeat),
      *      unless we are mid-fragment or inside an LSTRING block.
-     *   2. Reads that line again via get_line().
+     *   2. Reads that line again via get_line() and compiles it.
      *   3. Sends it to the remote parser via com::send().
      *   4. Queries com::get_repeats() to see how many repetitions the
      *      remote side still expects. When that value reaches zero, it
@@ -400,12 +502,16 @@ namespace duckscript {
             f.seek(state.last_pos, SeekSet);
             
         get_line();
+        compile_line();
 
         // Save the value of get_repeats before sending the command.
         int repeats = com::get_repeats() - 1;
 
         // Send the line again
-        com::send(buffer, read);
+        com::send(packet, packet_len);
+
+        // The next repetition depends on the counter the ATmega answers with
+        SET_FLAG(FLAG_WAIT_IDLE);
 
         // Keep LSTRING state in sync even during repeats
         check_lstring_block();
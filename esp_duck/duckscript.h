@@ -15,6 +15,7 @@ namespace duckscript {
     void run(String fileName);
 
     void nextLine();
+    void sendAhead();
     void repeat();
     void stopAll();
     void stop(String fileName);
@@ -34,6 +34,7 @@ void setup() {
     com::onError(duckscript::stopAll);
     com::onRepeat(duckscript::repeat);
     com::onLoop(duckscript::check_loop_block);
+    com::onReady(duckscript::sendAhead);
 
     com::set_print_callback([](const char* str) {
         webserver::sendAll(str);
@@ -0,0 +1,192 @@
+/*!
+    \file esp_duck/layout.cpp
+    \brief The ATmega's keyboard layouts, to look up STRING text before it is sent
+    \copyright MIT License
+
+    The layouts in src/locale are copies of the ones locale::get() on the
+    ATmega has enabled, the ESP8266 sketch can't include the ATmega's files.
+    Enabling another layout there means copying it here and adding it to
+    get() as well, or both boards type different keys.
+
+    The lookup is the one of keyboard::lookup() and locale.cpp, down to
+    the order the tables are searched in.
+ */
+
+#include "layout.h"
+
+#include <string.h> // strlen, strncasecmp
+
+#include "src/locale/mac/locale_es_la_mac.h"
+#include "src/locale/win/locale_es_la_win.h"
+#include "src/locale/win/locale_es_win.h"
+#include "src/locale/win/locale_us_win.h"
+
+/*! Bytes per row of the utf8 table: 4 byte character, modifiers, key */
+#define UTF8_ROW 6
+
+/*! Bytes per row of the combinations table: 4 byte character, dead key modifiers and key, modifiers, key */
+#define COMBINATION_ROW 8
+
+namespace layout {
+    // ===== PRIVATE ===== //
+
+    /**
+     * @brief The parser's compare() of the SD card build, same length and case insensitive
+     */
+    bool is(const char* name, size_t len, const char* templ) {
+        return (strlen(templ) == len) && (strncasecmp(name, templ, len) == 0);
+    }
+
+    /**
+     * @brief Character of a table row, its UTF-8 bytes read as one big endian number
+     */
+    uint32_t key(const uint8_t* row) {
+        uint32_t res = 0;
+
+        for (uint8_t i = 0; i < 4; ++i) res = (res << 8) | pgm_read_byte(row + i);
+
+        return res;
+    }
+
+    /**
+     * @brief Codepoint to the form key() reads from a row
+     */
+    uint32_t encode(uint32_t codepoint) {
+        if (codepoint < 0x80) return codepoint << 24;
+
+        if (codepoint < 0x800) {
+            return (0xC0UL | (codepoint >> 6)) << 24
+                   | (0x80UL | (codepoint & 0x3F)) << 16;
+        }
+
+        if (codepoint < 0x10000) {
+            return (0xE0UL | (codepoint >> 12)) << 24
+                   | (0x80UL | ((codepoint >> 6) & 0x3F)) << 16
+                   | (0x80UL | (codepoint & 0x3F)) << 8;
+        }
+
+        return (0xF0UL | (codepoint >> 18)) << 24
+               | (0x80UL | ((codepoint >> 12) & 0x3F)) << 16
+               | (0x80UL | ((codepoint >> 6) & 0x3F)) << 8
+               | (0x80UL | (codepoint & 0x3F));
+    }
+
+    /**
+     * @brief locale::decode(), the codepoint of the character at the start of b
+     *
+     * @param len Receives the bytes of the character, 0 for a stray or cut off byte
+     */
+    uint32_t decode(const uint8_t* b, uint8_t* len) {
+        uint32_t codepoint;
+        uint8_t  n;
+
+        if (b[0] < 0x80) {
+            *len = 1;
+            return b[0];
+        }
+
+        if ((b[0] & 0xE0) == 0xC0) {
+            n         = 2;
+            codepoint = b[0] & 0x1F;
+        } else if ((b[0] & 0xF0) == 0xE0) {
+            n         = 3;
+            codepoint = b[0] & 0x0F;
+        } else if ((b[0] & 0xF8) == 0xF0) {
+            n         = 4;
+            codepoint = b[0] & 0x07;
+        } else {
+            *len = 0;
+            return b[0];
+        }
+
+        for (uint8_t i = 1; i < n; ++i) {
+            if ((b[i] & 0xC0) != 0x80) {
+                *len = 0;
+                return b[0];
+            }
+
+            codepoint = (codepoint << 6) | (b[i] & 0x3F);
+        }
+
+        *len = n;
+        return codepoint;
+    }
+
+    /**
+     * @brief Finds a character in a table, row by row
+     *
+     * The ATmega binary searches the tables that are in order, both find
+     * the same row. The ESP8266 is fast enough to not bother.
+     */
+    const uint8_t* search(const uint8_t* table, size_t rows, uint8_t width, uint32_t codepoint) {
+        uint32_t c = encode(codepoint);
+
+        for (size_t i = 0; i < rows; ++i) {
+            if (key(table + i * width) == c) return table + i * width;
+        }
+
+        return NULL;
+    }
+
+    // ===== PUBLIC ===== //
+
+    hid_locale_t* get(const char* name, size_t len) {
+        // Must be the same layouts as locale::get() on the ATmega
+        if (is(name, len, "US")) return &locale_us_win;
+        else if (is(name, len, "ES-LA_MAC") || is(name, len, "ES_LA_MAC")) return &locale_es_la_mac;
+        else if (is(name, len, "ES-LA") || is(name, len, "ES_LA")) return &locale_es_la_win;
+        else if (is(name, len, "ES")) return &locale_es_win;
+        else return &locale_us_win;
+    }
+
+    /**
+     * @brief Looks up the keys that type the UTF-8 character at str
+     *
+     * @param locale  Layout to look it up in
+     * @param str     Character, up to its last byte
+     * @param strokes Receives up to 2 keys, the dead key comes first for combinations
+     * @param n       Receives the number of keys, 0 if the layout can't type it
+     * @return Number of extra bytes used from str
+     */
+    uint8_t lookup(hid_locale_t* locale, const char* str, stroke* strokes, uint8_t* n) {
+        uint8_t  len;
+        uint32_t codepoint = decode((const uint8_t*)str, &len);
+
+        *n = 0;
+
+        if (len == 0) return 0;
+
+        // Combinations first, they hold some ASCII characters too
+        const uint8_t* row = search(locale->combinations, locale->combinations_len, COMBINATION_ROW, codepoint);
+
+        if (row) {
+            strokes[0].modifiers = pgm_read_byte(row + 4);
+            strokes[0].key       = pgm_read_byte(row + 5);
+            strokes[1].modifiers = pgm_read_byte(row + 6);
+            strokes[1].key       = pgm_read_byte(row + 7);
+
+            *n = 2;
+            return len - 1;
+        }
+
+        if (codepoint < locale->ascii_len) {
+            strokes[0].modifiers = pgm_read_byte(locale->ascii + (codepoint * 2) + 0);
+            strokes[0].key       = pgm_read_byte(locale->ascii + (codepoint * 2) + 1);
+
+            *n = 1;
+            return 0;
+        }
+
+        row = search(locale->utf8, locale->utf8_len, UTF8_ROW, codepoint);
+
+        if (row) {
+            strokes[0].modifiers = pgm_read_byte(row + 4);
+            strokes[0].key       = pgm_read_byte(row + 5);
+
+            *n = 1;
+            return len - 1;
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,29 @@
+/*!
+    \file esp_duck/layout.h
+    \brief The ATmega's keyboard layouts, to look up STRING text before it is sent
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint8_t
+
+#include "src/locale/locale_types.h"
+#include "src/locale/usb_hid_keys.h"
+
+/*! \namespace layout
+ *  \brief Finds the keys of characters like keyboard::write() on the ATmega
+ */
+namespace layout {
+    typedef struct stroke {
+        uint8_t modifiers;
+        uint8_t key;
+    } stroke;
+
+    /*! Layout the ATmega's locale::get() selects for a LOCALE name */
+    hid_locale_t* get(const char* name, size_t len);
+
+    /*! Looks up the UTF-8 character at str, see lookup() in layout.cpp */
+    uint8_t lookup(hid_locale_t* locale, const char* str, stroke* strokes, uint8_t* n);
+};
@@ -14,8 +14,8 @@
  * @{
  */
 #define SD_CMD_LS         0x10   // !< List directory contents (followed by null-terminated directory path)
-#define SD_CMD_READ       0x11   // !< Read file contents (followed by null-terminated file path)
-#define SD_CMD_WRITE      0x12   // !< Write file contents (followed by append flag + filename, then data chunks)
+#define SD_CMD_READ       0x11   // !< Read file contents (followed by null-terminated file path and the window)
+#define SD_CMD_WRITE      0x12   // !< Write file contents (followed by sequence number, append flag + filename, then data chunks)
 #define SD_CMD_RM         0x13   // !< Remove (delete) a file (followed by null-terminated file path)
 #define SD_CMD_RUN        0x14   // !< Execute a script from SD card (followed by null-terminated file path)
 #define SD_CMD_STOP_RUN   0x15   // !< Stop script execution (no arguments)
@@ -25,12 +25,26 @@
 /**
  * @brief Acknowledgment byte used in the streaming protocol
  *
- * For operations that return large amounts of data (SD_CMD_LS, SD_CMD_READ),
- * the receiving device sends this byte after processing each chunk to signal
- * that it is ready for the next one.
+ * SD_CMD_LS packs as many entries as fit into each packet, an entry with an
+ * empty name ends the directory. Every packet starts with its sequence
+ * number, counting from 0. The receiving device sends this byte followed by
+ * that number after processing each packet to signal that it is ready for
+ * the next, the directory is closed once the last one was acknowledged. The
+ * number of the packet before means this one got lost, it is sent again.
+ *
+ * SD_CMD_READ streams up to window chunks ahead, the byte after the file
+ * path (1 if it is missing). Every chunk starts with its sequence number,
+ * counting from 0. The receiving device answers with this byte followed by
+ * the sequence number of the last chunk it processed, which makes room for
+ * that chunk and all before it. A chunk with only the sequence number ends
+ * the file, the file stays open until it was acknowledged as well.
  *
  * For SD_CMD_WRITE, this device sends this byte after successfully writing
- * each chunk to signal readiness for the next one.
+ * each chunk to signal readiness for the next one. The receiving device
+ * numbers the packets of a write, the byte after SD_CMD_WRITE: 0 opens the
+ * file, the chunks count from 1 to 255 and on with 1. The byte after SD_ACK
+ * is the number of the packet it answers. A packet sent again because its
+ * SD_ACK got lost is answered again but not written twice.
  */
 #define SD_ACK 0x06 
 
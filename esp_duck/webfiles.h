@@ -52,15 +52,15 @@ const uint8_t hidcontrol_html[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x
 
 const uint8_t hidcontrol_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0xcd,0x5c,0x5b,0x73,0x1b,0x47,0x76,0x7e,0x57,0x95,0xfe,0xc3,0x8,0x76,0x3c,0x3,0x1b,0x1c,0x53,0xf2,0x2a,0xc9,0x92,0x96,0x15,0x10,0x4,0x49,0x14,0xc1,0x4b,0x1,0xa0,0xbc,0x36,0xad,0x50,0x43,0x60,0x48,0x42,0x1c,0xcc,0x20,0x33,0x3,0x4a,0x5c,0x99,0x79,0x4c,0xde,0x93,0xd7,0x54,0xe5,0x6d,0x37,0xd9,0xec,0xba,0x36,0xb5,0x49,0xf9,0x92,0x87,0xfc,0x97,0xfd,0x5,0xf9,0x9,0xf9,0x4e,0x5f,0xe6,0xd2,0x17,0x90,0x52,0xb4,0x55,0x51,0x15,0x35,0x40,0xf7,0x39,0xdd,0xa7,0xbb,0x4f,0x9f,0xfb,0xc0,0x5d,0x64,0xa1,0x93,0xe5,0xe9,0x74,0x9c,0xbb,0xeb,0xf7,0xef,0xdd,0xbf,0xf7,0xe9,0xa7,0x4e,0xe7,0x60,0x7f,0xab,0xb7,0xed,0x7c,0x44,0x1f,0x86,0xa3,0xf6,0xfe,0x68,0x78,0xff,0xde,0x38,0x89,0xb3,0xdc,0xe9,0x6c,0x6d,0x3b,0x4f,0x9c,0x37,0xf7,0xef,0x39,0xf8,0x37,0x3a,0x19,0x7d,0x75,0xd8,0xdb,0xdf,0x5e,0x73,0x1e,0xaf,0xae,0xb6,0x64,0xdb,0xe6,0x46,0xbf,0xd3,0xef,0x75,0x76,0xd7,0x9c,0x9f,0x55,0x5a,0xfb,0xed,0xaf,0xe,0x8e,0x46,0x55,0xc8,0xce,0xce,0xd1,0xfe,0xee,0xc9,0xb0,0xf7,0x75,0x77,0xcd,0x79,0xa8,0xb4,0x6e,0x76,0x1,0x8f,0xe6,0xc7,0xb2,0xb9,0xdf,0xdb,0xef,0x16,0xad,0x8f,0x64,0xeb,0x66,0x77,0xab,0x7d,0xd4,0x2f,0x7,0x6f,0x1c,0xd,0x1b,0xa2,0x6b,0xef,0xe0,0x68,0xd8,0x3d,0x19,0x31,0x3a,0x1e,0xaf,0xde,0xbf,0x77,0xc3,0xd6,0xc6,0x17,0xb1,0xdb,0xfd,0x6a,0x58,0xae,0x62,0x78,0xd8,0xed,0xac,0xc9,0x2f,0xf4,0xaf,0xd1,0x8d,0xf3,0x30,0x6d,0xac,0x35,0xba,0xfb,0xa3,0xee,0xa0,0xd1,0x6a,0x8c,0x82,0x53,0x7c,0x1b,0xb5,0x37,0xf0,0xb9,0x9b,0x8d,0x83,0x79,0x48,0x9d,0xc3,0xe,0xbe,0x3a,0xf8,0x34,0x3c,0x6c,0x77,0xba,0xf8,0xbc,0x11,0x8c,0x2f,0xb3,0x79,0x30,0xa6,0xde,0x8d,0x76,0x67,0x57,0xb4,0x57,0x6,0xde,0xc,0xa3,0x30,0xa7,0x6e,0xac,0xa4,0x3b,0x22,0x9c,0x5e,0x9c,0x85,0x69,0x8e,0x96,0xde,0xfe,0xb0,0x3b,0x18,0xa1,0x65,0x27,0x99,0x11,0xc4,0xce,0xc1,0x1e,0xf5,0x77,0xe3,0x9,0x23,0x64,0x13,0x9f,0xf,0x83,0xf3,0xf0,0x68,0x8e,0xaf,0x87,0xed,0xed,0xee,0xd1,0x61,0x6d,0x64,0xea,0xdb,0x4c,0x5e,0xc5,0xa2,0x77,0xf3,0xe0,0xcb,0x7d,0x60,0xb4,0xd3,0x34,0x79,0xc5,0x50,0x8,0x9c,0x7f,0x15,0x50,0x55,0x88,0x7e,0x78,0x46,0x24,0xf4,0xbb,0x5b,0xa3,0xda,0xa0,0xac,0x73,0x30,0x3d,0xbf,0xa0,0xde,0x41,0x6f,0x7b,0x87,0xe8,0xeb,0x4,0xf3,0xac,0x9f,0x8c,0x2f,0xd1,0xd4,0x69,0x1f,0xe,0xfb,0x7,0x9d,0x5d,0xb4,0xee,0x2f,0x66,0xa2,0x71,0xff,0x68,0x4f,0xb4,0xd,0xc7,0x69,0x12,0x45,0xa2,0x79,0xd8,0x19,0x1c,0xf4,0xfb,0xbc,0xa7,0x4a,0x77,0x3a,0x8d,0x73,0x0,0x86,0x21,0x23,0x7d,0xd0,0x3,0xaf,0x75,0x6,0xdd,0xee,0x3e,0x5b,0x2f,0x58,0x93,0x2d,0x8,0x47,0xd9,0xe0,0x48,0x37,0x2,0x79,0xb8,0xd3,0xdb,0x1a,0xd5,0x4e,0xcd,0x7d,0xe8,0xae,0xb9,0xf,0xdc,0x96,0xfb,0x8,0xcf,0xbf,0xc2,0xf3,0x33,0x3c,0x3f,0xc0,0xf3,0x67,0x78,0x7e,0x88,0xe7,0x63,0x3c,0xff,0xc,0xcf,0x3f,0xc7,0xf3,0xaf,0xf1,0xfc,0xb,0x3c,0x3f,0xc2,0xf3,0x2f,0xf1,0xfc,0x18,0xcf,0x9f,0xe3,0xe9,0xe1,0xb9,0x8a,0x67,0xd3,0xad,0x10,0xe9,0xae,0xa0,0xe5,0x4,0x3d,0x4f,0xf0,0xfc,0x4,0xcf,0x63,0x3c,0xdf,0xe0,0xf9,0x1c,0xcf,0x1b,0x3c,0xbf,0xf9,0x6,0x1f,0xbe,0xc5,0x87,0x75,0x3c,0xd7,0xa8,0xc1,0xc5,0xa3,0x81,0xf,0x2d,0x3c,0x3f,0xc7,0xff,0x3e,0x9e,0x5f,0xe0,0xf9,0x29,0x9e,0x4f,0xf1,0x7c,0x81,0xe7,0xdf,0xba,0x62,0x49,0x75,0xe6,0xbc,0xc,0xaf,0x4f,0x93,0x20,0x9d,0xf4,0x83,0xeb,0x64,0x91,0x67,0x25,0x9f,0xbe,0x9a,0xc6,0x6b,0xce,0x71,0x49,0xd6,0x1b,0xe7,0x4a,0x70,0x3c,0xff,0x1e,0xe1,0xdb,0xff,0xfc,0xf3,0xdf,0xff,0x84,0xbf,0x1f,0x1c,0x34,0x17,0x7b,0x55,0x2,0x6f,0x74,0x15,0xe0,0x5f,0xe3,0xef,0x37,0xe,0x9a,0x4d,0xc0,0xdb,0x6,0xe0,0xdf,0x3a,0x68,0x66,0xc0,0x2a,0x78,0xa7,0x7d,0xd2,0xd9,0x63,0xc4,0x8,0xf0,0x7f,0xc1,0xdf,0xaf,0x9c,0x4e,0x7b,0x85,0x9a,0xd,0xe3,0x3,0x61,0x6b,0xc0,0xa6,0x50,0x11,0xd0,0x6c,0x9e,0x62,0x7,0x22,0x40,0xc5,0xf8,0x1d,0x44,0xc6,0xca,0xa6,0x71,0x5,0x80,0xd7,0x67,0x60,0xf0,0xd6,0x19,0xbe,0x56,0xd6,0x4c,0x18,0xff,0xed,0xa0,0xd9,0x30,0xfc,0xa6,0xba,0x9b,0xff,0xca,0x76,0xd3,0x4c,0xcb,0xe6,0xae,0x1,0xf8,0xf7,0xe,0x9a,0xd,0xc0,0x5d,0x75,0xe4,0xdf,0xb0,0x91,0xbb,0x5d,0x33,0xd5,0xdd,0xa1,0x1,0xfc,0x7,0xa7,0x6b,0xdc,0xf6,0xee,0x10,0xe2,0xb2,0xba,0x29,0x12,0x78,0x5,0xcd,0xc6,0xe1,0xb7,0x7a,0xca,0xf0,0xff,0x86,0xbf,0xef,0x1c,0x34,0x1b,0x86,0x17,0x1b,0x5e,0x7,0xfe,0xde,0x91,0x1b,0x5e,0x7,0xde,0xde,0x50,0x80,0x7f,0x4b,0x6c,0xe6,0xa0,0xd9,0x4,0x3c,0x30,0x0,0x7f,0xef,0x6c,0x1b,0x47,0xde,0x51,0x81,0x7f,0xc7,0x80,0x77,0xcc,0xc0,0x47,0x6,0xe0,0x9f,0x1c,0x34,0x1b,0x80,0x7b,0xea,0xd9,0x7c,0xc7,0xce,0xa6,0x67,0x3c,0xf5,0xde,0xbe,0x1,0xf8,0xf,0xe,0x9a,0x4d,0xc0,0x43,0x3,0xf0,0xf,0x4e,0xcf,0x78,0x8c,0xbd,0x91,0x1,0xf8,0x47,0x7,0xcd,0xc6,0x33,0xec,0xab,0xe0,0xff,0xce,0xc0,0xfb,0x23,0xd3,0xd8,0xfd,0x67,0x6,0xe0,0xff,0x72,0xd0,0x6c,0x0,0xde,0xef,0x2b,0xc0,0x7f,0x20,0x4,0x7,0xcd,0x26,0xe0,0x3,0x3,0xf0,0x7f,0x38,0x68,0x36,0x0,0x1f,0xaa,0x23,0xff,0x27,0x1b,0xf9,0xb0,0x6f,0x5e,0xe2,0xe1,0xc8,0x0,0xfe,0xa3,0x73,0x68,0x5c,0xe2,0xe1,0xe8,0x64,0xa3,0x26,0x1a,0x7e,0xcd,0xf8,0xe3,0x70,0xb4,0xb2,0x61,0x11,0xd,0x3,0x95,0xf4,0xef,0x19,0xe9,0x3,0x23,0xe9,0x83,0x23,0x3,0xf0,0x4f,0xce,0xc0,0xc8,0x51,0x43,0x95,0xa3,0x7e,0x60,0x1c,0x35,0x34,0x72,0xd4,0xb0,0x67,0x0,0xfe,0xce,0x19,0x1a,0x2f,0xe3,0x70,0xd7,0x0,0xfc,0x7b,0x67,0x68,0x14,0x3a,0x23,0xf5,0xca,0xfc,0xc8,0xb6,0x64,0x64,0xbc,0x32,0x47,0x6d,0x83,0xda,0xf9,0x95,0x73,0x44,0x22,0x84,0xc3,0x3e,0x2f,0xf6,0x70,0x16,0x8c,0x8d,0x8a,0xeb,0x64,0xaf,0xdd,0x91,0xa3,0x68,0xea,0xcb,0xf1,0xf6,0x82,0x71,0xd3,0xac,0xc4,0x8c,0x88,0x52,0x95,0x2d,0x41,0xdc,0xb6,0x22,0x92,0x5a,0xab,0x22,0x1a,0x75,0x55,0x5,0x5b,0xd7,0x58,0x4b,0xb1,0x49,0x6f,0x99,0xb1,0x85,0xf6,0xb2,0x13,0xcd,0x74,0xd8,0x12,0xdc,0x5b,0x66,0xfe,0xda,0xb8,0x64,0xa9,0xd5,0xec,0xd3,0x6e,0x9a,0x37,0x59,0x6a,0xb8,0x25,0x88,0xbb,0x56,0x44,0xd2,0x76,0x76,0xc4,0xae,0x79,0x46,0xa9,0xf9,0x96,0xad,0xb2,0x3b,0xb4,0xa2,0x92,0x62,0x5b,0x32,0x27,0xe9,0x42,0x7d,0x73,0x2b,0x1a,0x71,0xd9,0xb4,0x5b,0x3d,0xe3,0xb4,0x52,0x3b,0xda,0xa7,0xad,0x1d,0xa8,0xae,0x29,0xed,0x88,0xdb,0x1b,0x46,0x44,0xa9,0x35,0x97,0x20,0xe,0xac,0x88,0xa4,0x41,0xed,0x88,0x3b,0x66,0x44,0xa9,0x4d,0x97,0x20,0x1e,0x59,0x11,0x49,0xb3,0xda,0x11,0x7b,0xfb,0x46,0x44,0xa9,0x38,0x97,0x20,0xe,0xad,0x88,0xa4,0x44,0x97,0x20,0x8e,0xac,0x88,0xa4,0x50,0x97,0xb1,0x40,0xdf,0x8c,0x2a,0x95,0xab,0x7d,0xce,0xfe,0x33,0x2b,0x22,0x29,0x5a,0x3b,0xe2,0x7e,0xdf,0x88,0x28,0x95,0xee,0x12,0xc4,0x3,0x2b,0x22,0x29,0x60,0x3b,0xe2,0xa1,0x79,0x46,0xa9,0x8c,0x97,0x6d,0xcf,0xe1,0xc8,0x8a,0x4a,0x8a,0x79,0xc9,0x9c,0xa4,0x9e,0xf5,0x8b,0x59,0x51,0xd2,0xcb,0xa6,0x1d,0x98,0x97,0x2a,0x15,0xb6,0x7d,0xda,0xc1,0x91,0x15,0x91,0x94,0xb7,0x1d,0x71,0x68,0x16,0x5e,0x52,0x91,0x2f,0x41,0xec,0x59,0x11,0x49,0xa9,0x2f,0x41,0xdc,0xb5,0x22,0x92,0x82,0xb7,0x23,0x8e,0xcc,0x37,0x5a,0x2a,0x7b,0x3b,0xe2,0x51,0xdb,0xaa,0xb0,0x49,0xf1,0x17,0x88,0x42,0xfd,0x4b,0xaf,0x16,0xe1,0x24,0x84,0x90,0x46,0x5d,0x67,0xaf,0xbd,0x8f,0xc8,0xc4,0x0,0x7e,0x6e,0x14,0x64,0x99,0x33,0xcc,0x83,0x3c,0x94,0xbe,0x2d,0x73,0x7d,0xd3,0xc5,0x38,0x4f,0x52,0xaf,0x59,0xf5,0xea,0xf3,0x8b,0x69,0xe6,0xcf,0x92,0x9,0xf9,0xc1,0x71,0xf8,0xca,0x19,0x86,0xb9,0xd7,0x5c,0x57,0xfa,0x23,0xe6,0x2a,0x3,0x2,0xd1,0x29,0xbf,0x1e,0x13,0x52,0x41,0x31,0x51,0xc,0xc0,0xb3,0x20,0xca,0x42,0xb5,0x2f,0xbf,0x9e,0x4f,0xe3,0x73,0x5b,0x2f,0x88,0xce,0xf7,0x92,0x9,0xf9,0xe3,0xb3,0xb5,0x78,0x11,0x45,0x2d,0x27,0x5f,0x5b,0xbd,0xd1,0xc0,0xa6,0x59,0x1e,0xc6,0x61,0xca,0x1c,0x77,0xd9,0x2b,0xf6,0x84,0xff,0x7f,0x11,0x64,0x18,0xc7,0x9b,0x61,0x9d,0x4e,0x1a,0xe6,0x8b,0x34,0x2e,0x57,0xe9,0xa3,0x13,0x3d,0xeb,0x12,0x23,0x98,0x4c,0xa,0xd8,0x12,0x8,0xad,0xc,0x88,0xb5,0x9c,0x84,0xb3,0x69,0xee,0xb9,0xd4,0xe1,0x96,0x88,0x93,0x30,0x32,0x20,0x4e,0x58,0xfc,0xe9,0x36,0xdc,0x71,0x14,0x6,0x29,0xb0,0x33,0xaf,0x8e,0xcd,0xda,0xbd,0xe5,0xb8,0xe7,0x61,0x5e,0x60,0x8a,0xc5,0x21,0x8a,0x14,0x5c,0xfb,0x67,0x69,0x32,0xf3,0x8a,0xb1,0x4a,0x4,0xfe,0x7f,0x16,0xe6,0x1d,0x9c,0x8c,0x77,0x55,0xcc,0x28,0xe,0xea,0xaa,0x3e,0x1b,0xb5,0xba,0x6,0xe4,0x11,0x3b,0xba,0xa,0x7a,0x71,0x96,0xca,0x0,0xbc,0xdd,0x34,0x4,0x8f,0xb7,0x54,0x86,0x28,0xb8,0x4a,0x19,0x82,0xb7,0x6b,0x43,0x24,0xb1,0x17,0xb6,0x9c,0xf1,0x69,0x8d,0x7d,0xa7,0x67,0xde,0x83,0x3a,0x5b,0x1c,0x87,0xcf,0x9b,0x8e,0xd6,0x84,0x59,0x8e,0x9f,0x5b,0x59,0x9,0x0,0xfe,0x7c,0x91,0x5d,0x78,0x18,0xbd,0xce,0x51,0x9c,0xa4,0x50,0x9d,0xf3,0x2e,0x53,0xfa,0x67,0x49,0xda,0xd,0xc6,0x34,0xa8,0xf3,0xe4,0xb,0x10,0xee,0x35,0x2b,0x83,0xdf,0x94,0x91,0xe0,0xfd,0x6e,0x67,0xd4,0x3b,0xd8,0x97,0xf7,0x96,0xce,0xc9,0x74,0x6d,0x33,0xba,0xcf,0xfa,0xdd,0xa5,0x7b,0xc0,0xba,0x4c,0x57,0x1,0xdc,0xe2,0x24,0x97,0xca,0x8d,0x4f,0xaf,0xab,0x5f,0xf9,0x8a,0x1c,0xf,0x7,0x17,0x26,0x67,0xce,0x97,0xc3,0xbd,0x20,0x46,0xac,0x33,0x75,0x1e,0x3c,0x79,0xe2,0xb8,0x8b,0x78,0x12,0x9e,0x4d,0xe3,0x70,0xe2,0x3a,0x1f,0x7d,0x54,0x76,0xfa,0xaf,0x32,0xf5,0xbb,0x9f,0x86,0xc1,0xe4,0x9a,0xb,0x9d,0x27,0x40,0x7d,0xd8,0x54,0x67,0xa1,0x7f,0xf2,0x3e,0xa6,0x8b,0xea,0xfd,0x17,0x74,0xeb,0x44,0x21,0x24,0x37,0x49,0x5e,0xf9,0x25,0x51,0x98,0x54,0x6d,0x13,0xb4,0x18,0x9a,0xdf,0x3b,0x49,0x2,0x54,0x15,0x5f,0x37,0xce,0x38,0xc8,0xc7,0x17,0xe,0xe3,0x93,0x1a,0xcc,0x8d,0xe1,0x4c,0xb2,0x30,0x9e,0x78,0xe3,0xd9,0xa4,0xe5,0x20,0x9c,0x2d,0x85,0xa1,0x99,0xa9,0x93,0x4b,0x8d,0xe2,0x7e,0x72,0xee,0x87,0x69,0xea,0xb9,0xfb,0x49,0x4e,0xec,0x11,0x87,0xe3,0x1c,0xa7,0xd3,0x54,0x48,0xf,0x22,0x44,0xbd,0x3d,0xf7,0xcb,0xf0,0x74,0x88,0xf0,0x30,0xb8,0x20,0x5e,0xa,0x6e,0x5b,0x58,0x9d,0xe9,0x39,0x87,0xbc,0xca,0x4e,0x68,0x9,0x6c,0x47,0xdd,0xb3,0x45,0x3c,0xce,0xa7,0x9,0x64,0x86,0x4a,0x28,0x4,0x21,0x85,0x5a,0xb1,0x40,0x5a,0xe6,0x53,0xa7,0x81,0x2f,0x27,0xf8,0xd8,0x70,0xd6,0xd8,0xe7,0x86,0x42,0x82,0x18,0xd6,0x7b,0xf1,0xe1,0x1b,0xf4,0xde,0x38,0x1f,0xbe,0xc1,0x1e,0xdd,0xbc,0x68,0x81,0xb6,0x8c,0xee,0x8f,0xe1,0xe4,0x68,0x2f,0x26,0xa7,0xe7,0xde,0x8b,0x3f,0xfe,0xdd,0x3f,0x8,0x78,0xe7,0x5b,0x7c,0x0,0xc6,0xcd,0xb,0x75,0x89,0x37,0x96,0x35,0x2b,0xe7,0x5e,0x59,0xb2,0x61,0x53,0x6a,0x7,0x39,0x8d,0x21,0x1a,0x6a,0xeb,0xe6,0x1,0xe6,0x24,0x9d,0x92,0x60,0x14,0xc,0x89,0x75,0x15,0xfb,0x5e,0x99,0xc7,0xd0,0xb,0x1c,0xc,0xa7,0x2f,0x15,0x5b,0x4f,0x43,0x36,0xd9,0xc0,0x9e,0xba,0xc,0x2e,0x4,0x7c,0x29,0xe0,0x69,0x39,0x2a,0x8,0xed,0xd3,0x34,0x3e,0x4b,0x3c,0xf7,0x8f,0xff,0xf4,0x8f,0x4c,0xbe,0x98,0xb9,0x0,0xc4,0x2c,0xe6,0x13,0xdc,0x96,0x13,0x12,0x28,0x8b,0x4c,0x9b,0xb,0xcd,0x69,0x2e,0x3a,0x4f,0xa6,0x94,0xc4,0xb9,0xa,0x22,0x1d,0xa,0xea,0x62,0x3a,0xb,0x49,0xd8,0xf3,0xf5,0xec,0xf4,0x36,0xfd,0xf1,0x45,0x10,0x9f,0x87,0x42,0x7,0xe8,0x66,0x44,0xb3,0xc5,0x6c,0x8b,0xe2,0x6b,0xf5,0x44,0xd6,0x2d,0x5c,0x48,0xfb,0xaf,0x71,0xa1,0x68,0xf7,0x8c,0xa2,0x76,0xf,0x26,0xd2,0xa6,0x73,0x38,0x38,0xe8,0x74,0x87,0xc3,0x83,0xc2,0x52,0xea,0xcc,0x26,0x26,0x81,0x4b,0x7,0xd3,0x72,0x2c,0x62,0x77,0x8c,0xd3,0x22,0x80,0xf5,0xb7,0x11,0xc7,0xe1,0xeb,0x70,0xbc,0xfc,0xea,0xb,0xe,0xa2,0x4e,0x3e,0x8d,0x5f,0x13,0x17,0xcd,0xfa,0x5e,0x18,0xe4,0x43,0xc9,0xe,0x42,0x65,0x9b,0x18,0x42,0x3b,0x21,0xd,0x8b,0x53,0x26,0xf,0x85,0x67,0x21,0x9b,0x4b,0xaf,0x49,0x72,0x69,0x5a,0x31,0xae,0xb2,0x77,0x69,0x58,0xe1,0x4c,0x2e,0x30,0xf3,0xb,0x8b,0xa6,0xbe,0xb6,0x99,0x1f,0x85,0xf1,0x79,0x7e,0xe1,0x7c,0xe1,0xac,0x9a,0x57,0xc9,0x76,0xf3,0xd8,0xf7,0xfd,0x59,0xcb,0xb9,0x7c,0xee,0xbf,0x4c,0xa6,0xb1,0xe7,0x3a,0x6e,0xd3,0x72,0x43,0x2a,0x56,0x57,0x4d,0x76,0x87,0x58,0xa9,0x7d,0xfc,0x4b,0xc3,0xaa,0x6b,0x2b,0x1c,0x27,0xb3,0xd3,0xc4,0x3,0x15,0xf5,0x65,0x56,0xd,0x4f,0x3e,0x90,0x4e,0x60,0x5d,0x2d,0xe4,0xa9,0x97,0x6b,0x76,0x6,0xe7,0x6f,0xe4,0xbf,0x60,0x60,0x38,0xec,0x13,0x3e,0xaf,0x2f,0x99,0xe6,0xc5,0x70,0x84,0x1c,0xdf,0x36,0xa4,0x60,0x5e,0xca,0xc0,0xea,0x25,0xd8,0x69,0xf,0xda,0x1d,0xa4,0x5d,0xd,0xd7,0xe0,0x22,0x48,0x8d,0xf7,0x80,0x98,0x6f,0xd9,0x35,0x98,0x4d,0xde,0xea,0x16,0x70,0x8e,0xbe,0x50,0xd7,0xa,0x5,0xca,0x16,0x8b,0xd,0xaa,0x2d,0x6b,0xec,0x13,0x13,0xb9,0x2c,0xd9,0xeb,0x2a,0x4c,0x22,0x71,0xd8,0x6,0xd1,0x17,0x7d,0x87,0x74,0xbb,0x8d,0x39,0x1,0x64,0xbc,0xbb,0x2c,0xc9,0x89,0xf3,0x50,0x8f,0x9f,0x8d,0xc4,0x4d,0xd2,0xec,0x62,0x7a,0x96,0x13,0xb5,0x66,0xa6,0x12,0x6e,0x80,0x1c,0xc9,0x7c,0x43,0xfe,0x14,0xcc,0x3f,0xae,0xb1,0xff,0xf8,0xe2,0x4f,0xc0,0xff,0x90,0x3d,0xe0,0xc9,0xfa,0xd2,0x4d,0x37,0xa0,0xdc,0x23,0xe5,0x44,0xa9,0xc,0xc0,0x67,0x3b,0x73,0xc,0x2,0x8b,0x53,0xad,0x37,0x6b,0x7,0xfa,0x5,0xe,0x31,0x60,0xe6,0x26,0xbe,0x7c,0x8e,0x2f,0xbf,0x2c,0x19,0x62,0x7c,0xe1,0xe7,0xc9,0xd1,0x7c,0x1e,0xa6,0x9d,0x20,0xb,0x6b,0xb,0x29,0x20,0x74,0x9e,0x1f,0x75,0x7f,0x31,0x72,0x36,0x28,0x35,0x2e,0x59,0x7d,0x14,0xbe,0xce,0x37,0x22,0x58,0x46,0x16,0x7e,0xbf,0x8d,0xd1,0xeb,0xeb,0x7f,0x15,0x40,0xe1,0xcc,0x88,0xe7,0x51,0x66,0xb1,0xba,0x6a,0x92,0x3,0xe4,0x5a,0x1f,0xc2,0x43,0x9b,0x82,0x6a,0xf,0xf6,0x49,0x12,0x5d,0x85,0x64,0xda,0xbc,0x84,0x26,0x36,0xe9,0x7c,0xce,0x28,0x39,0x84,0x74,0x4a,0x57,0x49,0x95,0xd7,0x6,0x63,0x48,0x18,0x14,0x69,0x38,0x4b,0xae,0xc2,0xee,0x55,0x18,0xe7,0x7d,0xe1,0x8c,0x78,0x85,0xe9,0xd5,0x82,0x6f,0x1c,0x4f,0x60,0x1a,0xaa,0x2c,0xc2,0x29,0x25,0x62,0x3c,0xa2,0xb4,0x8b,0xba,0x4,0xa0,0x8d,0x7a,0x7b,0x5d,0x28,0xe3,0x86,0xc6,0x51,0x37,0x2d,0x67,0x96,0x35,0xd7,0x55,0xf3,0x98,0x13,0x2d,0xa6,0x20,0x6b,0x26,0xb4,0x11,0xcb,0x78,0x51,0x2e,0x89,0xad,0xd2,0x44,0xd1,0xff,0x79,0x49,0xe4,0x42,0x84,0xb8,0xa3,0x79,0x30,0x8d,0x98,0xa0,0x68,0x1c,0xec,0x36,0x88,0x99,0xd8,0xfe,0x7b,0x26,0x14,0x76,0x1b,0xf4,0xad,0xd8,0xec,0x3e,0xeb,0x75,0xba,0x27,0xdd,0xc1,0xe0,0x60,0x60,0xd8,0xf,0xd5,0x90,0xe2,0x84,0x23,0x8c,0xf0,0x36,0x54,0xdf,0x54,0xc4,0xb5,0x88,0x4e,0x64,0xd7,0xf1,0x98,0xcb,0xcb,0xfc,0x75,0xde,0xa2,0x68,0x5,0x2b,0x9d,0x51,0x2e,0x9a,0x3,0x77,0xe1,0x75,0x2e,0x2f,0x49,0xed,0x58,0x86,0xcc,0x56,0x23,0xc5,0xee,0x35,0xd2,0x45,0x1c,0x43,0xb7,0x37,0xaa,0x73,0xf2,0x23,0x8b,0xe0,0xe1,0x11,0xfb,0x62,0x14,0x3f,0x9b,0x47,0xe4,0x84,0x7f,0x13,0xbb,0xf5,0x3,0x36,0xb8,0x8d,0x70,0x70,0x1d,0x8f,0xec,0xfc,0x29,0x70,0x57,0xd7,0xf1,0xf8,0x9c,0xf,0x25,0xa4,0x17,0x5a,0x3e,0xf9,0xc4,0xe8,0x73,0x89,0x69,0x29,0x0,0xc1,0x10,0x8e,0xa7,0xcf,0x35,0x6e,0x92,0x6b,0x8b,0xe2,0x65,0xc2,0x50,0xa3,0xe5,0x25,0xa7,0xe5,0x25,0xd1,0x12,0x17,0x84,0xbc,0x74,0x3e,0xe1,0xd1,0xab,0xb2,0x28,0xca,0x3a,0x54,0x49,0xe0,0xf8,0x62,0x11,0x93,0x29,0x86,0x81,0xb2,0xc5,0x29,0xd5,0x70,0xc1,0x34,0x7a,0xd9,0xa2,0xd1,0xd4,0xc1,0xd6,0xed,0x63,0x55,0xe5,0x75,0xa9,0x9e,0xd9,0xd8,0x37,0xdf,0xc4,0xf0,0x70,0xb8,0x89,0xe6,0xd8,0x47,0x8,0x48,0xc2,0x8,0x85,0xc4,0x84,0x8d,0x15,0xfa,0x46,0x6f,0x36,0x34,0xd9,0xe,0x64,0x9a,0xf5,0x11,0x84,0xeb,0xe3,0x44,0xb0,0xe8,0x29,0xbb,0x31,0xd5,0xf3,0x74,0x56,0x9c,0x87,0x96,0x5b,0xf6,0xa0,0x82,0xfa,0xed,0xb7,0x66,0x46,0xb5,0xed,0x89,0xcb,0xca,0xc0,0xc0,0x70,0x72,0x27,0xcc,0x28,0x86,0x4d,0xb8,0x75,0xb1,0x37,0x26,0x27,0x3d,0xd5,0xc9,0xa2,0xe5,0x27,0x51,0x48,0x9e,0x35,0xdd,0x76,0x76,0xe9,0xe1,0xdf,0x95,0x7a,0x62,0xd,0x57,0x16,0x9d,0xfe,0x2c,0xcc,0x32,0x44,0x17,0xd4,0xa9,0xab,0xd7,0x8c,0x8d,0xd1,0xa8,0xeb,0x58,0x84,0x50,0x82,0x28,0xd2,0x2e,0x50,0x15,0xad,0x70,0x3,0x1b,0x6f,0xef,0x75,0xdd,0x68,0x2a,0xaf,0xfb,0xc,0x9b,0xea,0xec,0xc0,0xdd,0xe9,0x97,0x11,0xe1,0xee,0x55,0x6e,0xd4,0x77,0xb0,0xfb,0xa0,0x9b,0xc6,0x2d,0x52,0x70,0xfc,0x83,0xcd,0xda,0x23,0xbb,0x48,0x82,0x6b,0x91,0xdf,0xd9,0x84,0xeb,0x48,0x53,0xa7,0x6a,0x10,0xd6,0xa2,0xbe,0xcf,0x82,0x88,0x2c,0x37,0xd7,0xe2,0x40,0x50,0x41,0x9d,0x67,0x89,0x90,0x9c,0x20,0xba,0x15,0x36,0x2b,0xa2,0xaf,0x36,0xb8,0x70,0x67,0x99,0xd1,0x53,0x3b,0x33,0x55,0x0,0x16,0xfe,0xd6,0xc9,0x2c,0x98,0xef,0xc2,0xdc,0xc,0xc9,0xe8,0x54,0x8c,0x32,0xdd,0xd9,0xa,0xfd,0x79,0x1a,0x92,0x84,0xdf,0xc,0xcf,0x82,0x45,0x94,0x9b,0x9d,0x73,0x6c,0x89,0xcf,0xfd,0x20,0x63,0x4,0xe2,0x36,0x9b,0x11,0x33,0x33,0x6a,0xe4,0x25,0x64,0x91,0x2c,0x32,0x8f,0x1e,0x84,0xfe,0x38,0x4f,0x23,0x90,0x2b,0xbe,0x5,0x51,0x5e,0x7e,0x99,0x41,0xeb,0xe1,0xdb,0xbb,0xd2,0x7c,0xc1,0x1d,0x4f,0x6d,0x1f,0x6e,0xcc,0x67,0x74,0x34,0x37,0x9c,0x50,0x41,0x5f,0x53,0x35,0x97,0x3b,0xa3,0x41,0x5f,0xb5,0xe5,0x1,0xce,0xc,0x49,0x13,0xbc,0x6e,0x5e,0x73,0x4,0xbe,0x62,0xd,0xbc,0xdd,0x37,0x1,0x17,0x3b,0xa2,0x40,0x6f,0x1f,0xf5,0xdc,0xa6,0x39,0xc0,0x33,0x5f,0xe4,0x6f,0xcd,0x79,0x9c,0xa3,0xe2,0x2b,0xb0,0x54,0xe8,0xe3,0xea,0xc2,0xc4,0xf7,0x71,0x61,0x6b,0x51,0x26,0xe1,0xe6,0x5f,0x49,0xb6,0x13,0xb7,0xa0,0x4e,0x32,0xd,0x81,0xb3,0x4e,0xae,0xc,0x93,0x28,0x80,0xa5,0x86,0x4c,0xe4,0xe7,0xa6,0xd9,0xa4,0x84,0x64,0xa6,0x4c,0xcf,0x55,0x45,0xa1,0x95,0x28,0xeb,0x9a,0x7e,0xf7,0x84,0x22,0x74,0x10,0x72,0x1,0xaa,0x51,0x9e,0x93,0xd9,0x2e,0xdc,0xb0,0xd8,0x25,0xe9,0x2f,0xbf,0xa5,0xe4,0x94,0x25,0x71,0x3e,0x8d,0xb5,0xd0,0xaa,0xc6,0x68,0xe3,0xe6,0xfa,0x12,0xd1,0x6d,0xf2,0x51,0x38,0x65,0x93,0xe9,0xd9,0x99,0xf3,0xa4,0x5c,0x36,0x74,0x54,0xb1,0x1d,0x86,0xe5,0x28,0xd6,0xa,0x61,0xdb,0xad,0x94,0xda,0xed,0x75,0x8b,0x8a,0x63,0x77,0x19,0xa9,0x56,0xf1,0x16,0x5f,0x19,0x7d,0x7,0xc6,0x45,0x7a,0x7c,0x84,0x72,0x6,0xce,0x24,0x19,0x2f,0x66,0xb8,0xa9,0xe4,0x25,0x76,0xa3,0x90,0x3e,0x6e,0x5c,0xf7,0xc0,0xb1,0x61,0x1c,0x9c,0x46,0xe1,0xae,0x28,0x64,0x75,0x4d,0x6e,0xd0,0xe9,0x53,0x6c,0x6d,0x88,0xd0,0xef,0x84,0xe4,0x41,0xc1,0x88,0x53,0x11,0xb7,0x95,0x45,0xb0,0x3d,0x62,0x71,0xa3,0xe0,0x95,0x92,0xf0,0x52,0x65,0xff,0x4b,0x9f,0x29,0xa4,0xec,0xcb,0x69,0x7e,0xe1,0xb9,0x5b,0x38,0x63,0x4c,0x70,0x29,0xb7,0x1f,0xe,0xdb,0x67,0x85,0xbb,0x76,0x79,0x9b,0xb7,0xc6,0x5d,0x41,0xd4,0x87,0x1f,0x5f,0x3e,0x27,0xce,0xa1,0xb4,0x9f,0x91,0x98,0x9a,0x20,0x57,0x8,0xd2,0xc5,0x8c,0xc8,0xea,0x19,0xc5,0x8c,0x41,0xca,0x48,0x70,0xa3,0x94,0xd1,0x84,0x8c,0x84,0x36,0x8,0x19,0x5d,0xc6,0x48,0x60,0x45,0xc6,0x48,0x35,0xbd,0x77,0xb0,0xd9,0xdb,0xea,0x21,0x18,0xa3,0xe4,0x6e,0x29,0xf,0x6a,0x4b,0x1,0x31,0x35,0x7d,0x7b,0x1e,0xe8,0x2e,0x9e,0x6b,0x9e,0x9c,0x9f,0x47,0x21,0x4b,0x62,0x6a,0xf2,0x2b,0x79,0x5,0xbc,0x4d,0x8c,0xe7,0xe3,0xa3,0x67,0xf0,0x19,0xc0,0xd9,0x65,0x1c,0x43,0x24,0x6f,0x6d,0x12,0x8a,0xba,0xfd,0x19,0x63,0xbd,0x19,0xb1,0x8b,0x47,0xc3,0xaf,0xb0,0x31,0x7c,0x38,0x2e,0x9f,0x8b,0x38,0xa3,0x7c,0xb3,0xc1,0x98,0xf5,0x60,0x91,0xfe,0xcd,0xd3,0xa8,0x13,0x4d,0x61,0x8f,0xc1,0x82,0x9e,0xe9,0x41,0xfe,0xba,0x64,0x9f,0x99,0x55,0x1b,0xb7,0x3a,0x67,0x16,0xdc,0xdb,0xd3,0xd0,0x77,0x57,0xdd,0x86,0x21,0x69,0x34,0x2c,0x5e,0x4b,0x6b,0x17,0x41,0x29,0x1c,0xc6,0x53,0x6d,0x1d,0xc8,0x99,0xd4,0x19,0x6a,0x66,0x60,0xa6,0xa3,0x1e,0x65,0x13,0x47,0xf4,0x1a,0x40,0xc9,0x49,0x68,0x7c,0xf7,0x5c,0xa2,0xb0,0x3e,0xc1,0x3,0x48,0xbe,0xf2,0xdc,0x70,0xcb,0xa9,0x44,0x8c,0x71,0x2b,0x59,0xd2,0xa1,0xe6,0x10,0x97,0x8,0x22,0x17,0xac,0xa2,0x88,0x10,0xb3,0x5,0x89,0xe5,0xbb,0x55,0x14,0x1e,0xb6,0x32,0x23,0x88,0x74,0xb1,0x8a,0x22,0x52,0xd,0xe6,0x60,0x6b,0x41,0xb8,0xce,0xf8,0x61,0xb4,0x4c,0xf2,0x4a,0xb9,0xc9,0x2d,0x77,0xed,0xfe,0x47,0x4d,0xe0,0xfb,0x6c,0xe7,0xf7,0x83,0x59,0x58,0xde,0xf,0x96,0x6d,0x7f,0xea,0xb8,0xdc,0x8a,0x5f,0x41,0x7c,0x60,0xa,0x77,0x4,0x4e,0x86,0x68,0x28,0x53,0x73,0x38,0x6a,0xd,0xca,0xb5,0xac,0x41,0xee,0xe4,0xfb,0x5d,0xc5,0x3,0x5a,0x86,0xc6,0xe0,0x65,0xf4,0x94,0x1f,0xab,0xb6,0x52,0xeb,0xda,0x4,0x1b,0x54,0xc6,0x62,0xea,0xbc,0x1c,0x90,0x16,0x7f,0xf7,0xe1,0xca,0xad,0xb2,0xec,0x8a,0xac,0x8f,0x28,0xe7,0x2b,0x36,0xe2,0x6f,0x16,0x61,0x7a,0x3d,0x44,0x91,0x6,0xdd,0x82,0x76,0x14,0x79,0x2e,0x55,0x4b,0x4c,0xcf,0xa6,0x61,0xba,0x72,0x9a,0x23,0xe4,0x51,0x24,0xed,0xf1,0xcd,0x1a,0x96,0xa3,0xf8,0x2d,0xfa,0x69,0x5b,0xdb,0x39,0x6c,0xa8,0xd3,0x5,0x6a,0x3e,0x5c,0x28,0xa8,0x60,0x5,0xa3,0x69,0xe6,0x1,0xc5,0x73,0x9b,0xc,0x81,0xad,0x8f,0xa2,0x41,0xbe,0x90,0xbc,0x6e,0x80,0xbc,0xd5,0x55,0x48,0x9e,0xaf,0x22,0x4,0x6c,0x81,0xa1,0xda,0x4a,0x25,0x8f,0xeb,0xe7,0x3f,0xa5,0x4,0xad,0x9d,0x1,0xc6,0x8b,0x34,0xa5,0xc0,0x94,0xac,0xb4,0xa8,0x1d,0x33,0x70,0x9b,0x34,0x80,0x9f,0xc3,0xfb,0xc5,0x35,0x41,0xec,0x8a,0x24,0xfd,0x8b,0xe,0x47,0x22,0xd1,0x5b,0x8,0x36,0xc2,0xbf,0x79,0xb1,0xc4,0xb3,0xca,0xee,0xc6,0x89,0x66,0x4a,0x32,0xe2,0xc4,0x37,0x6a,0xee,0x2a,0x82,0x1,0x72,0xd,0x67,0xfd,0x14,0x91,0xb4,0xf3,0x34,0x59,0xb0,0xa5,0xba,0x1f,0x7c,0x36,0x7e,0xec,0xde,0x96,0xe7,0xb2,0x21,0xbb,0x4b,0xd2,0x8f,0x9a,0x9c,0xed,0x1f,0x6c,0x73,0x55,0xcd,0x16,0x8,0xd5,0x54,0xbe,0x42,0x44,0x3a,0xaa,0x2c,0x9,0x3a,0x89,0x12,0x7c,0x6d,0x9,0xda,0xa8,0x9e,0xa5,0x25,0x1d,0xb,0x24,0x63,0x4d,0x70,0x8f,0x83,0xb3,0x2a,0x1c,0x25,0xfa,0x19,0x58,0x3d,0x3e,0x51,0x96,0x17,0x11,0xe2,0xb,0x4,0x25,0x85,0x3a,0xa4,0x21,0xce,0x1e,0xd7,0xa6,0x12,0xf6,0x93,0x98,0x61,0xfc,0xd6,0xa6,0x66,0x76,0x91,0xbc,0x82,0x41,0xa3,0xb,0x89,0x8a,0x85,0xb9,0xd4,0x3f,0x11,0xd6,0x2,0xdb,0x25,0xeb,0x2c,0x93,0xf0,0x74,0x71,0x8e,0x9d,0xd4,0x66,0x1,0xde,0x1d,0x46,0x9f,0x4c,0xaf,0xaa,0xa3,0xe3,0x6d,0x37,0x28,0x7,0x31,0x1,0x6,0x9f,0x5e,0xd5,0xc6,0xc5,0x77,0x95,0xb5,0x8f,0x3f,0x7c,0x43,0xc1,0x5e,0x32,0x77,0xbc,0x26,0x2e,0x27,0xde,0xa9,0x43,0x5,0x5,0xf1,0xce,0x90,0xfb,0x48,0xcd,0x9b,0xe7,0x7c,0x8b,0x95,0x71,0x38,0x33,0x8d,0x93,0x28,0xa1,0x80,0x77,0x35,0xec,0x1,0xca,0xfd,0x0,0xb6,0x6f,0x3c,0xe9,0x5c,0x4c,0xa3,0x89,0x7,0xe8,0xa6,0xd2,0x9d,0xb1,0xf7,0xf7,0x46,0xc9,0x9c,0x42,0x8c,0xc5,0xf7,0x9d,0x90,0x5e,0x8,0x5c,0x7a,0xa5,0xc6,0xb7,0xee,0xe5,0x30,0x14,0x9,0x71,0xf5,0x42,0x81,0x3,0xf0,0x9f,0xa0,0x7b,0x32,0x45,0xb4,0x37,0xa0,0x1a,0xd,0xf7,0x94,0xa2,0x5c,0x15,0x89,0x5a,0xd4,0x16,0xee,0xb5,0x51,0x13,0xac,0xdb,0x15,0xc8,0xe9,0x77,0x60,0x75,0xdf,0xad,0xbe,0x90,0x59,0x8a,0xac,0xba,0x30,0x67,0x3b,0x6c,0x29,0x1a,0x24,0x8,0x5e,0xc4,0xc0,0x91,0x9a,0xe6,0x10,0x13,0x3,0x9b,0x4d,0xbc,0x2,0x55,0x4a,0x4f,0x3,0xc2,0x85,0x84,0x47,0xd0,0xca,0x93,0x63,0xd8,0xe1,0x11,0x0,0x17,0x8,0x45,0xe4,0xaf,0xc0,0xd2,0x80,0x67,0x89,0xa4,0x86,0x44,0xb6,0x18,0xb2,0xe5,0x58,0xe1,0xc3,0x2b,0x39,0x38,0x2,0x71,0x62,0xd8,0x8b,0x12,0xde,0x4e,0xd5,0x62,0x2a,0xf0,0x8e,0x7a,0xd5,0xad,0x51,0xa0,0x52,0xc6,0x16,0x4,0x36,0x8,0xc7,0x49,0x3a,0x9,0x53,0xcf,0x40,0x32,0xbd,0x8c,0x2c,0x89,0xc6,0x67,0x75,0x4f,0x30,0x48,0xd3,0x96,0xb3,0x95,0xde,0x60,0x3d,0x3b,0x5b,0x6,0xb7,0x24,0x6,0xc1,0x76,0xaa,0x59,0x71,0xd,0xa1,0x92,0x33,0x57,0xb1,0x66,0x1,0xb,0x6,0x18,0x90,0x78,0xf1,0x84,0x82,0x40,0xc7,0xaa,0x43,0x97,0x31,0x85,0x2a,0x70,0xe5,0x48,0x11,0xcc,0x55,0x91,0x58,0xee,0x83,0x65,0x5a,0xa8,0xb3,0x40,0xe4,0x8a,0xda,0x56,0x4f,0xea,0x17,0x1e,0x54,0x59,0xdc,0x59,0x2d,0x74,0x89,0xc,0x31,0x54,0xb9,0x94,0x17,0x48,0x48,0xb6,0xfb,0x5d,0x88,0x95,0xa8,0xee,0xc8,0x88,0x23,0xf6,0xcb,0x9a,0xc9,0xa8,0x79,0xb7,0xfa,0xa3,0xe2,0x46,0xf8,0xb5,0x1a,0x98,0x32,0x1e,0x1a,0xe4,0x39,0x19,0x37,0x7a,0x7,0xc1,0x8f,0x52,0xe8,0xc4,0x79,0x30,0xa9,0x75,0xd7,0x6b,0x87,0x70,0xeb,0xc1,0x5d,0x28,0xaa,0x33,0x7,0xcc,0x8a,0xf1,0x4d,0x6,0xc9,0xfc,0x2e,0x76,0x0,0x8f,0x47,0xa8,0x5a,0x0,0xc8,0xcb,0x63,0x60,0xf1,0x5c,0x4f,0xb6,0xd1,0x98,0xc8,0xc2,0x91,0xcb,0x12,0x16,0x8e,0x1,0xee,0xa0,0x5f,0x86,0x94,0x6b,0xf3,0xd8,0xc6,0x58,0xcc,0x4d,0x23,0xb0,0x80,0xe7,0xed,0xf8,0x2c,0x84,0xa8,0xe1,0xcb,0xc0,0xa2,0x39,0x24,0xbd,0xcc,0x5a,0xc5,0xcc,0x64,0xa8,0x1e,0x33,0x63,0x13,0x5f,0x9e,0xdf,0x6a,0xb2,0x92,0xdd,0x99,0xc4,0x63,0x72,0x9a,0x29,0x22,0x69,0x49,0xc8,0xde,0x1a,0x15,0xe6,0x40,0x59,0x9e,0xcc,0x11,0xde,0x9f,0x7,0xe7,0x1,0xa9,0x17,0x23,0x14,0x67,0x5f,0x21,0x2f,0x2c,0x66,0x32,0x28,0x77,0x97,0x66,0x51,0x6f,0xde,0x7e,0x6b,0xaa,0x86,0xfc,0xb1,0x34,0xc6,0xff,0xbf,0xee,0x4f,0x29,0x56,0x96,0x39,0x12,0x77,0xda,0xa1,0x22,0x5b,0xac,0x5c,0x62,0xfd,0xe,0xa2,0x79,0xc9,0x1d,0x6c,0xe4,0x2,0xb5,0x51,0xbf,0x7e,0x48,0xee,0xa1,0xd1,0x70,0xff,0x28,0x96,0x9a,0x27,0x8b,0xf1,0xc5,0x90,0xe2,0x81,0x14,0x54,0x45,0x59,0x0,0x32,0xf5,0x93,0x4a,0x85,0x7f,0x9,0x8d,0x31,0xc,0x9,0xf1,0x79,0xc2,0x12,0x5a,0x74,0x4f,0x1b,0x2d,0xe3,0xee,0x13,0x1e,0x24,0xe1,0x21,0x7,0xc4,0x8f,0x23,0x80,0x8a,0x10,0x91,0x36,0x81,0xd9,0x9b,0x18,0xe3,0x38,0x4c,0xd1,0xf9,0xdc,0xbb,0x22,0x2f,0x5c,0x2f,0xee,0xad,0x51,0x6e,0x8c,0x73,0xb1,0x57,0x2b,0x95,0xf5,0x58,0x26,0x9a,0xbc,0xe6,0x31,0xe5,0x6a,0xd3,0x35,0x6b,0xb2,0xa2,0xb0,0x20,0x6a,0x3f,0x49,0xe6,0x9e,0xe6,0xea,0xdd,0x71,0xd3,0x88,0x36,0xcb,0xa6,0xf1,0x9a,0x0,0x75,0x23,0xc,0x67,0x28,0x81,0xf7,0x82,0xfc,0xc2,0xf,0x4e,0x33,0xa,0x61,0x62,0x58,0x62,0x8a,0x5f,0x34,0x91,0x4e,0x78,0x44,0x51,0x59,0x43,0xe7,0x57,0xac,0xb3,0x59,0xec,0x8f,0x61,0x83,0x85,0xb1,0x3a,0xf,0x19,0xc0,0x3c,0x48,0xb3,0xb0,0x7,0x73,0xdc,0xca,0x7e,0x8c,0xd2,0x21,0x81,0x37,0x9a,0x4f,0x79,0xc6,0x84,0x26,0x7f,0xd4,0x5c,0xba,0xed,0x9f,0x50,0x96,0xa5,0x20,0xd9,0xf9,0xd8,0xf1,0xf8,0x8c,0x1f,0x3b,0xab,0xfe,0xe3,0x65,0xa8,0xd7,0x75,0xd4,0xaf,0x96,0xa0,0xbe,0xcd,0xa1,0x2c,0xe6,0x96,0x23,0x31,0xb1,0xa5,0x89,0xab,0xe8,0x34,0xbc,0x92,0x1f,0x11,0x25,0x2d,0x39,0x95,0x22,0xa5,0x8f,0x56,0x57,0x59,0x86,0x8f,0xed,0x7c,0xb3,0x3a,0x2c,0x93,0x61,0xde,0xc3,0x77,0xa5,0x1c,0x25,0x39,0x8c,0x9f,0x2a,0x61,0x34,0x13,0xb9,0x6a,0xe0,0x51,0x6,0xac,0x17,0x59,0x68,0x29,0xa6,0xe2,0x29,0xe5,0x54,0x18,0xa5,0x46,0x8b,0xc8,0x9e,0x38,0xe6,0x56,0xad,0x44,0x56,0x7b,0xc5,0xbd,0x53,0x5b,0xaf,0x4d,0xad,0xd6,0x5d,0xe7,0x38,0x69,0x70,0x7e,0xbe,0xe4,0xed,0x24,0x99,0x77,0x27,0xe3,0xb9,0x4c,0x52,0xdc,0x86,0x5e,0xc8,0x66,0x3a,0x2d,0x6f,0xf2,0xba,0xe5,0x4c,0xae,0x4d,0x2e,0x38,0xf9,0xa0,0x7b,0x27,0x7b,0x7,0xcf,0xc8,0x1c,0x9c,0xbc,0xa6,0xea,0xf7,0xc9,0x75,0xcd,0xd9,0x64,0xaf,0x68,0x28,0xa6,0x70,0xb3,0xd8,0x22,0x9f,0x6f,0x90,0x37,0xd6,0x94,0x2,0x67,0xa,0x28,0x19,0xad,0x66,0xa8,0x46,0xb7,0xb9,0xc8,0x90,0x6b,0xa9,0x4d,0xc0,0xd4,0x2b,0x4e,0x6e,0x2c,0xb,0x60,0xc1,0x7b,0xd0,0x8e,0xe9,0xde,0xb,0xf1,0xdc,0x21,0x86,0xeb,0x9c,0x1a,0x36,0x2d,0x98,0xe5,0x77,0x92,0x2b,0x7c,0x90,0x36,0x78,0x39,0xce,0x6b,0x92,0xe5,0xa1,0x9e,0xd4,0x10,0xeb,0xe0,0xbf,0xa5,0x83,0x85,0xd0,0x1c,0x1f,0xc3,0xd1,0x4f,0xdf,0xcb,0x72,0xaa,0xdb,0xa9,0xdd,0x82,0xa,0x7,0x3d,0xa8,0x35,0x68,0x44,0x32,0x3b,0xc6,0xae,0xc6,0x9,0x6f,0x23,0x8f,0x35,0x2d,0xae,0xf2,0xc0,0xdd,0xf8,0x40,0x9a,0x48,0x65,0xe8,0x92,0x5e,0x8e,0x6b,0x64,0xcc,0xf4,0x32,0x14,0xab,0x54,0xb3,0x35,0xd,0x7a,0x2f,0x83,0x4b,0x6,0x5a,0xf4,0x9a,0x73,0xb0,0xaf,0xc1,0x9b,0x73,0xbb,0xfa,0xac,0xbc,0x8,0xf0,0x9d,0x27,0xde,0xda,0x6a,0xdc,0x2d,0x6b,0x5b,0xf2,0x41,0xfd,0x54,0xf0,0x2,0xcb,0xde,0xc9,0xe1,0x0,0x5,0xd3,0xce,0x43,0xf6,0xa,0xcb,0xde,0xc9,0x0,0xbf,0x31,0xd5,0xc6,0xbb,0xa7,0xf,0x1b,0xef,0x83,0x37,0xe8,0x9a,0x1a,0xea,0xfa,0x2a,0x92,0xb,0x52,0xbf,0xd0,0xc4,0x42,0xfa,0x91,0x42,0x58,0xf5,0x1f,0x1a,0xba,0xae,0x45,0x97,0xe5,0x5,0x1,0xd8,0xa9,0x9a,0xed,0x71,0x5b,0x5e,0x4b,0x38,0x72,0x4c,0xe6,0xb2,0xd9,0x58,0xf8,0xb4,0x20,0x65,0x5d,0x87,0xbc,0x36,0x41,0x5e,0xab,0x8c,0x49,0x23,0xd2,0xcb,0x66,0xab,0x74,0x29,0x9,0x89,0x7d,0x69,0x5a,0x14,0x28,0x98,0x60,0x4a,0x82,0x74,0x5a,0x1f,0xa8,0xaa,0x12,0x56,0x9e,0x10,0x95,0xc6,0xce,0x6b,0xde,0x79,0x6d,0xc,0xf0,0xca,0x42,0xfc,0xc2,0x30,0x33,0x1f,0x87,0x54,0x5,0x4d,0x4d,0x33,0xc0,0x4e,0xed,0xc9,0xfa,0xac,0x8a,0x1a,0xe5,0x67,0xcb,0x43,0xcc,0xe5,0xcf,0xa6,0xe9,0xd2,0xae,0x38,0x14,0xa3,0xa8,0x2e,0xa7,0x7d,0xc3,0xeb,0x67,0x8b,0xa9,0xea,0xdd,0xeb,0x66,0x85,0x65,0x8,0x64,0xf,0xba,0x9d,0x83,0xc1,0x26,0xb2,0xcf,0x1f,0xe1,0xbd,0x7f,0x94,0xe0,0x81,0xbd,0x47,0x65,0x84,0x4f,0x46,0x91,0x24,0x31,0x92,0x75,0x95,0xe4,0xf3,0x9d,0xe2,0xbb,0xcc,0x90,0xd0,0xe3,0xbb,0x8e,0x2d,0xc0,0xcb,0xea,0x3e,0x71,0x99,0x2b,0x61,0x5a,0x2c,0x68,0x1c,0x2d,0x26,0x61,0xe6,0x35,0xf6,0xc0,0x4,0x58,0x24,0xfe,0xa,0x8f,0xa5,0xc9,0x2,0xa8,0x53,0x64,0x86,0xd2,0x9d,0xd1,0x5e,0x1f,0xb4,0x34,0x1a,0xef,0x35,0x60,0x5c,0x4d,0x4d,0x71,0x53,0x75,0x5,0x3b,0xd1,0x58,0x1a,0x56,0xae,0xbf,0x18,0x51,0x86,0x8b,0x4f,0xd9,0xbe,0x6e,0x24,0x79,0x9e,0x50,0x2a,0xa9,0xf1,0x70,0xfe,0xda,0x41,0x78,0x1f,0xb5,0x19,0x1f,0x3c,0x7a,0xf4,0xa8,0x61,0xc4,0x39,0xc3,0xa8,0xc3,0xe9,0x2f,0xd9,0xf4,0xf,0x81,0xd0,0x78,0xef,0xa1,0xe6,0x8a,0xc9,0xc0,0x5e,0x43,0x7e,0x7f,0x87,0xcc,0xce,0x58,0x3d,0x1f,0x57,0x3b,0x45,0xe8,0x47,0xc1,0x64,0xf4,0x52,0xd,0x5,0x2,0x33,0x84,0x8,0x5d,0x8d,0xbc,0x64,0x7e,0x6d,0x4c,0x79,0xc6,0xf0,0xa0,0x59,0x19,0xf3,0xf2,0x28,0x81,0x38,0x3a,0x57,0x17,0x58,0x74,0x7a,0x40,0xaf,0xbc,0x4f,0x2d,0xc6,0x6c,0xfa,0x28,0x86,0xf1,0x98,0x55,0x1f,0x56,0xcf,0xb8,0x29,0x5e,0xba,0xf8,0xa6,0x1e,0x68,0x57,0x85,0x46,0x68,0x29,0xce,0x2e,0x67,0x6d,0x83,0x1,0xed,0xc,0xd9,0x20,0x90,0x0,0x4d,0x35,0x1d,0x26,0xf1,0x84,0x41,0xf3,0x84,0x35,0x18,0xa9,0x28,0x20,0x39,0x2b,0xcd,0x93,0x6c,0x4a,0xd1,0x9,0x62,0xa5,0xb3,0xe9,0xeb,0xb0,0xc6,0xc5,0xa,0x6c,0x84,0x5f,0x2e,0x24,0xb8,0x95,0x9f,0xe3,0x5f,0x9d,0xeb,0x14,0xc8,0x9c,0xf1,0x56,0x63,0xb5,0xc6,0xbe,0x72,0x3d,0xa7,0xc9,0xe4,0xba,0xc6,0xa2,0x12,0xb9,0xb9,0x9c,0xe0,0x33,0xc,0x50,0x7f,0x5f,0xa5,0x9c,0x95,0x1d,0xab,0xad,0x2f,0xe7,0xa7,0x8e,0x55,0xe,0x28,0x1c,0xeb,0x21,0x34,0x51,0xdf,0xaf,0x4a,0xc9,0xdb,0xd2,0x1a,0x77,0xe1,0xc5,0x2e,0xc6,0x63,0x54,0xfe,0x9e,0x2d,0x6a,0xc9,0x4c,0x52,0xef,0x32,0x64,0xed,0x12,0x5b,0x1a,0x52,0xbf,0x70,0x2a,0xb,0xdc,0x65,0xa5,0xf0,0xef,0x70,0xb5,0xb4,0x2b,0x66,0xa9,0xb5,0x16,0xc5,0x86,0xd1,0x64,0xe3,0x5c,0xde,0x7e,0x25,0x5,0x6a,0xa9,0xb8,0x36,0x81,0xd2,0x19,0x7f,0xb0,0xfa,0x18,0xc7,0x6c,0xa9,0x40,0xd7,0x72,0xae,0x96,0x51,0x18,0x3d,0x2d,0xfa,0xb9,0xd2,0x3b,0xd4,0x71,0x97,0xaf,0x34,0x37,0x3a,0xc9,0x7c,0x1a,0x96,0x12,0x62,0xa9,0x59,0xf7,0x16,0x25,0xdf,0x18,0xf6,0xda,0x61,0x9f,0x45,0xa9,0xb7,0xf9,0x8d,0x6a,0x51,0x1a,0x4e,0x87,0x4d,0x56,0x21,0x24,0x16,0x1c,0xac,0x39,0xb,0x5d,0x37,0x94,0xac,0xb1,0xed,0x1a,0x70,0x4b,0xd6,0x7c,0xd,0x2a,0xca,0x79,0xbb,0x7f,0xb0,0xd1,0xee,0x3b,0xed,0xc3,0xde,0xfd,0x7b,0x14,0x69,0x43,0xe8,0xbd,0xe5,0xb4,0xe7,0xf3,0xa1,0xa8,0xcf,0xb9,0x7f,0x4f,0xbe,0xf5,0x6a,0x4c,0xce,0x0,0xfc,0xa9,0x5f,0x76,0x30,0xf5,0x5f,0x43,0x30,0x66,0x68,0xa,0xac,0x8e,0x92,0xa1,0x51,0xe7,0x32,0x65,0x6a,0xaa,0xc8,0xa2,0xb3,0x8e,0x6b,0xce,0xa5,0x30,0xb4,0x6a,0x97,0x82,0x84,0xf7,0x7d,0xb5,0x34,0x4f,0x39,0x15,0xef,0x59,0x77,0x8a,0x8a,0x3a,0x66,0xf5,0xb3,0x5d,0x2b,0x86,0x60,0xb7,0xa7,0xc3,0x1d,0x61,0x1a,0x84,0x61,0x57,0x63,0x26,0xa7,0xca,0x9c,0x3c,0x14,0x25,0x9c,0x4f,0x5,0x43,0xfa,0xa4,0xc6,0xb5,0x49,0xdf,0xae,0x8a,0x50,0x77,0xa2,0xab,0x38,0xe2,0x8d,0x3c,0x7e,0xb5,0x4b,0x34,0xf2,0x13,0x8a,0x9f,0x2,0xa9,0xc1,0x83,0xeb,0x2c,0xe0,0x4c,0x27,0x8a,0x5d,0xa8,0x9d,0x55,0x99,0xf4,0x6a,0xd6,0xc2,0x33,0xe,0x4f,0x75,0x5a,0x25,0x4e,0x2e,0xf1,0xa,0x91,0x73,0x97,0x6a,0x1,0xf9,0xde,0x47,0x1d,0x93,0x2a,0x7d,0x48,0x5,0x16,0xa7,0x56,0xc9,0xc4,0xbd,0x16,0xc5,0xd1,0xad,0x6a,0xc9,0x2a,0x21,0xd6,0x97,0xc2,0x5f,0x18,0x7b,0x6f,0x6b,0x91,0x14,0x15,0xd3,0xcb,0xf7,0xf,0x94,0x59,0xab,0xb9,0x3c,0x65,0xce,0x77,0x2b,0x6c,0x91,0x45,0x2d,0x6c,0x2b,0x6a,0xc3,0x53,0x69,0xa,0x23,0x45,0x5f,0xfc,0x3c,0x99,0x2f,0x22,0xdc,0x7a,0xf1,0x8b,0xb5,0x2a,0x25,0x9,0xd9,0x3c,0x5d,0x58,0x9,0xac,0xc4,0xf7,0x0,0x22,0xb1,0x56,0x6f,0x2e,0xcb,0x35,0x9,0x97,0x6b,0x45,0xe,0x5e,0xa7,0xb0,0x90,0x5e,0x55,0x40,0xdd,0xa0,0x2e,0xa,0xfe,0xab,0x3f,0xa1,0x7b,0x9c,0x64,0xe5,0xaf,0x9d,0x78,0x97,0xf0,0xcd,0xd4,0xf7,0xfe,0x4,0xa1,0xf3,0x7c,0x89,0x91,0x83,0x5e,0x2c,0xb6,0x26,0x45,0xd1,0x54,0x1c,0xcf,0xa5,0x7f,0xa5,0xf4,0xd4,0x8d,0x6d,0x54,0x20,0xab,0x7e,0x25,0xab,0x37,0x85,0x23,0x49,0xc0,0x32,0x6e,0xa0,0xc7,0xaa,0x6b,0xb,0xae,0xda,0x28,0x40,0x2b,0xe4,0x72,0x71,0x28,0x10,0x31,0xbd,0xfd,0xde,0xe8,0xfe,0x3d,0xdb,0x3b,0x7e,0x6e,0x94,0x4,0x93,0xa2,0x1a,0xf1,0x4d,0x71,0xec,0xf,0xee,0x9a,0xfb,0xd4,0x4c,0x45,0x4a,0xba,0xf2,0x94,0xbd,0x28,0xba,0x28,0x8c,0x1e,0xa9,0xe,0xd0,0x4d,0xbf,0xb1,0x90,0x49,0xf3,0xaf,0x7a,0xf0,0x88,0x87,0xbc,0x75,0xb5,0x8,0xc8,0x5,0x5a,0x93,0x70,0x6f,0xa9,0x14,0x29,0xaf,0x13,0xff,0x59,0x86,0x6a,0xa,0x4a,0xfb,0x6d,0x6,0x63,0x92,0xb9,0x58,0x63,0x99,0xb3,0xe6,0x4d,0x75,0x8e,0xd6,0xc3,0xd6,0xfc,0xf6,0x40,0x59,0x2b,0xd7,0x43,0xe,0xac,0xdd,0x1a,0x3a,0xc2,0xe6,0xfa,0xff,0x2,0x1e,0xca,0x6b,0x37,0x8f,0x5d,0x0,0x0 };
 
-const uint8_t index_html[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0xed,0x5d,0xfd,0x73,0xe2,0x38,0x93,0xfe,0x7d,0xab,0xf6,0x7f,0xd0,0xb2,0x55,0xbb,0xa4,0x8a,0x8f,0x7c,0xcc,0xec,0xed,0x66,0x32,0x54,0x11,0x20,0x13,0x76,0x48,0xc2,0x1,0xd9,0xd9,0xbd,0xab,0xab,0x94,0xb1,0x5,0x78,0x63,0x6c,0xbf,0x96,0x9d,0x84,0xf7,0xea,0xfe,0xf7,0x7b,0x5a,0xb2,0xc1,0x10,0x32,0x18,0x87,0x18,0xdf,0x7b,0x93,0xaa,0x99,0x10,0x23,0xb7,0xa4,0x47,0xad,0xee,0x56,0xab,0xd5,0x3a,0xfb,0xa1,0x5c,0xfe,0xfe,0x3b,0x86,0x9f,0xc1,0xc4,0x14,0x4c,0x38,0x23,0xff,0x51,0xf3,0x38,0xc3,0x67,0xcb,0xd4,0xb9,0x2d,0xb8,0xc1,0x2,0xdb,0xe0,0x1e,0xf3,0x27,0x9c,0x5d,0xb5,0x7,0xac,0xa3,0x1e,0x57,0x58,0x9f,0x73,0xf9,0x30,0x2c,0xc7,0x46,0xa6,0x85,0xff,0x1c,0x8f,0x19,0xdc,0xd7,0x4c,0x4b,0x54,0x14,0xdd,0xbe,0x13,0x78,0x3a,0x3f,0x65,0x13,0xdf,0x77,0xc5,0x69,0xb5,0x3a,0x36,0xfd,0x49,0x30,0xac,0xe8,0xce,0xb4,0x2a,0x5c,0x4d,0xe7,0x93,0x60,0x62,0xfb,0x5c,0x9f,0x54,0xbf,0x98,0x17,0x66,0x33,0xd0,0xef,0xbf,0xff,0x4e,0xbd,0x78,0xe5,0x18,0xe6,0xc8,0x44,0xfd,0x9a,0x8d,0x7f,0x86,0xe6,0xfa,0xf8,0x3c,0x9c,0x9d,0xaa,0x6f,0xcb,0xac,0xc9,0x3d,0xae,0xdf,0xff,0x7a,0xf4,0xfd,0x77,0xe5,0x72,0xed,0xfb,0xef,0xce,0x7e,0x68,0xde,0x34,0x6,0x7f,0x75,0x5b,0xa8,0x69,0x6a,0xd1,0x83,0xf0,0x37,0x95,0x3e,0x9b,0x70,0xcd,0x8,0x3f,0xcb,0xbf,0xa7,0x68,0x23,0xd3,0x27,0x9a,0x27,0xb8,0xff,0xb1,0x70,0x3b,0xb8,0x28,0xff,0x5a,0x78,0xf6,0xbd,0xad,0x4d,0xf9,0xc7,0xc2,0x83,0xc9,0x1f,0x5d,0xc7,0xf3,0xb,0x4c,0x77,0xd0,0x52,0x1b,0xe5,0x1f,0x4d,0xc3,0x9f,0x7c,0x34,0xf8,0x3,0xba,0x5e,0x96,0x7f,0x94,0x98,0x69,0x9b,0xbe,0xa9,0x59,0x65,0xa1,0x6b,0x16,0xff,0x78,0x58,0xf9,0xb5,0xc4,0xa6,0x78,0x36,0xc5,0xa3,0xc0,0x7c,0x89,0x36,0xf0,0x9b,0xf2,0xb2,0xee,0x58,0x8e,0x17,0x23,0xff,0xe3,0xc9,0x2f,0x27,0xbf,0x9d,0xb4,0xe8,0xa5,0xf5,0xaf,0x19,0x5c,0xe8,0x9e,0xe9,0xfa,0xa6,0x63,0xc7,0x5e,0x23,0x0,0x19,0x21,0xb8,0x54,0x9b,0x6f,0xfa,0x16,0xaf,0xcd,0xbf,0x3b,0xab,0xaa,0x7,0x4b,0xa4,0x2d,0xd3,0xbe,0x67,0x1e,0xb7,0x3e,0x16,0x84,0x3f,0xb3,0xb8,0x98,0x70,0x8e,0xee,0xfa,0x33,0x97,0x9a,0xc8,0x9f,0xfc,0xaa,0x2e,0x44,0x81,0x4d,0x3c,0x3e,0xa,0x4b,0x54,0xe8,0x41,0xbc,0x16,0xd5,0x1e,0x26,0x3c,0x1d,0x25,0xe4,0xe7,0xca,0xdf,0x28,0x71,0x56,0x55,0x7f,0xbc,0x54,0xd4,0x4,0x6b,0x3d,0x25,0x2a,0x29,0x8c,0xbb,0x9,0x18,0xc1,0xe2,0x5e,0x42,0xc2,0x3e,0xf7,0x5c,0x8f,0xfb,0xeb,0xcb,0x9f,0x55,0x63,0xc,0x71,0x36,0x74,0x8c,0x59,0x9c,0x90,0xad,0x3d,0xc4,0xfe,0x94,0x8f,0x2,0x8b,0xe9,0x96,0x26,0xc4,0xc7,0xc2,0x94,0xdb,0x41,0x61,0xe5,0xeb,0x10,0xc4,0xda,0x99,0x16,0x82,0xa4,0xfa,0x45,0xc,0x58,0x88,0x43,0xaf,0xa1,0x1d,0x28,0xb6,0xe1,0xe5,0xcb,0x76,0xb3,0x81,0x31,0xf5,0x1c,0x2b,0xa4,0x80,0x7,0x2c,0x7c,0x92,0x94,0x6,0xd8,0xda,0x37,0xed,0xb1,0x8,0x29,0xf4,0xc3,0x3f,0x93,0xbe,0xe,0xd8,0xc0,0xbc,0x5a,0xd4,0x80,0x41,0xf8,0x67,0xd2,0xd7,0x75,0x8f,0x1b,0xa6,0x1f,0x55,0x5e,0x1f,0x3a,0x81,0xff,0xc2,0xab,0x67,0xd5,0xc0,0x8a,0x43,0x5f,0x5d,0xc6,0xfe,0xcc,0x30,0x1f,0x98,0x69,0x10,0xd7,0x69,0x7e,0x20,0xc7,0x11,0x4f,0x96,0x26,0x93,0x66,0xda,0xab,0x34,0x5,0xd7,0x69,0x6a,0xac,0x6b,0xe5,0xe4,0xa8,0xd6,0x97,0xa4,0xc0,0x1,0x47,0xeb,0xa,0x50,0x85,0xe1,0x48,0xd3,0xc4,0x2,0x75,0xee,0x15,0x6a,0x6c,0xcd,0xcf,0xf3,0x97,0x57,0x9,0x78,0xce,0xe3,0x3a,0x4e,0x99,0x17,0x75,0x6b,0x67,0x43,0x34,0xc7,0xf1,0xb4,0x31,0x4,0xe4,0x59,0x75,0x58,0x3b,0x83,0x48,0xb4,0x65,0x87,0x47,0x1e,0xe7,0x57,0x7c,0xea,0x78,0xb3,0x42,0xad,0x7c,0x46,0xa2,0xd2,0x46,0xe7,0xdd,0xaf,0x91,0x1b,0x6,0xbe,0xef,0xd8,0x51,0xe5,0x86,0x66,0x8f,0xd1,0x74,0x45,0xcc,0xf1,0xa6,0x9a,0x5f,0xa8,0xa9,0xdf,0xa8,0x48,0x96,0x4c,0x4e,0xb,0x2a,0xc1,0x2e,0x84,0xe3,0xe0,0xb8,0x85,0x1a,0xfd,0x9f,0x82,0xca,0xc4,0xf4,0xb9,0x22,0x3,0xc9,0xed,0xd8,0x36,0x86,0xa9,0x50,0x9b,0x7f,0xdc,0x40,0x70,0x75,0xe4,0xbf,0xf6,0x1c,0x78,0xad,0x65,0x81,0x4d,0x9c,0x21,0x45,0x84,0x60,0xfd,0x6e,0xfb,0xe2,0xa2,0xcf,0x8a,0x6d,0x12,0x22,0x60,0xfb,0x83,0x95,0x8e,0x40,0x52,0x3a,0x9a,0x11,0x2,0xa2,0xde,0xe9,0xa9,0x47,0xb5,0x9f,0x7e,0x7c,0x3a,0x3e,0x1a,0xe,0x3f,0xcc,0x3b,0xb3,0x1d,0x9f,0xbd,0xd0,0x75,0x5f,0x1b,0x42,0xb7,0x86,0xc5,0xe5,0x1f,0xf1,0xca,0x7,0xf2,0x1,0x6a,0x92,0xdf,0xd4,0x5e,0xcf,0x97,0xa6,0xed,0x6,0x3e,0x73,0x2d,0xd2,0xce,0x8e,0x5,0xe5,0xff,0xb1,0x70,0x1,0xe5,0x4e,0xba,0x87,0x55,0xcf,0xe8,0x57,0x2d,0xae,0x1d,0xa,0x11,0x5d,0x31,0x75,0x1c,0x7f,0x52,0x60,0xf,0x9a,0x15,0xe0,0xbb,0xaa,0x6a,0xa4,0xcd,0x1f,0xe9,0xed,0x42,0x35,0x39,0xa7,0x88,0x40,0xd7,0x39,0xa9,0x9c,0x45,0x27,0x1b,0x1e,0xd7,0x88,0x7b,0x1c,0x5b,0x87,0xc1,0x71,0x2f,0x65,0xc,0x1e,0x14,0xd,0x47,0xf,0x20,0x92,0xfd,0xca,0x98,0xfb,0x2d,0x8b,0xd3,0xc7,0xf3,0x59,0xdb,0x28,0xfe,0x1c,0x56,0xfb,0xf3,0x41,0x45,0x36,0xe7,0xa0,0x50,0x53,0x6f,0xe4,0x88,0xcd,0x9a,0x8d,0x7a,0xaf,0xb9,0x99,0xb7,0xfa,0xcd,0x7d,0x72,0x57,0xbf,0xb9,0x91,0xbf,0x76,0x88,0x4d,0xb,0x7a,0x3,0x26,0xe4,0xb,0x2d,0x9d,0x4b,0x47,0xa1,0x84,0xe6,0xb9,0x66,0x8c,0xf9,0x9c,0xfd,0x86,0xf4,0x57,0x59,0xb8,0xe6,0x68,0x4,0x4d,0xa1,0x26,0x71,0x28,0x39,0xd9,0xba,0x46,0xef,0x0,0xba,0xbd,0x4d,0x2a,0x2e,0x71,0x92,0xf3,0x2a,0xf9,0xb4,0x72,0x3d,0x98,0xa3,0x50,0x28,0x31,0xa,0x4d,0xe7,0xd1,0x56,0xbc,0x65,0x84,0x9f,0x52,0xce,0x8f,0x6d,0xe1,0xa0,0x3e,0x62,0xa1,0xa1,0xad,0x76,0x73,0xd1,0xb4,0xc2,0x32,0x58,0x5f,0x3c,0x68,0xf,0x36,0xc3,0x6a,0x82,0x85,0x86,0xde,0x4,0xb,0x80,0x4a,0xa5,0x52,0x60,0xc2,0xe5,0x96,0xa5,0x4f,0x38,0x89,0x85,0x91,0x66,0x9,0xc5,0xac,0x61,0x5,0x6f,0xdc,0x8f,0x58,0x51,0x83,0xf,0x83,0xf1,0xf8,0x65,0x6e,0x89,0x7e,0x6e,0x2,0x1f,0xac,0x70,0x1a,0x63,0x67,0xd5,0x61,0xd3,0x1e,0x39,0xd0,0xad,0xda,0x3,0x37,0x42,0xb6,0xfd,0x4a,0xbd,0x5f,0x6b,0xfe,0xfe,0xba,0x76,0x7d,0x33,0x68,0x9d,0x32,0x1a,0x2a,0x58,0x9b,0xcc,0x77,0xe4,0x2,0xb1,0xdf,0x64,0xba,0xe6,0x19,0xf8,0xcf,0x66,0xbe,0x76,0x8f,0x55,0xa3,0x9,0x9e,0x37,0x47,0xf2,0xcb,0x70,0x2c,0xb1,0xde,0x7c,0xe0,0xde,0x8c,0x59,0x8e,0x3d,0xae,0xec,0xbf,0xdb,0x8b,0x41,0x29,0x87,0x93,0xa6,0xac,0x66,0x85,0xd8,0x84,0xc0,0x57,0x35,0x19,0x86,0xb6,0x1f,0x89,0x27,0x7c,0x26,0x80,0x22,0x31,0xb5,0xd1,0x98,0x4a,0x44,0xdc,0x20,0xa0,0x63,0xc4,0x9b,0xe9,0x8,0x2f,0xec,0x3d,0x5,0x42,0x2f,0xb0,0x61,0xa8,0x5,0x76,0x3a,0x6a,0x71,0x4b,0x54,0xd1,0xeb,0x6f,0x63,0x45,0x6e,0xa0,0x48,0x54,0xa2,0x7e,0xd3,0x67,0x26,0x8c,0x24,0xa6,0x69,0x4a,0x46,0x7a,0x53,0xe5,0xf7,0x7b,0x9f,0xb5,0x17,0xeb,0x56,0x56,0x3c,0x6f,0xd,0xea,0x7,0xdb,0xa8,0xc2,0xdf,0xfb,0x49,0x94,0xe1,0xbf,0xae,0x2e,0x44,0xff,0x77,0xa2,0xd,0x89,0x4e,0xee,0xf4,0x21,0xd,0xee,0xff,0x43,0x8d,0x48,0x63,0x91,0x2f,0x9d,0xf8,0xd6,0xca,0x81,0x7a,0xfc,0x86,0xea,0x61,0x89,0xfc,0xab,0x15,0x4,0xb4,0x2,0x11,0xec,0xed,0x42,0x39,0x90,0xf8,0x96,0xad,0xdb,0xb1,0x62,0x90,0x2c,0x94,0x58,0x35,0x7c,0xb5,0xbb,0x10,0x83,0xb0,0x53,0x7c,0xa2,0xd8,0x50,0x1f,0x9,0x46,0xf2,0xee,0xcd,0xd4,0xb2,0xee,0x8d,0x74,0xcf,0xce,0xb4,0xcc,0x71,0x2d,0xd6,0xd8,0x70,0xe2,0x85,0x9a,0x6,0x5a,0xe0,0x78,0x27,0x5a,0x80,0x80,0x32,0xa8,0x16,0x25,0x96,0x54,0x25,0x85,0x97,0x1,0x91,0x2e,0x65,0x52,0x59,0xfa,0xfd,0xd8,0x73,0xb0,0xdd,0x70,0xca,0x7e,0x3c,0x3e,0x39,0xfe,0xb7,0x63,0xed,0x3,0x73,0x35,0xc3,0x80,0x2d,0x79,0xca,0x8e,0xe,0xdd,0xa7,0xf,0x90,0x70,0xe6,0x78,0x2,0x49,0x71,0x7c,0x28,0xff,0x1c,0xa1,0x3d,0xe5,0x91,0x36,0x35,0xad,0xd9,0x29,0x9b,0x3a,0xb6,0x23,0xb7,0x14,0x3e,0xb0,0xa9,0xf6,0x54,0x5e,0x29,0xea,0x60,0xb0,0x46,0x96,0xf3,0x58,0x46,0x49,0x2d,0xf0,0x9d,0xf,0x4c,0xba,0xdd,0x51,0xd5,0x89,0xfe,0xfe,0x43,0x61,0x7,0x72,0x23,0xea,0x7,0x24,0xc2,0xd8,0xb4,0xcb,0x60,0xb8,0x53,0xd5,0xe8,0xb1,0xe6,0x86,0xed,0x2f,0x6c,0xef,0xbf,0x5b,0x38,0x3c,0x2c,0xae,0x79,0xb1,0xc1,0x53,0xb0,0x16,0xe1,0xd8,0xe8,0x71,0xb8,0x7b,0xb7,0xf7,0xc7,0xcd,0x15,0xe0,0xa2,0xa,0xc7,0x9d,0xad,0xad,0xa1,0x81,0x2f,0xe0,0x82,0x9e,0x4e,0xe1,0x82,0x17,0x7b,0xf6,0xa0,0x60,0xc7,0x8a,0x8c,0xa5,0x66,0xe8,0xf8,0xd1,0xa8,0x9c,0x34,0x60,0xe4,0x36,0x50,0x2,0x83,0xd,0x5c,0xae,0xfa,0x7,0xbe,0x7a,0x89,0xe7,0x27,0x27,0xab,0xd6,0x58,0x99,0x5d,0x3b,0x3e,0x17,0xec,0x27,0xec,0x80,0x4d,0x4d,0x55,0x2d,0x79,0x91,0x4f,0x76,0x31,0x65,0x36,0x78,0x89,0x5,0x5c,0xff,0xf6,0xb8,0x26,0x57,0x57,0x80,0x4c,0xfd,0xc5,0xce,0x39,0xfc,0xb9,0x9c,0x5,0x42,0xae,0xb5,0xb0,0x96,0xfa,0x5d,0x7b,0xd0,0xc2,0x89,0x1d,0x6b,0x79,0x89,0xdd,0x73,0xee,0xca,0x2,0x23,0xc7,0xc2,0xc,0xa0,0xe2,0xd6,0xa2,0xf,0xd8,0xb9,0xa2,0x9d,0x2a,0xe3,0x74,0x83,0x7b,0x79,0xc9,0x51,0xbf,0xb6,0xc4,0xda,0x8d,0x81,0xd5,0x9f,0xf6,0x88,0x4c,0x16,0xb4,0x1a,0x4b,0x40,0x7b,0x44,0xbb,0x66,0xd8,0x42,0x74,0x1c,0x57,0x30,0xf8,0x7d,0x0,0x16,0x14,0x2b,0x5a,0xa5,0x59,0xea,0x61,0x9,0x4c,0x5b,0xd3,0x2c,0x8b,0xd1,0x1e,0x88,0x69,0xa3,0xeb,0x81,0xae,0x5a,0x3d,0xd,0x84,0x2f,0xa9,0x9c,0xe9,0x8e,0xc1,0x6b,0xda,0xa3,0x66,0x62,0xe,0xc8,0xcf,0xe4,0x49,0xaf,0xb0,0xcd,0x4d,0xb9,0x1,0x26,0xde,0xa3,0x29,0x78,0x49,0xa2,0x73,0xdb,0x66,0x8f,0x26,0xaa,0x22,0xd7,0xfb,0x3f,0x79,0x65,0x43,0x67,0xab,0x1b,0x7b,0x9b,0xc,0xf,0xf4,0xaf,0xab,0x79,0xe8,0x22,0xb7,0x18,0x7f,0xe2,0x7a,0x40,0xdd,0xa3,0xf5,0xb0,0xed,0x60,0x2f,0x2b,0x70,0x69,0xeb,0x91,0x1b,0x15,0xea,0x13,0xbb,0x95,0x43,0xdd,0xf5,0x9c,0x29,0x1a,0x5d,0xc1,0x3b,0xc5,0x83,0x10,0x35,0x3d,0xf0,0x3c,0x4c,0x6,0xac,0xb1,0x2d,0xb,0xd8,0x68,0x33,0x7c,0x22,0x70,0xa6,0xe6,0x13,0x76,0x4d,0xf5,0x70,0xe6,0x52,0xe1,0x7a,0xe3,0x33,0xe3,0x9e,0xe7,0x78,0x22,0xc3,0x1e,0xd6,0xc5,0xcc,0xd6,0xd9,0x28,0xb0,0xc3,0xc1,0xa3,0x2d,0x66,0x8d,0x78,0x91,0xcc,0xba,0x61,0xad,0xc4,0x20,0x51,0x68,0xc,0x66,0x6a,0x58,0x35,0xeb,0x51,0x9b,0x9,0x36,0x44,0x21,0x1a,0x56,0x74,0x1f,0xdb,0xd3,0xf8,0xd2,0x70,0x24,0x2a,0x43,0x3e,0x21,0xfb,0xc5,0x32,0xe1,0x4b,0xc0,0xc6,0x90,0x6d,0x90,0x77,0x21,0xc6,0xfc,0x1a,0xd5,0xb6,0xb9,0x5d,0xb1,0xe6,0x60,0x87,0x99,0x30,0x3,0x5a,0x92,0xd1,0xe6,0x78,0xc1,0x49,0x1,0xa8,0x1,0xa4,0x91,0x15,0x58,0x75,0x69,0xb3,0x91,0x51,0x31,0x84,0x4e,0x11,0x10,0x3c,0xf5,0x6e,0x5b,0x10,0x3f,0xc,0x2d,0x47,0xbf,0x27,0x28,0xfe,0xc2,0xf4,0x81,0x2f,0x85,0x90,0xa0,0x21,0x4e,0x30,0x0,0x72,0x56,0x44,0x9e,0xf2,0x70,0x92,0x94,0xc2,0xc7,0x10,0x7,0x58,0xea,0xac,0x3c,0x1c,0x71,0x5f,0x9f,0xac,0x3c,0xfb,0xf3,0xb2,0xb7,0xf2,0xe4,0xb,0x1f,0xf6,0x6,0x8d,0xf9,0x43,0xbc,0x93,0x21,0x4b,0xb5,0x97,0x85,0x7,0xd,0xe1,0x73,0x49,0x20,0x19,0x8d,0x80,0xa,0x99,0x8d,0x19,0x81,0x47,0x53,0x48,0x99,0x71,0x82,0x66,0xda,0xb2,0xf9,0x26,0xe7,0x59,0x46,0x9d,0x18,0x90,0x44,0xe,0x79,0x30,0x6c,0xbb,0xc7,0x5d,0xec,0x51,0x14,0x75,0x18,0x41,0x7e,0x89,0x8d,0xec,0x83,0xa8,0x1f,0x18,0x7f,0xc7,0xb6,0x66,0xc,0x4c,0x6e,0x5a,0xd2,0x5f,0x4f,0x91,0x16,0x24,0xb5,0xe2,0xe6,0x5c,0x68,0x9d,0x62,0xcf,0x3b,0x81,0x1c,0xf6,0x31,0x9d,0xb8,0x12,0x33,0x4a,0xee,0xf0,0x5,0xdf,0x87,0x30,0x41,0x5,0xc2,0xbe,0x97,0xee,0xba,0xb9,0x68,0xca,0x6c,0x88,0xe3,0x80,0xcc,0x71,0x98,0x37,0x79,0xcc,0xa1,0x52,0xb1,0x9d,0x23,0x31,0xb0,0xa1,0xc9,0x1e,0x22,0x4d,0xd0,0x6b,0x75,0x5b,0xf5,0x41,0xf4,0x42,0xd8,0xa5,0x24,0x80,0x40,0xbb,0x20,0x28,0x0,0x91,0x1c,0x4,0x88,0x2b,0x71,0x20,0xe2,0xb,0x61,0x60,0x23,0x4e,0x42,0x55,0x88,0xf5,0xb5,0xae,0x82,0x53,0xec,0x60,0x3a,0xc4,0x24,0x75,0x46,0xd2,0xab,0x99,0x99,0x4c,0xed,0x3b,0xd3,0xd5,0xa1,0xf,0x5b,0x49,0x1c,0x8f,0xe9,0xb1,0xa4,0x3d,0xa4,0xf2,0x80,0x9a,0xf7,0x29,0xc6,0x67,0xa1,0x64,0xa6,0x40,0xe8,0x34,0xe9,0x48,0x74,0xfa,0x83,0x5e,0xfb,0xfa,0xd3,0x8a,0x8,0x58,0x2,0x3b,0x7a,0xd8,0xb9,0xb9,0xe9,0xae,0x3c,0x6a,0xb6,0x3a,0xf5,0xbf,0xc2,0x67,0x95,0xcc,0xe6,0xd7,0xb3,0xde,0xd2,0x3c,0x2,0x38,0x82,0x84,0x1,0x4d,0x1f,0x78,0x1b,0x1c,0x32,0x2,0xc4,0x42,0xb,0x49,0x49,0x1,0x15,0x4a,0xa6,0xd5,0xc8,0xe2,0x4f,0xe6,0xd0,0xb4,0x4c,0x7f,0x26,0x5,0xc,0xd,0x3d,0x89,0x5c,0x8c,0x76,0x4c,0xdd,0x58,0xce,0xd8,0xcc,0x4c,0xf2,0x75,0xb1,0xa,0x10,0xa4,0x3c,0x85,0xd4,0x85,0xc4,0x8e,0x9a,0xaf,0x6,0x56,0x76,0x90,0x9c,0xec,0xd0,0x9b,0x2,0xfc,0xf1,0x48,0xdf,0x4,0xe0,0x6a,0x29,0x2f,0x22,0x1d,0xe7,0xe8,0xba,0x26,0xa4,0x85,0x5,0x71,0xe2,0x7a,0xe,0x16,0x6a,0xf8,0x92,0xd,0xda,0x57,0xad,0x9b,0xdb,0x81,0x32,0xd,0xb2,0xea,0x4c,0x7b,0x8a,0x6,0x3c,0xc8,0x4d,0x5b,0xc5,0xb8,0xf0,0x6f,0x21,0x16,0xc0,0x98,0xb,0xb7,0x51,0xe0,0x7,0xde,0x2b,0x4d,0xb1,0x95,0x10,0x93,0xb4,0x4b,0x95,0x17,0x97,0x5,0xf5,0xb9,0x48,0xbe,0x88,0xc,0x8a,0x9d,0x2c,0xb,0xbe,0xb6,0x9b,0xaf,0xa,0xac,0x4,0xb5,0xad,0x2f,0xe4,0x25,0x91,0xb5,0xfe,0xa4,0x16,0x35,0x1e,0x7e,0xc2,0x49,0xc2,0x57,0x5a,0x4f,0xda,0xd4,0xb5,0xf8,0x16,0x6f,0x34,0x17,0x81,0x6b,0x9,0xde,0x42,0x11,0xef,0xab,0x3,0xbb,0x9,0x81,0x33,0x7f,0x25,0xb4,0xeb,0x35,0x10,0x19,0x35,0x25,0xca,0x48,0xd2,0x82,0x61,0x8b,0xfe,0x93,0x7f,0x30,0x5f,0x70,0xf8,0x46,0x2a,0x1a,0x85,0x4b,0xf8,0x69,0x9d,0x42,0xa,0x3a,0x75,0x83,0x64,0x3d,0xb,0x9,0x31,0x98,0xc,0xb6,0x70,0xc0,0x83,0x64,0x25,0x94,0xd4,0xda,0x81,0x9e,0xc3,0xba,0x51,0x61,0x8a,0x7,0x95,0x4,0xc4,0x37,0x0,0x9e,0x6,0x2d,0xf2,0xe2,0xbf,0xa,0x2a,0x49,0x20,0x3d,0x4e,0x3,0xbc,0xe,0x3d,0xe,0xd7,0x37,0x16,0x77,0xfe,0xc4,0xa1,0x7d,0x7,0xf,0x16,0x36,0x99,0x37,0xad,0xeb,0x41,0xab,0xb7,0x47,0x5c,0x2c,0xfb,0xd5,0xc8,0x80,0xc4,0x4e,0xb0,0x21,0xed,0x20,0x71,0xc1,0x3,0x9,0xb,0x93,0x5a,0x5,0x76,0x9f,0x6d,0xec,0x9,0x21,0xd9,0x9c,0x22,0xb6,0x33,0xee,0xf9,0x4c,0xa4,0x6,0x49,0x51,0x29,0x34,0x6,0xbd,0x4e,0xa1,0xc4,0xa,0xf5,0xce,0x80,0x7e,0xc1,0x1c,0x49,0x3,0x58,0x37,0x44,0xc8,0x81,0x19,0x8,0xd,0x25,0x6d,0x4,0x6a,0x1d,0x13,0xe6,0x34,0xb0,0xb0,0x12,0xe5,0x4e,0x20,0xac,0xd9,0x9e,0x0,0x83,0x2c,0x18,0x3a,0xaf,0x6,0x4c,0x51,0x29,0x7c,0xba,0x6d,0x13,0x50,0x5e,0x2a,0xd9,0x64,0x99,0x9a,0x90,0x3a,0x3c,0x3e,0x6,0x11,0xa1,0x3d,0xa1,0x63,0x70,0x4b,0x9b,0x15,0xa7,0xe9,0x81,0x51,0x4,0xde,0x1f,0x1e,0xa6,0x61,0x1c,0x72,0xc6,0xc4,0x8d,0xd1,0xc8,0xc0,0x59,0x2c,0x24,0xe0,0xc3,0xb6,0xe0,0xd5,0x21,0xf,0x98,0xd8,0x13,0x44,0x9c,0xec,0x9a,0x62,0x6a,0x80,0x52,0xbf,0xde,0xe7,0xb4,0x70,0x51,0x62,0x7,0xbc,0xbb,0x2f,0x89,0xac,0xd,0xd3,0xf7,0x3d,0xe5,0xcb,0xaa,0xe7,0x83,0xfa,0xf9,0x1e,0xfb,0xd,0x93,0xec,0x15,0x63,0x9e,0xee,0xe5,0x70,0xc4,0xfb,0x8d,0x3d,0xf6,0x1b,0x35,0xd3,0x6f,0x12,0x98,0xf4,0x3b,0xbd,0x60,0x88,0x8,0x15,0xe,0x9f,0xe,0x8f,0x49,0x68,0xe2,0xf7,0xbb,0x42,0x6a,0x54,0x3c,0xed,0x51,0x3a,0x21,0x43,0xb2,0xfb,0x12,0x6,0x16,0x37,0x8a,0xf8,0x57,0x62,0x9a,0x4e,0xce,0x95,0xd4,0xe8,0x10,0x9d,0x42,0xaf,0xfd,0xe9,0x92,0x14,0x2f,0xdc,0xf7,0x69,0x28,0xd,0x2,0xf,0x5e,0x5a,0x65,0xc8,0xb2,0x4e,0xab,0x49,0x1a,0x98,0x14,0xb0,0x33,0x1a,0xed,0xb,0x1d,0x87,0x8e,0xf9,0x14,0xf1,0x2b,0x3d,0x30,0x8a,0x44,0xe1,0xb6,0x9f,0x8e,0x57,0xb0,0x64,0x6,0x8b,0xc,0x1d,0x72,0x7e,0x43,0x33,0xc1,0xb2,0xdd,0x13,0x16,0x53,0x2c,0xe1,0x8b,0x4f,0x25,0x36,0x4b,0xd,0x85,0xa4,0xf0,0xfe,0xb0,0xc4,0xca,0xc7,0x69,0xb4,0xeb,0x15,0x5e,0x27,0xf7,0x7,0xb9,0x66,0xb0,0x11,0x22,0xe0,0xc0,0xd8,0x93,0x5,0x46,0xdb,0xa8,0xc5,0xa1,0x6f,0xa7,0xb7,0xbe,0x24,0x85,0xa3,0x54,0x20,0xc8,0xee,0xd3,0xfb,0x7b,0xea,0x3d,0x96,0xf6,0xd8,0x5f,0x2c,0x6a,0x53,0xf2,0x5e,0xa7,0x46,0x20,0xa4,0xf2,0x3e,0x35,0x4,0x8f,0x38,0xbd,0x66,0x31,0x45,0x66,0x9f,0x4b,0x97,0x3b,0xc9,0x90,0xaf,0xe2,0x86,0x38,0x9d,0x34,0x3c,0x71,0x89,0x48,0xb1,0x68,0x62,0xa8,0x3d,0xfb,0x3d,0x1,0x82,0x53,0xd,0xe4,0xb6,0xdc,0x1,0x24,0xcb,0x94,0xd2,0x80,0xd2,0x53,0x14,0xf2,0x81,0xb,0xd6,0xdd,0xce,0xb4,0x88,0xed,0xf7,0x12,0xc5,0xac,0xa4,0x47,0x45,0xd1,0x39,0x2a,0x21,0xcc,0x24,0x15,0x24,0xbe,0xd4,0xb0,0x1a,0x53,0x84,0xc2,0x5d,0x8d,0xbd,0xe9,0xd6,0x31,0x19,0x65,0x88,0xa2,0x11,0xaf,0x50,0xae,0xe3,0x62,0xa1,0x49,0xe1,0x87,0x69,0x94,0x6b,0xc7,0x19,0x83,0x3d,0x30,0xf7,0x10,0x58,0x2b,0xa2,0x30,0xf6,0xd0,0xc3,0xb6,0xaf,0xd5,0x9,0xed,0x2e,0xf9,0xf0,0xb7,0xbe,0x62,0x8d,0xf2,0x1a,0x12,0x11,0x8b,0x44,0x81,0x6,0x73,0x62,0x7b,0xc2,0xc3,0x14,0x8,0x39,0xb4,0xe1,0xc5,0x4b,0x8f,0x7,0xce,0x23,0xc2,0xfe,0x8a,0x11,0x4a,0x41,0xa9,0x41,0x31,0xb6,0x32,0x4e,0x60,0x29,0x76,0x43,0xf8,0x14,0x48,0xa2,0x2c,0xe7,0x7d,0x69,0x63,0xb,0x51,0x3f,0xaf,0xf1,0x77,0xc8,0x7d,0x74,0xa6,0xc8,0x1c,0xa5,0xf2,0x7a,0xa8,0xa8,0xf,0x49,0x1,0x81,0x7b,0x96,0x4b,0x31,0xed,0xd8,0x3e,0x21,0x17,0xf5,0xc1,0xde,0x14,0xd1,0xfa,0xd,0xf6,0x14,0x7a,0x48,0x12,0x3a,0xc1,0x76,0x31,0xfb,0xf8,0xd3,0xd8,0xff,0xc0,0xfe,0x1b,0x32,0xeb,0x7f,0xd2,0xd0,0x1b,0x46,0xa1,0xa4,0xb4,0x8f,0x6c,0x4b,0xf7,0x21,0xb6,0x6b,0x7b,0xb2,0x2,0xf1,0x6c,0x4f,0x3e,0xbe,0xe9,0x1b,0x6e,0x82,0x9b,0x3b,0xd1,0x5f,0xf8,0xfa,0x2b,0xbb,0x25,0xdb,0x9d,0xfe,0x7b,0x71,0xb3,0xec,0xd6,0xa7,0xdd,0x54,0x13,0x52,0x75,0x27,0x7b,0x64,0x93,0x77,0x38,0x5e,0x4f,0xf1,0x2b,0x82,0x55,0x59,0xeb,0x41,0x6e,0x6c,0xb2,0x62,0x57,0x9b,0x51,0xe4,0xbe,0xa8,0xa8,0xd8,0x16,0x51,0xe1,0xea,0x1b,0xc,0x10,0x5,0xb9,0xbe,0x4b,0xbf,0xe3,0xb6,0x99,0x1d,0xb7,0xda,0x48,0xa3,0xe2,0x75,0x6f,0x2c,0xc3,0x72,0x44,0xc2,0xf2,0xc9,0xb7,0xd0,0x36,0x8d,0x77,0x82,0xde,0xcc,0xdd,0x3c,0xfe,0xe3,0xf9,0xcc,0xd5,0x62,0x5e,0xdc,0x24,0xfc,0x86,0x12,0xd7,0x70,0x95,0x27,0x2c,0xda,0x34,0x5,0xe1,0x2f,0x58,0x97,0x36,0xe7,0xfb,0x10,0x18,0x16,0x6b,0xd,0xbe,0xd0,0xf6,0xfa,0x98,0x18,0x9f,0xc2,0x14,0xe5,0x81,0xf8,0x4d,0xbc,0xbe,0xc3,0x7e,0x1b,0xaa,0x4d,0x6a,0xba,0x9d,0x53,0x0,0x56,0x47,0xb5,0x26,0x63,0x1c,0xc2,0xf9,0x2e,0x5b,0xc0,0xc2,0x26,0xb0,0x7,0x53,0x63,0xae,0x83,0x5,0x1f,0x2,0xd7,0x34,0xdb,0x74,0x3,0x2b,0x91,0x28,0xd8,0x21,0x3c,0x32,0x24,0xb9,0xdb,0xbf,0x34,0xe9,0x10,0xd2,0xec,0xd,0x31,0x69,0x50,0x45,0x4b,0x88,0x84,0x62,0x91,0x4d,0x54,0xdd,0x88,0x1e,0xf0,0xcd,0x11,0x14,0xae,0xc8,0x9e,0x3b,0x9a,0x7c,0xc4,0x29,0x45,0x4e,0xdd,0x78,0xd0,0x6c,0x1d,0xee,0xae,0xc,0x78,0x83,0xb6,0x9b,0x4c,0xec,0xbd,0xb3,0x48,0xfc,0x45,0x8d,0xa0,0x90,0xe,0x5f,0x5,0x4f,0x93,0x57,0x8,0xa1,0x2d,0xd9,0x3,0x32,0x80,0x59,0xc8,0xbd,0xee,0xbc,0x21,0x59,0x0,0xf2,0xc,0x7,0xd5,0x8,0xb6,0x68,0x85,0x9c,0x2f,0x1e,0x1f,0x83,0x61,0x32,0x95,0x21,0x18,0x10,0xa,0xe9,0xbc,0x8c,0x62,0xaf,0x8b,0x38,0x84,0x85,0x64,0x5,0x77,0xe1,0xf3,0x2d,0xb1,0x89,0xb6,0x1b,0xe2,0x24,0x42,0xa,0xa7,0xd4,0x59,0x19,0x3d,0x4a,0x27,0xe8,0x12,0xd2,0x6b,0xdb,0x7f,0x3,0x1e,0x5a,0xfa,0x21,0x73,0x12,0xb2,0xe6,0x38,0xf8,0x64,0x1,0x24,0xd8,0xf7,0x14,0x5d,0x17,0xd6,0x10,0x6,0x99,0x23,0xb9,0x8b,0xc5,0xa5,0x51,0xcb,0x48,0xc1,0xe2,0x51,0x86,0x38,0x2e,0x2a,0x6f,0x76,0x3a,0x45,0xc3,0xb2,0xee,0x2,0xcf,0x4a,0x85,0x5e,0xf8,0xee,0x1c,0xb6,0xdb,0x5e,0x27,0xe1,0xfb,0x1d,0x32,0x2b,0x80,0x10,0x5a,0x10,0x3,0x3,0x81,0x54,0x12,0xb9,0xcc,0xd5,0x93,0xeb,0x9a,0x46,0xdf,0x75,0x9c,0x51,0xd1,0xd5,0x68,0x55,0x16,0x31,0x44,0x29,0x12,0x8f,0x5b,0xc2,0xd3,0x95,0x54,0xd8,0x2a,0x95,0xa4,0xe0,0x68,0xb0,0x7c,0x26,0x9c,0xf0,0x89,0xd8,0x46,0x50,0xe3,0xa2,0xe3,0x9,0xaa,0x8d,0xac,0xdb,0x6e,0x66,0x2f,0x92,0x2e,0x4c,0x8f,0x3f,0xca,0x80,0xf9,0xec,0x44,0x51,0x54,0x27,0xd6,0x81,0x9e,0x3,0x30,0xe8,0x23,0x80,0xa1,0x3c,0x69,0x7b,0x10,0xca,0xb7,0xf5,0x46,0x16,0x9d,0xbf,0x95,0x21,0xeb,0xba,0x5c,0x60,0x45,0x49,0xab,0xb2,0xb6,0x48,0x5a,0xf,0xe0,0x33,0xf2,0xe1,0xbc,0xbd,0x45,0x12,0x8d,0xb5,0xac,0x92,0x2c,0xb3,0x2c,0x47,0x96,0x3f,0xe9,0x56,0x60,0xf0,0xae,0xe6,0x4f,0x20,0x0,0xfc,0x49,0x2a,0x61,0x48,0x2f,0xce,0x25,0x21,0x1d,0xa2,0x16,0x33,0xc4,0x41,0x4f,0x99,0x7a,0x9e,0x88,0x90,0x8a,0x45,0xb3,0x99,0x6c,0x8f,0x5c,0x82,0xd1,0xcb,0xe4,0x37,0x5b,0xd5,0xca,0xaf,0x0,0x67,0x43,0x7a,0xa3,0xa5,0x95,0x60,0xd7,0x33,0x1f,0xd0,0x93,0x31,0x67,0x2d,0x4a,0xc7,0x27,0xcd,0xe2,0x35,0xcb,0x42,0x1c,0x80,0xc3,0xc6,0x91,0xfe,0x6d,0x59,0x98,0x96,0x1,0x47,0x8e,0xa1,0xfc,0x3a,0xe1,0xe2,0x30,0x9d,0xd6,0x69,0x6c,0xa5,0x65,0xea,0x43,0x19,0x4a,0x33,0xaf,0x5a,0x1e,0xe6,0x2c,0xc3,0xa7,0xff,0xa0,0x86,0x79,0x8a,0x5c,0x92,0x58,0xd,0x89,0x69,0x96,0x13,0x91,0x66,0xff,0xc3,0x63,0x96,0x30,0xdc,0xca,0x48,0x3d,0x29,0x75,0xfe,0x40,0x82,0x4a,0xe0,0x10,0x99,0xb6,0x58,0x12,0xfd,0x8d,0x93,0xb4,0xa4,0x75,0x29,0xca,0x68,0x8e,0x4c,0x96,0x52,0xd8,0x99,0xe2,0xe0,0x28,0xf7,0x30,0xed,0x35,0x2c,0x54,0x44,0xf6,0xec,0xd1,0x58,0x69,0xc1,0xa,0x97,0x64,0x88,0x85,0xef,0xdc,0x73,0xbb,0x4d,0x6b,0x11,0xe1,0xd8,0xda,0x1b,0x2f,0x87,0xea,0x3e,0x44,0xb7,0xcc,0x2d,0xf6,0x57,0x7f,0xd0,0xba,0x62,0xb2,0x72,0x66,0xc6,0x6b,0xcf,0xb0,0xeb,0xea,0x18,0x1f,0x9d,0xab,0x81,0xe9,0xd3,0x92,0xd8,0x63,0x75,0x3c,0x15,0xe6,0x5d,0xa,0x6d,0x75,0xd5,0x6f,0x6f,0xa5,0x93,0x14,0x1f,0xd4,0xd7,0x35,0x21,0xf4,0x9a,0x64,0x69,0x83,0x59,0xd6,0xa5,0x9c,0x95,0x7d,0x9c,0xcf,0x78,0xc3,0xf1,0x27,0xf2,0x22,0xb2,0xbe,0xb9,0x8a,0xc1,0x74,0x1d,0x4a,0xf,0x8b,0xd4,0xb4,0x72,0xd5,0xb2,0x10,0xe,0xf,0x58,0xbc,0x38,0xaf,0x72,0xf,0x2c,0x54,0x72,0x22,0xf7,0xec,0x13,0x2c,0x5f,0xdf,0x7b,0x49,0x19,0xf3,0xd8,0xd7,0xdf,0x34,0x72,0x6a,0x46,0xb3,0x85,0xc4,0xb9,0x48,0xab,0xc,0x39,0xcd,0x4a,0x38,0x33,0x47,0x49,0x52,0xb7,0x64,0x3a,0xb2,0x4,0x59,0xfc,0xfd,0x84,0xef,0xb5,0x6c,0x19,0xb4,0xa6,0xb2,0x41,0x1b,0x1a,0x52,0x16,0xcb,0xa5,0x71,0xf3,0xba,0xcf,0xfe,0x11,0x70,0xcf,0xcc,0x74,0xe9,0x63,0xea,0x53,0x57,0xc1,0x11,0x3a,0x4c,0x4c,0xb7,0xc4,0xe6,0xc8,0x6c,0x89,0x48,0xbb,0xab,0xde,0xdd,0x46,0xa,0xcd,0x79,0x1e,0x88,0x48,0x30,0xc8,0x7,0xd5,0x6e,0x5c,0x75,0x41,0x4,0x87,0x79,0x33,0xf5,0x56,0x52,0x2,0x6e,0xd9,0x1e,0x1a,0xda,0x22,0xfc,0x1f,0x31,0x28,0xe8,0x23,0xb7,0x8c,0x3b,0x72,0x1c,0x6d,0x9,0xb,0x9c,0x27,0x8a,0x50,0x48,0x23,0xe9,0x6b,0xae,0x9c,0xfe,0xa,0x51,0x42,0xe5,0x72,0x30,0xe8,0x86,0x6e,0x4d,0xf8,0x72,0x61,0xcd,0x80,0x5d,0x84,0xbf,0xf,0x7c,0xce,0x11,0x1d,0xf2,0xcb,0xbb,0x15,0x84,0xd2,0xa2,0xb2,0x25,0x1c,0xaa,0xee,0x32,0x97,0xb3,0xc8,0x58,0xa0,0xf3,0x7b,0xff,0xe6,0x3a,0x4b,0x83,0x16,0x33,0xde,0x52,0x33,0x47,0x4c,0x7d,0x9a,0x34,0xc8,0x39,0x80,0xf0,0x4d,0xa7,0x84,0x43,0xa5,0x43,0xf2,0x18,0x2e,0x31,0xf,0xed,0x1b,0x6e,0xab,0xce,0x51,0x1,0x79,0x84,0xc0,0x70,0xbe,0x3c,0x7f,0x99,0x4c,0xbf,0xc9,0x8,0x59,0x89,0xa,0x4e,0x18,0xc8,0x56,0xe2,0xa0,0x8a,0xaf,0xe9,0x13,0x99,0x3,0x36,0x3b,0x80,0x46,0x21,0xaf,0x14,0xe1,0xee,0x78,0xa0,0x1c,0x1b,0xb0,0x36,0xf0,0x3f,0x99,0xb9,0x4b,0xc8,0x78,0x70,0x9,0xfa,0xa9,0x38,0xe8,0x2,0xd3,0x81,0xf2,0x68,0x2b,0xdd,0x2d,0xd2,0x4e,0x2b,0x90,0xd9,0x3,0x2c,0x5d,0xe0,0x80,0xb5,0x75,0x42,0x74,0x46,0x61,0xee,0xb7,0xec,0x11,0x52,0x6e,0x6d,0x57,0xb5,0x96,0xb0,0x92,0x87,0x68,0x33,0x4,0xec,0x91,0xf,0xd,0xed,0x41,0xb1,0x92,0x14,0x38,0x6b,0x91,0xda,0x12,0x18,0xe4,0x65,0x68,0xd6,0xff,0xd8,0x5,0xf7,0x28,0x4a,0x59,0xae,0x96,0x10,0x80,0x26,0x46,0x10,0x8,0x93,0x67,0x66,0xc,0xe2,0xe3,0xee,0xa2,0xa4,0x7c,0x22,0x85,0x35,0x43,0x86,0x8c,0x7a,0x5b,0x65,0xbf,0x49,0x83,0x9,0x85,0x82,0x61,0x81,0x85,0x8c,0x8b,0xb4,0xce,0x76,0x84,0x4c,0x73,0x4a,0x4c,0x8e,0xc0,0xf4,0x2c,0xa7,0x19,0xda,0x62,0x3a,0x2b,0x8,0xa5,0x35,0xf0,0x52,0xe2,0x40,0xbf,0xcb,0x2,0x37,0x68,0xec,0x6,0x82,0xed,0xd6,0x12,0x3d,0x4e,0xe9,0x3b,0x90,0x5a,0x96,0xf6,0x82,0xc5,0x9a,0xd5,0x84,0xa7,0xa,0xa8,0xef,0xbf,0x2d,0x27,0x52,0x6f,0x30,0xd1,0x86,0xbb,0x20,0x10,0x8b,0x64,0x3a,0x53,0x36,0x89,0x14,0x56,0x33,0xbd,0x96,0xd4,0xd9,0x23,0x73,0xb4,0xcb,0xed,0xc8,0xc5,0x5e,0xff,0xa0,0xd1,0x65,0xe1,0x80,0x32,0xd9,0x98,0x2c,0xb7,0xd8,0x66,0x38,0x34,0x6c,0x67,0xdf,0x7b,0x59,0x6d,0x79,0xa8,0xd1,0x5,0x3c,0xfb,0xea,0x3b,0x6a,0x9f,0x64,0xde,0x73,0x58,0xc0,0x93,0xbd,0x8e,0xb8,0x8d,0x3c,0x46,0x88,0xec,0xcb,0xa6,0xdf,0xd2,0x8d,0x7b,0x2d,0x6b,0x94,0xce,0x1a,0xd9,0x59,0x46,0xd7,0xa7,0x78,0x2a,0x6a,0x21,0x4b,0x56,0xe7,0xde,0x1e,0xa6,0x39,0x2a,0xdd,0xd9,0x50,0x27,0x51,0x22,0x9f,0x28,0x66,0xd2,0xd4,0x59,0xa8,0x32,0xd8,0xa5,0xdc,0x45,0x78,0xae,0x43,0xbe,0x29,0x8d,0x1d,0x28,0xd,0x7d,0xfa,0xb6,0xde,0xfe,0xc8,0xdb,0x44,0x91,0x60,0x61,0x12,0xab,0xb5,0x51,0x62,0x88,0x1d,0x54,0x2b,0xeb,0x2c,0x7d,0xbe,0xa1,0xb5,0xd9,0x42,0xbb,0x16,0xce,0x84,0xd7,0x78,0x58,0xb6,0x8,0xeb,0x89,0x32,0x59,0xaf,0x40,0xa3,0x49,0x3a,0x6f,0x39,0xc3,0x90,0x9d,0x93,0x7d,0x5c,0xfd,0x61,0x7d,0x9f,0xcc,0x44,0xb1,0xe6,0x9b,0xb5,0x49,0x3b,0xa3,0xb9,0x1a,0xbd,0x56,0xc,0x3f,0x7c,0x9b,0x93,0xa9,0x83,0xa7,0x1c,0xff,0xe8,0xa4,0x88,0xed,0xc1,0x2d,0x79,0x4f,0x1,0x9f,0x74,0xcf,0xc5,0x75,0x2d,0xa,0xed,0xee,0xdd,0xc,0x8e,0x4e,0xc8,0x51,0x84,0xf5,0x91,0xaf,0xce,0x44,0xe8,0xa6,0x3b,0x79,0xd5,0xf6,0xff,0xd6,0xde,0x3c,0xfe,0xa4,0x84,0xc3,0x5b,0x77,0x3a,0x12,0x41,0x42,0xbe,0xa4,0xbc,0xdd,0xa8,0x5c,0x33,0x90,0xd8,0x1,0x97,0xff,0x65,0xdb,0xe5,0x26,0x97,0x5d,0xc6,0xa7,0x2d,0xbb,0x7c,0xc9,0x9f,0xc2,0x1e,0x24,0x15,0x30,0x5c,0x75,0x3b,0xd6,0xd5,0x90,0x40,0xa6,0x21,0x81,0x6a,0x95,0x27,0xeb,0x7d,0xeb,0x81,0xe,0xd7,0x9c,0x42,0x5e,0x1b,0x89,0x48,0x63,0x3a,0xad,0xe1,0x19,0x99,0x32,0xb5,0xae,0x71,0xa1,0x79,0xd,0x39,0x97,0xa8,0xbb,0xf0,0xc6,0x4e,0xcc,0x91,0x9f,0xaa,0xd7,0xe1,0xbb,0x5b,0x4e,0xed,0x86,0x6c,0x41,0xf6,0xd3,0x19,0xfa,0x33,0x9b,0xe9,0xc,0x65,0x1b,0x7a,0xdf,0x49,0x5b,0x66,0xce,0xd1,0xce,0x70,0x14,0x20,0x64,0xc9,0xe7,0x6a,0x78,0x71,0xc0,0x3f,0xe5,0xe0,0xfe,0x79,0x23,0x73,0xa9,0x6c,0x39,0xbc,0xf4,0x56,0xd4,0x84,0x6c,0x17,0x1f,0x6,0xdf,0x53,0xd7,0xe7,0xd3,0x7a,0x7f,0x7d,0xf,0x4f,0xef,0xc2,0xc0,0x1b,0x6f,0xed,0xc6,0xeb,0xc8,0x97,0x12,0x16,0xfe,0x14,0x26,0x4d,0x15,0xd1,0x39,0x5f,0xcd,0x72,0x11,0x2c,0x5,0xf3,0x85,0x56,0x44,0xaf,0x66,0xf6,0xcd,0x21,0x7a,0xca,0x8,0xc7,0x7d,0x3,0xca,0x18,0xff,0x66,0xce,0xa5,0xdd,0x9f,0x4b,0x2b,0xb,0xc3,0xb3,0xa1,0xbe,0x37,0xf,0xf9,0x4c,0x65,0xec,0x68,0x4c,0x5e,0x99,0xbc,0x64,0xf4,0x84,0x63,0xab,0xee,0x18,0x95,0xc9,0xf6,0xd8,0xad,0x6d,0x52,0x79,0x26,0x34,0x24,0x94,0x86,0xc3,0x9c,0x2e,0xf0,0xcd,0x56,0x9e,0x1a,0x7c,0x67,0x40,0x85,0xfd,0xeb,0xa7,0xb1,0x92,0xb4,0xd5,0x8d,0xdd,0x10,0x38,0xba,0xf2,0x42,0xa1,0x27,0xf1,0x7c,0x93,0xb9,0xf7,0xb5,0xf3,0x99,0x6f,0x90,0xb1,0x74,0x71,0xfb,0x47,0x79,0x9e,0x60,0xbd,0xac,0x6e,0x95,0xcc,0x2e,0x99,0xe9,0xc2,0x8b,0xf0,0x2d,0x97,0xe9,0x57,0xf8,0x7b,0x3e,0xb4,0x94,0x35,0x46,0xd,0x51,0xaf,0x75,0x95,0xf2,0x48,0xf4,0x7a,0x62,0x4c,0x66,0xa7,0x64,0x5f,0x1c,0xcf,0x32,0x7e,0x48,0x71,0xbe,0x5e,0xe5,0x37,0xdd,0xcb,0x61,0xf1,0x35,0x1d,0x6a,0xb6,0x2e,0xea,0xb7,0x9d,0xc1,0x5d,0x3c,0x9d,0xf5,0xe,0x70,0x5a,0x22,0x4b,0x17,0xd6,0xa4,0x48,0x91,0x25,0xef,0x54,0x44,0xf8,0x33,0x5d,0x9b,0xe0,0x3f,0x72,0x84,0x7d,0x72,0x79,0xa3,0xe2,0x16,0x67,0x78,0xb2,0x41,0x70,0xc7,0xc8,0x11,0x62,0x48,0x4f,0x90,0x2,0xb2,0x26,0x25,0x74,0x54,0x98,0xe5,0x5,0x9d,0xa5,0x1c,0xeb,0x3b,0x80,0x47,0xd1,0x7b,0xe5,0x1c,0xc,0xd3,0xc4,0x2e,0xdd,0x1f,0x93,0xdc,0x57,0x90,0x1d,0x6c,0x9d,0xeb,0x5d,0x3,0xd7,0xb9,0x7e,0x33,0xe8,0xa4,0x5f,0x76,0x4c,0xe7,0x4f,0xe8,0xc0,0x25,0xdd,0x2b,0x30,0xc4,0x9e,0xc8,0x3d,0x2b,0xca,0x34,0x98,0x7,0x79,0x41,0x36,0xcc,0xfa,0x7f,0x77,0xde,0xfa,0xd4,0x8e,0xe0,0x85,0xd9,0xbe,0xa9,0x78,0xeb,0xba,0xb9,0x3d,0x58,0x9,0x6f,0x22,0x58,0x53,0xed,0xe6,0x37,0xe9,0x67,0xa9,0x2f,0xc9,0x5e,0x89,0x8f,0x3e,0x3b,0x4a,0xf1,0xce,0x71,0x8a,0x77,0x4e,0xb6,0xeb,0xe,0xb0,0x4e,0x80,0xdc,0xd6,0xa3,0x71,0x81,0xdd,0x48,0xba,0x8d,0x97,0xee,0x49,0x40,0x86,0x68,0x21,0x43,0x93,0x96,0x31,0x94,0x3c,0x1c,0x6b,0x46,0x85,0xe,0xa4,0x78,0xd8,0xb9,0x96,0xa6,0x6d,0xa8,0x85,0xc0,0xfc,0x78,0xcf,0x7f,0x74,0x62,0x17,0x69,0x8,0xf6,0x88,0xbb,0x2b,0x11,0x96,0xbe,0xa3,0x2c,0x30,0xbb,0x60,0x74,0xdc,0x59,0x91,0x98,0xcb,0xa9,0x6c,0x3e,0x59,0x7c,0xde,0x8b,0xa4,0x9c,0xb7,0x56,0xd0,0x25,0x65,0x75,0xa5,0x7d,0x91,0x12,0xf9,0x35,0x75,0x1d,0x6f,0xd1,0xb5,0x37,0xe2,0xf5,0x81,0xc3,0x54,0x3e,0x9f,0xa5,0xcc,0xde,0x24,0x95,0xc1,0xf6,0x33,0x75,0xdd,0x92,0x62,0xff,0x5,0xbe,0x92,0xf7,0xc3,0x36,0xc9,0x3f,0xb0,0xd4,0xb4,0xe4,0xbd,0x56,0xb1,0x3b,0x61,0x70,0x3f,0x91,0x17,0xde,0xb2,0x56,0x94,0xd7,0x55,0x69,0x72,0x97,0x9f,0xae,0x2c,0x3a,0xa8,0xd0,0x15,0x3c,0xf2,0x1e,0x8f,0xf0,0x9e,0x16,0xb1,0x7a,0x21,0xda,0x70,0x86,0xc0,0x2a,0xdf,0x8f,0xce,0x4f,0x87,0x64,0xb1,0x58,0x3c,0xa4,0x36,0xda,0x7c,0xac,0xae,0xbd,0x91,0xb7,0xe1,0xb2,0xf2,0x51,0x85,0xd1,0x9c,0xe5,0x6a,0x21,0x53,0x62,0x9b,0x39,0x9d,0x45,0x46,0x13,0x8b,0x52,0x75,0x7f,0xbd,0x78,0xf9,0x68,0x8b,0x35,0x74,0x16,0xda,0x69,0xe9,0xf6,0x99,0x9d,0xac,0x57,0x88,0x1e,0x3b,0x49,0x93,0x1e,0x4d,0x65,0x6b,0xa2,0x71,0x2,0xd9,0xf9,0x7d,0x3c,0xcc,0x56,0x99,0xd2,0x72,0xa3,0xcf,0x6f,0x1a,0xf5,0x4e,0x6b,0x77,0x88,0x29,0x7a,0x10,0x4,0x29,0x33,0xd8,0x12,0x5e,0xab,0x59,0x6c,0x63,0x37,0xaa,0x98,0xf6,0x29,0x7b,0xd9,0xf4,0x5f,0xbe,0x63,0x68,0x4d,0x91,0x4f,0xe7,0x1b,0x8b,0xdc,0xf6,0x37,0x16,0x69,0x6d,0x2e,0x72,0xd1,0xdb,0x58,0xa4,0xf9,0x79,0x63,0x91,0xde,0xed,0xc6,0x22,0xe7,0x9b,0x3b,0xdd,0x8d,0x26,0x44,0x85,0x5d,0x91,0x18,0x93,0x32,0x29,0x42,0x14,0xe9,0xca,0x6c,0x3a,0x34,0x1e,0x9d,0xe,0xbd,0xd2,0xf4,0xd8,0xe5,0x7b,0xd1,0x6d,0x69,0x88,0x34,0x40,0x59,0xba,0x2d,0x4d,0x86,0x7a,0x4e,0x4d,0x24,0x30,0xd0,0xd5,0x59,0x7e,0xb,0x12,0x48,0x5e,0xb2,0x1a,0xbf,0x42,0x32,0xc1,0xed,0x5a,0x10,0xb1,0x8a,0x2a,0xb,0xf3,0x11,0x18,0xf3,0x71,0x27,0xd3,0xc2,0x8e,0x2e,0x32,0x91,0x13,0x88,0xcc,0x61,0xac,0xcb,0x54,0x86,0xe4,0xaa,0xfa,0x55,0xd1,0x5d,0x97,0x72,0xbb,0x7a,0x3c,0x6c,0xab,0x8b,0x19,0xe7,0x55,0x70,0xb,0xa6,0xbc,0xbd,0x72,0x14,0x58,0x24,0x70,0x9f,0x35,0xed,0x3,0xfc,0x51,0x9c,0xee,0x3a,0x2a,0xa9,0xb,0xd4,0xa2,0x7a,0xe8,0x22,0x90,0x79,0x3,0xa4,0x8c,0x37,0x1c,0xfb,0x67,0x75,0xa3,0xde,0x48,0x1e,0x3e,0xb1,0x7d,0xa4,0x62,0x8b,0x2e,0xdb,0x23,0x41,0x4c,0x55,0x7a,0xce,0x93,0x4c,0x8c,0x2,0x4a,0x27,0x24,0x35,0xdf,0x2d,0x88,0x54,0xf2,0x32,0xc7,0x3f,0xb7,0xfe,0x6a,0xdc,0x34,0x77,0x38,0xc9,0x43,0x82,0x8c,0xf2,0x9b,0xd3,0x7f,0xef,0xd2,0x2e,0x84,0xb4,0xe8,0xbe,0x3,0x9d,0x60,0x63,0xb2,0xba,0x22,0x22,0xee,0xe9,0x6,0x4,0xb5,0xe5,0x73,0xf4,0x9f,0x25,0x6,0xcb,0x4b,0x7e,0xfe,0xe5,0xbf,0xe,0x88,0xb,0xa2,0xdd,0x65,0xa0,0x1d,0xdb,0x6c,0xce,0x8d,0x40,0x6d,0x35,0x77,0x28,0x4d,0x5b,0x4d,0x26,0x53,0xa5,0xb3,0xa3,0x74,0x49,0xd2,0x29,0x2f,0x3a,0xcd,0x20,0x8f,0xae,0x3e,0xa6,0x4c,0xe9,0xf2,0xe2,0x4c,0xd6,0xf8,0xfd,0xaa,0x71,0x5b,0x3e,0x39,0x3e,0x3a,0x86,0xf,0x5e,0x48,0x63,0x9c,0xb2,0xa8,0x97,0xc2,0xca,0xa4,0x29,0xd3,0xba,0x18,0x54,0x68,0x96,0x52,0x9a,0x4f,0xa2,0x31,0x5,0xad,0x92,0xba,0x13,0x86,0x21,0xaf,0xac,0xbc,0xfe,0x6c,0xe9,0xdb,0xd1,0x28,0xfa,0xfa,0xb0,0xc2,0x36,0xf7,0xe8,0x70,0x67,0xb6,0xc3,0x6b,0x13,0x15,0xae,0x77,0x85,0xab,0xe4,0xd1,0x61,0xc6,0x92,0xdd,0xf8,0xc3,0x17,0x37,0xf7,0x9e,0xab,0xfb,0xe1,0x63,0x97,0xf7,0xaa,0xab,0xee,0xe3,0xf7,0x8b,0xd7,0x58,0x87,0x8f,0x70,0x93,0xd3,0xd1,0x1,0xc6,0x45,0x8e,0x5f,0xf1,0x18,0x1f,0xaf,0x4c,0xc3,0x80,0xd4,0x2c,0xbe,0xc3,0xe7,0x73,0xda,0x2e,0x28,0xfe,0x8a,0x4f,0xb0,0xf4,0x1e,0x49,0x65,0x16,0x8f,0x7e,0xa1,0x54,0x9a,0x44,0xac,0xf6,0xf2,0xfd,0xbd,0x59,0xdf,0x25,0xf6,0xcd,0xfd,0x9e,0x56,0x2,0x5c,0xdd,0x5d,0xdd,0xfc,0xb1,0x43,0xd1,0xad,0xe8,0x91,0x83,0x94,0x95,0xdf,0x1f,0xa6,0x4d,0xad,0xaf,0x92,0xea,0xb3,0xe2,0x9f,0xec,0x2f,0x2c,0x5b,0xfa,0xd1,0x72,0x65,0x79,0x5,0x92,0x1f,0x5,0x78,0x75,0xd7,0xe8,0xb4,0x1b,0x9f,0x77,0x89,0xa2,0x24,0x98,0x46,0x2a,0xff,0x7b,0x0,0x2a,0x2a,0x2d,0xbf,0xbc,0x24,0x74,0xe9,0xce,0x9f,0x7d,0xe6,0x1e,0x5f,0xdb,0xcd,0x6e,0xaf,0xd5,0xef,0xef,0x12,0x37,0x49,0x30,0xd,0x6e,0x2a,0x75,0xbd,0xb6,0x94,0xa4,0x5d,0x1e,0xe0,0xca,0x11,0x5a,0xbd,0x56,0xa7,0x55,0xef,0xef,0x74,0xb6,0x86,0x24,0xd3,0x20,0x36,0xcf,0x6b,0xaf,0x51,0xb2,0x65,0x23,0x7,0xe9,0xed,0xd7,0xf6,0xb0,0xdf,0xe8,0xdd,0x74,0x3a,0xbb,0xc4,0x4c,0x51,0x64,0xef,0xb7,0xa7,0xf9,0x7,0x92,0x2e,0x9b,0xba,0x16,0xdd,0x16,0x81,0x33,0x0,0x8e,0x30,0x49,0xa2,0x21,0x27,0x20,0xce,0x41,0x5c,0x87,0xf2,0xed,0x94,0x51,0x38,0xf5,0x41,0x25,0xaf,0xa6,0x4b,0x3f,0xba,0x3,0xfd,0x33,0x2e,0x7e,0xfb,0xbf,0x78,0xf7,0xe8,0x67,0x19,0xad,0xf5,0xaf,0xa2,0xc3,0xb5,0xc8,0xab,0x56,0x7e,0xd1,0x2c,0xfe,0x67,0xce,0x1c,0x69,0xf5,0xcd,0x4d,0xfe,0x8f,0x9c,0x35,0xf9,0x70,0x73,0x93,0x7f,0xcb,0x59,0x93,0x2f,0x8e,0x36,0xb7,0xf9,0xe2,0xe8,0x38,0x37,0xb,0xa5,0xf5,0xcb,0x24,0xb5,0x5a,0xff,0x26,0x6b,0x72,0x21,0x6b,0xe8,0x5e,0xd3,0x4,0x4e,0xfc,0xc6,0xcd,0xf5,0x0,0x4a,0x32,0x67,0xf3,0xa1,0x7f,0xd9,0xbe,0x18,0xe4,0x4d,0x12,0x76,0xf2,0xd6,0xa2,0x2f,0xed,0xeb,0xe6,0xcd,0x97,0x7e,0x82,0x51,0xc6,0x9d,0xad,0xb9,0x96,0x1d,0x37,0x98,0x34,0xdf,0x4,0x47,0x3e,0x4,0x87,0xc,0x33,0xc9,0x19,0xa7,0x5f,0xb5,0xae,0x6f,0x73,0xd6,0x24,0xec,0x70,0xb7,0x6,0xad,0x9c,0x35,0xea,0xf2,0xe6,0x2a,0x6f,0x4d,0x6a,0x5f,0xf7,0x5b,0xbd,0xbc,0x49,0xce,0x6e,0xfd,0x53,0xeb,0xb6,0x9b,0xc3,0x46,0x41,0x9e,0x5f,0xe7,0xac,0x59,0xb9,0xc3,0x29,0x87,0x18,0xd1,0x1e,0x49,0xde,0x22,0x20,0x68,0x6f,0x25,0x67,0x6d,0xc2,0x75,0xd6,0x39,0x6b,0xd1,0x56,0xb1,0x5a,0xd9,0xb4,0xa8,0xdf,0xc8,0x9b,0x31,0xde,0xad,0x37,0x5a,0xb9,0x93,0x95,0xb7,0xf0,0x85,0xc2,0xe2,0x3d,0xef,0xb5,0xea,0x9f,0x73,0xd6,0xb8,0x46,0xbd,0xdb,0x47,0xf8,0x4b,0xde,0x9a,0x75,0x7d,0x7b,0x95,0xc3,0x56,0x75,0x11,0xf9,0x37,0x80,0xa3,0xb6,0xd5,0xca,0x9b,0x50,0x57,0xde,0xe3,0x9d,0x42,0xf6,0x16,0x6b,0xa7,0xeb,0x60,0xea,0x6a,0xdf,0x3c,0xbc,0xf9,0x58,0x3c,0x61,0x8e,0xdd,0x25,0xf0,0x3f,0x52,0xb1,0xdf,0xf2,0x27,0x1e,0xee,0xea,0xc8,0xd,0xdf,0x6b,0xff,0x99,0xc3,0x96,0xe5,0x71,0x55,0x4a,0xed,0xba,0x6a,0x5f,0xdf,0xf6,0x73,0xd8,0xae,0xe6,0xcd,0x20,0x87,0xad,0xea,0x76,0x76,0x8,0xd6,0x2e,0x85,0x29,0x2,0x65,0x54,0x56,0xb5,0xd8,0xf3,0xb3,0x2a,0x65,0x37,0x8f,0x3f,0x18,0x39,0x48,0x4a,0xbb,0xda,0xa4,0x33,0xec,0xaa,0xe2,0xc6,0xaf,0x8f,0x5,0x4a,0x13,0x2d,0x4e,0xab,0x55,0x5c,0x91,0x36,0x9,0x86,0x15,0xc4,0x13,0x56,0x65,0xd0,0xe1,0x24,0x98,0xe0,0xa6,0x53,0x7d,0x52,0xfd,0x62,0x5e,0x98,0x74,0x49,0x6b,0x81,0xa9,0xa4,0xe3,0x1f,0xb,0x77,0x43,0x4b,0xb3,0xef,0xb,0xb5,0x1b,0x84,0x65,0x99,0x36,0x6d,0x37,0x3a,0x81,0xa7,0x23,0xd8,0x45,0x7b,0xd6,0xbe,0xa1,0x57,0x93,0xff,0x25,0xaf,0xbc,0x89,0x88,0x48,0xfd,0xfe,0xd7,0xa3,0xea,0x22,0xc8,0xab,0xfc,0x72,0x13,0x1a,0x34,0x6a,0x9a,0xa1,0xb9,0x74,0xd,0x2,0x5,0x80,0xfa,0x4b,0xe1,0x61,0x6b,0x9a,0x44,0x2d,0x7a,0xde,0x20,0x19,0xbd,0x44,0x27,0x7d,0x29,0x79,0x2,0x0,0x2d,0xd4,0xa2,0x20,0xa4,0x67,0x65,0x1b,0x8e,0x3b,0x53,0xf1,0x68,0x45,0xfd,0x0,0x87,0x1b,0x8f,0x8f,0x58,0x3f,0x2,0x8c,0xd,0x80,0x98,0xed,0xe0,0x8a,0x4f,0x64,0x9f,0x38,0xdb,0xdc,0xef,0x39,0xd2,0xd4,0xf5,0xe7,0xbd,0x5b,0xfa,0x7a,0xb9,0x2f,0x67,0xd5,0xa5,0x61,0x5,0xc8,0x8a,0xa9,0xa0,0x4c,0xfd,0xa9,0x55,0xfb,0xfe,0xbb,0xff,0x5,0xa4,0x58,0x60,0xe6,0xa,0xb9,0x0,0x0 };
+const uint8_t index_html[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0xed,0x5d,0xfd,0x72,0xe2,0xb8,0x96,0xff,0x7f,0xaa,0xe6,0x1d,0x34,0x4c,0xd5,0xbd,0xa4,0x8a,0x8f,0x90,0x74,0xcf,0xce,0xa4,0x69,0xaa,0x8,0x90,0xe,0xd3,0x24,0x61,0x81,0x4c,0x4f,0xef,0xd6,0x56,0x4a,0xd8,0x2,0x7c,0x63,0x5b,0xbe,0x92,0x9c,0x84,0xbb,0xb5,0x8f,0xb5,0x2f,0xb0,0x4f,0xb6,0xe7,0x48,0x36,0x5f,0x21,0x8d,0x71,0x88,0x61,0xef,0x76,0xaa,0xba,0x43,0x8c,0x74,0x74,0xce,0x4f,0x47,0xe7,0x43,0x92,0xa5,0xea,0x4f,0xc5,0xe2,0x8f,0x3f,0x10,0xf8,0x19,0x4c,0x1c,0x49,0x24,0x1f,0xa9,0x47,0x2a,0x18,0x81,0xcf,0xae,0x63,0x31,0x5f,0x32,0x9b,0x84,0xbe,0xcd,0x4,0x51,0x13,0x46,0xae,0xda,0x3,0xd2,0x31,0x8f,0x4b,0xa4,0xcf,0x98,0x7e,0x18,0x95,0x23,0x23,0xc7,0x85,0xff,0xb8,0x20,0x36,0x53,0xd4,0x71,0x65,0xc9,0xd0,0xed,0xf3,0x50,0x58,0xec,0x8c,0x4c,0x94,0xa,0xe4,0x59,0xb9,0x3c,0x76,0xd4,0x24,0x1c,0x96,0x2c,0xee,0x95,0x65,0x40,0x2d,0x36,0x9,0x27,0xbe,0x62,0xd6,0xa4,0xfc,0xc5,0xb9,0x70,0x9a,0xa1,0x75,0xff,0xe3,0xf,0xa6,0xe2,0x15,0xb7,0x9d,0x91,0x3,0xed,0x53,0x1f,0xfe,0xd9,0x34,0x50,0xf0,0x79,0x38,0x3d,0x33,0xdf,0x16,0x49,0x93,0x9,0x66,0xdd,0xff,0x5a,0xf9,0xf1,0x87,0x62,0xb1,0xf6,0xe3,0xf,0xd5,0x9f,0x9a,0x37,0x8d,0xc1,0xd7,0x6e,0xb,0x5a,0xf2,0x5c,0x7c,0x10,0xfd,0xc6,0xd2,0xd5,0x9,0xa3,0x76,0xf4,0x59,0xff,0xed,0x1,0x8f,0xc4,0x9a,0x50,0x21,0x99,0xfa,0x98,0xbb,0x1d,0x5c,0x14,0x7f,0xcd,0x3d,0xfb,0xde,0xa7,0x1e,0xfb,0x98,0x7b,0x70,0xd8,0x63,0xc0,0x85,0xca,0x11,0x8b,0x3,0xa7,0x3e,0x94,0x7f,0x74,0x6c,0x35,0xf9,0x68,0xb3,0x7,0x10,0xbd,0xa8,0xff,0x28,0x10,0xc7,0x77,0x94,0x43,0xdd,0xa2,0xb4,0xa8,0xcb,0x3e,0x1e,0x97,0x7e,0x2d,0x10,0xf,0x9e,0x79,0xf0,0x28,0x74,0x5e,0xa2,0xd,0xf8,0x79,0xac,0x68,0x71,0x97,0x8b,0x5,0xf2,0x3f,0x9f,0xfe,0x72,0xfa,0xdb,0x69,0xb,0x2b,0xad,0xaf,0x66,0x33,0x69,0x9,0x27,0x50,0xe,0xf7,0x17,0xaa,0x21,0x80,0x4,0x11,0x5c,0x6a,0x4d,0x39,0xca,0x65,0xb5,0xd9,0x77,0xd5,0xb2,0x79,0xb0,0x44,0xda,0x75,0xfc,0x7b,0x22,0x98,0xfb,0x31,0x27,0xd5,0xd4,0x65,0x72,0xc2,0x18,0x88,0xab,0xa6,0x1,0xb2,0xc8,0x9e,0x54,0xd9,0x92,0x32,0x47,0x26,0x82,0x8d,0xa2,0x12,0x25,0x7c,0xb0,0xd8,0x8a,0xe1,0x87,0x48,0x61,0x41,0x9,0xfd,0xb9,0xf4,0x37,0x28,0x51,0x2d,0x9b,0x3f,0x5e,0x2a,0xea,0x80,0x6a,0x3d,0x25,0x2a,0x29,0xed,0xbb,0x9,0x28,0x82,0xcb,0x44,0x42,0xc2,0x8a,0x89,0x40,0x30,0xb5,0xbe,0x7c,0xb5,0xbc,0xa0,0x10,0xd5,0x21,0xb7,0xa7,0x8b,0x84,0x7c,0xfa,0xb0,0xf0,0xa7,0x7e,0x14,0xba,0xc4,0x72,0xa9,0x94,0x1f,0x73,0x1e,0xf3,0xc3,0xdc,0xca,0xd7,0x11,0x88,0xb5,0x2a,0x8d,0x40,0x32,0x72,0xa1,0x2,0xe6,0x16,0xa1,0xa7,0xc0,0x7,0x14,0xdb,0x50,0xf9,0xb2,0xdd,0x6c,0x40,0x9f,0xa,0xee,0x46,0x14,0xe0,0x1,0x89,0x9e,0x24,0xa5,0x1,0x6a,0xad,0x1c,0x7f,0x2c,0x23,0xa,0xfd,0xe8,0xcf,0xa4,0xd5,0x1,0x36,0x50,0x5e,0x1a,0x33,0x30,0x88,0xfe,0x4c,0x5a,0xdd,0x12,0xcc,0x76,0x54,0xdc,0x78,0x7d,0xc8,0x43,0xf5,0x42,0xd5,0x6a,0x39,0x74,0x17,0xa1,0x2f,0x2f,0x63,0x5f,0xb5,0x9d,0x7,0xe2,0xd8,0xa8,0x75,0x54,0x85,0xba,0x1f,0xe1,0xc9,0xd2,0x60,0xa2,0x8e,0xbf,0x4a,0x53,0x32,0xb,0x87,0xc6,0x3a,0x2e,0x27,0x95,0x5a,0x5f,0x93,0x2,0xd,0xa8,0xac,0x2b,0x80,0xd,0x46,0x3d,0x8d,0x3,0xb,0xa8,0x33,0x91,0xab,0x91,0x35,0x3f,0xcf,0x2b,0xaf,0x12,0x10,0xfc,0x71,0x9d,0xa6,0xcc,0x8a,0x6,0xb5,0xea,0x10,0xd8,0xe1,0x82,0x8e,0xc1,0x40,0x56,0xcb,0xc3,0x5a,0x15,0x4c,0xa2,0xaf,0x5,0x1e,0x9,0xc6,0xae,0x98,0xc7,0xc5,0x34,0x57,0x2b,0x56,0xd1,0x54,0xfa,0x20,0x7c,0xf0,0x2d,0x72,0xc3,0x50,0x29,0xee,0xc7,0x8d,0xdb,0xd4,0x1f,0x3,0xeb,0x86,0x18,0x17,0x1e,0x55,0xb9,0x9a,0xf9,0xd,0xd,0xe9,0x92,0xc9,0x69,0x81,0x4b,0xf0,0x73,0x51,0x3f,0xf0,0x20,0x57,0xc3,0xff,0x53,0x50,0x99,0x38,0x8a,0x19,0x32,0x60,0xb9,0xb9,0xef,0x43,0x37,0xe5,0x6a,0xb3,0x8f,0x1b,0x8,0xae,0xf6,0xfc,0xb7,0x9e,0x3,0x5e,0x6b,0x55,0x60,0x93,0x66,0x68,0x13,0x21,0x49,0xbf,0xdb,0xbe,0xb8,0xe8,0x93,0x7c,0x1b,0x8d,0x8,0xa8,0xfd,0xd1,0x8a,0x20,0x60,0x29,0x39,0xb5,0x23,0x40,0x4c,0x9d,0x9e,0x79,0x54,0xfb,0xcb,0xcf,0x4f,0x27,0x95,0xe1,0xf0,0xc3,0x4c,0x98,0xed,0xf4,0xec,0x5,0xd1,0x15,0x1d,0x82,0x6f,0x8d,0x8a,0xeb,0x3f,0x16,0x1b,0x1f,0xe8,0x7,0xd0,0x92,0xfe,0xa6,0xf6,0x7a,0xbd,0x74,0xfc,0x20,0x54,0x24,0x70,0xd1,0x3b,0x73,0x17,0x9c,0xff,0xc7,0xdc,0x5,0x38,0x77,0xf4,0x3d,0xa4,0x5c,0xc5,0x5f,0xb5,0x45,0xef,0x90,0x8b,0xe9,0x4a,0x8f,0x73,0x35,0xc9,0x91,0x7,0xea,0x86,0xf0,0x5d,0xd9,0x30,0xe9,0xb3,0x47,0xac,0x9d,0x2b,0x27,0xd7,0x14,0x19,0x5a,0x16,0x43,0x97,0x33,0x17,0xb2,0x21,0x18,0x45,0xed,0xe1,0xbe,0x5,0x1,0xc7,0xbd,0xb6,0x31,0xf0,0x20,0x6f,0x73,0x2b,0x4,0x93,0xac,0x4a,0x63,0xa6,0x5a,0x2e,0xc3,0x8f,0xe7,0xd3,0xb6,0x9d,0xff,0x6b,0xd4,0xec,0x5f,0x8f,0x4a,0x9a,0x9d,0xa3,0x5c,0xcd,0xd4,0x38,0x20,0x35,0x6b,0x36,0xea,0xbd,0xe6,0x66,0xdd,0xea,0x37,0xf7,0xa9,0x5d,0xfd,0xe6,0x46,0xfd,0xda,0x21,0x36,0x2d,0xf0,0x1b,0x10,0x42,0xbe,0xc0,0xe9,0xcc,0x3a,0x4a,0x63,0x34,0xcf,0xa9,0x3d,0x66,0x33,0xf5,0x1b,0xe2,0x5f,0x45,0x19,0x38,0xa3,0x11,0x78,0xa,0x33,0x88,0x23,0xcb,0x49,0xd6,0x31,0xbd,0x3,0xe8,0xf6,0x36,0xa8,0x98,0xc6,0x49,0x8f,0xab,0xe4,0xc3,0x2a,0x10,0x10,0x8e,0x82,0x43,0x59,0xa0,0xd0,0xe4,0x8f,0xbe,0xd1,0x2d,0x3b,0xfa,0x94,0x72,0x7c,0x6c,0xb,0x7,0xca,0x8,0x89,0x6,0x5d,0x15,0x73,0xce,0x5a,0x6e,0x19,0xac,0x2f,0x2,0xbc,0x7,0x99,0x42,0x36,0x41,0xa2,0x40,0x6f,0x2,0x9,0x40,0xa9,0x54,0xca,0x11,0x19,0x30,0xd7,0xb5,0x26,0xc,0xcd,0xc2,0x88,0xba,0xd2,0x28,0x6b,0xd4,0xc0,0x1b,0xcb,0xb1,0x50,0xd4,0x66,0xc3,0x70,0x3c,0x7e,0x59,0x5b,0xe2,0x9f,0x9b,0x50,0x81,0x2a,0x9c,0x2d,0xa8,0xb3,0x11,0xd8,0xf1,0x47,0x1c,0x7c,0x2b,0x7d,0x60,0x76,0xa4,0xb6,0xdf,0x68,0xf7,0x5b,0xec,0xef,0x4f,0xb4,0xeb,0x9b,0x41,0xeb,0x8c,0x60,0x57,0x41,0xb4,0x49,0x14,0xd7,0x9,0x62,0xbf,0x49,0x2c,0x2a,0x6c,0xf8,0xcf,0x27,0x8a,0xde,0x43,0xd6,0xe8,0x80,0xce,0x3b,0x23,0xfd,0x65,0xd4,0x97,0x90,0x6f,0x3e,0x30,0x31,0x25,0x2e,0xf7,0xc7,0xa5,0xfd,0x8b,0x3d,0xef,0x94,0x62,0x34,0x68,0x8a,0x66,0x54,0xc8,0x4d,0x8,0x7c,0xd3,0x93,0x41,0xd7,0xf6,0x63,0xf3,0x4,0x9f,0x11,0xa0,0xd8,0x4c,0x6d,0xc,0xa6,0x12,0x11,0xb7,0x11,0xe8,0x5,0xe2,0xcd,0x74,0x84,0xe7,0xf1,0x9e,0x1,0xa1,0x17,0xfa,0x10,0xa8,0x85,0x7e,0x3a,0x6a,0x8b,0x91,0xa8,0xa1,0xd7,0xdf,0x26,0x8a,0xdc,0x40,0x11,0xa9,0xc4,0x72,0xe3,0x67,0x22,0xed,0x24,0xa1,0x69,0x4a,0x45,0x7a,0x53,0xe7,0xf7,0x7b,0x9f,0xb4,0xe7,0x79,0x2b,0xc9,0x9f,0xb7,0x6,0xf5,0xa3,0x6d,0x5c,0xe1,0xef,0xfd,0x24,0xce,0xf0,0x9f,0xd7,0x17,0x82,0xfc,0x3b,0xf1,0x86,0x48,0xe7,0xe0,0xfc,0x21,0x76,0xee,0xff,0x43,0x8f,0x88,0x7d,0x71,0x58,0x3e,0xf1,0xad,0x9d,0x3,0x4a,0xfc,0x86,0xee,0x61,0x89,0xfc,0xab,0x1d,0x4,0x78,0x5,0x24,0xd8,0xdb,0x85,0x73,0x40,0xf3,0xad,0xb9,0xdb,0xb1,0x63,0xd0,0x2a,0x94,0xd8,0x35,0x7c,0x53,0x5c,0x30,0x83,0x10,0xa7,0x28,0xa4,0xd8,0x30,0x1f,0x11,0x46,0x9c,0xdd,0x9b,0x9a,0xb4,0xee,0x8d,0x7c,0xcf,0xce,0xbc,0xcc,0x49,0x6d,0x81,0xd9,0x68,0xe0,0x45,0x9e,0x6,0xbc,0xc0,0xc9,0x4e,0xbc,0x0,0x2,0x65,0x63,0x2b,0xc6,0x2c,0x99,0x46,0x72,0x2f,0x3,0xa2,0xa7,0x94,0xd1,0x65,0x59,0xf7,0x63,0xc1,0x43,0xdf,0x3e,0x23,0x3f,0x9f,0x9c,0x9e,0xfc,0xcb,0x9,0xfd,0x40,0x2,0x6a,0xdb,0x10,0x4b,0x9e,0x91,0xca,0x71,0xf0,0xf4,0x1,0x2c,0x9c,0x33,0x9e,0x80,0xa5,0x38,0x39,0xd6,0x7f,0x8e,0x80,0x9f,0xe2,0x88,0x7a,0x8e,0x3b,0x3d,0x23,0x1e,0xf7,0xb9,0x5e,0x52,0xf8,0x40,0x3c,0xfa,0x54,0x5c,0x29,0xca,0xa1,0xb3,0x46,0x2e,0x7f,0x2c,0x42,0x49,0x1a,0x2a,0xfe,0x81,0xe8,0x69,0x77,0x68,0xea,0xd4,0x7a,0xff,0x21,0xb7,0x3,0xbb,0x11,0xcb,0x1,0x16,0x61,0xec,0xf8,0x45,0x50,0xb8,0x33,0xc3,0xf4,0x98,0x6,0x11,0xff,0xb9,0xed,0xe7,0xef,0xe6,0x13,0x1e,0x2e,0xa3,0x62,0xa1,0xf3,0xc,0xac,0xf9,0x23,0x18,0x7c,0x4c,0xb2,0x14,0xb3,0x7a,0x33,0x7,0x38,0x6f,0x82,0x7,0xd3,0xb5,0x2d,0x34,0xe0,0xb,0xd2,0xe0,0x9e,0x47,0x7d,0x5b,0xee,0x79,0x6,0xe5,0xa7,0x62,0x11,0x83,0xa5,0x66,0x34,0xf1,0x43,0xb1,0x9c,0xe,0x60,0xf4,0x32,0x50,0x82,0x80,0xd,0xb4,0xdc,0xc8,0x7,0x7a,0xf5,0x92,0xce,0x4f,0x4e,0x57,0xa3,0xb1,0x22,0xb9,0xe6,0x8a,0x49,0xf2,0x17,0xd2,0x71,0x3c,0xc7,0x34,0x8b,0xb3,0xc8,0xa7,0xbb,0x18,0x32,0x1b,0x66,0x89,0xa5,0x12,0x90,0x17,0xd5,0x74,0x76,0x5,0x90,0x99,0xbf,0xc8,0x39,0x1b,0x71,0xc1,0x48,0x28,0x75,0xae,0x5,0xb9,0xd4,0xef,0xf4,0x81,0x46,0x3,0x7b,0x81,0xf3,0x2,0xb9,0x67,0x2c,0xd0,0x5,0x46,0xdc,0x85,0x11,0x80,0xc5,0xdd,0xb9,0xc,0xc4,0xf1,0x71,0xa5,0xca,0x3e,0xdb,0x30,0xbd,0xbc,0x34,0x51,0xbf,0xb6,0xc4,0xda,0x85,0x81,0xd5,0x9f,0xf6,0x8,0x43,0x16,0xe0,0x1a,0x52,0x40,0x7f,0x84,0xab,0x66,0xc,0xb2,0x3e,0x1e,0x48,0xc2,0x5,0xae,0x65,0x81,0x63,0x5,0xae,0xa8,0x6b,0x1e,0x16,0x40,0x69,0x6b,0xd4,0x75,0x9,0xae,0x81,0x38,0x3e,0x88,0x1e,0x5a,0x86,0x6b,0x2f,0x94,0x4a,0x53,0xa9,0x5a,0xdc,0x66,0x35,0xfa,0x48,0x1d,0x18,0x3,0xfa,0x33,0xce,0xa4,0x97,0xc8,0x66,0x56,0x6e,0x0,0x13,0xf1,0xe8,0x48,0x56,0xd0,0xe8,0xdc,0xb6,0xc9,0xa3,0x3,0x4d,0xe1,0xd4,0xfb,0x3f,0x58,0x69,0x83,0xb0,0xe5,0x8d,0xd2,0x26,0xc3,0x3,0xe4,0xeb,0x52,0x1,0x22,0x32,0x97,0xb0,0x27,0x66,0x85,0x28,0x1e,0xe6,0xc3,0x3e,0x57,0x44,0x86,0x1,0x2e,0x3d,0x32,0xbb,0x84,0x32,0x91,0x5b,0xdd,0xd5,0x5d,0xc1,0x3d,0x60,0xba,0x4,0x75,0xf2,0x47,0x11,0x6a,0x56,0x28,0x4,0xc,0x6,0xc8,0xb1,0x5d,0x17,0xb0,0xa1,0x53,0xf8,0x84,0xe0,0x78,0xce,0x13,0x83,0xcc,0x3b,0x1a,0xb9,0x58,0xb8,0xde,0xf8,0x4c,0x98,0x10,0x5c,0xc8,0xc,0x25,0xac,0xcb,0xa9,0x6f,0x91,0x51,0xe8,0x47,0x9d,0x87,0x4b,0xcc,0x14,0x75,0x11,0xc3,0xba,0x61,0xad,0x40,0xc0,0xa2,0x60,0x1f,0x4c,0x4d,0xb7,0x52,0xf7,0x91,0x4e,0x25,0x19,0x42,0x21,0xec,0x56,0x10,0x9f,0xc,0xf0,0x4b,0x9b,0x6b,0x54,0x86,0x6c,0x82,0xf1,0x8b,0xeb,0xdc,0x33,0xb0,0xb9,0x20,0x18,0xce,0x2e,0x2c,0x28,0x3f,0xc5,0xd6,0x36,0xf3,0xb5,0xc0,0x8e,0x6f,0x6b,0xcc,0x0,0x2d,0xad,0x68,0x33,0xbc,0x9c,0x11,0x3c,0x93,0x0,0xa4,0x9d,0x15,0x58,0x75,0x1d,0xb3,0x61,0x50,0x31,0x4,0x9f,0x22,0xc1,0xf0,0xd4,0xbb,0x6d,0x89,0xfa,0x30,0x74,0xb9,0x75,0x8f,0x50,0x7c,0x85,0xe1,0x63,0x51,0x1f,0x91,0xc0,0x2e,0x4e,0xd0,0x1,0x7a,0x54,0xc4,0x33,0xe5,0xd1,0x20,0x29,0x44,0x8f,0xc1,0x1c,0x40,0xaa,0xb3,0xf2,0x70,0xc4,0x94,0x35,0x59,0x79,0xf6,0xe7,0x65,0x6f,0xe5,0xc9,0x17,0x36,0xec,0xd,0x1a,0xb3,0x87,0x50,0x27,0x43,0x95,0x6a,0x2f,0x1b,0xf,0xec,0xc2,0xe7,0x96,0x40,0x2b,0x1a,0x2,0x15,0x29,0x1b,0xb1,0x43,0x81,0x43,0xc8,0x84,0x71,0x12,0x47,0xda,0x72,0xf8,0xa6,0xc7,0x59,0x46,0x42,0xc,0xd0,0x22,0x47,0x3a,0x18,0xf1,0x2e,0x58,0xc0,0xa8,0xca,0x5b,0x10,0x4,0xa9,0x2,0x19,0xf9,0x47,0xb1,0x1c,0xd0,0xff,0xdc,0x77,0xa7,0x4,0x94,0xdc,0x71,0xf5,0x7c,0x3d,0xee,0xb4,0x40,0xab,0xb5,0x18,0xce,0x45,0xd1,0x29,0x13,0xa5,0x4,0x76,0x58,0xc1,0x70,0x62,0xc6,0xcc,0x18,0xbb,0xc3,0xe6,0x7a,0x1f,0xc1,0x4,0x2e,0x10,0xe2,0x7b,0x3d,0x5d,0x37,0x33,0x4d,0x99,0x75,0xf1,0x22,0x20,0x33,0x1c,0x66,0x2c,0x8f,0x19,0xb8,0x54,0xaa,0xcc,0x16,0x14,0x1f,0x3c,0xd9,0x43,0xec,0x9,0x7a,0xad,0x6e,0xab,0x3e,0x88,0x2b,0x44,0x22,0x25,0x1,0x4,0xbc,0xb,0xa3,0x76,0x81,0x38,0x8,0x48,0xa0,0x71,0x40,0xe2,0x73,0x63,0xe0,0xbb,0xe0,0xc7,0xcd,0xac,0x65,0xc0,0x2c,0xb3,0x39,0xc5,0xf,0xbd,0x21,0xc,0x52,0x3e,0xd2,0xb3,0x9a,0x99,0xd9,0xd4,0x3e,0xf7,0x56,0xbb,0x3e,0xe2,0x12,0x35,0x1e,0x86,0xc7,0x92,0xf7,0xd0,0xce,0x3,0xdc,0xbc,0xc2,0x3d,0x3e,0x73,0x27,0xe3,0x1,0x42,0x67,0x49,0x7b,0xa2,0xd3,0x1f,0xf4,0xda,0xd7,0x9f,0x56,0x4c,0xc0,0x12,0xd8,0xf1,0xc3,0xce,0xcd,0x4d,0x77,0xe5,0x51,0xb3,0xd5,0xa9,0x7f,0x8d,0x9e,0x95,0x32,0x1b,0x5f,0xcf,0xa4,0xc5,0x71,0x4,0xe0,0x48,0x34,0x6,0x38,0x7c,0xa8,0x4f,0x38,0x6,0x1,0x72,0xee,0x85,0xb4,0xa5,0x0,0x17,0x8a,0xa1,0xd5,0xc8,0x65,0x4f,0xce,0xd0,0x71,0x1d,0x35,0xd5,0x6,0x6,0xbb,0x1e,0x4d,0x2e,0xf4,0xf6,0x82,0xbb,0x71,0xf9,0xd8,0xc9,0xcc,0xf2,0x75,0x21,0xb,0x90,0xe8,0x3c,0xa5,0xf6,0x85,0xa8,0x8e,0x54,0x99,0x8e,0xd5,0x2,0xe2,0x24,0x3b,0xf8,0x4d,0x9,0xfa,0xf1,0x88,0xdf,0x84,0xa0,0xd5,0xda,0x5e,0xc4,0x3e,0x8e,0x5b,0x16,0x95,0x3a,0xc2,0x2,0x73,0x12,0x8,0xe,0x89,0x1a,0x7c,0x49,0x6,0xed,0xab,0xd6,0xcd,0xed,0xc0,0x84,0x6,0x59,0x9,0xd3,0xf6,0x80,0x81,0x7,0xbd,0x68,0x6b,0x14,0x37,0x70,0xc1,0xaf,0xc1,0xa8,0x8a,0x8d,0xdb,0x28,0x54,0xa1,0x78,0x65,0x28,0xb6,0xb2,0xc5,0x24,0x6d,0xaa,0xf2,0x62,0x5a,0x50,0x9f,0x99,0xe4,0x8b,0x38,0xa0,0xd8,0x49,0x5a,0xf0,0xad,0xd5,0x7c,0x53,0x60,0x65,0x53,0xdb,0xfa,0x42,0x22,0x89,0xad,0x55,0x93,0x5a,0xcc,0x7c,0xb5,0xc,0x7f,0x24,0xab,0xd2,0x7a,0xa2,0x5e,0xe0,0xb2,0x2d,0x6a,0x34,0xe7,0x1b,0xd7,0x12,0xd4,0x82,0x22,0xe2,0x9b,0x1d,0xbb,0x9,0x81,0xaa,0x5a,0xd9,0xda,0xf5,0x1a,0x88,0xec,0x9a,0x31,0x65,0x68,0x69,0x41,0x61,0xf3,0xea,0x49,0x1d,0xcd,0x12,0xe,0x65,0xa7,0xa2,0x91,0xbb,0x64,0x60,0x6e,0x72,0x29,0xe8,0xd4,0x6d,0xb4,0xf5,0x24,0x22,0x44,0x20,0x64,0xf0,0x25,0x7,0x1d,0xc4,0x28,0xa1,0x60,0x72,0x7,0x7c,0xe,0xd1,0x8d,0xd9,0xa6,0x78,0x54,0x4a,0x40,0x7c,0x3,0xe0,0x69,0xd0,0xc2,0x59,0xfc,0x57,0x41,0xa5,0x9,0xa4,0xc7,0x69,0x0,0xd5,0xc1,0x8f,0xb3,0x27,0x5,0xc9,0x9d,0x9a,0x70,0x5c,0x77,0x10,0x10,0x61,0x63,0x78,0xd3,0xba,0x1e,0xb4,0x7a,0x7b,0xc4,0xc5,0xf5,0x5f,0x8d,0xc,0x90,0xd8,0x9,0x36,0xe8,0x1d,0x34,0x2e,0xf0,0x40,0xc3,0x42,0xb4,0x57,0x81,0xb8,0xcf,0xb7,0xf7,0x84,0x90,0x66,0x27,0x5f,0x2a,0x95,0xee,0xd9,0x54,0xa6,0x6,0xc9,0x50,0xc9,0x35,0x6,0xbd,0x4e,0xae,0x40,0x72,0xf5,0xce,0x0,0x7f,0x41,0x38,0x92,0x6,0xb0,0x6e,0x84,0x10,0x87,0x30,0x10,0x3c,0x94,0x8e,0x11,0x90,0x3b,0x22,0x1d,0x2f,0x74,0x21,0x13,0x65,0x3c,0x94,0xee,0x74,0x4f,0x80,0x81,0x2d,0x18,0xf2,0x57,0x3,0x66,0xa8,0xe4,0x3e,0xdd,0xb6,0x11,0x28,0x91,0xca,0x36,0xb9,0xe,0x95,0xda,0x87,0x2f,0xf6,0x41,0x4c,0x68,0x4f,0xe8,0xd8,0xcc,0xa5,0xd3,0xbc,0x97,0x1e,0x18,0x43,0xe0,0xfd,0xf1,0x71,0x1a,0xc5,0xc1,0xc9,0x98,0xc5,0x60,0x34,0xe,0x70,0xe6,0x89,0x84,0xe7,0xb8,0xae,0x23,0x71,0x33,0xa4,0x2d,0xf7,0x4,0x11,0xc3,0xb8,0x26,0x9f,0x1a,0xa0,0xd4,0xd5,0xfb,0xc,0x13,0x17,0x63,0x76,0x40,0x77,0xf7,0x65,0x91,0xe9,0x30,0xbd,0xec,0x29,0x2b,0x1b,0xc9,0x7,0xf5,0xf3,0x3d,0xca,0xd,0x21,0xd9,0x2b,0xfa,0x3c,0x5d,0xe5,0xa8,0xc7,0xfb,0x8d,0x3d,0xca,0xd,0x2d,0xe3,0x6f,0x34,0x98,0xf8,0x3b,0xbd,0x61,0x88,0x9,0xe5,0x8e,0x9f,0x8e,0x4f,0xd0,0x68,0xc2,0xef,0x77,0xb9,0xd4,0xa8,0x8,0xfa,0xa8,0x27,0x21,0x23,0xb2,0xfb,0x32,0x6,0x2e,0xb3,0xf3,0xf0,0xaf,0x40,0xa8,0x85,0x93,0x2b,0xa9,0xd1,0x41,0x3a,0xb9,0x5e,0xfb,0xd3,0x25,0x3a,0x5e,0x25,0xc2,0x34,0x94,0x6,0xa1,0xf0,0x65,0x14,0xc8,0x92,0x4e,0xab,0x89,0x1e,0x18,0x1d,0x30,0x1f,0x8d,0xf6,0x85,0xe,0xc7,0xd7,0x7c,0xf2,0xf0,0x2b,0x3d,0x30,0x86,0x44,0xee,0xb6,0x9f,0x4e,0x57,0x20,0x65,0x6,0x15,0x19,0x72,0x9c,0xfc,0x6,0xcf,0x4,0x91,0xed,0x9e,0xb0,0xf0,0x20,0x85,0xcf,0x3f,0x15,0xc8,0x34,0x35,0x14,0x9a,0xc2,0xfb,0xe3,0x2,0x29,0x9e,0xa4,0xf1,0xae,0x57,0x50,0x1d,0xa7,0x3f,0x70,0x6a,0xc6,0xa,0x85,0xe4,0x62,0x5f,0x11,0x18,0x2e,0xa3,0xe6,0x87,0xca,0x4f,0x1f,0x7d,0x69,0xa,0x95,0x54,0x20,0x68,0xf1,0xb1,0xfe,0x9e,0xa4,0x87,0xd4,0x9e,0xbb,0x6e,0x9e,0x7a,0x38,0x7b,0x9d,0x1a,0x81,0x88,0xca,0xfb,0xd4,0x10,0x3c,0x4e,0x18,0x73,0x89,0x21,0xb3,0xcf,0xd4,0xe5,0x4e,0x2b,0xe4,0xab,0xb4,0x61,0x91,0x4e,0x1a,0x9d,0xb8,0xe4,0xae,0x1d,0xf,0xc,0xb3,0x66,0xbf,0x27,0x40,0x4,0xd3,0xd3,0x96,0x3b,0x80,0x64,0x99,0x52,0x1a,0x50,0x7a,0x86,0xc2,0x61,0xe0,0x2,0x79,0x37,0xf7,0xf2,0x9e,0xe3,0x17,0x70,0xcf,0x4a,0x7a,0x54,0xc,0x9d,0x4a,0x81,0x54,0x8e,0x53,0x41,0xa2,0xb4,0x87,0xa5,0xc4,0x10,0x8a,0x56,0x35,0xf6,0xe6,0x5b,0xc7,0x18,0x94,0x51,0x31,0x96,0xaf,0x70,0xae,0xe3,0x7c,0xae,0x89,0xdb,0xf,0xd3,0x38,0xd7,0xe,0x1f,0x83,0x7a,0xc0,0xd8,0xa3,0x63,0x26,0xe3,0x6d,0xec,0xd1,0xc,0xdb,0xbe,0xb2,0x13,0x5c,0x5d,0x52,0xd4,0xb,0x5e,0x91,0xa3,0xbc,0x86,0x44,0xac,0x22,0xf1,0x46,0x83,0x19,0xb1,0x3d,0xe1,0xe1,0xc8,0x5e,0xe8,0xfb,0x8e,0x3f,0x4e,0x8f,0xc7,0xe3,0xc4,0x81,0xf8,0x6b,0x81,0x50,0xa,0x4a,0xd,0xdc,0x63,0xab,0xf7,0x9,0x2c,0xed,0xdd,0x90,0xa,0x37,0x92,0x98,0xc8,0x79,0x5f,0xde,0xd8,0x65,0x2c,0x78,0xcd,0x7c,0x87,0x5e,0x47,0x27,0x86,0x4c,0x25,0xd5,0xac,0x87,0xd9,0xf5,0xa1,0x29,0x90,0x9,0x73,0x3,0xdc,0xd3,0xfe,0x7b,0x5f,0x4f,0x51,0x1f,0xed,0xcd,0x11,0xad,0x5f,0x60,0x4f,0xe1,0x87,0x34,0xa1,0xd3,0x2,0x71,0xc8,0xc7,0xbf,0x8c,0xd5,0x7,0xf2,0x9f,0x60,0xb3,0xfe,0x2b,0xd,0xbd,0x61,0xbc,0x95,0x14,0xd7,0x91,0x7d,0x3d,0x7d,0x38,0xac,0x91,0x9e,0x6e,0x40,0x3e,0x5b,0x93,0x5f,0x5c,0xf4,0x8d,0x16,0xc1,0x9d,0x9d,0xf8,0x2f,0xf8,0xfa,0x1b,0xab,0x25,0xdb,0xbd,0xfd,0xf7,0xe2,0x62,0xd9,0xad,0xc2,0xd5,0x54,0x7,0xac,0xea,0x4e,0xd6,0xc8,0x26,0xef,0x6a,0x5f,0xf4,0xfe,0x15,0x49,0xca,0xa4,0xf5,0xa0,0x17,0x36,0x49,0xbe,0x4b,0xa7,0xb8,0x73,0x5f,0x96,0xcc,0xde,0x16,0x59,0x62,0xe6,0x1b,0xe8,0x20,0xdc,0xe4,0xfa,0x2e,0xfd,0x8a,0xdb,0x66,0x75,0xdc,0x6a,0x21,0xd,0x8b,0xd7,0xc5,0x58,0x6f,0xcb,0x91,0x9,0xcb,0x27,0x5f,0x42,0xdb,0xd4,0xdf,0x9,0xa4,0x99,0x4d,0xf3,0xa8,0xc7,0xf3,0x69,0x40,0x17,0x66,0x71,0x93,0xe8,0x1b,0x94,0xb8,0xe6,0x3e,0x4b,0x58,0xb4,0xe9,0x48,0xc4,0x5f,0x92,0x2e,0x2e,0xce,0xf7,0xc1,0x60,0xb8,0xa4,0x35,0xf8,0x82,0xcb,0xeb,0x63,0x54,0x7c,0xdc,0xa6,0xa8,0x5f,0x88,0xdf,0xa4,0xeb,0x3b,0x94,0xdb,0x36,0x3c,0x99,0xe1,0x76,0x8e,0x1b,0xb0,0x3a,0x86,0x9b,0x8c,0x71,0x88,0xc6,0xbb,0xe6,0x80,0x44,0x2c,0x90,0x7,0x87,0x92,0x80,0x43,0xc2,0x37,0x85,0xd8,0xd1,0x77,0x82,0xd0,0x4d,0x64,0xa,0x76,0x8,0x8f,0xde,0x92,0xdc,0xed,0x5f,0x3a,0xf8,0x12,0xd2,0xf4,0xd,0x31,0x69,0x60,0x43,0x4b,0x88,0x44,0x66,0x91,0x4c,0x4c,0xdb,0x84,0xa,0xe5,0x8c,0xc0,0xe1,0xca,0xec,0xb5,0xa3,0xc9,0x46,0xc,0x8f,0xc8,0xa9,0xdb,0xf,0xd4,0xb7,0x98,0x9d,0x85,0x6e,0xe0,0x72,0x93,0x13,0xb8,0x8c,0xc4,0xe6,0x2f,0x66,0x2,0xb7,0x74,0x28,0xb3,0x79,0x1a,0x67,0x85,0x98,0xd8,0x3,0x20,0x3,0x8,0xb,0x99,0xe8,0xce,0x18,0xc9,0x2,0x90,0x67,0x38,0x18,0x26,0xc8,0x9c,0xb,0x3d,0x5e,0x4,0x1b,0x83,0xc2,0x64,0x6a,0x43,0xa0,0x43,0x70,0x4b,0xe7,0x65,0xbc,0xf7,0x3a,0xaf,0x20,0xb3,0x61,0xea,0x2e,0x7a,0xbe,0x25,0x36,0xf1,0x72,0xc3,0x22,0x89,0x88,0xc2,0x19,0xa,0xab,0x77,0x8f,0xe2,0x1b,0x74,0x9,0xe9,0xb5,0xfd,0xbf,0x1,0x3c,0x98,0xfa,0x75,0x5b,0x60,0x62,0x21,0xd7,0xa1,0xc4,0x5,0x90,0x20,0xbe,0xc7,0xdd,0x75,0x51,0xb,0xd1,0x26,0x73,0xc1,0x46,0x2e,0xd3,0x41,0x2d,0x41,0x7,0xb,0x8f,0x32,0xc4,0x71,0xde,0x78,0xb3,0xd3,0xc9,0xdb,0xae,0x7b,0x17,0xa,0x37,0x15,0x7a,0x51,0xdd,0x19,0x6c,0xb7,0xbd,0x4e,0xc2,0xfa,0x1d,0xc,0x2b,0x0,0x21,0xe0,0x60,0x1,0xc,0x77,0x6a,0x90,0xcb,0xdc,0x3d,0x5,0x81,0x63,0xf7,0x3,0xce,0x47,0xf9,0x80,0x62,0x56,0x16,0x2b,0x44,0x21,0x36,0x8f,0x5b,0xc2,0xd3,0xd5,0x54,0xc8,0x2a,0x95,0xa4,0xe0,0x50,0x88,0x7c,0x26,0xc,0xf1,0x89,0xd5,0x46,0x22,0x73,0xf1,0xeb,0x9,0x86,0x47,0xd2,0x6d,0x37,0xb3,0x37,0x49,0x17,0x8e,0x60,0x8f,0x7a,0xc3,0x7c,0x76,0xa6,0x28,0x6e,0x13,0xf2,0x40,0xc1,0x1,0xc,0xfc,0x8,0xc0,0xe0,0x39,0x69,0x7b,0x30,0xca,0xb7,0xf5,0x46,0x16,0xc2,0xdf,0xea,0x2d,0xeb,0x96,0x4e,0xb0,0xe2,0x43,0xab,0xb2,0x8e,0x48,0x5a,0xf,0xa0,0x67,0x38,0x87,0xf3,0xf6,0x11,0x49,0xdc,0xd7,0xba,0x49,0x8c,0xcc,0xb2,0xec,0x59,0xf6,0x64,0xb9,0xa1,0xcd,0xba,0x54,0x4d,0xc0,0x0,0xa8,0x49,0x2a,0x63,0x88,0x15,0x67,0x96,0x10,0x5f,0xa2,0x96,0x53,0xa9,0x98,0x47,0xcc,0xf3,0x44,0x84,0xcc,0x5e,0x34,0x9f,0x68,0x7e,0x74,0xa,0x86,0x95,0x71,0xde,0x6c,0xd5,0x2b,0xbf,0x2,0x9c,0xd,0xc7,0x1b,0x2d,0x65,0x82,0x5d,0xe1,0x3c,0x80,0x24,0x63,0x46,0x5a,0x78,0x1c,0x9f,0xe,0x8b,0xd7,0xa4,0x85,0x1,0x14,0x83,0x6c,0xea,0x7b,0x5a,0x98,0x56,0x1,0x47,0xdc,0x36,0xf3,0x3a,0x51,0x72,0x98,0xce,0xeb,0x34,0xb6,0xf2,0x32,0xf5,0xa1,0xde,0x4a,0x33,0x6b,0x5a,0xbf,0xcc,0x59,0x64,0x2e,0xe4,0xf8,0x66,0x9b,0x37,0xb3,0x26,0x90,0xd,0x49,0x2f,0xcb,0x81,0x88,0xa3,0xff,0xe1,0x31,0x4b,0x18,0x6e,0xf5,0x4e,0x3d,0x6d,0x75,0xfe,0x70,0x18,0xee,0x66,0x8f,0x43,0x5b,0x48,0x89,0xfe,0x46,0xad,0x7b,0xf4,0xba,0xb8,0xcb,0x68,0x86,0x4c,0x96,0x56,0x98,0x7b,0x41,0xa8,0x98,0x80,0x61,0x4f,0x21,0x51,0x91,0xd9,0xab,0x47,0x63,0x85,0x83,0x15,0x2d,0xc9,0x10,0xb,0xc5,0xef,0x99,0xdf,0xc6,0x5c,0x44,0x72,0x9f,0xbe,0x71,0x3a,0x54,0x57,0x60,0xba,0xf5,0xd9,0x62,0x5f,0xfb,0x83,0xd6,0x15,0xd1,0x8d,0x13,0x67,0xb1,0xf5,0xc,0x45,0x37,0xaf,0xf1,0xe1,0x7b,0x35,0x10,0xfa,0xb4,0x34,0xf6,0x90,0x1d,0x7b,0xd2,0xb9,0x4b,0xe1,0xad,0xae,0xfa,0xed,0xad,0x7c,0x92,0xd1,0x83,0xfa,0x3a,0x16,0xa2,0x59,0x93,0x2c,0x63,0x30,0xd7,0xbd,0xd4,0xa3,0xb2,0x6f,0xd1,0xb7,0xec,0x7f,0x24,0x2f,0xe3,0xe8,0x9b,0x99,0x3d,0x98,0x1,0xc7,0xe3,0x61,0x1d,0xea,0xea,0xac,0x65,0x6e,0x1c,0x1e,0x20,0x79,0xe1,0xaf,0x9a,0x1e,0x98,0xbb,0xe4,0x44,0xd3,0xb3,0x4f,0x10,0xf9,0x2a,0xf1,0x92,0x33,0x66,0xb,0x5f,0x7f,0xf7,0xc8,0xa9,0x15,0xcd,0x97,0x1a,0xe7,0x3c,0x66,0x19,0x7a,0x98,0x15,0x88,0xcd,0xf1,0x90,0xd4,0x2d,0x95,0xe,0x23,0x41,0xb2,0x58,0x3f,0x61,0xbd,0x96,0xaf,0x37,0xad,0x99,0xd3,0xa0,0x6d,0xaa,0xa8,0x49,0x8d,0x9b,0xd7,0x7d,0xf2,0xf7,0x90,0x9,0x27,0xd3,0xd4,0xc7,0xb1,0xbc,0xc0,0xc0,0x11,0x4d,0x98,0x38,0x41,0x81,0xcc,0x90,0xd9,0x12,0x91,0x76,0xd7,0xd4,0xdd,0xc6,0xa,0xcd,0x74,0x1e,0x10,0xd1,0x60,0xe0,0x1c,0x54,0xbb,0x71,0xd5,0x5,0x22,0xd6,0x3d,0xcb,0x74,0xb6,0x12,0xf,0xe0,0xd6,0xfc,0x60,0xd7,0xe6,0x43,0xe1,0x2e,0x40,0x81,0x1f,0x99,0x6b,0xdf,0xe1,0xc4,0xd1,0x96,0xb0,0xdc,0xf6,0x3a,0x86,0x50,0x44,0x23,0x69,0xb5,0x40,0xf,0x7f,0x83,0x28,0xa2,0x72,0x39,0x18,0x74,0xa3,0x69,0x4d,0x2a,0x14,0x44,0x33,0xa0,0x2e,0x52,0xed,0x3,0x9f,0x73,0x2a,0xd9,0x2f,0xef,0x56,0x10,0x4a,0x8b,0xca,0x96,0x70,0x98,0xb6,0x8b,0x4c,0x8f,0x22,0x7b,0x8e,0xce,0xef,0xfd,0x9b,0xeb,0x2c,0x3,0x5a,0x18,0xf1,0xae,0x19,0x39,0xd2,0x53,0x38,0x68,0x4,0xf7,0xa,0x10,0x4e,0x14,0x88,0xc,0x87,0x38,0x63,0xb8,0xa4,0x3c,0xb8,0x6e,0xb8,0xad,0x3b,0x87,0x6,0x70,0x46,0x8,0x14,0x4e,0xe9,0xf7,0x2f,0x93,0xf9,0x37,0xbd,0x43,0x56,0xa3,0x42,0x25,0xd1,0x5c,0x12,0xaa,0x14,0xb5,0x26,0xfa,0xc,0xd8,0xec,0x0,0x1a,0x45,0xba,0x92,0x97,0x4c,0x3c,0xe0,0x19,0x1b,0x10,0x6d,0xc0,0xff,0x18,0xe6,0x2e,0x21,0x23,0x98,0x7,0xee,0x37,0x8d,0x6,0x5d,0xc0,0x70,0xc0,0x73,0xb4,0x8d,0xef,0x96,0x69,0x87,0x15,0x90,0xd9,0x3,0x2c,0x5d,0xc0,0x1,0x72,0xeb,0x84,0xe8,0x8c,0xa2,0xb3,0xdf,0xb2,0x47,0xc8,0x4c,0x6b,0x7,0x86,0x5b,0xc4,0x4a,0xbf,0x44,0x9b,0x21,0x60,0x8f,0x6c,0x68,0xd3,0x7,0xa3,0x4a,0xda,0xe0,0xac,0x45,0x6a,0x4b,0x60,0xbe,0xb0,0x61,0xb3,0xfe,0xc7,0x2e,0xb4,0xc7,0x50,0xca,0x32,0x5b,0x12,0x10,0xc0,0x8e,0xc0,0x20,0x4c,0x9e,0x85,0x31,0x1e,0x7d,0xba,0x8b,0xf,0xe5,0x93,0x29,0xa2,0x19,0xc,0x64,0x4c,0x6d,0x73,0xfa,0x4d,0x1a,0x4c,0x70,0x2b,0x18,0x24,0x58,0x5c,0x50,0xcc,0xb3,0xb9,0xd4,0xc7,0x9c,0xa2,0x92,0x3b,0x56,0x96,0x5a,0x83,0xbc,0x38,0x7c,0x5,0xa1,0xb4,0x1,0x5e,0x4a,0x1c,0xf0,0x77,0x51,0x4e,0xa8,0xd8,0xd,0x4,0xdb,0xe5,0x12,0x3d,0x86,0xc7,0x77,0x30,0xa2,0xd7,0x82,0xe5,0x9a,0x6c,0x42,0x98,0x2,0xe6,0xfb,0xef,0xe9,0x44,0xea,0x5,0x26,0x5c,0x70,0x97,0x8,0x62,0x1e,0x43,0x67,0x3c,0x4d,0x22,0x45,0xd4,0x8c,0xd5,0x92,0x4e,0xf6,0xe8,0x33,0xda,0xf5,0x72,0xe4,0x7c,0xad,0x7f,0xd0,0xe8,0x92,0xa8,0x43,0x89,0x66,0x26,0xcb,0x25,0xb6,0xa9,0x9a,0x70,0x3f,0x7b,0xe9,0x75,0xb3,0xc5,0x21,0xc5,0xb,0x78,0xf6,0x25,0x3b,0xb4,0x3e,0xc9,0x5c,0x72,0x88,0x80,0x27,0x7b,0xed,0x71,0x9f,0x29,0x8b,0xaa,0x8c,0xe4,0xd6,0xd3,0xb8,0xd7,0xba,0x45,0x3d,0x59,0xa3,0x85,0x25,0x78,0x7d,0x8a,0x30,0xbb,0x16,0xb2,0x54,0x75,0x26,0xf6,0x30,0xcc,0xa1,0xd1,0x9d,0x75,0x75,0x12,0x27,0xf2,0x9,0xf7,0x4c,0x3a,0x16,0x89,0x5c,0x6,0xb9,0xd4,0xab,0x8,0xcf,0x7d,0xc8,0x77,0xa7,0xb1,0x3,0xa7,0x61,0x79,0x6f,0x3b,0xdb,0x1f,0xcf,0x36,0xe1,0x4e,0xb0,0xe8,0x10,0xab,0xb5,0xbb,0xc4,0x1c,0x3f,0xca,0xac,0xb3,0x9c,0xf3,0x8d,0xa2,0xcd,0x16,0xf0,0x35,0x9f,0x4c,0x78,0xcd,0xc,0xcb,0x16,0xdb,0x7a,0xe2,0x93,0xac,0x57,0xa0,0xa1,0x9a,0xce,0x5b,0x8e,0xb0,0x9f,0x8a,0x45,0xf2,0x71,0xf5,0x87,0xf4,0x15,0x86,0x89,0x72,0xcd,0x37,0x6b,0xf,0xed,0x8c,0xc7,0x6a,0x5c,0x2d,0x1f,0x7d,0xf8,0x3e,0x26,0xd3,0x2a,0xa3,0xe0,0xaa,0x72,0x9a,0x97,0x4a,0x6c,0xa9,0x7b,0x6,0xf8,0xa4,0x6b,0x2e,0x41,0xe0,0xe2,0xd6,0xee,0xde,0xcd,0xa0,0x72,0x8a,0x13,0x45,0x90,0x1f,0x29,0xf3,0x4e,0x84,0xe5,0x4,0x93,0x57,0x2d,0xff,0x6f,0x3d,0x9b,0xc7,0x9e,0x8c,0x71,0x78,0x6b,0xa1,0x63,0x13,0x24,0x75,0x25,0x33,0xdb,0xd,0x8d,0x53,0x9b,0x59,0x78,0xf9,0x5f,0xb6,0x22,0x37,0x99,0x16,0x19,0x3e,0x6d,0x29,0xf2,0x25,0x7b,0x8a,0x24,0x48,0x6a,0x60,0x98,0x11,0x7b,0x41,0xd4,0x88,0x40,0xa6,0x5b,0x2,0x4d,0x96,0xa7,0xdb,0x7d,0xeb,0x8e,0x8e,0x72,0x4e,0xa9,0xaf,0x8d,0xa4,0x96,0x7e,0x5b,0x43,0xd8,0x99,0x2a,0xb5,0x45,0x99,0xa4,0xa2,0xa1,0xc7,0x12,0x8a,0x5b,0x80,0x88,0xc9,0x19,0xa9,0x54,0x52,0x47,0x75,0xb7,0x1c,0xda,0xd,0xcd,0x41,0xf6,0xc3,0x19,0xfc,0x67,0x36,0xc3,0x19,0x9c,0x6d,0x34,0xfb,0x8e,0xde,0x32,0x73,0x8d,0xe6,0xc3,0x51,0x28,0x2d,0xbc,0xd8,0x4c,0x77,0xef,0x3d,0x9b,0xa6,0xec,0xdc,0x3f,0x6f,0xf4,0x59,0x2a,0x5b,0x76,0x2f,0xd6,0x8a,0x59,0xc8,0x36,0xf9,0xb0,0xd9,0x9e,0x44,0x9f,0xd,0xeb,0xfd,0xc9,0x1e,0xbd,0xbd,0xb,0x1,0xde,0x78,0xeb,0x69,0xbc,0x8e,0xae,0x94,0xb0,0xf0,0xa7,0xe8,0xd0,0x54,0x19,0xbf,0xe7,0x4b,0xdd,0x60,0x42,0x7d,0x8,0x5f,0x30,0x23,0x7a,0xb5,0xb2,0x6f,0xde,0xa2,0x67,0x82,0x70,0x92,0x8f,0x82,0xf1,0xef,0xe1,0x5c,0xda,0xf5,0xb9,0xb4,0xb6,0x30,0x7a,0x37,0x54,0x89,0xd9,0x96,0xcf,0x54,0xc1,0xe,0x25,0xfa,0xca,0xe4,0xa5,0xa0,0x27,0xea,0x5b,0x73,0xc7,0xa8,0x3e,0x6c,0x8f,0xdc,0xfa,0xe,0x96,0x27,0x92,0x8e,0x98,0x9a,0x12,0x7d,0x81,0x6f,0xb6,0xf6,0xd4,0x66,0x3b,0x3,0x2a,0x92,0xaf,0x9f,0x26,0x4a,0xa2,0xab,0xb,0xbb,0x11,0x70,0x78,0xe5,0x85,0x41,0x4f,0xe3,0xf9,0x26,0x63,0xef,0x5b,0xef,0x67,0xbe,0xc1,0x89,0xa5,0xf3,0xdb,0x3f,0x8a,0xb3,0x3,0xd6,0x8b,0xe6,0x56,0xc9,0xec,0xe,0x33,0x9d,0xcf,0x22,0x7c,0x3f,0xcb,0xf4,0x1b,0xfa,0x3d,0xeb,0x5a,0x3c,0x35,0xc6,0x74,0x51,0xaf,0x75,0x95,0xf2,0x95,0xe8,0xf5,0xc4,0x88,0x3e,0x9d,0x92,0x7c,0xe1,0xc2,0xb5,0x7f,0x4a,0xf1,0x7e,0xbd,0x39,0xdf,0x74,0x2f,0x2f,0x8b,0xaf,0x11,0xa8,0xd9,0xba,0xa8,0xdf,0x76,0x6,0x77,0x8b,0xc7,0x59,0xef,0x0,0xa7,0x25,0xb2,0x78,0x61,0x4d,0x8a,0x23,0xb2,0xf4,0x9d,0x8a,0x3e,0xf1,0xf0,0xda,0x4,0xf5,0xc8,0x98,0x4f,0x98,0xbe,0x51,0x71,0x8b,0x77,0x78,0xb2,0x41,0x70,0xc7,0xc8,0x21,0x62,0x95,0xe3,0x34,0x90,0x35,0xf1,0x40,0x47,0x83,0xd9,0xa1,0xa0,0xb3,0x74,0xc6,0xfa,0xe,0xe0,0x31,0xf4,0x5e,0x39,0x6,0xa3,0x63,0x62,0x97,0xee,0x8f,0x49,0x3e,0x57,0x90,0x1d,0x6c,0x9d,0xeb,0x5d,0x3,0xd7,0xb9,0x7e,0x33,0xe8,0xf4,0xbc,0xec,0x18,0xdf,0x3f,0xc1,0x17,0x2e,0xf1,0x5e,0x81,0xa1,0x60,0xf4,0x9e,0xe4,0xf5,0x31,0x98,0x47,0x87,0x82,0x6c,0x74,0xea,0xff,0xdd,0x79,0xeb,0x53,0x3b,0x86,0x17,0xc2,0xf6,0x4d,0xc5,0x5b,0xd7,0xcd,0xed,0xc1,0x4a,0x78,0x13,0xc1,0x9a,0x66,0x37,0xd7,0xc4,0x9f,0x25,0x59,0x92,0x55,0x59,0xec,0x7d,0x52,0x49,0x51,0xe7,0x24,0x45,0x9d,0xd3,0xed,0xc4,0x1,0xac,0x13,0x20,0xb7,0x75,0x6f,0x5c,0x70,0xa1,0x6f,0xe3,0xc5,0x7b,0x12,0xd8,0x93,0x92,0x7a,0x6b,0xd2,0x32,0x86,0x5a,0x87,0x17,0xd8,0x28,0xe1,0xb,0x29,0x62,0xaa,0x26,0x3a,0xb4,0x8d,0xbc,0x10,0x28,0x3f,0xd4,0x53,0x8f,0x7c,0xe1,0x22,0xd,0x49,0x1e,0x85,0xa3,0x14,0xdb,0xd5,0xb1,0x5b,0xbb,0x50,0xf4,0x9b,0x9b,0x6e,0x62,0x2d,0xc7,0xb2,0x87,0xa9,0xe2,0x33,0x29,0x92,0x6a,0xde,0x5a,0x43,0x97,0x54,0xd5,0x8d,0xf7,0x7d,0x7f,0x7c,0xfc,0x9a,0xb6,0x4e,0xb6,0x10,0xed,0x8d,0x74,0x7d,0xc0,0x89,0x39,0xcf,0x67,0xe9,0x64,0x6f,0xb4,0xca,0xa0,0xf6,0x53,0x73,0xdd,0x92,0x51,0xff,0x39,0xbe,0x5a,0xf7,0x23,0x9e,0xf4,0x1f,0x90,0x6a,0xba,0xfa,0x5e,0xab,0x85,0x3b,0x61,0x1c,0x15,0x9d,0xcf,0x23,0x49,0x5e,0x5f,0x57,0x45,0xf5,0x2a,0x3f,0x5e,0x59,0x74,0x54,0xc2,0x2b,0x78,0xf4,0x3d,0x1e,0xd1,0x3d,0x2d,0x72,0xf5,0x42,0xb4,0xe1,0x94,0x48,0xa6,0x54,0xfc,0xfe,0x74,0x44,0x16,0x92,0xc5,0x63,0xe4,0xd1,0x67,0x63,0x73,0xed,0x8d,0xbe,0xd,0x97,0x14,0x2b,0x25,0x82,0x63,0x96,0x99,0x44,0xa6,0x40,0x36,0x6b,0x3a,0x89,0x83,0x26,0x12,0x1f,0xd5,0xfd,0xed,0xe2,0xc5,0xca,0x16,0x39,0x74,0x16,0xde,0x69,0xe9,0xf6,0x99,0x9d,0xe4,0x2b,0x48,0x8f,0x9c,0xa6,0x39,0x1e,0xcd,0x9c,0xd6,0x84,0xfd,0x4,0x64,0x67,0xf7,0xf1,0x10,0xdf,0x9c,0x94,0x76,0x30,0xfe,0xfc,0xa6,0x51,0xef,0xb4,0x76,0x87,0x98,0xa1,0x7,0x86,0x20,0xe5,0x9,0xb6,0x88,0xd7,0xea,0x29,0xb6,0xb,0x37,0xaa,0x38,0xfe,0x19,0x79,0x39,0xf4,0x5f,0xbe,0x63,0x68,0x4d,0x91,0x4f,0xe7,0x1b,0x8b,0xdc,0xf6,0x37,0x16,0x69,0x6d,0x2e,0x72,0xd1,0xdb,0x58,0xa4,0xf9,0x79,0x63,0x91,0xde,0xed,0xc6,0x22,0xe7,0x9b,0x85,0xee,0xc6,0x3,0xa2,0x44,0xae,0xd0,0x8c,0x69,0x9b,0x14,0x23,0x5a,0x0,0x48,0xf1,0xa5,0xf1,0xf8,0xed,0xd0,0x2b,0x6a,0x2d,0x5c,0xbe,0x17,0xdf,0x96,0xc6,0x7c,0x2c,0x8b,0xb7,0xa5,0xe9,0xad,0x9e,0x9e,0x63,0x9,0x6e,0x99,0x77,0xf9,0x5d,0xb0,0x40,0xfa,0x92,0xd5,0xc5,0x2b,0x24,0x13,0xdc,0xae,0x5,0x26,0xd6,0x50,0x25,0xd1,0x79,0x4,0xf6,0xac,0xdf,0x31,0xb4,0xf0,0xe3,0x8b,0x4c,0xf4,0x0,0xc2,0x70,0x18,0xf2,0x32,0x73,0x42,0x72,0xd9,0xfc,0x2a,0x59,0x41,0x80,0x67,0xbb,0xa,0x16,0xf1,0x1a,0xc0,0x88,0x13,0x25,0x72,0xce,0xf4,0xed,0x95,0xa3,0xd0,0x45,0x83,0xfb,0x8c,0xb5,0xf,0xc4,0xb1,0x19,0xde,0x75,0x54,0x30,0x17,0xa8,0xc5,0xed,0xe0,0x45,0x20,0x33,0x6,0xb4,0x8d,0xb7,0xb9,0xff,0x57,0x73,0xa3,0xde,0x48,0xbf,0x7c,0xe2,0x2b,0x77,0x3a,0xbb,0x6c,0xf,0xd,0x31,0x36,0x29,0xf8,0x93,0x3e,0x18,0x5,0x28,0x9d,0xa2,0xd5,0x7c,0x37,0x27,0x52,0x3a,0x94,0x31,0xfe,0xb9,0xf5,0xb5,0x71,0xd3,0xdc,0xe1,0x20,0x8f,0x8,0x12,0x3c,0xdf,0x1c,0xff,0x7b,0x97,0x36,0x11,0xa2,0xf1,0x7d,0x7,0x16,0xc2,0x46,0x74,0x73,0x79,0x8f,0xdb,0x78,0x3,0x82,0x59,0xf2,0xa9,0xfc,0x7b,0x81,0x40,0xe4,0xa5,0x3f,0xff,0xf2,0x1f,0x47,0xa8,0x5,0xf1,0xea,0x32,0xa0,0xbd,0xb0,0xd8,0x7c,0x28,0x60,0xf,0xbe,0x76,0x31,0xfa,0xed,0xd5,0x7,0x3b,0x4,0x7c,0x81,0x28,0x39,0x79,0x9f,0x66,0x6e,0xe3,0xa,0xe2,0x8,0x2f,0xf4,0xb4,0xf3,0x41,0x10,0xff,0xe7,0xbf,0xe7,0xf3,0x42,0x18,0x8b,0xcf,0x6c,0x2e,0xc4,0x3d,0x18,0x7a,0x14,0xb4,0x35,0x88,0xdf,0xdb,0x96,0xe6,0x56,0x31,0xcf,0x91,0xfa,0x8c,0x71,0x59,0x22,0x49,0x38,0x9d,0x45,0x13,0x79,0xdb,0xbc,0x75,0x7d,0x44,0x94,0xe9,0x76,0x49,0x46,0xe8,0x13,0xe9,0xec,0x42,0x3d,0xdd,0xa,0xb4,0x4d,0xed,0xc3,0xf1,0x8c,0xad,0xe6,0xe,0xdd,0x62,0xab,0x49,0xf4,0x99,0xf7,0xa4,0x92,0xee,0xb4,0x7b,0x3c,0xe0,0x1e,0xb1,0x12,0x78,0x87,0x35,0x1e,0x79,0xaf,0x6f,0x40,0x25,0x8d,0xdf,0xaf,0x1a,0xb7,0xc5,0xd3,0x93,0xca,0x9,0x99,0x20,0x9a,0xd0,0x93,0x78,0x1c,0x7e,0x21,0x6a,0x4c,0xc7,0xa4,0xad,0x8b,0x41,0x9,0xcd,0x2d,0x9e,0xd7,0x8a,0x34,0x3c,0xa0,0x55,0x30,0x97,0xfb,0x90,0x4a,0xc1,0xdc,0x63,0xb7,0xf4,0xed,0x68,0x14,0x7f,0x7d,0xfc,0x72,0x47,0xcf,0x25,0x3a,0xde,0x59,0x10,0xf8,0xda,0x13,0x27,0xd7,0xaf,0x69,0x98,0x53,0xc0,0xa3,0xa3,0x67,0x76,0xb3,0xb0,0x31,0xbf,0x82,0xf9,0x5c,0x9f,0x16,0x2d,0x17,0x6e,0x61,0xae,0x82,0xcb,0x59,0xbe,0x28,0xbe,0x46,0x3a,0x6c,0xa4,0x48,0xbe,0x72,0x4,0xfd,0xa2,0xfb,0x2f,0x7f,0x2,0x1f,0xaf,0x1c,0xdb,0x6,0xf7,0x97,0x7f,0x7,0x9f,0xcf,0x71,0xdd,0x27,0xff,0x2b,0x7c,0x82,0x90,0xfd,0x11,0xc7,0x61,0xbe,0xf2,0xb,0x9e,0x89,0x8a,0xc4,0x6a,0x2f,0x5f,0xc4,0x9c,0xf5,0xa5,0x70,0xdf,0xd7,0x51,0xd2,0x5a,0x80,0xab,0xbb,0xab,0x9b,0x3f,0x76,0xe8,0x12,0xc,0x3d,0x9c,0xe9,0x26,0xc5,0xf7,0xc7,0x69,0xef,0x48,0x30,0xb7,0x23,0x90,0xfc,0x9f,0xe4,0x2b,0xe4,0x9f,0xfd,0x38,0xef,0x5c,0x4e,0x25,0xf,0x27,0x92,0xb9,0xba,0x6b,0x74,0xda,0x8d,0xcf,0xbb,0x44,0x51,0x13,0x4c,0x63,0x95,0xff,0x35,0x4,0x2a,0xe6,0x7e,0x5,0x7d,0xdb,0xeb,0xd2,0xe5,0x4d,0xfb,0x3c,0x44,0x7e,0xad,0x98,0xdd,0x5e,0xab,0xdf,0xdf,0x25,0x6e,0x9a,0x60,0x1a,0xdc,0xcc,0x1d,0x4,0x74,0xe9,0xb4,0x7d,0xfd,0x26,0xde,0x1,0xa1,0xd5,0x6b,0x75,0x5a,0xf5,0xfe,0x4e,0x47,0x6b,0x44,0x32,0xd,0x62,0xb3,0xb,0xa,0x28,0x9e,0x9a,0x6d,0x1f,0xc0,0x3d,0x5,0x6b,0x25,0xec,0x37,0x7a,0x37,0x9d,0xce,0x2e,0x31,0x33,0x14,0xc9,0xfb,0xed,0x69,0xfe,0xc1,0x84,0x72,0x2c,0x1a,0x5f,0xfb,0x41,0xf2,0x5d,0x2e,0x1d,0xb4,0x68,0x67,0xe4,0x36,0x28,0x90,0xeb,0xc8,0xbe,0x9d,0x11,0xdc,0x17,0x7f,0x54,0x3a,0xd4,0xd0,0xa5,0x1f,0x5f,0x66,0xff,0x19,0x82,0xee,0xff,0x8b,0x97,0xc8,0x7e,0xd6,0xdb,0xee,0xfe,0x59,0x7c,0x38,0x8d,0x13,0x9a,0xe2,0x8b,0x61,0xf1,0x3f,0xe,0x6c,0x46,0xb4,0xbe,0x99,0xe5,0x7f,0x3b,0x30,0x96,0x8f,0x37,0xb3,0xfc,0xdb,0x81,0xb1,0x7c,0x51,0xd9,0xcc,0xf3,0x45,0xe5,0xe4,0x60,0x12,0xa5,0xf5,0x69,0x92,0x99,0x76,0xf9,0x6e,0x6b,0xe,0xc2,0xd6,0xe0,0x5,0xb5,0x9,0x56,0x63,0x1a,0x37,0xd7,0x3,0x70,0x92,0x7,0x36,0x1e,0xfa,0x97,0xed,0x8b,0xc1,0xa1,0x59,0xc2,0xce,0xa1,0x71,0xf4,0xa5,0x7d,0xdd,0xbc,0xf9,0xd2,0x4f,0xd0,0xcb,0x9f,0x6e,0xdb,0x7,0x6d,0x3b,0x6e,0x60,0xd0,0x7c,0x37,0x1c,0x87,0x61,0x38,0xf4,0x7e,0xa1,0x3,0xd3,0xf4,0xab,0xd6,0xf5,0xed,0x81,0xb1,0xd4,0x84,0x7c,0x6c,0x9b,0x29,0xfa,0x4c,0x98,0xba,0xbc,0xb9,0x3a,0x34,0x96,0xda,0xd7,0xfd,0x56,0xef,0xd0,0x2c,0x67,0xb7,0xfe,0xa9,0x75,0xdb,0x3d,0x40,0xa6,0xc0,0x9e,0x5f,0x1f,0x18,0x5b,0x7,0x87,0xd3,0x1,0x62,0x84,0x6b,0x24,0x87,0xb6,0x95,0x5,0xd7,0x56,0xe,0x8c,0xa7,0x41,0xfd,0xfc,0xc0,0x38,0xda,0x6a,0xd3,0x5d,0x36,0x1c,0xf5,0x1b,0x87,0x16,0x8c,0x77,0xeb,0x8d,0xd6,0xc1,0xd9,0xca,0xdb,0x7e,0xb,0x23,0xde,0xf3,0x5e,0xab,0xfe,0xf9,0xc0,0x98,0x6b,0xd4,0xbb,0xfd,0xce,0x4d,0xe3,0xd0,0xd8,0xba,0xbe,0xbd,0x3a,0x40,0xae,0xba,0xbd,0xf6,0xf5,0xa0,0xdf,0xe8,0xb5,0x5a,0x87,0x66,0xd4,0xcd,0xec,0xf1,0x4e,0x21,0x7b,0x8b,0xdc,0xe9,0x3a,0xf4,0x2,0xfa,0x7d,0x86,0xf7,0x30,0x92,0x27,0x18,0x63,0x77,0x9,0xe6,0x1f,0xb1,0xd8,0x6f,0x87,0x67,0x1e,0xee,0xea,0x7d,0xc8,0xfd,0xda,0x7f,0x1e,0x20,0x67,0x87,0x98,0x95,0x22,0x5f,0x57,0xed,0xeb,0xdb,0xfe,0x1,0xf2,0xd5,0xbc,0x19,0x1c,0x20,0x57,0xdd,0xce,0xe,0xc1,0xda,0xa5,0x31,0xad,0x96,0xa5,0x39,0x1e,0x6f,0xe1,0x79,0xb5,0x8c,0xc7,0xd4,0x2f,0x3e,0x18,0x71,0xae,0xd8,0x2a,0x4b,0x55,0x4a,0x26,0x82,0x8d,0x3e,0xe6,0xf0,0xbc,0x6f,0x79,0x56,0x2e,0x8f,0x1d,0x35,0x9,0x87,0x25,0x8b,0x7b,0x65,0xbd,0x7b,0x74,0x12,0x4e,0x7c,0xc5,0xac,0x49,0xf9,0x8b,0x73,0xe1,0xe0,0x6d,0xbb,0x39,0x62,0x4e,0x8f,0xff,0x98,0xbb,0x1b,0xba,0xd4,0xbf,0xcf,0xd5,0x6e,0x84,0x33,0x76,0x7c,0x5c,0x6e,0xe4,0xa1,0xb0,0x58,0xb5,0x4c,0x9f,0xf1,0x37,0x14,0x35,0xfd,0x5f,0xf2,0xc6,0x9b,0x4c,0x30,0xeb,0xfe,0xd7,0x4a,0x79,0xbe,0xc9,0xab,0xf8,0x32,0xb,0xd,0xec,0x35,0x6a,0xd3,0x0,0xef,0xb3,0xc0,0xbd,0x7b,0x6a,0x69,0x7b,0xd8,0x1a,0x96,0x90,0xa3,0xe7,0xc,0xe9,0xdd,0x4b,0xf8,0xca,0x36,0x9e,0x82,0x1,0x80,0xe6,0x6a,0xf1,0x26,0xa4,0x67,0x65,0x1b,0x3c,0x98,0x9a,0xfd,0x68,0x79,0xeb,0x88,0x9c,0x1c,0x9f,0x54,0x48,0x3f,0x6,0x8c,0xc,0x0,0x31,0x9f,0xbb,0x7c,0xec,0x30,0x59,0xdd,0x2c,0xf7,0xc,0x69,0x14,0xfd,0xb9,0x74,0x4b,0x5f,0x2f,0xcb,0x52,0x2d,0x2f,0x75,0x2b,0x80,0x6c,0x94,0xa,0x9c,0xa9,0xf2,0x5c,0xf8,0xf0,0xbf,0x26,0x2,0x2d,0x11,0xd3,0xba,0x0,0x0 };
 
 const uint8_t index_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0xb5,0x5a,0xdb,0x6e,0xdb,0xc8,0x19,0xbe,0x37,0xe0,0x77,0x98,0x10,0xdb,0x35,0x99,0x28,0x92,0xbd,0xe8,0x45,0x61,0x39,0xe,0xb2,0xb1,0x8d,0x26,0x88,0x37,0x8b,0xc8,0xe9,0xa2,0x68,0x16,0x32,0x4d,0x8e,0x2c,0xc6,0x14,0xa9,0xe5,0x21,0x8a,0x9b,0xf5,0x5d,0xdf,0xa0,0xf,0xd0,0x57,0xec,0x23,0xf4,0xfb,0xe7,0x40,0xce,0x90,0xa3,0x83,0x17,0xe8,0x2,0xce,0x4a,0x9c,0xff,0x3c,0xff,0x99,0x1a,0x3d,0xdd,0xdf,0x63,0x8c,0x5d,0xcd,0x93,0x92,0x95,0xf9,0xac,0x5a,0x85,0x5,0x67,0xf8,0x9c,0x26,0x11,0xcf,0x4a,0x1e,0xb3,0x3a,0x8b,0x79,0xc1,0xaa,0x39,0x67,0x97,0x6f,0xae,0xd8,0x3b,0xf9,0x78,0xc8,0x26,0x9c,0x8b,0x87,0xa,0x8e,0xcd,0x92,0x14,0xff,0xe4,0x5,0x8b,0x79,0x15,0x26,0x69,0x39,0x14,0x64,0x27,0x79,0x5d,0x44,0xfc,0x98,0xcd,0xab,0x6a,0x59,0x1e,0x8f,0x46,0xb7,0x49,0x35,0xaf,0x6f,0x86,0x51,0xbe,0x18,0x95,0xcb,0x30,0xe2,0xf3,0x7a,0x9e,0x55,0x3c,0x9a,0x8f,0x7e,0x49,0x2e,0x92,0xb3,0x3a,0xba,0xdb,0xdf,0x13,0x78,0x97,0x79,0x9c,0xcc,0x12,0x70,0xf,0x33,0xfc,0xc5,0xe1,0xb2,0xc2,0xe7,0x9b,0xfb,0x63,0x71,0xc8,0x9e,0xb3,0x33,0x5e,0xf0,0xe8,0xee,0x2f,0x47,0xf8,0xfe,0x74,0xb4,0xbf,0x37,0x1a,0xb1,0x17,0xf4,0x1f,0xbb,0x20,0x29,0x2e,0xc3,0x2c,0xbc,0x85,0xcc,0xfe,0xe4,0xe7,0x37,0x17,0x17,0x93,0x40,0x9e,0xed,0xef,0x45,0x69,0x58,0x96,0x2,0x44,0x43,0x7c,0x23,0x7a,0x51,0x9e,0x95,0x55,0x51,0x47,0x55,0x5e,0xf8,0x81,0x7c,0xc4,0xa0,0x5a,0x52,0xe,0x49,0xa7,0x77,0x49,0x59,0xb1,0x17,0xcc,0xf3,0xc6,0x74,0xf0,0x40,0xff,0xd0,0x5f,0xbd,0x8c,0xc3,0x4a,0x1c,0xb6,0x38,0xab,0x72,0x5a,0xf2,0x2c,0xf6,0xbd,0x5,0x5f,0x78,0x3,0xe6,0x2f,0xca,0x5b,0xf0,0x3e,0xd5,0xc7,0x8a,0x13,0x2c,0x96,0xf1,0x12,0x24,0x71,0x3c,0x2c,0x97,0x69,0x52,0xf9,0xa3,0x4f,0xd9,0x28,0x18,0x6b,0xa8,0x64,0xe6,0xb,0x90,0x61,0xca,0xb3,0xdb,0x6a,0x4e,0xd2,0xb3,0xa3,0xa0,0xa5,0x22,0xe9,0xe4,0x29,0x1f,0xf2,0xa2,0x80,0xcc,0xde,0x65,0x98,0xc2,0xf0,0xb,0x58,0xa8,0xe0,0xe5,0x12,0x67,0xfc,0x18,0xec,0x89,0xfb,0xb8,0xc5,0x29,0x78,0x55,0x17,0x59,0xf3,0xe0,0x41,0x19,0xba,0x91,0xea,0xe6,0xbe,0xe2,0x10,0x4a,0x70,0xfe,0xc7,0xe1,0xaf,0x4a,0x32,0x8f,0x79,0x1,0xbe,0x8d,0x6d,0xd8,0x9a,0xfc,0x42,0xc3,0x1e,0x6d,0x86,0x9d,0x15,0xbc,0xa5,0xfb,0xc3,0x66,0xd8,0x25,0x87,0xb3,0x64,0x64,0xee,0xcb,0xb0,0x9a,0xf,0x67,0x69,0xe,0xf5,0x84,0x60,0x23,0x76,0x74,0x78,0x18,0x38,0x48,0x3b,0x51,0x4,0xcf,0x91,0x26,0x47,0x68,0x1a,0xf1,0xdc,0xf7,0xe8,0xf0,0x92,0x2f,0xf2,0xe2,0xde,0xb,0x86,0x49,0x96,0xf1,0xe2,0xaf,0x57,0x97,0xef,0x40,0xe0,0xfa,0xbb,0x6f,0xa4,0xd8,0x83,0x34,0x85,0xd0,0xd1,0xff,0xee,0x9b,0xc1,0xe4,0xe1,0x4f,0x82,0x65,0x70,0xdd,0xc8,0xe1,0xf4,0x12,0x7d,0xd8,0xb8,0x43,0x5a,0x92,0x37,0x44,0xe5,0x17,0xdb,0x1b,0xba,0xe8,0xcf,0x5e,0x30,0xc0,0x8c,0x3b,0xc7,0x5,0xa7,0xf8,0xbb,0xa,0x6f,0x52,0xee,0xb7,0x6,0x78,0xd0,0x1f,0xd5,0x87,0xc6,0x2f,0x2d,0x70,0xcd,0xcb,0xf6,0x3b,0x8b,0xab,0xc3,0x3,0x53,0x5e,0x21,0x5e,0x17,0x29,0xe9,0x73,0x82,0x10,0xf,0xe3,0xd3,0x93,0xaa,0xc0,0xdf,0xfc,0x94,0x62,0xe7,0x64,0x84,0xf,0xf4,0x65,0x92,0xfc,0xb3,0xfd,0xf2,0x2a,0xaa,0x12,0x70,0x91,0xdf,0x47,0x4,0x3e,0xd2,0xa8,0x37,0x79,0x7c,0x7f,0xda,0x1a,0x46,0xfa,0x36,0x1c,0xf6,0x3c,0x8c,0xe6,0xbe,0x70,0xf5,0x1,0x4b,0x5c,0x81,0x82,0x8,0xb,0x95,0xeb,0x18,0x6e,0xd3,0x75,0x2,0x88,0xf4,0x53,0xb8,0x20,0x1f,0x23,0x78,0x87,0x3,0x2,0x80,0x44,0x5,0xc0,0xc7,0x8a,0x12,0x13,0xc5,0x4a,0x58,0xfd,0x88,0x4b,0x2e,0xfd,0x65,0x58,0x94,0xfc,0x4d,0x56,0xf9,0x2,0xf7,0xe8,0xd7,0xc0,0x74,0x96,0x64,0xc6,0x7c,0x4d,0x5e,0x7,0xe3,0x29,0x3b,0xb4,0x42,0x91,0x60,0x12,0x11,0xa2,0x87,0xec,0xfb,0xef,0xd9,0x93,0xf3,0x38,0x41,0x1e,0x11,0xe6,0x7d,0xbf,0xe4,0x19,0x8f,0x3,0x7d,0x8d,0x61,0xdc,0x10,0x33,0xe3,0x52,0x58,0x1a,0x57,0x7f,0x2d,0x6d,0xc,0x83,0x21,0x31,0x66,0x4c,0xe4,0xaa,0x17,0x7,0x84,0xf1,0x3c,0x81,0x22,0x7,0xa7,0xff,0xfd,0xcf,0xbf,0xff,0x75,0x42,0x59,0x33,0x3b,0x65,0x70,0x4b,0x45,0xea,0x1,0x76,0x8e,0x5,0x9e,0x7c,0x46,0x9a,0xb6,0xcf,0xae,0x9d,0x8c,0x6e,0xea,0xaa,0xca,0x35,0xb,0x2f,0xe,0x33,0xa4,0x42,0x8f,0xe5,0x59,0x84,0x5c,0x7e,0x87,0x7,0x1c,0x1e,0xc0,0xa7,0xfe,0x81,0xc1,0xe5,0x20,0xf0,0x4e,0xe5,0xf3,0x93,0x91,0x44,0x3f,0x65,0xd7,0xdb,0x69,0x2f,0x8b,0x64,0x11,0x22,0xd0,0x5a,0xe2,0xc2,0xe,0x5d,0xca,0x1c,0x46,0x33,0xe8,0x8e,0xff,0x8,0xe1,0xb0,0x86,0xdd,0xeb,0xac,0x47,0xbb,0x84,0x37,0xab,0xb3,0xc7,0xb1,0x40,0x21,0xcc,0x4c,0xc1,0x1d,0xb4,0x4d,0x9a,0xd2,0xe6,0xe4,0xf9,0xd7,0x66,0x92,0xb5,0x82,0x55,0xb3,0xf2,0x0,0xd7,0x44,0x85,0x4a,0x4b,0x65,0x54,0x24,0xcb,0x4a,0x4,0x6e,0x27,0x2f,0x11,0x56,0x37,0xc8,0x4d,0x67,0xd2,0xee,0xa8,0x5c,0x2f,0xaa,0xb,0x24,0x81,0x6a,0x82,0xcf,0xa8,0x71,0x14,0xc4,0xb2,0xc,0x6a,0x5e,0x6d,0x90,0x7f,0xa6,0x6c,0x30,0xb,0xd3,0x92,0x5b,0x47,0x96,0xdb,0x57,0xf9,0xbb,0x7c,0xc5,0x8b,0xd7,0x61,0x89,0x7c,0x32,0x44,0x72,0x29,0x7f,0x41,0x9,0xf7,0xbd,0xe1,0xe7,0xd2,0xb,0x2,0x49,0x2,0xc5,0xd3,0xa6,0xa0,0x24,0x91,0x35,0x52,0xb6,0x0,0x1f,0xdf,0xf8,0x5a,0x8e,0x1,0xb0,0x2,0xb,0x5e,0x44,0x48,0x59,0xe5,0xcb,0x5e,0x84,0xd0,0x43,0x84,0x27,0x2f,0x96,0xa8,0x5f,0xbc,0xf0,0x6d,0x3c,0x23,0xf6,0x67,0xc9,0xd7,0xb,0xf5,0xad,0x47,0xa4,0x55,0xb,0x8c,0xdb,0xe0,0x85,0xd1,0xb9,0x10,0x94,0x10,0xdf,0x4e,0x60,0xf5,0x2f,0x61,0x5a,0x4b,0x62,0x92,0xc0,0xb8,0x7,0x6a,0x81,0x79,0xda,0xa4,0xf,0x8c,0xc3,0x88,0x6b,0x28,0xef,0x44,0xd7,0x49,0xd5,0x94,0x5e,0x17,0x93,0x6b,0xb4,0x2a,0x3c,0x5c,0x30,0xcf,0x70,0x45,0xef,0x7a,0xc0,0xd2,0xfc,0x76,0xba,0x6a,0xcc,0xda,0xa4,0x9c,0x89,0x80,0xf6,0xbb,0x6,0xd7,0xb6,0xe8,0x65,0xab,0xb7,0x13,0xfb,0x3e,0x85,0x5e,0x3d,0x28,0x13,0xc6,0x72,0xca,0x86,0x9d,0x76,0xac,0x7e,0x6f,0x44,0x60,0xa2,0x1c,0xe6,0xb8,0x56,0x14,0x67,0x2b,0xef,0x93,0x5c,0xea,0x80,0x3d,0x41,0x4e,0xf5,0x4e,0xd9,0xf9,0x4f,0x67,0x5e,0x2f,0xe3,0xa,0xd9,0x1d,0x77,0x42,0x25,0x54,0xa2,0x1b,0x1,0x2e,0x75,0xe8,0x59,0xda,0x9,0xbb,0xde,0x70,0xd2,0x1b,0xc3,0xaa,0x2e,0xa5,0xe,0x49,0x76,0x3b,0x1c,0xe,0x8d,0x72,0xd4,0x75,0x2,0x43,0xe7,0x28,0xcd,0x4b,0xee,0x75,0x2f,0x49,0x81,0xc8,0x28,0x99,0x2a,0xda,0xc1,0x9a,0xe4,0xd1,0x98,0x39,0x2,0xf3,0x8a,0xf7,0xa3,0x5f,0x16,0x3b,0xa8,0x96,0x10,0xb9,0x58,0x85,0x85,0xac,0x78,0x49,0xf9,0x37,0x7a,0x6e,0x5,0xc7,0xa0,0xc9,0xb,0x9a,0x25,0x19,0xf6,0x89,0x45,0x20,0x68,0xbb,0xc6,0x6d,0x81,0x4a,0xc8,0x76,0x63,0x91,0x20,0x73,0xd6,0x31,0x6a,0x6c,0x13,0xa5,0xcf,0x18,0xd5,0x6f,0xe3,0x32,0xd7,0x57,0xc6,0xff,0x4f,0x44,0x19,0x61,0x24,0xcd,0xb8,0x25,0x8c,0x4,0xb9,0x8c,0xaf,0x3a,0x4c,0xbd,0x91,0x67,0x77,0x80,0xe6,0x30,0x60,0x6,0x6f,0x73,0x69,0xab,0x22,0xa9,0x4c,0xd3,0x37,0xce,0xff,0x6d,0x9b,0x5d,0x77,0x4c,0x71,0x5a,0xaf,0x83,0x2,0x9d,0xed,0x17,0xe8,0x35,0xaa,0xf8,0x62,0x89,0xa,0x50,0xdc,0x4f,0x65,0x65,0xf1,0xe,0xba,0xda,0x35,0x38,0xda,0x16,0x8f,0xc1,0xd1,0x69,0x68,0xb,0x8e,0xe9,0x9b,0xcb,0xbb,0xaa,0x94,0x7d,0xd8,0xd1,0xe1,0xf,0x7f,0xd6,0xfa,0x61,0x62,0xf4,0xa9,0x18,0xa1,0x89,0x62,0x87,0x63,0xfc,0xef,0x44,0x76,0xf2,0x11,0x4f,0x52,0x9d,0xb,0x74,0xf3,0x35,0xd2,0x34,0x2,0x0,0x3e,0x7b,0x16,0x74,0x1b,0xc6,0x1b,0x7e,0x9b,0x64,0xa0,0x93,0xb0,0xa7,0x1a,0xb2,0xd3,0xc,0x42,0x76,0x3d,0x2a,0x2c,0x92,0xcc,0x97,0x8,0xcf,0x34,0x70,0x73,0x31,0x8a,0x61,0xd0,0xf5,0x9b,0x69,0x11,0xae,0x1a,0xa1,0xca,0xfa,0x6,0x56,0x40,0x1e,0x90,0x64,0x6,0x44,0x3c,0x40,0x66,0x13,0x29,0x4d,0xa7,0x8a,0x32,0xfc,0xa2,0x33,0x85,0xe1,0x1a,0x9d,0x9c,0xe8,0xce,0xf,0x8d,0xaf,0xea,0x3b,0xdd,0xe8,0xab,0x6,0x74,0x46,0xfe,0xe2,0xb8,0x99,0xed,0x14,0x5c,0xb9,0xc8,0x48,0xf0,0x24,0x46,0x3f,0xf3,0x3c,0xbe,0x7a,0x3b,0x35,0x73,0x38,0xf7,0xba,0xca,0xe6,0x88,0x37,0xdd,0x72,0x64,0x30,0x38,0x8f,0x5f,0xcf,0xa9,0xa9,0x8d,0xed,0x5a,0xe6,0x4,0xb1,0xb,0x9e,0xba,0x1a,0xd9,0xe9,0xf6,0x35,0x55,0xe5,0x69,0x96,0x14,0xb,0xff,0xfa,0x4c,0x0,0x99,0xad,0xf8,0xcb,0xeb,0x20,0xe8,0x59,0xa9,0x63,0x43,0x74,0x91,0x4e,0xb2,0xbb,0x36,0x5c,0x8d,0xc7,0x87,0x29,0x2f,0x30,0x10,0x5d,0xe5,0x44,0x93,0x85,0xc,0x8a,0x10,0x8d,0x1,0xbb,0xcf,0x6b,0x7c,0x2a,0xe0,0xec,0x73,0xe8,0xc9,0xaa,0x5c,0x54,0x66,0xb1,0xab,0x11,0x3b,0x1a,0xda,0xa8,0xe0,0x4b,0xc6,0x70,0x29,0x58,0x87,0xd0,0x73,0xa2,0xa0,0x9a,0x5f,0x84,0x3,0x3d,0x1,0x35,0xe3,0xe2,0xcc,0x32,0x67,0xed,0x11,0x7a,0xae,0x7c,0x4d,0xa4,0x1e,0x71,0x9d,0xf0,0xb4,0xa2,0x52,0xfe,0x36,0x4d,0x88,0x23,0x92,0x6c,0xd7,0xf1,0x6c,0xdf,0xea,0x76,0x14,0xd7,0x74,0xbc,0xb,0xcf,0x81,0xb8,0x67,0x7,0xed,0x57,0x69,0xea,0x58,0xe2,0xd0,0x89,0xb7,0x11,0x57,0xe,0x92,0xbe,0xd3,0x3d,0xbc,0xb,0x71,0xc8,0x64,0x8d,0x7d,0x29,0xf7,0x6b,0xab,0x24,0x4d,0x95,0x73,0xe1,0xfe,0x52,0x26,0xe3,0xb2,0x7c,0x62,0x5d,0x6c,0x23,0x80,0x24,0xef,0x68,0x1b,0xd4,0xd5,0x4b,0xe,0x15,0xd2,0x8b,0x24,0x5c,0x85,0x77,0x20,0xcb,0x90,0xd7,0xea,0x8a,0xf,0x3f,0x65,0x7f,0x87,0x23,0xb4,0x2e,0x0,0xc1,0x32,0x1e,0x61,0x16,0x9a,0xc1,0xc8,0x98,0x6d,0xe2,0xb2,0xbd,0xd5,0x7,0xc3,0xf7,0xf5,0x1c,0xb5,0xd1,0xf9,0xbd,0xf,0x75,0x26,0x42,0x51,0xa9,0x20,0xb0,0x20,0x4c,0x12,0x41,0xad,0x7b,0xc,0x4d,0xf2,0x62,0xeb,0xe5,0x4b,0x29,0x46,0x84,0x89,0x36,0x4e,0x4a,0x1a,0x6e,0x58,0x52,0x69,0x27,0xc3,0x68,0x46,0xd2,0x93,0x20,0x41,0xaf,0x40,0x1b,0x73,0xdb,0xee,0xe,0x5,0x1d,0x84,0x1a,0x32,0xd9,0x13,0x2,0x75,0xa2,0xa8,0xe0,0xe6,0xd6,0xcf,0x97,0x85,0x49,0xad,0xb2,0x64,0xc6,0x23,0x92,0xd3,0x54,0x2e,0x71,0x64,0x2,0x17,0xc8,0xdd,0x4c,0x23,0x71,0x44,0x3c,0x1,0x2e,0x13,0xe6,0x69,0x60,0x45,0x23,0x93,0xa9,0x98,0x97,0x90,0xaa,0xb2,0xf6,0x61,0x55,0x17,0x67,0x43,0xab,0x6c,0xe8,0xa2,0x2c,0x72,0x8a,0xd,0xad,0xc6,0x74,0x7,0xb8,0x4a,0x5f,0x1d,0xe2,0x75,0xe6,0xa2,0x8c,0x9b,0xb6,0xe1,0x44,0x34,0xf5,0x1,0x45,0xc,0xf6,0x21,0x11,0x3a,0x1d,0x8b,0x35,0x1,0xd5,0xc0,0x49,0x3f,0xee,0x80,0xe9,0xd8,0x69,0xa0,0xf4,0x5d,0xf7,0x59,0x6b,0x8f,0xd4,0xdc,0xf7,0xf7,0xa8,0x5f,0x30,0x6f,0x4c,0xad,0xdd,0xde,0xdf,0x7c,0x86,0x87,0x43,0xfd,0x19,0x36,0x46,0x3f,0x17,0x39,0xd6,0x76,0xd5,0xbd,0xbf,0x4a,0xb2,0x38,0x5f,0xd,0xd8,0x41,0x83,0x81,0xe,0x45,0xf8,0xf4,0x2d,0xaf,0x8e,0x6d,0xa1,0x54,0xef,0xa,0x2f,0x92,0x8c,0x9a,0xbd,0xb2,0xac,0x1d,0xf6,0x22,0x59,0x3e,0xdb,0x71,0x95,0xdc,0x2b,0x4c,0xe6,0xdc,0xdd,0x34,0xce,0xcd,0x78,0xd5,0x3b,0x75,0x54,0xad,0xd,0x14,0xdc,0xe7,0xdb,0x36,0x3,0xe,0x20,0x41,0xc8,0x2,0x53,0x69,0xa2,0x33,0xdb,0x97,0x12,0x7c,0xc0,0x1c,0xa3,0x9f,0x1e,0xd8,0xd6,0x91,0x57,0xb8,0xe6,0xc4,0xe9,0x16,0xd7,0x6,0x34,0x5b,0x4b,0xd2,0xfc,0x4d,0xb6,0xac,0xc9,0x19,0x20,0xc1,0xcb,0xfe,0x6c,0xcf,0x8e,0xbb,0x33,0xc4,0xd8,0x24,0x70,0x13,0xc6,0x82,0x85,0x46,0x56,0xac,0x7e,0xa4,0xc7,0x2d,0xba,0xf9,0xd4,0x6b,0xdb,0x5b,0x52,0x50,0x10,0xb0,0xe6,0x54,0xf1,0x44,0x2e,0x72,0xae,0xf8,0xd7,0xaa,0x27,0x7f,0xb,0x23,0xdc,0x49,0x35,0xf9,0xa5,0xd6,0xf6,0x45,0x6b,0x77,0x88,0xe4,0x9,0xc8,0xe7,0xe5,0x32,0x99,0xcd,0x4a,0xf,0xd2,0xe8,0x7,0x71,0x84,0x54,0xee,0xdc,0x18,0x90,0x54,0x36,0xb5,0xb3,0xd7,0xaf,0x3e,0x9c,0x79,0xb4,0xa6,0x6c,0xec,0x65,0x49,0xdc,0x3c,0xb5,0xc6,0x2b,0xe3,0x9,0x12,0xd1,0x32,0xc5,0x5b,0x1b,0xac,0x8b,0xf1,0x2a,0x7,0x21,0x75,0xe0,0x1e,0x77,0x10,0x58,0x64,0x63,0xa,0x58,0x7f,0x83,0x43,0xc8,0x56,0x62,0xdd,0x1e,0x66,0xac,0xf4,0x70,0x41,0xd9,0x30,0xca,0x25,0x4b,0x83,0x6b,0x26,0xc6,0xac,0xd,0xbc,0xd7,0x2f,0x7f,0x8,0x55,0xf3,0xb6,0x57,0x7,0x9d,0x31,0xb0,0x5,0x54,0x2,0x40,0xed,0xd7,0x72,0x36,0x70,0x69,0x4d,0x49,0x4b,0xef,0x36,0xba,0x5e,0x6a,0x8,0x70,0xdc,0x1f,0x61,0xcd,0xf9,0x5c,0xf,0x1f,0x6d,0x63,0xf8,0x29,0xa3,0xf6,0x41,0x53,0xa6,0xed,0x22,0x9e,0x8c,0x2d,0xdb,0x99,0x7b,0xe,0x5d,0xe6,0x97,0x4b,0x2a,0xb3,0xc8,0x56,0xbb,0x99,0xc9,0x5e,0xb2,0x0,0xcd,0x6d,0x22,0x27,0x50,0xdb,0x6c,0x21,0x85,0xf9,0x68,0xc,0x60,0x28,0xb2,0x5f,0x9d,0xa6,0x3d,0xe6,0x66,0x50,0x62,0x79,0x40,0x70,0xa,0xe1,0xf7,0xdf,0x49,0x24,0x58,0xcd,0x9d,0x47,0x8e,0x5d,0xcf,0xed,0x20,0xc7,0xf0,0xa6,0xa2,0x4c,0x80,0xda,0x5e,0xda,0x9d,0x56,0xb7,0x6f,0x52,0x14,0xb9,0x81,0x90,0xb3,0xbf,0x5f,0xdb,0xb2,0x4a,0x91,0x16,0x16,0xef,0xc,0x2c,0xc0,0xc7,0xe,0x0,0xef,0x33,0x34,0x5c,0x33,0xd1,0xe9,0xac,0x0,0x27,0x1a,0x2b,0x80,0x32,0xa4,0x1c,0xbc,0x97,0xc5,0x3b,0x19,0x46,0x2f,0x74,0xd1,0x96,0x81,0x68,0xbc,0xbd,0x91,0x97,0xc3,0x9c,0x61,0x19,0x4b,0xb8,0xfe,0xea,0x96,0xd4,0x90,0xf7,0x64,0xa4,0x98,0x40,0x2e,0x3c,0xa6,0x65,0x2c,0x1a,0x2b,0xdf,0x65,0xee,0x41,0x73,0x9,0x6d,0xcc,0x34,0x23,0xb2,0x70,0x2a,0x59,0x93,0xe5,0xea,0xe4,0x51,0x14,0xd6,0xec,0x7b,0x77,0xa9,0xa3,0xc6,0x2,0x29,0xc9,0x66,0xb9,0xf0,0x7a,0xeb,0x1d,0xa1,0xc0,0xa6,0xf7,0x82,0xa4,0xf4,0x43,0xf3,0x2a,0xb0,0xbb,0xaf,0xda,0x5e,0xf3,0x3b,0x9c,0x76,0xe5,0x63,0x84,0x30,0x7a,0xa2,0xd7,0xd2,0xdb,0xbb,0x6f,0xfa,0x8c,0xa5,0x51,0xcf,0x70,0xd6,0xb6,0xaf,0x6d,0xf2,0x1d,0xde,0xe9,0xd0,0xa1,0xef,0x7e,0xd4,0xdd,0x2f,0x6a,0xea,0x6,0xc5,0xa4,0xa1,0x87,0xcc,0x48,0xc0,0x97,0xd8,0xc8,0xa0,0xd1,0x13,0x3,0x66,0x86,0x4e,0x7f,0xab,0xf7,0x35,0x6c,0xbb,0xb5,0xdf,0x72,0xae,0x46,0x6,0xb4,0xfe,0x62,0x14,0x21,0xda,0x78,0x35,0x9b,0x2f,0xd8,0xe4,0xc,0xa5,0x11,0xb,0x9d,0xfe,0x9b,0x36,0x88,0x40,0xfe,0x28,0xe7,0x95,0xad,0xfb,0x46,0x7,0x65,0x51,0x8b,0x37,0x50,0xef,0xd3,0xb4,0x72,0x1f,0x5e,0x57,0xdd,0x7d,0x94,0xc6,0xdc,0x54,0x13,0xb7,0x7a,0xab,0xb1,0xd0,0xd8,0xe6,0xac,0x9e,0x42,0xd7,0xb7,0xd1,0xb4,0x9,0xbb,0xf8,0xea,0x7a,0x3e,0xbb,0x72,0xe9,0xf,0x64,0xba,0x8b,0x16,0x13,0x99,0xd5,0x3e,0x5b,0x33,0x19,0xdc,0x75,0x2a,0xd9,0x89,0xf4,0x91,0x49,0x4f,0xb6,0xac,0x86,0x96,0x5d,0xad,0x73,0x5c,0x59,0x5c,0xcd,0x27,0x6e,0x32,0xfd,0xd6,0xa0,0x25,0xe6,0x6a,0x21,0xd6,0x48,0xd6,0x96,0xf2,0xf5,0x82,0x19,0x79,0xc9,0x20,0x22,0x4b,0x2f,0x21,0xf6,0xaa,0x6f,0x8b,0x6d,0xd7,0x67,0x4b,0xad,0x50,0xce,0x88,0xb2,0x2c,0xae,0xd5,0xa4,0x2d,0xb5,0x5d,0x2,0x14,0x9,0x2a,0xbe,0x5a,0x3a,0x26,0xae,0x91,0x58,0xd4,0x61,0x33,0x75,0xa9,0xbb,0x9e,0x46,0xbd,0x9c,0xe6,0x38,0x9d,0x5a,0x2f,0x18,0x8d,0xb1,0x2d,0xef,0x8e,0x39,0x9d,0x93,0x2e,0xe2,0x96,0xc1,0xae,0xc3,0xd6,0x31,0xde,0x39,0x57,0x7f,0x3,0xd5,0x34,0x2,0x8,0x45,0x6e,0x3d,0x1c,0x44,0xc1,0xb9,0x9a,0x9,0x77,0x99,0x31,0xa5,0x12,0xeb,0xc5,0x68,0xe7,0xb4,0xf5,0x22,0x58,0xd3,0x60,0xcb,0xfe,0xb1,0xb6,0x80,0x25,0x77,0x35,0xc7,0xdb,0xc9,0xae,0x6,0x11,0x79,0xe8,0x8f,0x98,0x64,0xa3,0x34,0xe6,0xf4,0xba,0x8b,0x5d,0x3a,0x52,0xec,0xef,0xcd,0xea,0x4c,0xfc,0x8,0x85,0x76,0x48,0x6a,0xdb,0x85,0x5c,0xab,0x52,0xaa,0x73,0x9d,0xb3,0x76,0xe7,0xbd,0x7e,0x2d,0x29,0xb2,0x99,0xd4,0x6d,0x18,0xc6,0xf1,0xf9,0x17,0x44,0x9,0xd1,0x83,0x44,0xf8,0x25,0x56,0x9a,0x8b,0x97,0x9b,0x5a,0x12,0xcd,0xfc,0x9c,0x5e,0x19,0x2a,0x91,0x90,0x3d,0xd5,0x6f,0xa,0x20,0xfe,0x8a,0xa8,0x27,0xb2,0x31,0x6f,0x7e,0x3,0x50,0x7e,0xe0,0x82,0x8e,0x9,0xd8,0x5d,0x53,0x69,0xc,0xb5,0x23,0x34,0x41,0xe5,0xa3,0x86,0x24,0x6d,0x31,0xcd,0x63,0xb5,0x9f,0x19,0xeb,0xba,0x74,0x2e,0xde,0x51,0xf0,0x89,0x9c,0x2c,0x4d,0x48,0xf5,0x22,0x83,0x12,0x89,0xfd,0xaa,0x50,0xa3,0xc8,0xd9,0x73,0x2d,0x8a,0x2a,0xd7,0xaa,0xa7,0x68,0x4a,0xc8,0x59,0xbe,0xca,0x7a,0xfa,0x49,0xc4,0x58,0x1d,0x4d,0xab,0xaf,0x95,0xef,0xa8,0x2,0x3e,0x7a,0xbe,0x7e,0xa,0xf6,0x83,0x46,0x2c,0x79,0x30,0xe9,0xea,0xac,0x5f,0xc9,0x60,0x85,0xe5,0xa4,0x1a,0x58,0xd6,0x0,0xd8,0x7a,0xd5,0x70,0x88,0x36,0xc2,0xef,0x69,0x85,0x5e,0xc1,0x1,0x6e,0xa4,0xda,0x3e,0x8a,0x80,0xbf,0xe3,0xf7,0xf5,0xb2,0x81,0x57,0x4e,0x6e,0xf6,0xa,0x1a,0x8d,0x1a,0x84,0xd6,0x45,0x26,0x67,0xda,0x49,0x2,0xd6,0xf9,0x9,0x89,0x71,0x66,0xc8,0x53,0x88,0x47,0xd4,0x1,0x29,0xf7,0x21,0x2c,0xac,0xb7,0xde,0x4e,0x1a,0xa9,0x5a,0x37,0x10,0x9d,0xc4,0x46,0x47,0x30,0xf7,0xe1,0x96,0x3b,0x6c,0x42,0x95,0xe,0xd1,0xa2,0x3a,0xdd,0xc2,0x49,0x60,0xab,0x63,0x8,0x92,0x4e,0xe7,0x10,0x27,0x1d,0x7,0x51,0x3c,0xb6,0xda,0xbe,0x23,0x68,0xeb,0x19,0x6e,0x2d,0xd,0xdf,0x10,0x97,0x12,0xe7,0x51,0xbd,0xa0,0x61,0xfd,0xb7,0x9a,0x17,0xf7,0x13,0x6c,0x65,0x69,0x31,0x48,0xcb,0x51,0x2f,0xca,0x63,0x5a,0x25,0xe8,0x5f,0xc1,0xd1,0x57,0xe3,0x87,0x10,0xf4,0xd5,0x91,0x5d,0x4,0x3b,0x47,0x7a,0x11,0xed,0xb8,0xec,0x17,0x44,0x2f,0xd7,0x76,0x67,0xf4,0xc6,0x9d,0xf6,0x3,0x9d,0x1f,0xb,0x6a,0x9d,0x54,0xfa,0x91,0x89,0x6d,0xa0,0x9a,0x88,0xf1,0xff,0x0,0xa5,0x28,0xeb,0xee,0x12,0x2c,0x0,0x0 };
 
 const uint8_t interpreter_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0xe5,0x5d,0x5b,0x77,0xdb,0xc8,0x91,0x7e,0xcf,0x39,0xf9,0xf,0x3d,0x8c,0x32,0x4,0xd7,0x24,0x74,0x71,0xec,0x64,0xc4,0xc8,0x19,0x9a,0xa2,0xc6,0x9a,0xd1,0x2d,0xa2,0x34,0x9e,0x8c,0xe5,0x95,0x21,0xb2,0x29,0x61,0xc,0x2,0x18,0x0,0x94,0xcc,0x68,0xf8,0xf,0xf6,0x61,0x5f,0xf6,0x71,0xff,0x5c,0x7e,0xc9,0x7e,0xd5,0xdd,0x0,0x1a,0x37,0x12,0x74,0xec,0x49,0xce,0x59,0x9f,0x63,0x89,0x44,0xdf,0xaa,0xab,0xaa,0xab,0xbe,0xae,0xae,0x86,0x9a,0xb3,0x90,0xb3,0x30,0xa,0xec,0x51,0xd4,0xec,0xfe,0xf6,0x37,0xbf,0xfd,0xcd,0xc8,0x73,0xc3,0x88,0xed,0x5f,0xf6,0xbf,0xbb,0xee,0x1f,0x7c,0xc3,0xf6,0xd8,0xe3,0x6f,0x7f,0xc3,0xf0,0xaf,0xff,0xea,0xf2,0xe4,0xbb,0xeb,0xe1,0xe1,0x8f,0x83,0x5d,0xf6,0xd5,0xb3,0xb6,0x7c,0xd8,0x43,0xad,0x8b,0xc3,0xe3,0xc1,0xe9,0xe5,0xc5,0x2e,0xdb,0xde,0xc2,0x3f,0x55,0x30,0xec,0x1d,0xc,0xae,0x8f,0x4f,0xf7,0x51,0x39,0xa,0x66,0x5c,0x3d,0x3d,0xee,0xfd,0x70,0xdd,0x3f,0x3d,0xf9,0x7e,0x70,0x7e,0x31,0x38,0xbf,0x3e,0xc4,0x8f,0xde,0xc5,0xe1,0xe9,0xc9,0x30,0x6d,0xbb,0xd0,0x68,0x78,0x69,0x85,0xfc,0xf9,0x1f,0x52,0xa,0xb8,0x3b,0xf2,0xc6,0xdc,0x0,0xb1,0xad,0xf8,0x11,0xfd,0x8b,0x82,0xb9,0xfe,0x95,0xfe,0x5,0x3c,0x9a,0x5,0x2e,0xbb,0x89,0x3c,0xcb,0x98,0xb9,0x3c,0x1c,0x59,0x3e,0x37,0x64,0xf3,0xcb,0xf3,0xc3,0xbe,0x37,0xf5,0x3d,0x97,0xbb,0x91,0xe8,0xaa,0xd5,0xea,0xa6,0x8d,0x17,0x6c,0x64,0x45,0xa3,0x3b,0x66,0xf0,0x56,0xbe,0xcf,0xe8,0x2e,0xf0,0x1e,0x98,0xcb,0x1f,0xd8,0x20,0x8,0xbc,0xc0,0x68,0x28,0xf2,0x64,0xb7,0x6c,0x62,0xd9,0xe,0x1f,0x37,0x32,0x9d,0xc9,0x8f,0xb,0x35,0xf9,0x31,0x5f,0x93,0x7c,0xd9,0x20,0x43,0xb0,0x9a,0x8a,0x15,0x79,0x37,0x9f,0x84,0x78,0x39,0xc4,0x32,0xe2,0xb3,0x22,0x39,0xb3,0xe6,0x8e,0x67,0x8d,0x43,0x29,0x14,0x59,0xe5,0xc1,0x76,0xc7,0xde,0x43,0xb8,0xab,0x8f,0x99,0x7e,0xe2,0xf7,0x56,0x68,0x7b,0xee,0x6e,0x5a,0x3f,0x29,0x89,0x1e,0x5e,0xce,0x7d,0x2b,0xc,0x8d,0x2,0xb9,0x1a,0x13,0xde,0xf9,0xde,0x3,0xf,0xc2,0x3b,0xee,0x38,0xac,0x33,0x62,0x8d,0x37,0xe7,0x7c,0xe2,0xf0,0x51,0x84,0x3e,0xcd,0x5e,0x18,0xf2,0xe9,0x8d,0x33,0x7f,0xbb,0xbb,0x7b,0x4,0xaa,0x5e,0xdb,0xd1,0xdd,0x99,0x15,0x44,0xb6,0xe5,0x9c,0x58,0x53,0x6e,0x34,0x87,0xf3,0x30,0xe2,0x53,0xb3,0xef,0x5,0xbc,0xd9,0xea,0x6e,0x58,0x7b,0xd4,0xf8,0x6d,0xd2,0xcc,0xfc,0x86,0x47,0x17,0x73,0x3f,0xad,0x78,0x6c,0xb9,0xd6,0x2d,0x9f,0x82,0xd1,0x66,0x6f,0x16,0x79,0x53,0x4b,0x8c,0x72,0x11,0x58,0x23,0xdb,0xbd,0x35,0xcf,0x86,0x83,0xe8,0xe1,0xc8,0xbb,0x3d,0xb,0xbc,0x7b,0x7b,0xcc,0x3,0xea,0xf2,0x66,0x6f,0xc3,0xa2,0x6e,0xe,0x6c,0xee,0x8c,0x8d,0x26,0xa6,0x94,0x94,0xb6,0x9b,0x27,0x9e,0x7b,0x36,0xbb,0x71,0xec,0x51,0x7b,0x18,0xa1,0xab,0x11,0x35,0x18,0xed,0x6d,0xdc,0x50,0x83,0xef,0x2d,0x67,0xc6,0x8d,0xd,0x77,0xe6,0x38,0xad,0xee,0x1b,0x35,0xfe,0xbe,0x6d,0xdd,0xba,0x5e,0x88,0xaa,0xa1,0x39,0xb8,0x7,0x19,0x34,0xac,0xf8,0x10,0xf7,0xfa,0x56,0x1b,0x6c,0x7a,0xcd,0x5d,0xeb,0x6,0x72,0xcb,0xc,0x75,0x8,0x31,0x59,0xee,0x8,0x13,0x36,0x87,0xc9,0x30,0xa3,0xf6,0x56,0xab,0xf1,0xae,0x9b,0x65,0x32,0xe9,0x65,0xf6,0xc9,0xd8,0xe,0xa9,0xc3,0xe1,0x28,0xb0,0xfd,0xe8,0xa5,0xe3,0x8d,0xde,0x63,0xba,0xb7,0x20,0x62,0x2d,0x9,0x6d,0x84,0x1f,0xc7,0xe7,0xcb,0xc8,0x76,0x42,0x90,0x9d,0xce,0x70,0x64,0x8d,0xee,0xf8,0xf8,0x9b,0xc0,0x9b,0xf9,0x67,0x1e,0x26,0x37,0xc7,0x8c,0x88,0x27,0x61,0x5,0x73,0x43,0x6d,0xca,0xc4,0xd9,0xf6,0xd7,0x8f,0xcd,0xe2,0x64,0x9a,0x7b,0x78,0x3c,0x70,0xcb,0x67,0xda,0xdc,0xdb,0x5a,0x2c,0xea,0xf0,0x6a,0xe4,0x70,0x2b,0x38,0x1b,0xbe,0xb2,0xc3,0xc8,0xb,0xe6,0x6b,0x31,0xe8,0x9c,0x4f,0xbd,0x7b,0xde,0x39,0x4,0x2b,0x98,0x81,0xd9,0x76,0xce,0x86,0xe7,0xdc,0x1a,0x3b,0xb6,0xcb,0x4f,0x7d,0x62,0x45,0xcb,0x54,0xdd,0xe,0xad,0x7b,0x7e,0x66,0x45,0x77,0xac,0x23,0x96,0x6d,0x4f,0xa8,0x3d,0x1b,0x62,0xb1,0xba,0x91,0x33,0xef,0x7b,0xa4,0x21,0x33,0xde,0x65,0x7d,0x22,0xa6,0xa3,0x1a,0x75,0xd9,0x9b,0x63,0x7b,0x14,0x78,0xa1,0x37,0x89,0xcc,0x33,0x1a,0x7a,0x48,0x43,0x43,0x7f,0xd1,0x20,0xf4,0x1c,0x4e,0x83,0x1d,0x61,0x30,0x2c,0x1b,0xd1,0x30,0x99,0x43,0x7d,0x15,0xd9,0xe7,0x13,0xee,0x42,0x1f,0x7b,0xe3,0x7b,0x52,0xb6,0xf1,0x5a,0xf3,0x87,0x90,0x3a,0xc7,0xfe,0x59,0x80,0x3e,0x2,0x58,0x4f,0xce,0x3a,0xfb,0xb2,0x57,0x10,0xe6,0x44,0xf6,0x94,0x1f,0x7b,0xae,0xd,0x8a,0x20,0xe,0xb6,0x41,0xde,0x23,0xa9,0xf0,0x92,0xdf,0x59,0xf7,0xb6,0x17,0x54,0x57,0x20,0x51,0xf6,0xa0,0x3f,0x41,0x18,0xd,0x39,0x77,0x73,0xc5,0x87,0xa7,0xbd,0xef,0xb1,0x94,0x22,0x69,0x3f,0x72,0x85,0x67,0x81,0x7d,0x6f,0x8d,0xe6,0xc7,0x64,0x10,0x55,0xc9,0xd0,0xbe,0x75,0x2d,0xcc,0x81,0xab,0x2a,0x97,0xfe,0xd8,0x8a,0xf8,0xa9,0xb,0x95,0xb,0xa2,0x99,0x4f,0x6,0xc7,0x9b,0x45,0x3,0x17,0x9a,0xc3,0x73,0xbd,0xf5,0x82,0xd1,0x9d,0x7d,0xf,0xd,0xb3,0x5c,0xb7,0x48,0xe7,0xa1,0x8b,0xaf,0x64,0x17,0xc1,0x5,0xb1,0xd0,0x3d,0x57,0xae,0x8d,0x5c,0x3d,0xa9,0xa0,0xf9,0x4e,0x86,0xb3,0x9b,0xa9,0x1d,0xd,0xad,0xa9,0xef,0xf0,0x90,0x84,0x8a,0x1e,0xd8,0xe,0xeb,0x1c,0xf7,0x48,0x93,0x7c,0x2f,0xa0,0x45,0xc2,0xb6,0x18,0x34,0xe2,0xf6,0xee,0xe2,0x2e,0xe0,0x56,0x4,0x81,0x59,0x33,0x27,0x52,0x1a,0xf4,0x1c,0x75,0x31,0xcd,0x0,0x93,0xa9,0x28,0x3e,0xf2,0x1e,0x2a,0x4a,0x86,0x20,0x38,0x28,0x6f,0x56,0x5f,0x7f,0x2e,0x40,0x3b,0xf,0x52,0x51,0x2c,0xd7,0x9f,0x80,0xdf,0x32,0x6b,0x3c,0x66,0x8d,0x57,0xdf,0x1d,0x1d,0x5f,0x5d,0xd,0x4f,0xf,0x2e,0x5e,0xf7,0xce,0x7,0x57,0x57,0x89,0x9e,0x5f,0x5d,0xbd,0x96,0x5e,0x88,0xc5,0x9a,0x79,0x75,0x75,0xc0,0x85,0xe8,0xc2,0x6,0xdb,0xbc,0x67,0xf9,0x1,0xd9,0x66,0xc4,0xce,0x7,0xdf,0x5c,0xef,0xbf,0x3e,0x3d,0xdf,0x67,0x9b,0x63,0x70,0x6b,0x73,0xb2,0x9a,0x7c,0x3f,0xf0,0x46,0x3c,0xc,0x5f,0x79,0x8e,0xe3,0x3d,0x90,0x61,0x84,0x22,0xdc,0xf2,0xe8,0x5a,0x3d,0x87,0x5b,0x6c,0x84,0xf7,0xa3,0x3b,0xd8,0x70,0x93,0x7f,0xe0,0x8d,0x75,0x56,0xc5,0xe1,0xe0,0x7,0xe3,0x84,0x3f,0x74,0x4e,0x6f,0x7e,0x2,0x89,0xec,0x84,0x47,0xe6,0x6b,0x7e,0xd3,0x77,0x6c,0x8,0xb7,0x65,0xee,0x7b,0xf,0x2e,0x79,0xde,0x61,0x44,0x5a,0x6f,0x34,0xef,0xa2,0xc8,0xf,0x77,0x37,0x37,0x3,0xeb,0xc1,0xbc,0x85,0x1a,0xce,0x6e,0x80,0xe3,0x2,0x38,0xe9,0x88,0xac,0xea,0xc8,0x9b,0x6e,0xa6,0x2b,0xff,0xd8,0x9a,0xd8,0x96,0xfa,0xee,0x3b,0x9e,0x1d,0x6d,0x4e,0x2d,0xe8,0x5a,0xb0,0xd9,0x87,0xe,0xc,0x3e,0xf0,0xd1,0x8c,0x38,0xb2,0x79,0xe8,0xde,0x7b,0xef,0x79,0x27,0xf6,0xaf,0xb0,0x3c,0x83,0x43,0xf7,0x27,0xe5,0x6a,0xfd,0x70,0x1b,0x16,0x96,0x2d,0xab,0xc3,0x3a,0x67,0x3,0x61,0xac,0xa6,0x96,0xf3,0x60,0x5,0x9c,0x38,0x80,0x67,0x92,0x33,0xe4,0x90,0xd9,0xc6,0x63,0x96,0x5d,0x8b,0x1a,0xa,0x13,0x24,0x43,0xed,0x1f,0x1d,0x19,0x63,0xc7,0xb9,0x9e,0x5,0xce,0xff,0x3b,0xbe,0x5e,0x6,0xe,0xb8,0xa7,0x66,0xbf,0x60,0x9d,0x3,0x2f,0x18,0xf1,0xde,0xf0,0xe8,0xbc,0x6,0x7,0x7d,0xdf,0x1e,0xf,0x7d,0xcf,0x9b,0x18,0x3e,0xa4,0xe2,0x26,0xdc,0x6f,0x33,0x4c,0x67,0x6a,0xb9,0xe3,0xb5,0x9c,0xbb,0xec,0xe3,0x70,0xc,0x55,0x97,0xbe,0x4b,0x69,0xfe,0xc6,0x63,0xb6,0xf7,0x45,0xeb,0xcd,0xd6,0x5b,0xf3,0x70,0xdc,0x65,0x1b,0xa1,0x8d,0xca,0x9a,0x8,0x4a,0xd0,0x8e,0xea,0x45,0xd8,0xd5,0x43,0x77,0xe2,0x89,0x56,0xe6,0x1,0x1c,0x9d,0x50,0x9c,0x3d,0xd6,0x1c,0x4d,0xc7,0xa4,0x50,0x4d,0x59,0xd2,0xb,0x6e,0x67,0x84,0x1f,0x68,0xc5,0x35,0x37,0x47,0x18,0x5d,0xcd,0x65,0xa1,0x2a,0x5c,0x86,0x5c,0xc8,0x48,0x8a,0x81,0x7a,0xd8,0x98,0x58,0x4e,0x8,0x5f,0xb9,0xe1,0xd7,0xa5,0x86,0xea,0x9a,0x9,0x49,0xd4,0x45,0x68,0xa7,0xcf,0xd6,0x71,0x97,0xf0,0x47,0xfc,0xc1,0x72,0x9c,0xe5,0x66,0xce,0xe5,0x51,0x78,0x7,0x43,0x77,0x3f,0x51,0xd5,0x59,0xc8,0x23,0x86,0xdf,0x60,0xe9,0x4,0xac,0x8,0xb1,0x4f,0x83,0xc5,0x66,0xde,0xa4,0xd4,0x52,0xe9,0xdf,0x4b,0xa9,0xb8,0xec,0xf5,0x3f,0x99,0x9d,0xbd,0xba,0xea,0xcf,0x2,0x92,0xf7,0xf7,0xd0,0xe,0x28,0xe9,0xd5,0x95,0x40,0x68,0x36,0x47,0x89,0xe4,0xa8,0x30,0xbb,0x12,0x66,0x1d,0x5d,0xf6,0x6a,0xdb,0xdb,0xea,0x59,0x8,0xc4,0x25,0xd0,0x30,0xb0,0xda,0x7a,0x9b,0x86,0x7,0x7e,0x1f,0x61,0x31,0x3a,0xe8,0x43,0xc9,0xbb,0xcb,0x32,0xcf,0xa0,0x24,0x81,0x1d,0xcd,0xb3,0x4f,0x7b,0xbe,0x8f,0x29,0x9,0x70,0xda,0x58,0x8f,0x54,0xfe,0x61,0xe4,0xcc,0xc6,0x2,0xba,0x61,0xd1,0x45,0x77,0xeb,0xd0,0xda,0x1b,0x8f,0x73,0xe8,0x68,0x40,0xbd,0x9,0xb0,0x40,0xd6,0xb5,0x49,0x2b,0x2d,0xba,0x5b,0x34,0x8b,0x34,0x69,0xbb,0xb7,0x8c,0x26,0xfa,0x40,0x36,0xd8,0x39,0xee,0xe6,0xa9,0x98,0x78,0x63,0xc,0xb,0xbf,0xa8,0xf6,0x61,0x1f,0x61,0xf,0x68,0x21,0x9,0x20,0xdb,0x7c,0xf5,0x5d,0xff,0x72,0x17,0xc2,0x87,0x96,0x90,0xf5,0x87,0x82,0x38,0xe8,0x93,0xf4,0x61,0x1a,0x76,0x42,0x5,0xdc,0x51,0x4e,0x4d,0xaf,0xae,0x4e,0x7d,0xe,0x9d,0x51,0x3,0x36,0x95,0x41,0xeb,0xb2,0xb8,0x3b,0xac,0x40,0x90,0x15,0xcd,0x61,0xfb,0xc4,0x9c,0xff,0xb9,0xce,0x85,0xd,0x69,0xee,0x73,0x87,0xdf,0x62,0xfd,0x28,0x93,0x80,0xe7,0x62,0xab,0xc0,0x9a,0xe9,0xf0,0x84,0x4c,0x3f,0xd7,0xf0,0xc6,0x58,0x82,0xa5,0x56,0x3a,0xb0,0x66,0xb5,0x52,0x12,0xc8,0xb6,0x24,0x56,0xb5,0xd9,0xdf,0xd5,0x96,0x9c,0x54,0xdd,0xa7,0x3b,0x57,0x57,0x89,0xe4,0x84,0x4d,0x64,0x1d,0x59,0x65,0x18,0xcd,0x1d,0xce,0x5e,0xd9,0xe3,0x31,0x77,0xe3,0x9e,0x86,0xe,0xe7,0x3e,0x7b,0xda,0x65,0xfa,0xae,0xa3,0xee,0x84,0xd0,0xf3,0x39,0x2d,0xd,0x84,0x88,0x24,0x7d,0x35,0x4c,0x9e,0xc0,0xb3,0xf7,0xf,0x9f,0x5d,0xa7,0x46,0x64,0x12,0xaf,0xae,0x42,0xc9,0x73,0xaf,0x5c,0x9f,0xa,0x2,0xfd,0x27,0xba,0xfc,0x67,0xc4,0x18,0x33,0x45,0xb9,0xb0,0x8f,0x15,0x8d,0x20,0xf0,0x63,0x84,0x2,0x2,0x7d,0xe8,0x7c,0xa0,0x0,0x7b,0xf8,0xef,0xbb,0xe0,0x3f,0xd3,0x52,0x8f,0xfb,0xa7,0x38,0x4,0x93,0x60,0xef,0x23,0x95,0xe4,0x5f,0xb2,0xde,0xfb,0x39,0xf9,0x95,0xe8,0xd1,0xce,0xc7,0x2c,0xf1,0x8f,0xd1,0xa5,0x8,0x48,0xd5,0x3d,0xa4,0xed,0x54,0xe8,0xb9,0xd6,0xea,0xdd,0xdb,0xbf,0x1e,0x8f,0x9f,0x49,0xff,0xb7,0x49,0x78,0x55,0xc1,0x3d,0x85,0xbb,0xd3,0x27,0x35,0x26,0x4e,0xdb,0x9a,0x79,0x28,0x2,0x6c,0x0,0x96,0xe,0x22,0x9b,0x11,0x22,0x1f,0xd3,0xd0,0xbe,0x5e,0xe9,0xe3,0x63,0x64,0x45,0x42,0xd1,0x81,0x55,0xa,0x9a,0xca,0x20,0x96,0x1a,0x8a,0x7,0x4,0xa5,0x7a,0x65,0xa3,0x17,0x60,0xd5,0x36,0x60,0x15,0xfb,0xf2,0x4b,0x96,0xe,0x98,0x45,0x72,0x9f,0x6d,0x40,0xb0,0x1,0x3a,0x39,0x62,0x9b,0x3f,0xcf,0x6c,0xa0,0xd6,0xcd,0x9f,0xb1,0xc5,0xb6,0x81,0xcb,0x63,0xf6,0x2c,0x6a,0x80,0x65,0xc7,0x79,0x65,0xff,0x64,0x8d,0xde,0x53,0xbc,0x63,0x2d,0x9d,0xd2,0x37,0x22,0xbf,0x30,0x28,0xf2,0x0,0x91,0xc3,0x58,0xc3,0x1e,0x65,0x88,0x9d,0x6d,0x5c,0x9b,0x8,0x7a,0xcc,0x8,0x47,0xff,0xc2,0x5e,0xdf,0x1,0x5d,0xa5,0x35,0x3a,0xae,0x17,0x31,0xe3,0x82,0x87,0x91,0xf4,0xf8,0xa8,0x1b,0x6f,0x3e,0x5a,0x88,0xab,0xff,0x2,0x1b,0x41,0x1b,0xb3,0xb8,0xc1,0xd7,0x8f,0x54,0xb2,0xd7,0x54,0x63,0x36,0xbb,0x83,0xf,0x3e,0x22,0xd,0x84,0xd1,0xf6,0x1e,0x93,0x71,0xa8,0xce,0x62,0xd1,0x66,0xc9,0x36,0x26,0xe,0xd0,0x3f,0x2e,0xd8,0xa2,0x3e,0x7a,0xe3,0x1f,0x60,0xf5,0xa3,0x40,0xac,0xb4,0x92,0x30,0xfa,0xd8,0xd,0x7,0x54,0xc3,0x20,0xdf,0x20,0x58,0xdd,0x66,0x63,0xc4,0x54,0x6d,0x77,0xad,0x7d,0x9d,0x5a,0x52,0xd8,0xe5,0xbc,0x41,0x44,0x9,0x21,0x9e,0x8,0xe1,0xc1,0xb,0x4f,0x9e,0x13,0xa8,0xd5,0xf8,0xe6,0xf0,0x54,0xb0,0x5,0x25,0x14,0x43,0xec,0x39,0xce,0xcb,0x79,0xc4,0x43,0x3,0x86,0x2d,0x19,0x7c,0xd1,0xc4,0x99,0x4,0xdb,0x18,0xdd,0xcd,0xdc,0xf7,0xb4,0x3b,0x7b,0x3,0x4d,0xe4,0x1f,0xd0,0xe2,0x98,0xa6,0x8e,0xca,0xf1,0x48,0x6d,0xd6,0x34,0x1f,0xb7,0xdb,0xcf,0x9f,0x2e,0x68,0x21,0x6e,0xd8,0x7b,0x5b,0x5d,0x0,0x52,0x44,0x95,0x46,0x77,0x86,0x6c,0xce,0x6c,0x37,0xee,0x8,0x53,0x61,0x6e,0xe8,0x78,0xde,0xfb,0x99,0x8f,0xba,0xe6,0x86,0xaa,0x62,0xa,0xcb,0xda,0x32,0xb1,0x37,0x16,0x53,0x5e,0x50,0x4f,0x4f,0x9e,0xb0,0x3a,0x91,0x5,0x7b,0x34,0xf5,0x25,0xe7,0x54,0x54,0xc2,0xf6,0xdb,0x2c,0x99,0xc7,0x5a,0xcc,0xbb,0x21,0x36,0xd0,0x64,0xeb,0x31,0x88,0x36,0x91,0xe4,0x80,0xca,0xf6,0xa1,0x64,0xf,0xf1,0xff,0xc1,0xb,0xde,0xd3,0xae,0x33,0x50,0xc1,0xf1,0x33,0xd4,0xd7,0xf8,0x73,0x23,0x78,0x23,0x86,0x25,0xd6,0x88,0xee,0x10,0xfc,0x76,0xc7,0x34,0x54,0x32,0x9d,0x45,0xb3,0x2d,0xe,0xd6,0xda,0xec,0x6b,0x34,0x69,0xb5,0xa0,0xc7,0xa7,0xb3,0xa8,0x73,0x82,0xd0,0x78,0xd6,0x77,0x74,0x8e,0x6d,0xc7,0xb1,0x43,0x1c,0x6,0xb9,0x38,0xdb,0x79,0xb6,0x55,0x8b,0x7f,0x64,0x9a,0x5,0xff,0x68,0xc6,0x6,0xe2,0x12,0x1a,0xf7,0xe8,0x23,0x42,0xf8,0xd7,0xae,0xdc,0xbd,0x37,0xa8,0x60,0xad,0x68,0xd8,0x6,0xb5,0x10,0x4b,0x71,0x8f,0x65,0xb9,0x7,0xe6,0x61,0x2c,0xf9,0x98,0x82,0x21,0xf4,0x80,0x8a,0x5f,0xae,0x90,0x41,0xd2,0x63,0x4b,0x35,0x50,0x91,0x5,0xaa,0x4f,0x8f,0x51,0x5f,0x9c,0x3c,0xc8,0x82,0x6c,0xf5,0x1b,0x6f,0xe6,0x8e,0x2d,0x58,0x11,0x54,0xff,0x66,0x66,0x8f,0x51,0x17,0x92,0xa3,0x4f,0x46,0xcb,0xbc,0xf0,0xd4,0xf2,0xa0,0x9a,0x77,0x18,0x12,0xf3,0x40,0x45,0x1c,0x32,0xf4,0xa5,0xa6,0x77,0x8,0x74,0x34,0x89,0xe2,0x29,0x7c,0xb7,0x8d,0x38,0x49,0xb4,0x49,0x92,0xed,0x20,0x98,0x6c,0x75,0x59,0xdc,0xf9,0x5e,0x93,0x3d,0x49,0x87,0x5a,0x88,0x61,0xc7,0x73,0xa,0xd4,0x8b,0xee,0x8c,0x56,0xe6,0xc9,0x13,0x74,0xd7,0xe9,0x64,0x9a,0x14,0xca,0xe3,0xf1,0x11,0x4c,0xf6,0xbd,0xd0,0x96,0x6,0x44,0x1b,0x99,0xa4,0xb3,0x77,0x75,0xd5,0x20,0xfe,0xc6,0xd2,0x5a,0xe0,0x7b,0x57,0x8,0x32,0x2e,0x15,0x63,0x24,0xc,0x7b,0xc2,0x9a,0xf4,0xac,0x72,0x2c,0x9a,0xeb,0x2e,0xb3,0xd2,0xad,0xf3,0xa6,0x37,0x8a,0x60,0x9e,0x71,0x5a,0xc9,0xad,0x69,0xb1,0x5d,0xfc,0x84,0x58,0xab,0x96,0xc0,0x5,0xff,0x10,0x99,0x3,0x3a,0x56,0x5,0x57,0xc1,0xea,0xcb,0x8b,0x83,0x3f,0xd1,0xa9,0x90,0x94,0xa3,0xa1,0x75,0xd0,0xf9,0xc9,0xc3,0x3a,0x0,0x3d,0x57,0x57,0x8,0xf8,0x2,0x84,0x41,0xc7,0x9e,0x64,0xbf,0xc7,0xdd,0x3f,0xd9,0xd3,0xd4,0x44,0x7b,0x58,0x6f,0xd0,0xa4,0xcb,0x4e,0x7,0x1f,0x75,0xa6,0xcb,0xf1,0xe8,0x71,0x3a,0x62,0x12,0xcd,0xb,0xa3,0x63,0x8e,0x23,0x82,0x31,0xeb,0x5c,0x6,0xb6,0xd4,0xdb,0x8e,0x7a,0x72,0x76,0x3a,0xbc,0x40,0x80,0x5e,0xa9,0x4b,0xa2,0x37,0x9d,0x97,0x44,0x97,0xa0,0x6e,0x9d,0x25,0x28,0xcd,0x74,0x6e,0x11,0xfe,0x2b,0xed,0xff,0xea,0x5,0x56,0xb4,0x89,0x4a,0xd,0xbe,0x7e,0x4c,0xb4,0x2f,0xe9,0xa6,0xcb,0x48,0x63,0xf7,0x62,0x2a,0xc9,0x23,0x2b,0x2a,0x2f,0xbc,0xce,0xb7,0xc0,0xa1,0x95,0x4c,0x8f,0xad,0x44,0x8e,0xf1,0x29,0x9b,0x59,0x47,0xa9,0xae,0xd8,0x1a,0x34,0x75,0xcd,0xfd,0x9,0x1d,0x37,0xeb,0x6c,0x79,0xe1,0x7a,0x1c,0xe9,0x4a,0xc2,0x69,0x44,0x5e,0x24,0xf0,0xa6,0x6d,0x0,0xe5,0x36,0xb,0x67,0xc2,0xba,0x67,0x4c,0xa3,0x9a,0x67,0x63,0x1f,0x53,0x62,0x56,0x14,0x89,0x53,0xce,0xc6,0x7a,0x27,0x68,0x2e,0x82,0x44,0x18,0xf4,0x18,0xa0,0x3,0x47,0xa9,0x38,0x95,0xc1,0xb8,0x43,0x1e,0x80,0x23,0x34,0x63,0xa2,0x42,0xec,0x31,0x40,0x87,0x30,0x9f,0xf8,0x4d,0xdf,0x2f,0x3c,0xfa,0x16,0x79,0xf4,0x79,0x28,0x29,0x13,0xd5,0xe5,0x47,0x7a,0x2a,0xf8,0x82,0x47,0x44,0x23,0x7d,0xef,0x9,0xf2,0x64,0xa8,0x35,0x2b,0xb1,0x1a,0x7c,0x99,0x28,0xed,0x34,0x42,0x41,0x59,0x9b,0x11,0x76,0x6f,0x33,0xda,0x7a,0x66,0x18,0x12,0x60,0xdf,0x12,0xc9,0x2f,0xe0,0x8b,0x38,0x13,0x2f,0x63,0x86,0x4c,0x41,0x90,0x95,0x95,0x6b,0xd0,0x5b,0xfe,0xf2,0xb,0xb2,0x3,0x6a,0xe9,0x5a,0xa3,0x5b,0x7f,0x5d,0x3c,0xf0,0x9b,0x91,0xd8,0x9b,0x54,0x7a,0xeb,0x64,0xf7,0x2,0x15,0x4e,0x6a,0x9b,0xfd,0x80,0x8f,0xe9,0x60,0xf,0x41,0xe7,0x55,0x7e,0x3e,0xad,0x4a,0x84,0x12,0x8f,0xe0,0xb8,0x45,0x98,0xf,0x61,0x74,0xb1,0x32,0xd2,0x6e,0x2f,0x7d,0xda,0x1d,0x9,0x8f,0xdb,0x4,0x7b,0xb1,0x33,0x82,0xf8,0x4,0x77,0x17,0xf8,0x94,0xf2,0x86,0x5c,0x7f,0x7e,0xd6,0xf5,0x5,0x76,0x86,0x91,0xb1,0x65,0xaa,0x29,0xb7,0x78,0xb9,0xd6,0x95,0x9d,0xb2,0xb,0xf9,0xd6,0x9f,0x47,0x7e,0x98,0xd2,0x39,0xff,0x79,0x6,0xab,0xa0,0x79,0x18,0x62,0xfe,0x41,0xe4,0x43,0x72,0xaa,0x8c,0x8e,0xc2,0xe9,0x40,0xb3,0x84,0xab,0xc2,0xfd,0x3d,0xa6,0x94,0x2f,0x84,0x79,0x4b,0x7a,0xfd,0xb4,0x82,0xd6,0xfa,0x55,0xe6,0x2a,0x4b,0x74,0x4a,0xb1,0x2c,0xe,0x9f,0x60,0x1a,0xe4,0xad,0x12,0xb5,0xc8,0x76,0x82,0x63,0x90,0x97,0xb6,0x2b,0x91,0x8b,0x38,0x3c,0x2e,0x14,0x2b,0x51,0xeb,0xe5,0xe8,0xa5,0x9f,0x7a,0x83,0xda,0x90,0x56,0xe7,0x89,0x6c,0x7e,0xc4,0xdd,0x5b,0xb1,0x4c,0xf5,0x3e,0x4d,0xf9,0x14,0xd,0x2,0x59,0x7b,0x28,0x90,0x81,0xa8,0x95,0xf6,0x0,0xe9,0x9f,0xeb,0xc5,0x2,0xfd,0x64,0x1a,0x98,0xaf,0x11,0xb1,0x57,0x38,0xad,0x1f,0x6f,0x29,0x0,0x75,0x4b,0xc6,0x2a,0xb6,0xed,0x3b,0x5e,0xc8,0x55,0x9f,0xc0,0x46,0x38,0x41,0x2f,0x1b,0x5f,0x96,0x64,0xaa,0xc5,0x2d,0x6b,0x2c,0x26,0x2c,0xda,0xb1,0x75,0x2f,0xd,0xa0,0x70,0xcc,0xa5,0xab,0x68,0x6d,0x50,0xbc,0xae,0x57,0xc5,0xc1,0x46,0xa,0x96,0x37,0x33,0x60,0x8e,0xf6,0x69,0x1f,0x21,0x68,0xec,0x13,0x68,0x12,0x68,0x93,0xfa,0x60,0x71,0x82,0xc2,0x55,0x60,0x2d,0x51,0x69,0xf8,0x8f,0xf0,0xcc,0xc1,0xbe,0x8c,0xd0,0x55,0x12,0xf2,0xda,0x18,0x61,0x1d,0x94,0xae,0x95,0xf2,0xc4,0x20,0x24,0xae,0x94,0x2d,0x9c,0x84,0x90,0xa5,0x88,0xcb,0x4e,0x1d,0xff,0x65,0xe2,0xf7,0xe3,0x59,0x77,0xd2,0x8e,0x25,0x55,0x75,0xc2,0x5f,0x81,0xe5,0x86,0x13,0x12,0x4b,0x61,0xdb,0x3d,0xb5,0x3e,0x5c,0x8f,0x55,0x0,0x8b,0xd8,0xb3,0xfd,0xd9,0x85,0xfb,0x31,0xe2,0xd3,0x34,0xbe,0x82,0x6d,0x40,0xb1,0x71,0xdc,0x2d,0x9e,0xad,0x19,0xde,0x6d,0x26,0x14,0xfe,0x5,0x13,0xed,0x24,0x13,0xdd,0x43,0x90,0x47,0x9f,0x38,0xed,0x20,0x96,0x30,0xbd,0xcb,0xc4,0xc2,0xed,0xbc,0xc2,0x61,0x2b,0x8d,0x14,0x47,0xfc,0xd8,0xe5,0xf9,0xd1,0x6e,0x4a,0x1d,0x4a,0xea,0x38,0x2c,0x50,0x64,0x7b,0x39,0x41,0x7c,0x76,0xae,0xd7,0xd9,0x6e,0x96,0xc1,0xdb,0x7f,0x83,0x4d,0x64,0x7e,0xcf,0xd8,0xae,0xbf,0x4b,0x94,0x87,0x23,0x75,0x36,0x87,0xed,0xda,0xdb,0x41,0xd4,0xd4,0xa1,0xff,0x9b,0x5f,0x77,0xeb,0xf7,0x29,0xf7,0x7c,0x35,0x96,0x55,0x12,0xcc,0x26,0x62,0x4c,0xdb,0x6b,0xae,0xb1,0x19,0x5c,0xb1,0x6a,0x8c,0xd4,0x41,0x21,0x8d,0xf0,0x7d,0x6b,0xf5,0xea,0xc9,0x7e,0xa3,0x2c,0xb4,0x40,0xa5,0x4c,0x84,0x85,0x73,0xe2,0x74,0xcd,0x18,0x14,0x23,0xa3,0x4,0xb3,0xa5,0x6b,0x6c,0x63,0x5,0x62,0x1e,0x22,0x49,0xf,0xb9,0xe,0xe6,0x45,0xff,0x4c,0x22,0x67,0x5a,0x2d,0x22,0x5c,0x5,0xc7,0x81,0xce,0x17,0x94,0xcb,0x99,0xa0,0x2,0x85,0x7c,0x21,0x97,0x4,0xa,0xbc,0xa1,0xc8,0xd7,0x9b,0xb7,0x6f,0x93,0xc0,0xdb,0x96,0x69,0x3e,0x7f,0xf6,0xec,0xe9,0xb3,0x5f,0x7e,0xff,0xb8,0xb5,0xe8,0x3e,0xdc,0x11,0x3e,0x36,0x36,0x6c,0x91,0xb3,0x21,0x3d,0x3e,0x2d,0x4e,0x43,0xd6,0x97,0x30,0x41,0x7c,0x8c,0x1,0x42,0xb,0x11,0x60,0xce,0xb6,0x5a,0x8f,0xdd,0xd,0x52,0x7a,0x4a,0x6e,0xd1,0x48,0x17,0x5a,0x2c,0x14,0x5c,0xf,0x16,0xf4,0x86,0xfd,0xc3,0xc3,0x58,0x7b,0x5a,0x8a,0x3e,0x5a,0xc2,0x6a,0x14,0x1a,0xc4,0xa6,0x99,0x60,0xb3,0x76,0x83,0xa8,0x36,0x75,0x8a,0x18,0x39,0x93,0x23,0xec,0xbc,0xf8,0x72,0x5b,0xc5,0xe3,0x94,0xd7,0xd4,0xaa,0xee,0x8,0xc2,0xe3,0x76,0x58,0x55,0x67,0x43,0x46,0x2b,0xcd,0xf0,0x1f,0xc6,0x2d,0x61,0xa3,0xe8,0xe1,0xb,0xd6,0x54,0x4d,0xe6,0x22,0xc3,0xc5,0x78,0x13,0x11,0x5d,0x3c,0x55,0x68,0x41,0x62,0x2b,0x55,0xe9,0x74,0x80,0x84,0xc3,0x31,0x8c,0x8a,0xfb,0x1,0xd9,0xc9,0xe7,0x4,0x3e,0xc5,0x75,0xf,0x90,0x87,0x70,0x67,0xb4,0x16,0xdd,0x58,0x28,0xa,0xd,0xd5,0x48,0x42,0x9a,0x43,0xd1,0xdd,0x7a,0xea,0x23,0xeb,0x92,0x79,0x6e,0xda,0x53,0xaa,0xcd,0x42,0xa1,0x30,0x6d,0xec,0x53,0xe3,0xdc,0x25,0x2f,0xec,0x86,0x7b,0xf2,0xb1,0x29,0x7f,0x19,0xea,0x5b,0xef,0xe0,0xfa,0xf0,0x64,0x70,0xd1,0x56,0x5f,0x87,0xa7,0xb8,0xa2,0x30,0xbc,0x38,0x1f,0xf4,0x8e,0x5b,0xdd,0x10,0x27,0x46,0xae,0xb,0x91,0x1a,0x46,0x43,0x68,0x5c,0x23,0xd1,0xb8,0x56,0xd7,0xb,0xcd,0xf1,0xcc,0xdf,0x31,0x42,0x53,0x18,0x38,0xcf,0x68,0x21,0x6b,0xba,0xcb,0x4a,0x1e,0x6f,0x97,0x56,0x6,0x4f,0x15,0xb9,0x3e,0x65,0x92,0xe0,0x87,0x19,0xfa,0xd6,0x83,0x6b,0x34,0x36,0x6f,0x6c,0x77,0xf3,0xc6,0xa,0xef,0x1a,0xad,0xe6,0x6a,0x56,0x51,0xc5,0x7a,0x8c,0xa2,0x9a,0xac,0x63,0xb3,0x17,0x5f,0xe2,0x24,0x86,0xdf,0x6f,0x46,0x23,0x7f,0x53,0x4c,0x6b,0x53,0xcd,0x8a,0x6d,0x41,0xcb,0x56,0x8f,0x88,0xc4,0x23,0x18,0xe7,0x7a,0x63,0xba,0x23,0xd6,0xe1,0x4c,0xcc,0x8,0x83,0x8b,0xd1,0x98,0x1a,0xad,0x86,0x16,0xf0,0xa0,0xa6,0x9,0xa1,0x9a,0x34,0x50,0x93,0xae,0xa7,0x48,0x7b,0xd1,0xc5,0x19,0x81,0x92,0x5a,0x77,0xc3,0xdf,0x53,0x83,0x76,0x95,0xf4,0x87,0xed,0x33,0x25,0x78,0x4d,0xe2,0x6d,0xc4,0xc1,0xa1,0x31,0xb8,0x2d,0x31,0x27,0x87,0x65,0x34,0xc0,0xa1,0x6,0x44,0x6d,0x4f,0x8c,0x58,0x11,0x86,0x42,0x51,0x70,0x54,0x16,0x5c,0xdb,0xae,0xb1,0xe1,0xb7,0xe1,0x5d,0xa2,0x6b,0x5c,0xb0,0xc0,0x17,0x1b,0xf7,0x2b,0x5a,0x8f,0x94,0x7,0x60,0xc,0x2f,0xf6,0xf,0x4f,0xda,0x8d,0x17,0x5f,0xe,0x61,0xec,0xe3,0x27,0xb8,0xf5,0x92,0x7f,0x34,0x38,0x3f,0x8f,0x1f,0xd1,0x71,0x98,0x92,0xbd,0x10,0x13,0x1e,0x2d,0xba,0xcd,0x65,0xc7,0x3e,0xe9,0x7d,0x11,0xf9,0x49,0xb3,0xbb,0x48,0x7f,0xcb,0xf0,0x4b,0xee,0xa7,0xe5,0xdd,0x13,0xc2,0xd2,0x32,0x4e,0x67,0xaa,0x2b,0x32,0x94,0x2c,0x17,0xc2,0xe5,0xc2,0xb0,0x22,0xa1,0x7e,0x6a,0xf9,0xc6,0x88,0xed,0xbd,0x60,0x23,0xe1,0xa0,0xb7,0xf0,0x88,0x9c,0x27,0x95,0xe9,0x37,0x3e,0xca,0x10,0xd2,0x89,0x77,0x46,0x3f,0xdc,0x43,0xa4,0x98,0xa8,0xc4,0x12,0xe4,0x23,0xb9,0x94,0x70,0xa7,0xc6,0x4e,0xa4,0x9e,0x92,0x1d,0x23,0x41,0x3a,0x7d,0x4f,0x43,0x92,0xf1,0x51,0x80,0x2f,0xaf,0x90,0x14,0xf3,0x63,0xab,0xce,0x8b,0x5f,0x9f,0xe7,0x23,0x79,0x30,0x9a,0x4,0xb9,0xf0,0x84,0xbb,0xf7,0xbb,0x17,0x83,0xe3,0xb3,0xab,0xab,0x8d,0x24,0x6a,0xb8,0x68,0x16,0x4e,0xd5,0x2b,0xea,0x35,0x74,0xda,0x65,0x16,0x97,0x7e,0xd9,0x45,0xda,0xe5,0xcc,0x5d,0x17,0xe8,0xd2,0xf6,0x53,0x56,0xb8,0xc3,0xa3,0x48,0xc7,0x63,0x33,0xe0,0xbe,0x63,0x8d,0xb8,0xb1,0xf9,0xc6,0xea,0xfc,0xbd,0xd7,0xf9,0xf1,0xed,0xe6,0x2d,0x12,0x2d,0x89,0xfb,0x59,0xb9,0xcb,0xce,0x4d,0x8a,0xcc,0xf5,0xef,0xac,0x80,0x52,0x46,0xd,0x48,0xe9,0xcf,0x0,0x78,0x3f,0x36,0xd9,0x5f,0xd8,0x57,0x5b,0xc,0xb7,0xa2,0x76,0x76,0x5a,0xec,0x5,0x2c,0x3b,0x3a,0x60,0x23,0x73,0xa4,0x2a,0xf6,0x22,0x63,0x8b,0xd0,0xce,0xf6,0xd3,0x16,0x6a,0x8e,0x50,0x11,0x8b,0x92,0xed,0x3c,0x6f,0xa5,0x43,0xb4,0xa,0x33,0x13,0xf1,0x62,0xfe,0x61,0x50,0x7e,0x89,0x4a,0xcd,0xa0,0x17,0x4,0xd6,0x5c,0x10,0x25,0x6a,0x68,0xaa,0x93,0x1d,0xdc,0x8c,0x62,0xbc,0xba,0xfd,0xbc,0x65,0xfa,0x74,0x5e,0x4f,0x29,0x91,0x3b,0xc0,0x73,0x50,0xaf,0x54,0xbf,0xa,0xba,0x1,0xa,0xf6,0xe5,0x3d,0x28,0x7c,0x2a,0xa3,0x0,0x8f,0x31,0x2a,0x8e,0xa,0x8d,0x4d,0x3a,0x1e,0xdc,0x59,0x6c,0xde,0x4a,0x32,0xa4,0x93,0x7b,0x51,0xca,0x38,0xa0,0xe1,0x90,0x72,0xea,0x45,0x25,0x9c,0x79,0x3d,0x6f,0x2d,0xa3,0x21,0x6,0x3b,0x72,0x2,0x4b,0x64,0x99,0x2e,0x21,0xd5,0xc4,0x58,0xd2,0xeb,0xc8,0xe2,0x21,0xc8,0xb1,0x7d,0x9c,0x2c,0x53,0xa7,0x88,0xfd,0xde,0xd9,0x13,0x2,0x41,0x4f,0x6b,0xe9,0xa,0x14,0xc5,0x56,0x9a,0xf2,0x98,0x4f,0xde,0x21,0x6d,0xc,0x89,0xc3,0xa4,0x6,0xa9,0x8e,0x3c,0x7f,0x6,0xd1,0x7f,0xf5,0xc7,0x6e,0xe9,0xed,0xb1,0x32,0x3e,0xc9,0x3e,0x80,0x23,0xf2,0xba,0xd4,0x61,0x71,0x91,0x20,0xba,0xc5,0x7e,0x4f,0xea,0xa4,0x5f,0x7,0x2b,0x4e,0x18,0x8b,0x71,0xb9,0x32,0x55,0x5c,0xb8,0x2b,0x74,0xe4,0xdd,0x4c,0x66,0xb8,0xd7,0x16,0x71,0xc9,0xb6,0xf7,0x9c,0xb6,0x2,0x7f,0xd8,0x59,0x2d,0x95,0x44,0x3b,0xcb,0xe6,0x9a,0x9f,0xe2,0x7f,0x52,0xc7,0xe5,0x6a,0x91,0x2e,0x90,0x31,0x5f,0x83,0x98,0xe8,0xce,0xe,0xcd,0x62,0xfd,0xf2,0x9e,0xb1,0x8f,0xc6,0x11,0xb5,0xe1,0xc4,0x21,0xb1,0xed,0xad,0x12,0x7b,0x4e,0x14,0x8b,0x94,0xe6,0xde,0xcb,0xfe,0xfe,0xe0,0xe0,0x9b,0x57,0x87,0xdf,0x22,0x7f,0xe3,0xe4,0xf4,0xec,0xaf,0xe7,0xc3,0x8b,0xcb,0xef,0x5f,0xff,0xf0,0xb7,0x1f,0xad,0x9b,0x11,0x12,0x8b,0x6e,0xef,0xec,0x9f,0xde,0x3b,0x53,0xd7,0xf3,0x7f,0xc6,0x4d,0x97,0xd9,0xfd,0xc3,0x87,0xf9,0xdf,0xb7,0xb6,0x77,0x9e,0xfe,0xe1,0xd9,0xf3,0x3f,0xfe,0xe9,0xab,0xa6,0x26,0x38,0x87,0x53,0xd8,0x35,0xc4,0x9e,0x91,0x89,0xd3,0xb6,0xb4,0x4,0x5b,0x3c,0x66,0x50,0x31,0xc1,0x64,0x1c,0xbe,0xdb,0xec,0xcf,0xcc,0x51,0xb1,0x39,0x9c,0xa1,0xb7,0x8a,0xb7,0x12,0x45,0x2f,0xd8,0x38,0x9,0x32,0x5,0x7b,0xc1,0x5a,0x9c,0xeb,0xdf,0x99,0x13,0x1c,0xcd,0x7,0xf2,0xa3,0x9a,0x68,0x8b,0xfd,0x87,0xaa,0xe7,0x28,0x88,0x5d,0xbc,0x5c,0xa8,0xf1,0x52,0x76,0xde,0xcd,0x5f,0x3a,0xa4,0x94,0x25,0xb6,0x3f,0x1b,0xbd,0x87,0xa,0x4d,0x63,0x82,0x4,0xaf,0x82,0xd9,0x8,0x37,0x80,0xb2,0x59,0x22,0x42,0x20,0x40,0xb7,0x47,0xb8,0xd0,0xc4,0x5d,0x1c,0x85,0xc8,0x80,0x74,0x97,0x15,0xab,0xfc,0x75,0xc6,0x67,0x62,0xcf,0xff,0x36,0x1d,0x53,0x7e,0xb0,0xe9,0x46,0xd,0x41,0x83,0xfc,0xad,0xa6,0x92,0x8b,0x9a,0xf6,0x84,0x19,0x11,0xf6,0x6,0xde,0x84,0xbd,0x1e,0xca,0xe0,0x55,0xc0,0xbe,0xd8,0x3,0xa3,0xb1,0x51,0xe4,0x13,0x40,0x9,0xe4,0x83,0x21,0x39,0x26,0x29,0x34,0x71,0x43,0x25,0xf7,0x1d,0x56,0xc0,0x1a,0xcf,0x87,0x22,0xb3,0x7b,0x6f,0x4f,0x4,0x8d,0x62,0xfd,0xa2,0x78,0x6c,0x71,0x40,0x79,0xdf,0x52,0xf5,0x94,0x7c,0x59,0xab,0x1b,0x55,0x22,0x33,0xe2,0x6b,0x5d,0x20,0xad,0x6a,0x91,0x63,0x1e,0x30,0x94,0x1d,0xe1,0x52,0x70,0x2c,0x81,0x2c,0x7,0x5,0xbb,0x72,0x32,0x8a,0xc9,0xec,0xea,0x58,0xb1,0x44,0x90,0x44,0x53,0xd1,0x34,0xea,0x3d,0xa,0x91,0x2a,0x6d,0x63,0x2f,0xd8,0xd6,0x92,0x73,0x8,0x80,0xb5,0xb1,0x4c,0xc0,0xc8,0x36,0x16,0xc6,0xcf,0x68,0x95,0x1c,0x2f,0x88,0xe4,0xf3,0xb,0xdc,0x4d,0xc3,0x7d,0x2f,0x43,0x35,0x37,0xe9,0xae,0x9a,0xb0,0x67,0xc5,0xfa,0x44,0x18,0x37,0xc7,0x3c,0xc2,0x21,0x9d,0x90,0x47,0xe3,0xf4,0xbb,0xf2,0x23,0x3e,0x89,0x8b,0x65,0x87,0x58,0x5,0x9e,0x73,0xcf,0x4b,0x29,0x58,0x30,0xe,0xde,0xaf,0xee,0x81,0x76,0xac,0x86,0x76,0xd3,0x77,0x7f,0xf0,0xfd,0x61,0x7f,0x70,0xd,0x60,0x7a,0x7a,0xbe,0xcb,0x28,0x8e,0x11,0xd3,0xd5,0x2a,0x1d,0xa6,0x1a,0x9e,0x66,0x26,0xaa,0x14,0xf,0xc0,0x59,0xa6,0xe4,0xc7,0x2,0x6f,0xc0,0x2,0x5e,0x83,0xa1,0x8d,0x76,0x41,0x8a,0xad,0xfc,0x52,0x7b,0xb0,0x84,0xb2,0x18,0x91,0xe4,0x2b,0xc4,0x11,0x5f,0x3b,0x37,0xb5,0x8b,0xe5,0xc5,0x25,0x5e,0xd4,0xb2,0x6e,0x36,0x98,0x21,0x74,0x95,0x78,0x0,0x4,0x38,0x45,0x5e,0x8b,0x61,0x28,0xce,0xd2,0x99,0x15,0x31,0xa8,0x55,0xe9,0x66,0x85,0x4c,0x41,0x9,0x32,0x24,0x63,0x71,0x1b,0x65,0xb5,0xd3,0x16,0x60,0x4,0x76,0xf5,0x79,0x55,0xc2,0xe2,0x1f,0x1f,0x52,0x89,0xe1,0x53,0x6b,0xdf,0x54,0x1d,0x43,0x15,0x12,0xb5,0x29,0x53,0x1a,0xd9,0x1b,0xd9,0x90,0xce,0x76,0xa5,0xbe,0xe4,0xb4,0x96,0x82,0x6b,0x5c,0xb6,0x4,0xf8,0xa9,0x21,0x55,0xc9,0xa5,0x9c,0xa6,0xbc,0x53,0xfc,0x86,0x13,0xc,0x7d,0x1c,0x82,0xb0,0xb1,0xb8,0xb1,0x25,0x99,0xb0,0x98,0x86,0xef,0xa,0xfa,0x82,0xdc,0x36,0x55,0x5c,0x5c,0x4,0x59,0x12,0x7d,0x8a,0x1b,0x3c,0xb2,0x9c,0x14,0xda,0x8a,0xdb,0x8b,0x72,0xa4,0x11,0x77,0x69,0x85,0x73,0xec,0x38,0x28,0x28,0x51,0xd8,0x6,0x11,0xc7,0xbe,0x10,0x43,0x65,0xcc,0xf6,0xea,0xfb,0xef,0x38,0x48,0x93,0xbb,0x4a,0x46,0x99,0x7f,0xa3,0xb8,0x69,0xfe,0xa,0x7c,0xde,0x41,0x63,0x42,0x4a,0xa5,0x62,0x81,0xc7,0x3a,0x9c,0xe5,0x80,0xe6,0x18,0x1e,0xc2,0x6b,0x22,0x5d,0x48,0xbe,0x39,0x99,0xb9,0xe2,0x4e,0x57,0xb3,0x40,0xa1,0xaa,0x66,0xbc,0x53,0xeb,0x87,0xae,0x34,0x4d,0xc7,0x8b,0x2b,0xf7,0x5d,0x9b,0x29,0x5,0x4,0xbb,0x85,0xfd,0xcd,0xde,0xf9,0x2f,0xb3,0xa,0x85,0xe9,0xc6,0x44,0xd0,0x64,0xad,0x7b,0xac,0x7d,0xba,0x96,0x53,0x3d,0x59,0x8b,0x66,0xa5,0x4d,0xb6,0x5a,0x22,0xa,0x44,0x53,0xe0,0xa9,0x44,0x30,0xe2,0x69,0x89,0x7d,0x2f,0x83,0x1e,0x22,0x76,0x95,0xe0,0xf,0x82,0x19,0x89,0x31,0x48,0x5f,0x3d,0xd1,0x2a,0x5f,0xb4,0x32,0x5d,0x70,0x4f,0xf6,0x81,0x28,0x51,0x28,0xa9,0x2,0x9e,0x46,0x47,0xa5,0xfd,0x74,0x97,0x5d,0xdf,0x91,0xd3,0x17,0xe2,0x95,0x32,0x41,0x34,0xe1,0xf0,0xe4,0x1b,0x12,0x9,0xd,0xb4,0x78,0xd7,0x5a,0xe2,0x2,0x53,0xde,0x50,0x94,0x50,0x70,0xa6,0x4d,0xa9,0xb8,0x7,0x38,0x87,0x5,0x60,0x8e,0x84,0x75,0x91,0x72,0xac,0xcf,0x30,0x39,0x4d,0x47,0x85,0xf1,0xe5,0x34,0x25,0xc,0xbe,0x72,0x9b,0xad,0x95,0xbc,0x15,0xd,0xcd,0x65,0xe0,0x2e,0x1d,0x0,0xad,0x44,0xf5,0x37,0xf6,0xdb,0x6e,0x59,0x1d,0x3b,0x3c,0x42,0x56,0xf5,0x91,0xac,0x69,0xb,0xb5,0xd6,0xbb,0xc7,0x56,0x62,0xbb,0x60,0xc,0x68,0x72,0x54,0x69,0x95,0x77,0xce,0x31,0x5e,0x29,0x17,0xb5,0x6c,0x15,0xc3,0x26,0xc5,0x21,0xbe,0xd0,0x68,0x43,0x36,0x41,0x86,0xe9,0x75,0xc6,0x33,0x9a,0x83,0x13,0xbc,0x93,0xa4,0xd9,0x5a,0x1d,0xa3,0x49,0x76,0x7d,0xc0,0x5,0xee,0xcc,0xaf,0x83,0x73,0xf2,0xb,0x5e,0x3a,0xd0,0x40,0xe4,0xec,0xaf,0xed,0x43,0x57,0x41,0xde,0x8a,0x85,0x2d,0x22,0xe3,0x6b,0x40,0xa6,0x8f,0x81,0x4b,0xcb,0xa1,0x52,0x3d,0xd0,0xd2,0x97,0x6c,0x6d,0xb4,0x96,0xda,0x63,0xbc,0xcb,0xc0,0x74,0xbc,0x5b,0xa3,0x1,0x3,0xc,0x25,0x54,0x1c,0x10,0x22,0x41,0x50,0x8c,0x9a,0x6b,0x1b,0x8a,0xec,0x7e,0x42,0xde,0xc,0xc1,0x52,0xa9,0xb5,0xa7,0xa0,0x6b,0x1b,0xc4,0x59,0x10,0x18,0x6f,0x46,0x32,0xd3,0x16,0x95,0x82,0x99,0xbc,0xa4,0xbf,0x57,0x40,0xc9,0xa2,0xf8,0x67,0xb5,0xe3,0x50,0x26,0xb5,0x14,0xeb,0x25,0x83,0x61,0xf,0xd5,0xc7,0x61,0x53,0x24,0x96,0x70,0xae,0xfc,0xce,0xa,0x5,0x97,0x72,0x3,0x25,0xdc,0x9,0xe5,0xed,0x54,0xa4,0x5,0x57,0x12,0x98,0xdb,0x12,0x7c,0xa2,0x61,0x3d,0x3f,0x37,0x6a,0x46,0x46,0x43,0x94,0x8b,0xac,0x67,0xae,0x58,0x6f,0x9a,0x66,0x63,0x5d,0x26,0x6a,0x44,0x54,0xcd,0xc1,0x4c,0x96,0x64,0x9e,0xc2,0x6b,0x39,0x32,0x7f,0x35,0xbf,0x9,0x70,0xe8,0x1a,0x59,0xe1,0xfb,0x3,0xb7,0x28,0xec,0x58,0x50,0xe9,0x17,0x33,0xba,0x43,0x74,0x57,0x1a,0x76,0xa3,0x6a,0x1b,0xf2,0x85,0x4e,0x7f,0xa9,0xb5,0x29,0x78,0xe5,0xe4,0x8e,0xb8,0x60,0x9e,0x9f,0x83,0x1f,0x95,0x66,0x2e,0xc3,0x89,0x7a,0x23,0xd1,0x6b,0x26,0x6c,0x6f,0x16,0xc6,0x57,0xbe,0xcb,0xde,0xf8,0x53,0x3a,0x5e,0x41,0x35,0x9e,0x3c,0x29,0x42,0xbd,0xe2,0xc6,0x58,0x33,0xae,0x82,0xcb,0xa5,0x3b,0x1a,0x59,0x41,0x87,0xe9,0x1,0xf1,0x56,0x43,0xde,0x1,0xe5,0xaf,0x17,0x61,0x67,0xb2,0x4d,0xd,0xaa,0xa6,0xbf,0x54,0x55,0x6a,0x2a,0x5c,0x5e,0x8b,0xb9,0x32,0x4d,0x19,0xe,0xee,0xc2,0x46,0xa3,0xc0,0x9c,0xca,0x44,0xcc,0x56,0xb7,0x4a,0x18,0xa8,0xb4,0xc4,0xab,0x94,0x6e,0x60,0x52,0x5,0x2c,0xc7,0x5f,0xc4,0x3e,0xa,0xad,0xc1,0xd9,0xf3,0xdc,0xca,0xd3,0x1c,0x9b,0xec,0x80,0xe5,0x7a,0x20,0x70,0x5a,0x44,0x6d,0xfa,0xc0,0xb9,0xd5,0xb2,0x44,0xfb,0xb5,0xc1,0xc4,0x2,0xcc,0x61,0x9f,0x22,0x66,0xc5,0xa9,0x5a,0xa,0xba,0x32,0x24,0x39,0xee,0xaf,0x44,0x14,0xa9,0xc4,0xf2,0x5d,0x87,0xb8,0xd0,0x63,0xc0,0x48,0xc1,0x19,0x87,0x9f,0x89,0x20,0x83,0xfa,0x56,0x11,0x49,0x96,0x3d,0x8d,0x29,0x12,0x34,0xe6,0x8e,0x35,0xc7,0x75,0xb3,0x4f,0x46,0x4b,0x66,0xe5,0x49,0x6f,0x94,0x5f,0x7f,0xf1,0x7e,0xd,0xa3,0x2e,0x27,0xe,0x4b,0x1,0xa0,0x73,0xc,0xa4,0x2b,0x5e,0x5f,0xf1,0xb9,0xf8,0xf5,0xee,0x68,0xb0,0xf,0x18,0x8e,0x91,0xe8,0xd4,0x51,0x8e,0x85,0x40,0xf8,0x36,0xe2,0xe0,0x5b,0x39,0x58,0x5e,0x24,0xd1,0x1b,0x59,0x48,0xb,0x0,0x13,0x69,0xc3,0xfa,0xd9,0x8,0x3c,0xed,0xf7,0x8e,0x6,0x44,0xa3,0x18,0x67,0x15,0x51,0xd4,0x92,0x2,0xe3,0x9f,0x48,0xeb,0x75,0x8f,0xfb,0xae,0x7f,0x7a,0x7c,0xc,0x40,0xbb,0x4b,0xbb,0x78,0x74,0xbf,0x8a,0x14,0xc2,0xa1,0x6,0x2,0x8,0xf3,0xcf,0xc6,0x9b,0x63,0xbc,0x11,0xf0,0x7b,0xe2,0xcd,0x7,0x92,0xde,0x7c,0x25,0x6f,0x10,0xd6,0x78,0x6f,0xdc,0x44,0x6e,0x21,0x95,0xee,0xd3,0x12,0xd5,0x3f,0x3a,0x4,0x7e,0x44,0xce,0x7b,0xe4,0xae,0x22,0x29,0xc4,0x9d,0x49,0x9c,0xc6,0x5a,0xd3,0xe8,0x33,0xd2,0x33,0xec,0x9f,0x9f,0x1e,0x1d,0x91,0x7e,0x4f,0x57,0xa,0x4d,0x58,0xa9,0xeb,0x29,0x5c,0x3b,0xff,0x15,0x38,0x75,0x76,0x3e,0x18,0xe,0xeb,0x71,0x2a,0xc0,0x85,0x49,0x9c,0x49,0xff,0x6a,0xa4,0x9d,0xf,0x8e,0x6,0xbd,0xe1,0xa0,0x1e,0x71,0x30,0xbb,0xe2,0xe0,0x4a,0x5a,0x77,0xfa,0x98,0xb5,0xaa,0x9f,0x94,0xb6,0xef,0x6,0x7f,0xeb,0xe3,0x45,0x98,0xa0,0x2c,0x1e,0x2b,0xb5,0xf8,0x8b,0x77,0x75,0x5c,0x11,0xa7,0xd,0xac,0xf0,0xf0,0x3a,0x5d,0xd2,0x41,0x25,0x5b,0xd6,0x18,0x4f,0x44,0xd6,0x4d,0x55,0xd5,0x8b,0xde,0x4b,0xad,0x22,0x6e,0x44,0x57,0xf6,0x39,0xec,0x6b,0x15,0x31,0x97,0x1b,0x4f,0xf3,0x84,0x25,0x2d,0xe2,0xc2,0x6e,0xc9,0x56,0x6b,0x2e,0x5f,0x62,0xa6,0x72,0x85,0x79,0xcd,0x2d,0x17,0x6c,0xa7,0x2f,0x42,0xc2,0x6f,0xde,0xd6,0xdc,0xa9,0xa4,0x38,0x1f,0xf7,0x69,0x68,0x47,0x8c,0x77,0xa4,0x55,0xec,0xe5,0x32,0x60,0xb6,0x0,0xad,0x33,0xfd,0xbf,0x48,0xc3,0x47,0x55,0x6f,0x2f,0x5d,0x1d,0x6d,0xc4,0x4d,0x4e,0xa,0x59,0x73,0xf8,0x20,0xcf,0x87,0x23,0x8f,0x44,0xb0,0xf1,0x8b,0xc6,0xb2,0x38,0x52,0x39,0x42,0x93,0x1a,0xa9,0x4f,0xb0,0xbb,0x46,0x94,0x28,0x39,0x14,0x14,0x1,0x9b,0x89,0xbc,0x27,0x6d,0x88,0x0,0xb,0x42,0x65,0x55,0x3b,0x1b,0x11,0x7f,0xd1,0xa5,0x22,0xc3,0xb9,0x69,0x54,0x8c,0x2a,0x64,0x97,0x5c,0x12,0xcd,0xce,0x5,0x9f,0x28,0x3a,0x54,0xd2,0x55,0x49,0xdc,0xa5,0xb8,0xa,0xaa,0xf0,0xe1,0x67,0x63,0xc9,0x72,0x7e,0x54,0xed,0x3b,0xd6,0x61,0x51,0x69,0xa3,0x1a,0x41,0xa8,0x35,0xc0,0xea,0x52,0xee,0x14,0xc6,0x2e,0xc7,0xa3,0xcb,0x21,0xe8,0x7a,0x23,0xbc,0xdb,0x1f,0x1c,0xf5,0xfe,0x26,0x5e,0xc,0x90,0xf2,0xa3,0x16,0x8c,0x5c,0x73,0x9c,0x5a,0x48,0xb1,0x6,0x38,0x5c,0x77,0xd8,0x2a,0xfc,0xb7,0x1a,0xf2,0x15,0x3b,0x3b,0x1f,0x1c,0x17,0xc0,0xdb,0xa,0xbc,0xb6,0x26,0xb9,0x95,0x90,0xac,0x6,0xa,0x5b,0x7b,0xa8,0x52,0xa0,0xb5,0xa,0x5b,0xad,0x3d,0x4a,0x39,0x7c,0xaa,0x8d,0x98,0xd6,0x1e,0xaf,0x14,0x14,0xad,0x81,0x83,0xd6,0x1e,0xb0,0x2,0xea,0xd4,0x46,0x37,0x6b,0xe,0xb8,0x1c,0xbf,0x2c,0x1,0x2b,0x75,0x50,0xca,0x6a,0x78,0xb2,0x6,0x2e,0xa9,0x2,0x24,0xb1,0x24,0x7c,0xdc,0xf0,0x43,0xe2,0xe7,0x8c,0x6e,0x8a,0x4d,0xdc,0x72,0x68,0x40,0x2b,0x13,0xeb,0xee,0x6c,0xd0,0xbb,0x10,0x6f,0x15,0x9c,0xd1,0x6d,0x63,0x8a,0x5e,0x87,0x19,0xeb,0x5d,0x76,0xca,0x22,0x2a,0xab,0xe3,0x95,0x9,0x72,0x9d,0x4b,0x23,0xbb,0xa2,0xff,0xc1,0xc9,0x3e,0x93,0x63,0x14,0xf9,0x87,0x94,0x55,0xd,0x35,0x19,0xd5,0x89,0x47,0x52,0x46,0x52,0x14,0x9a,0x33,0xcb,0x2,0xb0,0xa1,0x35,0xe1,0xe2,0xc5,0xca,0x65,0xa8,0x2b,0x8e,0xc4,0x16,0x39,0x11,0x97,0x60,0x72,0xf1,0xc7,0x82,0x62,0xcb,0x3c,0x9f,0xa9,0xed,0x8a,0x8b,0x4f,0x65,0x74,0x2e,0x49,0xd,0x32,0xd0,0x4,0x60,0x0,0xad,0x29,0x8f,0xb1,0x45,0xd9,0x8c,0xf8,0x5c,0xb4,0xca,0xb7,0x24,0x49,0xbc,0xcf,0x22,0x2c,0x64,0x4b,0xc5,0xdb,0xdc,0xe6,0x1b,0x2c,0xf8,0xc3,0xb3,0x8b,0xb7,0xb8,0x4c,0x12,0xd7,0x2d,0x40,0x7,0x92,0x5f,0x84,0x57,0xc0,0x96,0xb2,0x13,0xf7,0xb0,0xb9,0xe9,0x7a,0xf,0xc5,0x88,0xb1,0x1d,0x9e,0xcb,0xf0,0x60,0xb5,0x18,0x92,0x68,0x76,0x1c,0x48,0x44,0x52,0xce,0x17,0xd9,0x92,0x38,0x12,0x59,0x71,0x8a,0x4a,0x6f,0xe0,0xc8,0xfb,0xd4,0x5a,0xa1,0x51,0x2d,0x28,0x93,0x8,0x5d,0xc0,0x9d,0x1e,0x75,0x7c,0xa0,0x8e,0x9a,0x21,0x42,0x79,0x8d,0xc1,0x84,0x66,0xd1,0xb,0x70,0x3d,0x2,0x52,0xa7,0x13,0xb5,0x91,0x89,0x4f,0xa4,0x8d,0xd6,0xe3,0xa2,0x65,0x6a,0xda,0x21,0x22,0x92,0x71,0x29,0xbb,0x99,0xd9,0xce,0xb8,0x77,0x76,0x98,0xe8,0xc,0xae,0x33,0x92,0x5a,0xb5,0x65,0xbe,0x94,0x42,0xf6,0xf9,0x83,0x4d,0x75,0x68,0xee,0xdb,0xe9,0x4b,0xfc,0x35,0xf,0xb8,0xb,0xbc,0xfd,0x41,0xa6,0x62,0x24,0xbc,0x4a,0x9c,0x23,0xa,0xb4,0x57,0x2c,0x4a,0xec,0x57,0xd6,0x20,0x46,0x85,0xc5,0xfa,0x55,0xb5,0xf3,0x75,0x85,0xc1,0x40,0xe5,0xc4,0x90,0xe8,0xd,0xb2,0xd6,0x44,0x6b,0x25,0xa0,0x10,0x5a,0x4d,0x73,0xd,0x12,0x88,0xd4,0xd6,0x73,0xf0,0xc6,0xbb,0x2c,0x8b,0x6b,0xf4,0x26,0x79,0xd0,0xa3,0xb7,0x14,0xb0,0x84,0x1a,0x7b,0xa3,0x5c,0x23,0x5,0x58,0xf0,0x5c,0xab,0x4f,0x98,0x0,0xb5,0x25,0x2a,0xd0,0xab,0xa7,0x60,0x41,0xab,0x2d,0x5c,0x3b,0xaa,0xc3,0x8d,0xe4,0xa4,0x10,0xfb,0x7c,0xbd,0xb6,0xf4,0xcf,0xa8,0x2e,0x3c,0xb4,0x5e,0x5d,0xf3,0xdc,0x79,0xbe,0x4a,0xbf,0x57,0x36,0x46,0xce,0xf,0xeb,0x2d,0x33,0x3e,0xb3,0xac,0x6d,0xc1,0xa9,0xea,0xad,0x95,0x97,0x4a,0x24,0xaa,0x1c,0xa0,0xde,0xbe,0xcc,0x43,0x6a,0x3d,0x8,0x17,0xb6,0xab,0xf6,0xf8,0x49,0x23,0xe5,0xd8,0x74,0x2d,0xb3,0x6e,0xa,0xb5,0x84,0x63,0xd3,0xfb,0xa2,0xf7,0x6e,0xe6,0x7b,0x22,0xd7,0xd6,0xce,0xac,0x87,0x1b,0xaf,0x4a,0x3,0xb3,0x5e,0xae,0x5d,0xf6,0x37,0x16,0xa4,0x5d,0x25,0x65,0x4c,0x8c,0x31,0x7a,0x10,0xeb,0xd3,0xcc,0x9b,0xe9,0x8c,0x72,0xdd,0xca,0x41,0xa5,0x7d,0x4d,0x9a,0xe8,0x56,0x57,0x9f,0x6d,0x6c,0x44,0xe3,0xf9,0xc8,0xda,0x9a,0x6d,0xd5,0x2a,0x27,0x96,0x33,0x5b,0x59,0x33,0xa8,0xba,0x66,0x91,0x9,0x4c,0xd7,0x92,0xac,0x9a,0xd8,0xc5,0xd2,0x29,0xcb,0xfb,0xe,0xbb,0xea,0xb7,0x56,0x25,0xfe,0xb,0x15,0xbb,0xc9,0x27,0xad,0x50,0x65,0xf4,0xef,0xc6,0x1f,0x4a,0xbb,0x26,0x57,0xb5,0x2b,0x7e,0x6a,0xc5,0xe4,0x23,0x76,0xc5,0x4f,0xed,0xe1,0xb7,0xc3,0xd3,0x93,0x5d,0xf1,0x53,0x57,0x7b,0x95,0x8b,0xbe,0x9b,0x7c,0xca,0x17,0x1e,0x80,0xac,0xb8,0x58,0x7c,0x2e,0x50,0x18,0x13,0xa8,0x15,0x9c,0xcc,0xa6,0x37,0xa4,0x94,0xf2,0xb7,0x56,0xf0,0xd2,0xf3,0xe8,0xc0,0x73,0x37,0xfe,0xa0,0x15,0x89,0x6c,0xfe,0x5d,0xf9,0x4b,0x7b,0x2c,0xdd,0xc1,0xae,0xfa,0xad,0xf3,0x4e,0xfa,0x9a,0xdd,0xf8,0x43,0xbb,0xe0,0x71,0x71,0x35,0x50,0xaa,0x4d,0xa2,0x29,0x99,0x37,0xe1,0xa6,0x9f,0xa0,0x3f,0x86,0xee,0x19,0xfe,0x52,0x4c,0x28,0x25,0x34,0x6,0xa1,0x6b,0x78,0x2c,0xbb,0xc4,0x73,0x68,0xad,0xad,0x27,0x3d,0x81,0x8e,0x45,0xab,0x72,0xe0,0x24,0x62,0x93,0xfc,0x15,0x9a,0xe2,0xf8,0x63,0x6f,0x34,0x93,0x4e,0x48,0x79,0xd9,0xf,0x73,0x83,0x32,0xac,0x1e,0x9,0x80,0x29,0xe0,0x99,0x8b,0xe2,0xfc,0xe3,0x7f,0xff,0x8b,0x35,0xe3,0x76,0x4d,0x76,0xe3,0x78,0x38,0x5b,0xb3,0xc6,0x1e,0x5d,0xff,0xc4,0x1b,0xdd,0x5a,0xed,0xb2,0x4,0x8f,0x75,0xfb,0x97,0xad,0x96,0xf7,0x9e,0x9d,0xff,0xa2,0x9b,0xc9,0x33,0x97,0xd8,0x4,0x3e,0xb7,0xab,0x30,0x41,0xd6,0xcf,0x33,0xe0,0x94,0x43,0xb2,0x64,0xb0,0xbf,0x91,0x9e,0xa0,0xab,0x6e,0x14,0x8d,0x6d,0x9,0xfb,0xe2,0x79,0x12,0x6a,0xc0,0xcb,0xff,0xe8,0xe3,0xcb,0xf9,0x21,0xfd,0x8d,0x13,0x51,0xe3,0xdb,0x61,0x2,0x38,0xd5,0xab,0x3d,0x66,0xee,0x4b,0xb1,0xb9,0xa9,0x6c,0x28,0x6b,0xa8,0x86,0xa,0x5f,0xd1,0xb9,0xb9,0x1a,0x12,0x9,0x3b,0xea,0xa3,0x79,0x4f,0x2f,0x75,0x33,0xb1,0x2,0xa6,0xb9,0x54,0x3e,0x78,0x3c,0xa4,0x36,0x34,0x24,0x34,0xc6,0x6b,0x77,0x70,0xc7,0xae,0x51,0xbc,0xc2,0x54,0xdc,0x70,0x8b,0x99,0xa5,0x90,0x36,0xce,0xe3,0x88,0x93,0x40,0x12,0xe0,0x27,0xe9,0xd1,0xb1,0x48,0x3e,0xaf,0x30,0x97,0x9b,0xa5,0x92,0x78,0xae,0xc7,0x7a,0x4a,0x49,0x6,0x33,0xa7,0x1d,0xcb,0xf9,0xb7,0x14,0xa7,0x4c,0xf5,0x52,0xee,0x71,0x7a,0x3e,0xad,0xfe,0x72,0x12,0x52,0xb8,0x67,0x94,0x8f,0x84,0x89,0xc6,0x98,0xf2,0xdb,0x61,0x9c,0x2c,0x91,0xce,0x28,0x49,0xac,0xf8,0xc7,0xff,0xfc,0x77,0x23,0x5e,0x2e,0xcf,0xd3,0xd3,0xf2,0x6c,0xf2,0x85,0x80,0xc8,0x6c,0xf0,0xc3,0xa0,0x7f,0x49,0x31,0x4b,0x36,0xbc,0xe8,0x9d,0x5f,0x34,0x4a,0xeb,0x96,0xf4,0xa7,0x50,0x74,0xf6,0x9c,0x3f,0x75,0xff,0x32,0xe1,0xa4,0x5b,0xcc,0x20,0x8c,0x93,0x1a,0x1b,0xc4,0x1f,0x61,0xef,0x82,0x6b,0xb8,0x7d,0x1e,0x35,0x96,0x26,0x35,0xd6,0x42,0xbf,0x7f,0xd2,0x49,0x4b,0xc5,0x2c,0xc,0x93,0x92,0x71,0xb2,0xf9,0x49,0x77,0x3a,0x85,0xd0,0xa0,0x4,0xa7,0xd5,0xf0,0xb6,0x40,0x9c,0x1a,0x6,0x53,0x51,0x6a,0x28,0xc7,0xca,0x60,0x6e,0x72,0x9f,0xa,0x74,0x93,0xd7,0x36,0x30,0x48,0xab,0xcd,0x74,0xed,0xd6,0x7b,0xcc,0x4f,0x3c,0xed,0x5b,0xeb,0x47,0xb4,0x92,0x3d,0x15,0x59,0x95,0x88,0x22,0x9b,0x12,0xd0,0xad,0x4c,0x98,0xaa,0xd0,0x99,0xb2,0x23,0xc4,0xb3,0xa3,0xc1,0x5,0x42,0x69,0x6,0x6e,0xfc,0xe9,0xb,0x23,0xe,0x90,0x2f,0xe2,0x94,0x92,0xb0,0xf5,0xae,0xaa,0x9b,0x6a,0x95,0x4a,0xf2,0x95,0xae,0x43,0xa1,0xf6,0xc8,0xec,0x86,0x51,0xc2,0x5c,0x35,0xe2,0xf5,0x74,0x8f,0xdc,0x5e,0x75,0xdd,0x39,0xa9,0x14,0xe,0x99,0xb,0x2f,0x33,0x37,0xbc,0xd2,0xdc,0x8d,0x4f,0x47,0x7d,0x72,0x19,0x40,0x1f,0x4a,0xe4,0x77,0x97,0xa4,0xff,0xd0,0xe6,0xb1,0xa4,0x62,0x65,0xf6,0x4e,0xe1,0x0,0x4a,0xd8,0xc7,0xca,0x59,0x2d,0x52,0x96,0x4e,0x28,0x31,0xd2,0xa9,0x5a,0xcf,0x9e,0x9f,0x89,0x9,0x65,0x2d,0x62,0x3e,0xbf,0x6a,0xb5,0x7d,0xcb,0x67,0xd6,0x54,0x58,0x4d,0x2d,0x71,0x31,0xde,0xcf,0x26,0x5e,0x6b,0x14,0xbf,0x69,0xa6,0x34,0x36,0xf2,0xd1,0xbe,0xeb,0x23,0x1d,0xd0,0xa0,0xa6,0xe7,0xc9,0x59,0x4c,0x95,0xac,0xac,0x6d,0x97,0x63,0x4f,0x94,0x3f,0x23,0x2b,0x39,0xc3,0x28,0x37,0x6c,0x49,0x67,0x2b,0x2d,0x5b,0x52,0x33,0x31,0x6d,0xf9,0x83,0xc7,0xa,0xcb,0xf6,0x71,0x46,0xad,0x8e,0x11,0xcb,0xf,0x9d,0x9c,0xf9,0x25,0xb4,0x9a,0xf9,0x68,0x58,0x81,0x5c,0xd2,0xa1,0xf9,0x75,0xd2,0xb2,0x52,0xf4,0xa2,0x5e,0x28,0x7a,0x39,0x15,0x95,0x73,0x69,0xd3,0x22,0x6b,0x55,0x1b,0x4a,0x56,0x32,0x4a,0x72,0xab,0x95,0x14,0xa7,0x63,0xfc,0x21,0xe,0x45,0xb2,0x3a,0x53,0x6a,0x5c,0xb9,0x8d,0x56,0x45,0xe,0xed,0xd8,0xbe,0xd7,0xc9,0x1b,0x89,0xb7,0x8d,0x29,0xa,0x41,0x9d,0x7d,0x5f,0x38,0xf0,0xc1,0x33,0x53,0x4,0xf1,0xd4,0xeb,0x69,0x84,0x13,0x9d,0x77,0x30,0x70,0xa3,0xa4,0x26,0x1d,0x12,0xa4,0x6f,0xed,0x42,0xa5,0x92,0x3a,0x21,0xfd,0x7d,0x0,0xf3,0xc6,0xb,0xf0,0x76,0x91,0x97,0x5e,0x84,0x17,0x2c,0x51,0xb7,0xdb,0xfe,0x7,0xbc,0x60,0xc1,0xb1,0xc7,0xec,0x77,0x3b,0x3b,0x3b,0x8d,0xca,0x76,0x13,0xf4,0x3e,0xb4,0xff,0x2e,0x48,0xd9,0x46,0xa3,0x42,0x4d,0x4d,0x12,0x26,0xde,0xf8,0x2,0xc7,0xdf,0x47,0xba,0xf1,0xd8,0x40,0x17,0xad,0x65,0x75,0x65,0xf8,0xe0,0xc2,0xa3,0x3f,0xcc,0x2,0x83,0xab,0xbe,0xbf,0xe2,0xf8,0xe3,0x55,0x51,0xb9,0xf5,0xaa,0x74,0x8,0x4b,0xc,0x60,0xd1,0xa4,0x54,0x48,0x3c,0x6b,0x54,0x68,0x8b,0xb3,0xc7,0x6,0x55,0xa,0x24,0x8d,0x8,0xc2,0x30,0x48,0xf9,0x24,0xda,0x6d,0x60,0xc5,0xe0,0xd5,0xc5,0xf1,0x51,0x7c,0xdb,0x32,0x6f,0xc6,0xfc,0xf9,0xca,0x21,0x21,0xc2,0xc0,0x16,0xe7,0x95,0x89,0xba,0x60,0x2b,0x80,0xbf,0x6,0x27,0xde,0x41,0x8d,0x3f,0x3,0x87,0x58,0x4b,0xd3,0x4c,0xb4,0x21,0x7,0xc4,0x49,0x11,0xd0,0x54,0xbb,0xc9,0xad,0xfa,0x93,0xf7,0x65,0x45,0x8a,0x17,0xd7,0xd5,0xa5,0x55,0x8c,0x21,0x6b,0xc6,0x31,0x77,0x25,0x21,0x3b,0x4e,0xf,0x5a,0x5c,0xad,0xd5,0xd,0xaa,0x82,0x57,0xcf,0x5b,0x89,0xa5,0x8c,0xdb,0x48,0x43,0xa0,0xe,0x64,0x33,0x63,0x26,0x35,0xa4,0xce,0xc5,0x2f,0x24,0x92,0xef,0x10,0xfe,0xc0,0x13,0xd5,0xcf,0xd5,0x73,0xb8,0xb8,0x69,0xdd,0xe8,0x7c,0x85,0x7f,0xa9,0x6a,0xe6,0x6a,0x45,0x42,0xc5,0x1a,0x5b,0x71,0x71,0x42,0x37,0xbd,0x61,0x27,0xa3,0xb2,0x71,0xc3,0x56,0x39,0x71,0x13,0x34,0xc,0x8d,0xc2,0xac,0x42,0x21,0xa0,0xb2,0xe7,0x91,0x94,0x1d,0x66,0x72,0x6e,0xb9,0xb7,0xdc,0xc0,0xbb,0x61,0xb2,0xbc,0x88,0x6f,0xc9,0x76,0x97,0x38,0x8e,0x70,0x36,0xa2,0xd7,0x19,0x4c,0x66,0x8e,0xce,0x73,0x72,0xce,0x2a,0x27,0x15,0x7f,0x31,0x11,0xfa,0xd5,0xcc,0x3b,0xe6,0xb4,0x5d,0xd5,0xb5,0xf,0xa1,0xe3,0x6b,0x9a,0xce,0xc2,0xa9,0xb8,0x77,0xbb,0xe4,0xc6,0xa5,0xe7,0x8c,0x5f,0xde,0xc6,0xeb,0x5b,0x9a,0x21,0x5c,0x23,0xb8,0xd,0xe8,0x8d,0x4a,0x25,0x87,0xe2,0x65,0xd5,0x48,0x74,0xbf,0xdb,0x7a,0x6,0xe9,0xb1,0x62,0x83,0xc2,0x75,0xbd,0x8a,0x1e,0x4,0x1d,0x6d,0xbc,0xe2,0x7a,0x6b,0xc9,0xf9,0xba,0xe6,0xe9,0xfb,0x9e,0x6f,0x3,0xc3,0xc4,0x18,0xb7,0x34,0x63,0xa3,0x2a,0x1d,0xb9,0x90,0x38,0xec,0xcf,0x25,0xba,0x53,0xd0,0x33,0x83,0xe3,0x15,0xb0,0x10,0x19,0xcb,0x24,0x45,0xda,0xf6,0x45,0x1e,0x85,0x68,0xfd,0x1b,0xcf,0xa,0xc6,0xfa,0x5d,0x86,0xa2,0xee,0xca,0x5b,0x24,0x45,0xdd,0xcd,0x5a,0x1f,0x2,0x76,0xa5,0x7b,0xff,0x55,0x20,0xb6,0x90,0xc8,0xf,0x58,0x1,0xf7,0xe1,0xca,0x18,0xaf,0x96,0x47,0x9e,0x1a,0x8e,0x32,0x8c,0x97,0xe1,0x4e,0x59,0x85,0x2c,0xf4,0xcc,0x6d,0xe0,0x3f,0x3a,0xc2,0x10,0x3,0x53,0xfd,0x4,0x67,0x29,0x46,0x8d,0x5d,0x45,0xd5,0x1d,0xd7,0x26,0xc5,0x15,0x9b,0xed,0x6c,0x12,0xd8,0x40,0x6c,0xd7,0xbf,0xc5,0x9b,0x5f,0x4c,0xcf,0x15,0x1,0x74,0xba,0xb5,0x2c,0x6a,0xe4,0x43,0x2e,0xdd,0xa4,0x5,0xcd,0xb7,0xb4,0x49,0x41,0x54,0x69,0x1b,0x5,0x8e,0x4a,0x9b,0x95,0xc3,0x64,0x52,0x84,0x56,0xf7,0xff,0x0,0xf7,0x2a,0x2c,0xcd,0xea,0x79,0x0,0x0 };
 
-const uint8_t script_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0xad,0x19,0x69,0x73,0xdb,0xb8,0xf5,0xbb,0x67,0xfc,0x1f,0x10,0xa6,0xb3,0x22,0x37,0x32,0x25,0xc7,0xb9,0xd6,0xaa,0x37,0xe3,0x58,0xca,0xd4,0x4d,0x1c,0xa7,0x96,0xb3,0x9e,0x36,0x49,0xb5,0x10,0x9,0x49,0x8c,0x29,0x52,0x21,0x41,0xcb,0x6a,0xd6,0xff,0xbd,0xef,0x1,0x20,0x8,0x50,0x94,0x8f,0x9d,0xcd,0x4c,0x12,0x1,0xef,0xc0,0xbb,0xf0,0xe,0xb0,0xf3,0xf3,0xf6,0x16,0x21,0xe4,0x7c,0x16,0xe5,0x24,0x4f,0x27,0x7c,0x49,0x33,0x46,0xe0,0x77,0x1c,0x5,0x2c,0xc9,0x59,0x48,0x8a,0x24,0x64,0x19,0xe1,0x33,0x46,0x4e,0x8e,0xcf,0xc9,0x7b,0xb9,0xed,0x93,0x21,0x63,0x62,0x53,0xe1,0x91,0x49,0x14,0xc3,0x3f,0x69,0x46,0x42,0xc6,0x69,0x14,0xe7,0xbe,0x60,0x3b,0x4c,0x8b,0x2c,0x60,0xfb,0x64,0xc6,0xf9,0x22,0xdf,0xef,0x74,0xa6,0x11,0x9f,0x15,0x63,0x3f,0x48,0xe7,0x9d,0x7c,0x41,0x3,0x36,0x2b,0x66,0x9,0x67,0xc1,0xac,0x73,0x11,0xbd,0x8d,0xfa,0x45,0x70,0xb9,0xbd,0x25,0xe8,0x4e,0xd2,0x30,0x9a,0x44,0x70,0x3a,0x4d,0xe0,0x6f,0x48,0x17,0x1c,0x7e,0x8f,0x57,0xfb,0x2,0x48,0x76,0x48,0x9f,0x65,0x2c,0xb8,0x7c,0xb5,0xb,0xeb,0x9f,0x3b,0xdb,0x5b,0x41,0x9a,0xe4,0x9c,0x7c,0xe2,0x70,0x2e,0x39,0x20,0x3f,0x10,0x6b,0xb0,0x4f,0xdc,0x28,0xf4,0xc8,0xc1,0xaf,0x24,0x4c,0x83,0x62,0xce,0x12,0xee,0x4f,0x19,0x1f,0xc4,0xc,0x7f,0xbe,0x59,0x1d,0x87,0x8,0x6e,0x23,0x6a,0x9c,0x4e,0x1,0x79,0x9e,0x4f,0x5,0x36,0xf2,0x4a,0x63,0xe6,0xc3,0xae,0xd8,0x2b,0x51,0x46,0xcb,0x7c,0x3,0x96,0xf3,0xf9,0x62,0xf8,0x95,0x38,0xe4,0x9,0xd1,0xf8,0xf8,0x37,0x4c,0x97,0x49,0x9c,0xd2,0xf0,0xfc,0x9a,0xbb,0x68,0x9d,0xf,0x74,0xce,0xda,0xc2,0x4e,0x47,0x29,0x28,0x9d,0x70,0x4f,0x4a,0x4a,0x88,0x14,0x9f,0xc5,0x20,0xbb,0x96,0x35,0xc8,0x18,0xe5,0x4c,0x89,0xeb,0xb6,0x68,0xcb,0xeb,0x49,0x64,0x16,0xfb,0x39,0xe3,0x87,0x9c,0x67,0xd1,0xb8,0xe0,0xcc,0x6d,0xcd,0x32,0x36,0x69,0xb5,0x49,0x2b,0xa4,0x9c,0xee,0x73,0x76,0xcd,0x3b,0x8b,0x98,0x46,0x49,0x2f,0x98,0xd1,0xc,0x30,0xf,0xa,0x3e,0xd9,0x79,0xd5,0x6e,0x81,0x78,0x2c,0x9,0xd2,0x90,0x7d,0x3a,0x3b,0x3e,0x4a,0xe7,0x8b,0x34,0x41,0xc6,0xa6,0x38,0x1b,0x4f,0x28,0x35,0x69,0x49,0xf1,0x51,0x11,0x13,0x97,0xaf,0xc0,0x10,0x61,0x94,0xc3,0xb1,0x2b,0x50,0xa1,0x95,0x0,0xeb,0x96,0x82,0x6b,0x7d,0xc6,0x69,0xb8,0xf2,0xe9,0x62,0xc1,0x92,0xf0,0x68,0x16,0xc5,0xa1,0xcb,0x62,0x83,0x47,0x0,0x61,0x74,0xe9,0x7a,0x8d,0x44,0x19,0x9b,0xa7,0x57,0xcc,0x26,0xba,0xd1,0x56,0x9e,0x44,0xd7,0x6f,0x95,0x4c,0xda,0xca,0xda,0xb0,0xd1,0x84,0xe8,0x4d,0x3f,0x66,0xc9,0x94,0xcf,0xc8,0xaf,0xa4,0xab,0xe1,0x36,0xc6,0xe7,0xee,0x57,0xf2,0xe8,0x0,0x14,0xe8,0xb4,0x3c,0xad,0x28,0x11,0x6b,0x30,0x5e,0xb9,0xd1,0x2b,0x49,0xd,0xc,0x7d,0x46,0xc6,0xc0,0x8,0x1,0x73,0x3b,0xa4,0x33,0x5,0x97,0xec,0x68,0xaf,0xdd,0xc8,0xff,0x32,0xc6,0x8b,0x2c,0xb1,0x79,0x19,0xba,0xa4,0xd9,0x9c,0x42,0x6c,0x72,0x96,0xbb,0x63,0xfc,0xd7,0x52,0x24,0xca,0x3f,0xd0,0xf,0xe5,0xfe,0x1f,0x7f,0x10,0xf1,0x8b,0x1c,0x80,0xc0,0xa0,0x90,0x62,0xdc,0xea,0x92,0x37,0xa5,0xe9,0x91,0x46,0xe2,0xfc,0x9d,0xec,0x76,0x9f,0x3e,0xd3,0x48,0x72,0xf3,0x9,0x69,0x6d,0xc2,0x7d,0xf6,0xea,0xf9,0xcb,0x17,0x1a,0x5d,0x1,0x3a,0x92,0x89,0xcf,0xd3,0xb7,0xd1,0x35,0xb,0xdd,0x5d,0x4f,0xb0,0x78,0xa7,0x79,0xac,0xa3,0x4b,0x3e,0x75,0x8a,0x13,0x45,0x81,0x7a,0xe3,0xff,0x51,0xfe,0x1b,0x8d,0xa3,0x50,0x78,0x30,0x69,0x93,0x9c,0xa7,0x19,0x9d,0xa2,0x55,0x9d,0xe1,0xc7,0xe3,0xb7,0x6f,0x87,0x8e,0xb6,0x42,0xcc,0x38,0x49,0xa4,0xc5,0x13,0x1f,0xa2,0x73,0xae,0x23,0xa6,0xd2,0x42,0x93,0x1f,0x34,0x30,0x20,0x9a,0xdc,0x72,0xd6,0xe7,0xff,0xd2,0x9d,0xff,0x1d,0xee,0xfc,0xa7,0xbb,0xf3,0x8b,0x3f,0xfa,0xb2,0xd3,0xf9,0x2a,0x9c,0xa7,0x7d,0x27,0x19,0x27,0x76,0xc,0x91,0x9f,0x7e,0x22,0x8f,0xc4,0x5e,0xce,0x69,0xc6,0xf3,0xb,0xc8,0x6c,0x2e,0x46,0x8e,0x57,0x9e,0x21,0xc3,0x26,0xa9,0x42,0xe6,0x6,0x22,0x1d,0x32,0xe5,0x3,0x64,0xd9,0xa9,0x49,0x72,0xa3,0xd2,0xe3,0x7d,0x34,0xad,0xcb,0xc,0x8e,0xc5,0xa8,0xb1,0xd5,0xd8,0xdb,0x35,0x28,0x8,0xa1,0x31,0xcb,0xb8,0xfb,0xbb,0x88,0x6a,0x9e,0xa6,0xe4,0x6f,0x3f,0xea,0x1c,0x5e,0x93,0x56,0x3e,0x4b,0x33,0xde,0x22,0xfb,0xa4,0x15,0xa7,0xc9,0xb4,0x75,0x43,0xdc,0x13,0x7a,0xd,0x9c,0x88,0x48,0x38,0xde,0xef,0x95,0xd9,0xaa,0x78,0xa7,0xa0,0xb8,0xde,0xbe,0x29,0x7f,0x28,0xa8,0x69,0x22,0x53,0x41,0xfb,0xec,0xbd,0x3b,0xa4,0xbf,0x4b,0xf6,0xbd,0x87,0xc9,0xde,0x20,0xb9,0x25,0x9c,0xf4,0x7d,0x94,0x4,0x71,0x11,0xc2,0x75,0x6d,0xf9,0xe8,0xf9,0x9a,0x30,0xe,0x66,0x26,0x2,0x19,0x19,0x2a,0x64,0x94,0x26,0xc0,0xf3,0x7b,0x11,0x65,0x50,0xc9,0x5c,0x9f,0x5f,0xf3,0x36,0xf1,0xc3,0x9c,0x40,0xc5,0xf4,0xbf,0xe5,0x9e,0x73,0xbf,0x93,0xeb,0x16,0x3,0xc0,0x4d,0xf,0x81,0xb2,0x84,0xc,0x20,0x9c,0x44,0x15,0xf4,0x7,0xbd,0x72,0xf,0x2a,0x94,0xde,0x85,0xdf,0xe6,0x3e,0x94,0x34,0x13,0x4,0x4b,0xd,0x2d,0x53,0xfe,0x8,0x4,0xd5,0x38,0x46,0x45,0xf3,0xc7,0x51,0x12,0xba,0x62,0xdb,0xd3,0x44,0x46,0x2e,0xd6,0x34,0xc6,0x5e,0x8d,0x66,0x7b,0xab,0xd3,0xc1,0xe0,0x85,0xf0,0x1d,0x72,0xca,0x8b,0x9c,0x9c,0xd0,0x4,0x2,0x3a,0x93,0x9b,0xc0,0x34,0xa6,0x79,0xae,0x60,0x25,0x48,0x58,0x58,0x9c,0x96,0x15,0x1,0x5c,0x0,0x57,0x1b,0x9d,0x43,0x7,0xe3,0x7,0x45,0x96,0x41,0xe1,0xc0,0xe4,0xe1,0xf4,0x8c,0xfd,0x8,0x2a,0x5c,0x76,0x45,0xb1,0xc2,0x26,0x45,0x1c,0x9b,0x20,0x48,0xba,0x1,0x54,0x17,0x68,0x27,0x0,0xd8,0x2d,0xad,0x2a,0x53,0xa,0x94,0x41,0x77,0xe,0x25,0x73,0xd3,0x21,0x8,0xeb,0x99,0x35,0x3c,0x17,0xc2,0xe,0xf0,0x9c,0x81,0xeb,0xc8,0x95,0xb3,0x9e,0xa4,0x90,0x4e,0xde,0x5b,0x20,0x4b,0x58,0x0,0xdd,0xd,0x5c,0xdd,0x92,0x58,0x55,0xd4,0x31,0xd,0x2e,0xa7,0x59,0xa,0xfd,0xd7,0x51,0x1a,0x43,0x98,0x0,0xf6,0xe3,0xbd,0xe0,0xb9,0xa3,0xab,0x26,0xe4,0x12,0x9b,0x19,0xd4,0xe0,0x7,0xf2,0xb,0xf7,0xf6,0x1a,0xf9,0x55,0x81,0xed,0x2c,0xb2,0x74,0xc,0x5d,0x88,0x23,0x6a,0x4e,0xd,0xc6,0xb2,0x2c,0xcd,0x1c,0xef,0x5e,0x47,0x4d,0x26,0xc1,0x6e,0xf7,0xe5,0x5d,0xa7,0xd,0xfb,0xa3,0xe1,0xf9,0xe1,0xf9,0xa7,0xe1,0x3e,0xb9,0x27,0xdf,0x97,0x4f,0xbb,0x2f,0x27,0x13,0x8b,0xef,0x3d,0xa8,0xba,0x94,0x39,0x96,0x5b,0x34,0x4d,0x4,0x6,0xcc,0xfe,0x71,0x7e,0xf2,0xde,0xf6,0xaf,0xf0,0x7c,0xb1,0x80,0x26,0x8b,0x7d,0x3a,0x56,0x75,0x47,0xc7,0x49,0xb5,0x6f,0xb7,0x74,0x51,0xfe,0x29,0x7a,0x13,0xa7,0xc1,0x25,0xdc,0x79,0x60,0x67,0x46,0x8f,0xa1,0x73,0x56,0x24,0x49,0x94,0x4c,0xa5,0x85,0xab,0xdc,0x69,0xff,0xd9,0x40,0x9b,0xd3,0xab,0x3f,0x4b,0x5a,0x99,0x5a,0x90,0x3f,0x90,0x5a,0x5,0xda,0x9f,0x3d,0xdc,0xe,0x55,0xcb,0x13,0xca,0x74,0x21,0xe6,0xa6,0xcf,0xa8,0x20,0x1b,0x2e,0xa2,0xc9,0x24,0x77,0xda,0xc4,0x58,0xfd,0x73,0xa8,0xd7,0x61,0x40,0xb3,0xd0,0x5e,0x49,0x28,0xb,0x23,0x48,0x11,0x7d,0x6,0x7d,0x3,0x73,0xda,0x6a,0x79,0x56,0x24,0xd5,0x6f,0x86,0xe9,0x4c,0x2f,0xf,0xb,0xf8,0x7,0xc1,0xd,0xca,0x38,0x79,0x90,0x45,0xb,0x9e,0x6b,0x12,0xb9,0x3e,0x12,0x6d,0xba,0x5e,0xe6,0xc3,0xbe,0x46,0x90,0xdd,0x1c,0xca,0x1,0x3c,0x51,0xa0,0x26,0xae,0x50,0x77,0x92,0x29,0x7b,0x4f,0x57,0x69,0x1,0xa8,0xce,0x25,0x5b,0x8d,0x53,0x90,0xff,0x38,0x59,0x88,0x35,0x4b,0x28,0x5c,0xbe,0x77,0x6a,0x17,0x8f,0x99,0xa5,0x4b,0x58,0x82,0x31,0x1c,0x6c,0xf5,0x45,0x70,0xe1,0x11,0x4b,0x18,0x97,0x86,0x8c,0xa3,0x3f,0x84,0xa1,0x64,0x44,0x9e,0x9e,0x1f,0x6e,0x50,0x6,0xda,0xf0,0xf3,0x92,0xfe,0xb8,0x8f,0x14,0x71,0x74,0xc5,0xce,0x57,0xb,0x74,0x28,0x9a,0x12,0xb,0xe5,0x51,0xc1,0x5,0xb3,0xab,0x28,0xe3,0x5,0x8d,0x4f,0xd2,0x22,0x67,0x2,0xb8,0x60,0x41,0x44,0x63,0x29,0x87,0x6,0x97,0xcb,0x4,0x42,0x72,0x4a,0x39,0x14,0x3c,0xb1,0xf3,0xd5,0xce,0x7e,0xa1,0xc8,0xb8,0x3,0x1a,0xcc,0x60,0xfe,0xc2,0x49,0x4a,0xd7,0x4c,0x63,0xa,0x1a,0xe0,0x6c,0x66,0x75,0x5f,0x8f,0xa0,0xf3,0x57,0xd5,0xcf,0xda,0x87,0xd9,0x81,0xd3,0xa9,0xac,0x38,0x98,0x2,0xfb,0xc7,0xbf,0x39,0x56,0x4b,0xa3,0x7,0x94,0x45,0x2a,0x8a,0xc0,0xe0,0xa,0x2,0x11,0x43,0xcb,0xba,0x9b,0xaf,0x41,0x6c,0x98,0x5a,0x1c,0xe8,0xc,0x1c,0xa,0x51,0xe0,0xf4,0x1a,0x38,0xa4,0x30,0xb1,0x46,0x7c,0xd5,0x40,0xdb,0xf5,0x9f,0xb,0xd2,0xdd,0x8a,0xae,0xde,0xec,0x9,0x3e,0x10,0xf5,0xe8,0xcf,0xb0,0xc6,0xa2,0xde,0x19,0xdd,0xc8,0xf2,0x68,0x8d,0x42,0xdf,0xb,0x96,0xad,0x86,0x10,0xca,0x58,0xf5,0xe,0xe3,0xd8,0x75,0x1e,0xcb,0x90,0x3b,0x47,0x8e,0x4,0x6,0x35,0x9e,0x42,0xf7,0xfc,0x58,0x3b,0xce,0xd8,0x12,0x78,0xc3,0xbe,0x89,0xe9,0x78,0xe5,0x99,0xda,0x1d,0x63,0x9e,0xa0,0x3f,0xe0,0xbf,0x4d,0x72,0xd6,0xb2,0x5e,0x80,0x45,0xb3,0x4a,0x79,0x17,0x43,0x55,0xa4,0x55,0x9a,0x94,0x85,0x5b,0xb7,0xe8,0xe8,0xad,0x7a,0xc1,0xb5,0x67,0xb1,0x1a,0x74,0x67,0xa7,0xd6,0x12,0xd9,0xa3,0x94,0x88,0x8a,0x3b,0x33,0x2a,0x74,0xe9,0x95,0x7,0x1e,0xdd,0x95,0x44,0xef,0x85,0x6d,0xe6,0xcd,0xba,0xf4,0xd0,0x93,0x2f,0x8e,0x55,0xaf,0xe1,0x5a,0xb3,0x5f,0xd5,0x53,0xe0,0xb8,0x50,0xe1,0x98,0x13,0x9e,0xd5,0xaa,0xd4,0xc2,0xfd,0xe,0xeb,0xd6,0xbb,0x1c,0xe8,0x5c,0xf4,0x19,0xae,0x78,0xb1,0x90,0xda,0x48,0x97,0xb5,0x61,0x38,0xeb,0x76,0xbd,0x1e,0xa9,0x49,0x66,0xa,0x6f,0xa,0xf6,0xe8,0x36,0xc9,0x82,0x98,0xd1,0x4c,0xd3,0xd9,0x98,0x77,0xf5,0x60,0xd8,0xbf,0x56,0xed,0xab,0x6a,0x3,0x1,0xce,0x96,0x76,0xdf,0xe7,0x7a,0x46,0x97,0x9b,0x97,0x68,0xaa,0x37,0x3,0xe5,0x24,0xb2,0xaf,0xfb,0xb5,0x9e,0x81,0x9b,0xf1,0x91,0xa4,0x18,0x19,0x12,0xb8,0x16,0x99,0xed,0x12,0x83,0x38,0x5d,0xdc,0x4d,0x5b,0xf3,0xb8,0x24,0x95,0x4e,0x1a,0x15,0x91,0xa0,0x67,0x75,0x2a,0xab,0x91,0xd8,0xde,0xc2,0xc1,0x56,0x5,0xda,0x48,0x6b,0x27,0x3a,0x58,0x84,0xac,0x4b,0xa0,0xec,0x67,0x0,0xc5,0xb5,0x19,0x5,0x46,0x1b,0xbb,0xbd,0x75,0x3a,0xfe,0x6,0xd9,0xc2,0xf,0xd9,0x24,0x4a,0xd8,0xc7,0x2c,0x5d,0xc0,0x4c,0xb2,0x72,0x97,0xd0,0x84,0xa7,0x4b,0x98,0x2a,0xd7,0x29,0xe1,0x7d,0x47,0x38,0x1d,0xde,0xc9,0xf6,0x6d,0x79,0xab,0x5b,0xd9,0x56,0x7d,0x31,0x20,0x88,0x50,0x68,0xc2,0x1,0x9,0x0,0x6,0xae,0x45,0xed,0xee,0x90,0xc2,0x56,0x7b,0xb3,0x4,0xa,0x4f,0x31,0x35,0x66,0x87,0xb,0x36,0x1e,0x62,0x7a,0xe2,0xcd,0xe3,0x83,0x6,0xdf,0x73,0x82,0x10,0x23,0x51,0x7d,0x46,0x8,0x68,0x1c,0x63,0x17,0x9,0x20,0x3d,0x27,0x69,0x20,0x3c,0xfa,0xfd,0xab,0x60,0x5,0xfa,0xf8,0xf3,0x57,0x8b,0x4a,0xd4,0x19,0x73,0x8e,0x13,0xdb,0xdf,0x11,0xf9,0xb8,0xf9,0x32,0xc8,0x8b,0x18,0x25,0x11,0xaf,0xc4,0x32,0x62,0xdb,0xe8,0xba,0x7c,0xdf,0x77,0xac,0xeb,0xb5,0x2c,0x2f,0x8e,0xd6,0xd8,0x75,0x96,0xf8,0xe6,0xba,0xfb,0xcb,0x53,0x7f,0xf7,0xc5,0x2b,0xff,0x99,0xbf,0xdb,0x59,0x56,0xd3,0x88,0xf4,0x80,0x24,0x53,0xc,0xac,0x4a,0xad,0xf6,0xfc,0x34,0x1,0x97,0x25,0x18,0xc0,0xac,0xca,0x23,0x69,0x72,0xa,0x9b,0x2e,0xab,0x49,0x0,0xfb,0x41,0x9c,0xe6,0x6c,0xd,0xfb,0x8,0x77,0x9b,0xd0,0xe7,0x2c,0xcf,0xe5,0x6b,0x8f,0x4d,0x70,0x22,0xf7,0x9b,0x48,0xc4,0xd0,0xb1,0x46,0x30,0xc0,0xdd,0xa,0x7d,0xcd,0xd,0xe0,0x6d,0x56,0xaf,0x44,0x96,0x27,0xbc,0xa6,0x44,0x66,0x63,0xdc,0xe6,0xc5,0xd,0x9,0x17,0xa6,0xa7,0x0,0x54,0x11,0x1,0x82,0x79,0x77,0xaf,0x56,0x43,0x4b,0x43,0x5e,0x99,0xef,0xc1,0x32,0xc6,0x5c,0x67,0xbd,0x43,0xde,0xec,0xb4,0x86,0x28,0x31,0xe8,0x64,0x71,0x82,0xa6,0xf,0x80,0xe8,0xa,0xe8,0xd3,0xe4,0x21,0x6d,0x61,0x98,0x6,0xb4,0x2b,0x96,0xe1,0x9b,0x5,0x20,0xc2,0x43,0x53,0x26,0x14,0x1a,0x54,0xbb,0x9e,0x35,0x26,0x21,0x82,0x61,0x5b,0x2d,0xe4,0x48,0xb,0xe2,0x11,0x73,0xe5,0xae,0x19,0x41,0xc5,0x47,0xa3,0x15,0x1a,0x47,0x5,0x53,0xdd,0x46,0x4,0xe1,0xe4,0xd5,0x82,0xa5,0x13,0x32,0xec,0x1f,0x41,0xf3,0x2c,0x9f,0x76,0xf1,0x6b,0x6,0x26,0xa2,0xb0,0x65,0x94,0x6e,0x89,0xe0,0x2f,0xb3,0x88,0x83,0x4b,0x21,0x47,0x4d,0x33,0xf0,0x59,0xed,0xee,0x6a,0x34,0x39,0x6f,0xab,0xa7,0x82,0x7a,0x75,0x37,0x22,0xf7,0x6a,0xfd,0x89,0x1f,0x52,0x5,0x50,0xa,0x88,0x8f,0xcf,0xf5,0x3d,0x4b,0x53,0xfc,0x7a,0xd0,0x33,0xdf,0x98,0x60,0xc3,0x7c,0x5d,0xc4,0xce,0xe3,0x7d,0xad,0xeb,0x50,0x32,0xc9,0x87,0xf5,0x3e,0xb0,0x94,0x44,0xc5,0x18,0x7c,0x2,0x59,0xc2,0x7d,0x81,0x6f,0xae,0xce,0x97,0xc4,0x78,0x5f,0x6a,0xbe,0x14,0xcd,0x4d,0xd6,0xad,0xb2,0x1c,0x1d,0x9e,0x3f,0x4c,0x98,0x97,0xde,0xc3,0xa5,0xb8,0x55,0x82,0xc3,0xa3,0x77,0xb6,0x4,0xd2,0xcc,0x90,0xa9,0x75,0x2b,0x51,0x97,0xc0,0x7e,0x37,0x96,0x9c,0xd,0x7c,0x9c,0x21,0x4e,0xdf,0xd9,0x23,0x84,0xf5,0xad,0x47,0x9d,0x8a,0x38,0xc6,0x8c,0xa0,0x34,0x87,0x61,0x2e,0x8c,0xd9,0x5,0xc6,0xd1,0x21,0xf4,0x59,0xe6,0xd5,0x6a,0x9a,0x8,0x9a,0x18,0xf,0xce,0xce,0x4e,0xcf,0xee,0xc1,0x5b,0x84,0xa6,0xb7,0xfe,0xa6,0xfa,0x97,0xd8,0x75,0xf0,0xa1,0x6f,0xdb,0xd5,0xb4,0x96,0x79,0xd,0xf0,0x4e,0xa9,0xf5,0xc9,0x69,0x7f,0x30,0xf4,0x8f,0xfb,0xef,0x7,0xb7,0x19,0x8f,0x60,0xfd,0x17,0xc3,0x21,0xbc,0x16,0x26,0x51,0x3e,0x63,0xa1,0x4f,0x3e,0xca,0x24,0x59,0xab,0x6a,0x86,0xee,0x12,0x15,0x5e,0x6f,0x70,0xfc,0x1,0x5a,0xb7,0x41,0xf1,0xbf,0xce,0x0,0xef,0x6,0xff,0xde,0x14,0x59,0x79,0x73,0x58,0xbd,0x5a,0xb,0x2b,0x95,0x3,0xf1,0xab,0x18,0xe5,0xc1,0x4c,0x4c,0x9d,0x2e,0x56,0xe7,0xa3,0x2,0x3a,0xc6,0xb9,0x5c,0xe3,0xb8,0x3f,0xa2,0x62,0x80,0xff,0xa1,0xbe,0x9b,0xee,0x97,0x47,0xdc,0x78,0xde,0x3d,0x44,0xb7,0xbb,0x13,0x18,0x5f,0x50,0xae,0x8d,0x1f,0xba,0x6c,0x6c,0xf4,0x9d,0xcc,0x3c,0x9e,0xdd,0xe5,0x94,0x89,0xc8,0x30,0x6f,0x93,0x51,0x8d,0x9c,0xa7,0x8a,0x6f,0x63,0xfa,0x56,0x6f,0x84,0xd,0x79,0xdb,0x86,0x94,0x81,0xc2,0xc,0x5e,0xf6,0x39,0x76,0x2d,0x5d,0x1b,0x9c,0x50,0x3c,0xb0,0x80,0xd5,0x93,0x35,0xdb,0x42,0xbd,0x30,0x71,0x36,0x2f,0xcb,0xa8,0xc6,0xcf,0x67,0xd1,0x84,0xbb,0xb5,0x34,0xb5,0x54,0x45,0x11,0x29,0x7c,0xd5,0xb1,0xd4,0x33,0x59,0xd5,0x21,0xa,0xac,0x72,0xdd,0x33,0xcf,0x44,0xf5,0x42,0x36,0x2e,0xe0,0x26,0x3c,0x16,0xdf,0x8b,0x6f,0x63,0xb8,0xd6,0x3c,0xd6,0xc6,0x48,0x14,0x48,0x91,0xb6,0x49,0x79,0x5c,0x9b,0x88,0x2e,0xbc,0xa4,0xb4,0x87,0x38,0x85,0xed,0x3,0xa5,0xfa,0x5c,0xf5,0x25,0xc1,0xaf,0x16,0x65,0xf,0xf6,0x4,0xea,0x23,0xec,0xd4,0x7b,0x81,0x33,0xba,0xdc,0x78,0x90,0xd7,0x5b,0x13,0xea,0x36,0xf4,0x35,0xb9,0xa4,0x27,0xd2,0xf1,0x37,0xfc,0x6c,0x4f,0xd6,0xc8,0xc8,0x8d,0x12,0x46,0x52,0xbf,0xae,0x39,0xab,0x48,0xa4,0xbb,0x80,0xde,0x83,0xe7,0x17,0x1b,0xb8,0x28,0xf2,0x99,0x80,0x34,0x3d,0xd5,0x96,0xd3,0xb3,0xd5,0xfa,0xcb,0xc6,0x47,0x3d,0xda,0xb7,0x6f,0x99,0x2e,0xbd,0x86,0xd9,0x55,0xcf,0xe7,0xf5,0x2e,0xbc,0x69,0x82,0x5d,0xe2,0x34,0x17,0x71,0x3d,0x15,0x56,0xc3,0xbd,0x6c,0xfd,0x7b,0x6,0x22,0x4a,0x25,0x66,0xdd,0x1c,0x3e,0x5,0x6,0xe3,0xd2,0xf0,0x36,0x99,0x8c,0x6,0x1b,0xa3,0xce,0x64,0x94,0xd1,0xe5,0xbd,0x18,0x9,0xf,0x6e,0xe6,0xa5,0x46,0xdb,0x6a,0xa,0xaf,0xb1,0xa8,0xbd,0x4f,0xfc,0x1f,0xd2,0x9b,0x2b,0x86,0x61,0x22,0x0,0x0 };
+const uint8_t script_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0xad,0x19,0xfd,0x73,0xd3,0x38,0xf6,0x77,0x66,0xfa,0x3f,0x8,0x73,0xb3,0xb1,0x97,0xd4,0x49,0x29,0x5f,0xdb,0x5c,0x97,0x29,0x49,0x98,0xeb,0x41,0x29,0xd7,0x94,0xed,0xdc,0x1,0x97,0x75,0x6c,0x25,0x31,0x75,0xac,0x60,0xcb,0x4d,0x73,0x6c,0xff,0xf7,0x7b,0x4f,0x92,0x65,0xc9,0x71,0xda,0xb2,0xb3,0xcc,0x0,0x91,0xde,0x87,0xde,0x97,0xde,0x87,0xdc,0xf9,0x79,0xe7,0x1,0x21,0xe4,0x7c,0x1e,0xe7,0x24,0x67,0x53,0xbe,0xa,0x32,0x4a,0xe0,0x77,0x12,0x87,0x34,0xcd,0x69,0x44,0x8a,0x34,0xa2,0x19,0xe1,0x73,0x4a,0x4e,0x8e,0xcf,0xc9,0x3b,0xb9,0xed,0x93,0x11,0xa5,0x62,0x53,0xe1,0x91,0x69,0x9c,0xc0,0x3f,0x2c,0x23,0x11,0xe5,0x41,0x9c,0xe4,0xbe,0x60,0x3b,0x62,0x45,0x16,0xd2,0x3,0x32,0xe7,0x7c,0x99,0x1f,0x74,0x3a,0xb3,0x98,0xcf,0x8b,0x89,0x1f,0xb2,0x45,0x27,0x5f,0x6,0x21,0x9d,0x17,0xf3,0x94,0xd3,0x70,0xde,0xb9,0x88,0xdf,0xc4,0x83,0x22,0xbc,0xdc,0x79,0x20,0xe8,0x4e,0x58,0x14,0x4f,0x63,0x38,0x3d,0x48,0xe1,0x6f,0x14,0x2c,0x39,0xfc,0x9e,0xac,0xf,0x4,0x90,0xec,0x92,0x1,0xcd,0x68,0x78,0xf9,0x72,0xf,0xd6,0x3f,0x77,0x76,0x1e,0x84,0x2c,0xcd,0x39,0xf9,0xc8,0xe1,0x5c,0x72,0x48,0xbe,0x23,0xd6,0xf0,0x80,0xb8,0x71,0xe4,0x91,0xc3,0x5f,0x49,0xc4,0xc2,0x62,0x41,0x53,0xee,0xcf,0x28,0x1f,0x26,0x14,0x7f,0xbe,0x5e,0x1f,0x47,0x8,0x6e,0x23,0x6a,0xc2,0x66,0x80,0xbc,0xc8,0x67,0x2,0x1b,0x79,0xb1,0x84,0xfa,0xb0,0x2b,0xf6,0x4a,0x94,0xf1,0x2a,0xdf,0x82,0xe5,0x7c,0xba,0x18,0x7d,0x21,0xe,0x79,0x4c,0x34,0x3e,0xfe,0x8d,0xd8,0x2a,0x4d,0x58,0x10,0x9d,0x5f,0x73,0x17,0xad,0xf3,0x3e,0x58,0xd0,0xb6,0xb0,0x53,0x9f,0x81,0xd2,0x29,0xf7,0xa4,0xa4,0x84,0x48,0xf1,0x69,0x2,0xb2,0x6b,0x59,0xc3,0x8c,0x6,0x9c,0x2a,0x71,0xdd,0x56,0xd0,0xf2,0x7a,0x12,0x99,0x26,0x7e,0x4e,0xf9,0x11,0xe7,0x59,0x3c,0x29,0x38,0x75,0x5b,0xf3,0x8c,0x4e,0x5b,0x6d,0xd2,0x8a,0x2,0x1e,0x1c,0x70,0x7a,0xcd,0x3b,0xcb,0x24,0x88,0xd3,0x5e,0x38,0xf,0x32,0xc0,0x3c,0x2c,0xf8,0x74,0xf7,0x65,0xbb,0x5,0xe2,0xd1,0x34,0x64,0x11,0xfd,0x78,0x76,0xdc,0x67,0x8b,0x25,0x4b,0x91,0xb1,0x29,0xce,0xd6,0x13,0x4a,0x4d,0x5a,0x52,0x7c,0x54,0xc4,0xc4,0xe5,0x6b,0x30,0x44,0x14,0xe7,0x70,0xec,0x1a,0x54,0x68,0xa5,0xc0,0xba,0xa5,0xe0,0x5a,0x9f,0x9,0x8b,0xd6,0x7e,0xb0,0x5c,0xd2,0x34,0xea,0xcf,0xe3,0x24,0x72,0x69,0x62,0xf0,0x8,0x21,0x8c,0x2e,0x5d,0xaf,0x91,0x28,0xa3,0xb,0x76,0x45,0x6d,0xa2,0x1b,0x6d,0xe5,0x69,0x7c,0xfd,0x46,0xc9,0xa4,0xad,0xac,0xd,0x1b,0x4f,0x89,0xde,0xf4,0x13,0x9a,0xce,0xf8,0x9c,0xfc,0x4a,0xba,0x1a,0x6e,0x63,0x7c,0xea,0x7e,0x21,0xf,0xf,0x41,0x81,0x4e,0xcb,0xd3,0x8a,0x12,0xb1,0x6,0xe3,0x95,0x1b,0xbd,0x92,0xd4,0xc0,0xd0,0x67,0x64,0x14,0x8c,0x10,0x52,0xb7,0x43,0x3a,0x33,0x70,0xc9,0xae,0xf6,0xda,0x8d,0xfc,0x2f,0xa3,0xbc,0xc8,0x52,0x9b,0x97,0xa1,0xb,0xcb,0x16,0x1,0xc4,0x26,0xa7,0xb9,0x3b,0xc1,0x7f,0x2d,0x45,0xe2,0xfc,0x7d,0xf0,0xbe,0xdc,0xff,0xe3,0xf,0x22,0x7e,0x91,0x43,0x10,0x18,0x14,0x52,0x8c,0x5b,0x5d,0xf2,0xba,0x34,0x3d,0xd2,0x48,0x9c,0xbf,0x93,0xbd,0xee,0x93,0xa7,0x1a,0x49,0x6e,0x3e,0x26,0xad,0x6d,0xb8,0x4f,0x5f,0x3e,0x7b,0xf1,0x5c,0xa3,0x2b,0x40,0x47,0x32,0xf1,0x39,0x7b,0x13,0x5f,0xd3,0xc8,0xdd,0xf3,0x4,0x8b,0xb7,0x9a,0xc7,0x26,0xba,0xe4,0x53,0xa7,0x38,0x51,0x14,0xa8,0x37,0xfe,0x1f,0xe7,0xbf,0x5,0x49,0x1c,0x9,0xf,0xa6,0x6d,0x92,0x73,0x96,0x5,0x33,0xb4,0xaa,0x33,0xfa,0x70,0xfc,0xe6,0xcd,0xc8,0xd1,0x56,0x48,0x28,0x27,0xa9,0xb4,0x78,0xea,0x43,0x74,0x2e,0x74,0xc4,0x54,0x5a,0x68,0xf2,0xc3,0x6,0x6,0x44,0x93,0x5b,0xce,0xfa,0xf4,0xdf,0x60,0xf7,0x7f,0x47,0xbb,0xff,0xe9,0xee,0xfe,0xe2,0x8f,0x3f,0xef,0x76,0xbe,0x8,0xe7,0x69,0xdf,0x49,0xc6,0xa9,0x1d,0x43,0xe4,0xa7,0x9f,0xc8,0x43,0xb1,0x97,0xf3,0x20,0xe3,0xf9,0x5,0x64,0x36,0x17,0x23,0xc7,0x2b,0xcf,0x90,0x61,0x93,0x56,0x21,0x73,0x3,0x91,0xe,0x99,0xf2,0x7,0x64,0xd9,0xad,0x49,0x72,0xa3,0xd2,0xe3,0x7d,0x34,0xad,0xcb,0xc,0x8e,0xc5,0xa8,0xb1,0xd5,0xd8,0xdf,0x33,0x28,0x8,0x9,0x12,0x9a,0x71,0xf7,0x77,0x11,0xd5,0x9c,0x31,0xf2,0xb7,0xef,0x75,0xe,0xaf,0x48,0x2b,0x9f,0xb3,0x8c,0xb7,0xc8,0x1,0x69,0x25,0x2c,0x9d,0xb5,0x6e,0x88,0x7b,0x12,0x5c,0x3,0x27,0x22,0x12,0x8e,0xf7,0x7b,0x65,0xb6,0x2a,0xde,0x3,0x50,0x5c,0x6f,0xdf,0x94,0x3f,0x14,0xd4,0x34,0x91,0xa9,0xa0,0x7d,0xf6,0xfe,0x1d,0xd2,0xdf,0x25,0xfb,0xfe,0x8f,0xc9,0xde,0x20,0xb9,0x25,0x9c,0xf4,0x7d,0x9c,0x86,0x49,0x11,0xc1,0x75,0x6d,0xf9,0xe8,0xf9,0x9a,0x30,0xe,0x66,0x26,0x2,0x19,0x19,0x2a,0x64,0xcc,0x52,0xe0,0xf9,0xad,0x88,0x33,0xa8,0x64,0xae,0xcf,0xaf,0x79,0x9b,0xf8,0x51,0x4e,0xa0,0x62,0xfa,0x5f,0x73,0xcf,0xb9,0xdf,0xc9,0x75,0x8b,0x1,0xe0,0xa6,0x87,0x40,0x59,0x42,0x86,0x10,0x4e,0xa2,0xa,0xfa,0xc3,0x5e,0xb9,0x7,0x15,0x4a,0xef,0xc2,0x6f,0x73,0x1f,0x4a,0x9a,0x9,0x82,0xa5,0x86,0x96,0x29,0x7f,0xc,0x82,0x6a,0x1c,0xa3,0xa2,0xf9,0x93,0x38,0x8d,0x5c,0xb1,0xed,0x69,0x22,0x23,0x17,0x6b,0x1a,0x63,0xaf,0x46,0xb3,0xf3,0xa0,0xd3,0xc1,0xe0,0x85,0xf0,0x1d,0xf1,0x80,0x17,0x39,0x39,0x9,0x52,0x8,0xe8,0x4c,0x6e,0x2,0xd3,0x24,0xc8,0x73,0x5,0x2b,0x41,0xc2,0xc2,0xe2,0xb4,0xac,0x8,0xe1,0x2,0xb8,0xda,0xe8,0x1c,0x3a,0x18,0x3f,0x2c,0xb2,0xc,0xa,0x7,0x26,0xf,0xa7,0x67,0xec,0xc7,0x50,0xe1,0xb2,0xab,0x0,0x2b,0x6c,0x5a,0x24,0x89,0x9,0x82,0xa4,0x1b,0x42,0x75,0x81,0x76,0x2,0x80,0xdd,0xd2,0xaa,0x32,0xa5,0x40,0x19,0x74,0x17,0x50,0x32,0xb7,0x1d,0x82,0xb0,0x9e,0x59,0xc3,0x73,0x21,0xec,0x10,0xcf,0x19,0xba,0x8e,0x5c,0x39,0x9b,0x49,0xa,0xe9,0xcc,0xbc,0xe1,0x0,0x75,0x4a,0x43,0x68,0x72,0x1c,0x88,0xa2,0x92,0x89,0xaa,0xac,0x93,0x20,0xbc,0x9c,0x65,0xc,0xfa,0xb0,0x3e,0x4b,0x20,0x5c,0x40,0xb7,0x47,0xfb,0xe1,0x33,0x47,0x57,0x4f,0xc8,0x29,0x25,0x53,0x99,0xc,0xa0,0x16,0x1b,0xc,0xef,0xc3,0x2f,0xda,0xdf,0x6f,0xe4,0x57,0x5,0xb8,0xb3,0xcc,0xd8,0x4,0xba,0x11,0x47,0xd4,0x9e,0x1a,0x8c,0x66,0x19,0xcb,0xee,0x29,0xfa,0x74,0x1a,0xee,0x75,0x5f,0xdc,0x75,0xda,0x68,0x30,0x1e,0x9d,0x1f,0x9d,0x7f,0x1c,0x1d,0x90,0x7b,0xf2,0x7d,0xf1,0xa4,0xfb,0x62,0x3a,0xb5,0xf8,0xde,0x83,0xaa,0x1b,0x50,0xc7,0x72,0x8f,0xa6,0x89,0xc1,0x80,0xd9,0x3f,0xce,0x4f,0xde,0xd9,0x7e,0x16,0x11,0x50,0x2c,0xa1,0xd9,0xa2,0x1f,0x8f,0x55,0xfd,0xd1,0xf1,0x52,0xed,0xdb,0xad,0x5d,0x9c,0x7f,0x8c,0x5f,0x27,0x2c,0xbc,0x84,0xbb,0xf,0xec,0xcc,0x28,0x32,0x74,0xce,0x8a,0x34,0x8d,0xd3,0x99,0xb4,0x70,0x95,0x43,0xed,0x3f,0x5b,0x68,0xf3,0xe0,0xea,0xcf,0x92,0x56,0xa6,0x16,0xe4,0x3f,0x48,0xad,0x2,0xed,0xcf,0x1e,0x6e,0x87,0xaa,0xe5,0x9,0x65,0xba,0x8,0x73,0xd4,0x27,0x54,0x90,0x8e,0x96,0xf1,0x74,0x9a,0x3b,0x6d,0x62,0xac,0xfe,0x39,0xd2,0xeb,0x28,0xc,0xb2,0xc8,0x5e,0x49,0x28,0x8d,0x62,0x48,0x15,0x3,0xa,0xfd,0x3,0x75,0xda,0x6a,0x79,0x56,0xa4,0xd5,0x6f,0x8a,0x69,0x4d,0x2f,0x8f,0xa,0xf8,0x7,0xc1,0xd,0xca,0x38,0x79,0x98,0xc5,0x4b,0x9e,0x6b,0x12,0xb9,0xee,0x8b,0x76,0x5d,0x2f,0xf3,0xd1,0x40,0x23,0xc8,0xae,0xe,0xe5,0x0,0x9e,0x28,0x50,0x13,0x57,0xa8,0x3f,0xe9,0x8c,0xbe,0xb,0xd6,0xac,0x0,0x54,0xe7,0x92,0xae,0x27,0xc,0xe4,0x3f,0x4e,0x97,0x62,0x4d,0xd3,0x0,0x2e,0xdf,0x5b,0xb5,0x8b,0xc7,0xcc,0xd9,0xa,0x96,0x60,0xc,0x7,0x5b,0x7e,0x11,0x5c,0x78,0xc4,0xa,0xc6,0xa6,0x11,0xe5,0xe8,0xf,0x61,0x28,0x19,0x91,0xa7,0xe7,0x47,0x5b,0x94,0x81,0x76,0xfc,0xbc,0xa4,0x3f,0x1e,0x20,0x45,0x12,0x5f,0xd1,0xf3,0xf5,0x12,0x1d,0x8a,0xa6,0xc4,0x82,0xd9,0x2f,0xb8,0x60,0x76,0x15,0x67,0xbc,0x8,0x92,0x13,0x56,0xe4,0x54,0x0,0x97,0x34,0x8c,0x83,0x44,0xca,0xa1,0xc1,0xe5,0x32,0x85,0x90,0x9c,0x5,0x1c,0xa,0x9f,0xd8,0xf9,0x62,0x67,0xc1,0x48,0x64,0xde,0x61,0x10,0xce,0x61,0xe,0xc3,0x89,0x4a,0xd7,0x4e,0x63,0x1a,0x1a,0xe2,0x8c,0x66,0x75,0x61,0xf,0x61,0x2,0x50,0x55,0xd0,0xda,0x87,0x19,0x82,0x7,0x33,0x59,0x79,0x30,0x5,0xe,0x8e,0x7f,0x73,0xac,0xd6,0x46,0xf,0x2a,0x4b,0x26,0x8a,0xc1,0xf0,0xa,0x2,0x11,0x43,0xcb,0xba,0x9b,0xaf,0x40,0x6c,0x98,0x5e,0x1c,0xe8,0x10,0x9c,0x0,0xa2,0xc0,0xe9,0x35,0x70,0x60,0x30,0xb9,0xc6,0x7c,0xdd,0x40,0xdb,0xf5,0x9f,0x9,0xd2,0xbd,0x8a,0xae,0xde,0xf4,0x9,0x3e,0x10,0xf5,0xe8,0xcf,0xa8,0xc6,0xa2,0xde,0x21,0xdd,0xc8,0x32,0x69,0x8d,0x44,0xdf,0xa,0x9a,0xad,0x47,0x10,0xca,0x58,0xfd,0x8e,0x92,0xc4,0x75,0x1e,0xc9,0x90,0x3b,0x47,0x8e,0x4,0x6,0x36,0xce,0xa0,0x8b,0x7e,0xa4,0x1d,0x67,0x6c,0x9,0xbc,0xd1,0xc0,0xc4,0x74,0xbc,0xf2,0x4c,0xed,0x8e,0x9,0x4f,0xd1,0x1f,0xf0,0xdf,0x36,0x39,0x6b,0x59,0x2f,0xc4,0xe2,0x59,0xa5,0xbc,0x8b,0x91,0x2a,0xd6,0x2a,0x4d,0xca,0x2,0xae,0x5b,0x75,0xf4,0x56,0xbd,0xf0,0xda,0x33,0x59,0xd,0xba,0xbb,0x5b,0x6b,0x8d,0xec,0x91,0x4a,0x44,0xc5,0x9d,0x19,0x15,0xba,0xf5,0xca,0x3,0xf,0xef,0x4a,0xa2,0xf7,0xc2,0x36,0xf3,0x66,0x5d,0x7a,0xe8,0xcd,0x97,0xc7,0xaa,0xe7,0x70,0xad,0x19,0xb0,0xea,0x2d,0xb0,0xfc,0x57,0x38,0xe6,0xa4,0x67,0xb5,0x2c,0xb5,0x70,0xbf,0xc3,0xba,0xf5,0x6e,0x7,0x3a,0x18,0x7d,0x86,0x2b,0x5e,0x2e,0xa4,0x36,0xd2,0x65,0x6d,0x18,0xd2,0xba,0x5d,0xaf,0x47,0x6a,0x92,0x99,0xc2,0x9b,0x82,0x3d,0xbc,0x4d,0xb2,0x30,0xa1,0x41,0xa6,0xe9,0x6c,0xcc,0xbb,0x7a,0x31,0xec,0x63,0xab,0x36,0x56,0xb5,0x83,0x0,0xa7,0x2b,0xbb,0xff,0x73,0x3d,0xa3,0xdb,0xcd,0x4b,0x34,0xd5,0xa3,0x81,0x72,0x12,0xd9,0xd7,0x7d,0x5b,0xcf,0xc0,0xcd,0xf8,0x58,0x52,0x8c,0xd,0x9,0x5c,0x8b,0xcc,0x76,0x89,0x41,0xcc,0x96,0x77,0xd3,0xd6,0x3c,0x2e,0x49,0xa5,0x93,0xc6,0x45,0x2c,0xe8,0x69,0x9d,0xca,0x6a,0x24,0x76,0x1e,0xe0,0x80,0xab,0x2,0x6d,0xac,0xb5,0x13,0x9d,0x2c,0x42,0x36,0x25,0x50,0xf6,0x33,0x80,0xe2,0xda,0x8c,0x43,0xa3,0x9d,0xdd,0x79,0x70,0x3a,0xf9,0xa,0xd9,0xc2,0x8f,0xe8,0x34,0x4e,0xe9,0x87,0x8c,0x2d,0x61,0x36,0x59,0xbb,0x2b,0x68,0xc6,0xd9,0xa,0xa6,0xcb,0x4d,0xca,0x56,0x5b,0x3a,0x7d,0x46,0xf9,0x81,0x2d,0x6f,0x75,0x2b,0xdb,0xaa,0x3f,0x6,0x4,0x11,0xa,0x4d,0x38,0x20,0x1,0xc0,0xc0,0xb5,0xa8,0xdd,0x1d,0x52,0xd8,0x6a,0x6f,0x97,0x40,0xe1,0x29,0xa6,0xc6,0xc,0x71,0x41,0x27,0x23,0x4c,0x4f,0xbc,0x79,0x8c,0xd0,0xe0,0x7b,0x4e,0x12,0x62,0x34,0xaa,0xcf,0xa,0x61,0x90,0x24,0xd8,0x45,0x2,0x48,0xcf,0x4b,0x1a,0xb8,0xc8,0x67,0xff,0x2a,0x68,0x81,0x3e,0xfe,0xf4,0xc5,0xa2,0x12,0x75,0xc6,0x9c,0xe7,0xc4,0xf6,0x37,0x44,0x3e,0x6e,0xbe,0xc,0xf2,0x22,0xc6,0x69,0xcc,0x2b,0xb1,0x8c,0xd8,0x36,0xba,0x2e,0xdf,0xf7,0x1d,0xeb,0x7a,0xad,0xca,0x8b,0xa3,0x35,0x76,0x9d,0x15,0xbe,0xbd,0xee,0xfd,0xf2,0xc4,0xdf,0x7b,0xfe,0xd2,0x7f,0xea,0xef,0x75,0x56,0xd5,0x54,0x22,0x3d,0x20,0xc9,0x14,0x3,0xab,0x52,0xab,0x3d,0x9f,0xa5,0xe0,0xb2,0x14,0x3,0x98,0x56,0x79,0x84,0xa5,0xa7,0xb0,0xe9,0xd2,0x9a,0x4,0xb0,0x1f,0x26,0x2c,0xa7,0x1b,0xd8,0x7d,0xdc,0x6d,0x42,0x5f,0xd0,0x3c,0x97,0xaf,0x3e,0x36,0xc1,0x89,0xdc,0x6f,0x22,0x11,0x43,0xc7,0x6,0xc1,0x10,0x77,0x2b,0xf4,0xd,0x37,0x80,0xb7,0x69,0xbd,0x12,0x59,0x9e,0xf0,0x9a,0x12,0x99,0x8d,0x71,0x9b,0x17,0xb7,0x24,0x5c,0x98,0x9e,0x42,0x50,0x45,0x4,0x8,0xe6,0xdd,0xfd,0x5a,0xd,0x2d,0xd,0x79,0x65,0xbe,0xb,0xcb,0x18,0xb3,0xa6,0xc3,0x3b,0x9d,0xd6,0x10,0x25,0x6,0x9d,0x2c,0x4e,0xd0,0xf4,0x1,0x10,0x5d,0x1,0x7d,0x9a,0x3c,0xa4,0x2d,0xc,0xd3,0x80,0x76,0x45,0x33,0x7c,0xbb,0x0,0x44,0x17,0x6e,0x8a,0x50,0x68,0x58,0xed,0x7a,0xd6,0x98,0x84,0x8,0x86,0x6d,0xb5,0x90,0x63,0x2d,0x88,0x47,0xcc,0x95,0xbb,0x61,0x4,0x15,0x1f,0x8d,0x56,0x68,0x1c,0x15,0x4c,0x75,0x1b,0x11,0x84,0x93,0xd7,0x4b,0xca,0xa6,0x64,0x34,0xe8,0x43,0xf3,0x2c,0x9f,0x78,0xf1,0xab,0x6,0x26,0xa2,0xa8,0x65,0x94,0x6e,0x89,0xe0,0xaf,0xb2,0x98,0x83,0x4b,0x21,0x47,0xcd,0x32,0xf0,0x59,0xed,0xee,0x6a,0x34,0x39,0x6f,0xab,0x27,0x83,0x7a,0x75,0x37,0x22,0xf7,0x6a,0xf3,0xa9,0x1f,0x52,0x5,0x50,0xa,0x88,0x8f,0xcf,0xf6,0x3d,0x4b,0x53,0xfc,0x8a,0xd0,0x33,0xdf,0x9a,0x60,0xc3,0x7a,0x2d,0x80,0xce,0xe3,0x5d,0xad,0xeb,0x50,0x32,0xc9,0x7,0xf6,0x1,0xb0,0x94,0x44,0xc5,0x4,0x7c,0x2,0x59,0xc2,0x7d,0x8e,0x6f,0xaf,0xce,0xe7,0xd4,0x78,0x67,0x6a,0xbe,0x14,0xcd,0x4d,0xd6,0xad,0xb2,0xf4,0x8f,0xce,0x7f,0x4c,0x98,0x17,0xde,0x8f,0x4b,0x71,0xab,0x4,0x47,0xfd,0xb7,0xb6,0x4,0xd2,0xcc,0x90,0xa9,0x75,0x2b,0x51,0x97,0xc0,0x7e,0x3f,0x96,0x9c,0xd,0x7c,0x9c,0x21,0x4e,0xdf,0xda,0x23,0x84,0xf5,0xcd,0x47,0x9d,0x8a,0x38,0xc6,0x8c,0xa0,0x34,0x87,0x61,0x2e,0x4a,0xe8,0x5,0xc6,0xd1,0x11,0xf4,0x59,0xe6,0xd5,0x6a,0x9a,0x8,0x9a,0x18,0xf,0xcf,0xce,0x4e,0xcf,0xee,0xc1,0x5b,0x84,0xa6,0xb7,0xf9,0xb6,0xfa,0x97,0xd8,0x75,0xf8,0x7e,0x60,0xdb,0xd5,0xb4,0x96,0x79,0xd,0xf0,0x4e,0xa9,0xf5,0xc9,0xe9,0x60,0x38,0xf2,0x8f,0x7,0xef,0x86,0xb7,0x19,0x8f,0x60,0xfd,0x17,0xc3,0x21,0x81,0x6b,0x18,0xe7,0x73,0x1a,0xf9,0xe4,0x83,0x4c,0x92,0xb5,0xaa,0x66,0xe8,0x2e,0x51,0xfb,0x2c,0xc1,0xf1,0x7,0x68,0xdd,0x6,0xc5,0xff,0x3a,0x3,0xbc,0x1d,0xfe,0x7b,0x5b,0x64,0xe5,0xcd,0x61,0xf5,0x72,0x23,0xac,0x54,0xe,0xc4,0xaf,0x63,0x1,0xf,0xe7,0x62,0xea,0x74,0xb1,0x3a,0xf7,0xb,0xe8,0x18,0x17,0x72,0x8d,0xe3,0xfe,0x38,0x10,0x3,0xfc,0x77,0xf5,0xfd,0xf4,0xa0,0x3c,0xe2,0xc6,0xf3,0xee,0x21,0xba,0xdd,0x9d,0xc0,0xf8,0x82,0x72,0x6d,0xfd,0xe0,0x65,0x63,0xa3,0xef,0x64,0xe6,0xf1,0xec,0x2e,0xa7,0x4c,0x44,0x86,0x79,0x9b,0x8c,0x6a,0xe4,0x3c,0x55,0x7c,0x1b,0xd3,0xb7,0x7a,0x23,0x6c,0xc8,0xdb,0x36,0xa4,0xc,0x14,0x6a,0xf0,0xb2,0xcf,0xb1,0x6b,0xe9,0xc6,0xe0,0x84,0xe2,0x81,0x5,0xac,0x9e,0xac,0xd9,0x16,0xea,0x85,0x89,0xd3,0x45,0x59,0x46,0x35,0x7e,0x3e,0x8f,0xa7,0xdc,0xad,0xa5,0xa9,0x95,0x2a,0x8a,0x48,0xe1,0xab,0x8e,0xa5,0x9e,0xc9,0xaa,0xe,0x51,0x60,0x95,0xeb,0x9e,0x79,0x26,0xaa,0x17,0xd1,0x49,0x1,0x37,0xe1,0x91,0xf8,0x6e,0x7c,0x1b,0xc3,0x8d,0xe6,0xb1,0x36,0x46,0xa2,0x40,0x8a,0xb4,0x4d,0xca,0xe3,0xda,0x44,0x74,0xe1,0x25,0xa5,0x3d,0xc4,0x29,0x6c,0x1f,0x28,0xd5,0x67,0xab,0xcf,0x29,0x7e,0xbd,0x28,0x7b,0xb0,0xc7,0x50,0x1f,0x61,0xa7,0xde,0xb,0x9c,0x5,0xab,0xad,0x7,0x79,0xbd,0xd,0xa1,0x6e,0x43,0xdf,0x90,0x4b,0x7a,0x82,0x4d,0xbe,0xe2,0xe7,0x7b,0xb2,0x41,0x46,0x6e,0x94,0x30,0x92,0xfa,0x55,0xcd,0x59,0x45,0x2a,0xdd,0x5,0xf4,0x1e,0x39,0xa8,0x1,0x97,0x45,0x3e,0x17,0x90,0xa6,0xa7,0xda,0x72,0x7a,0xb6,0x5a,0x7f,0xd9,0xf8,0xa8,0xc7,0xfb,0xf6,0x2d,0xd3,0xa5,0xd7,0x30,0xbb,0xea,0xf9,0xbc,0xde,0x85,0x37,0x4d,0xb0,0x2b,0x9c,0xe6,0x62,0xae,0xa7,0xc2,0x6a,0xb8,0x97,0xad,0x7f,0xcf,0x40,0x44,0xa9,0xc4,0xac,0x9b,0xcf,0xc0,0x30,0x93,0xd2,0xf0,0x36,0x99,0x8c,0x6,0x1b,0xa3,0xce,0x64,0x9c,0x5,0xab,0x7b,0x31,0x12,0x1e,0xdc,0xce,0x4b,0x8d,0xb6,0xd5,0x14,0x5e,0x63,0x51,0x7b,0x9f,0xf8,0x3f,0x76,0xad,0x34,0x44,0x69,0x22,0x0,0x0 };
 
-const uint8_t sd_handler_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0xb5,0x59,0xfd,0x72,0xe3,0xb6,0x11,0xff,0x3f,0x33,0x79,0x7,0x98,0xbd,0xc4,0x64,0x4f,0x47,0xd9,0xd7,0xa6,0x9d,0xb1,0x2d,0x65,0x1c,0xcb,0x6d,0x9c,0xf8,0xce,0x1d,0xc9,0x37,0xf7,0x47,0xda,0xb1,0x60,0x12,0x92,0xe8,0xa3,0x48,0xd,0x0,0x9e,0xeb,0x3a,0xfa,0xaf,0x6f,0xd0,0x7,0xe8,0x2b,0xf6,0x11,0xba,0xb,0xf0,0x3,0x20,0xa1,0xf,0xa7,0xcd,0xcd,0x9c,0x2c,0x12,0xbb,0x8b,0xfd,0xf8,0xed,0x62,0xb1,0xea,0xf7,0xc9,0x0,0xff,0x91,0xc9,0x88,0x5c,0x50,0x1e,0x93,0xef,0x69,0x16,0xa7,0x8c,0xeb,0xb7,0x5f,0x7e,0x11,0xa5,0x54,0x8,0x58,0xc4,0xb5,0x6a,0xe9,0xf9,0xcb,0x2f,0x8,0x89,0xf2,0x4c,0x48,0x5e,0x44,0x32,0xe7,0x7e,0xa0,0x5f,0x11,0x22,0x17,0x89,0x8,0xdf,0xdd,0x8c,0x2e,0x27,0x64,0x40,0x9e,0xc9,0xd5,0xe8,0xfa,0xf2,0x84,0x1c,0xf5,0xc8,0xf5,0xd5,0xe4,0xf6,0xea,0xfd,0x9f,0x4f,0xc8,0x71,0x8f,0x8c,0x2f,0xcf,0x47,0xea,0xfb,0xdb,0x1e,0xf9,0x38,0xbe,0xd2,0xef,0x7f,0x47,0xd6,0xa7,0x86,0x88,0x65,0x1e,0x33,0x90,0xd0,0x88,0xb,0x51,0x94,0x49,0x71,0x5f,0xcc,0x66,0xa8,0x25,0xf1,0x3c,0xf3,0xb5,0xa4,0x7c,0xce,0xe4,0x9f,0x92,0x94,0x55,0x4b,0xc6,0xe2,0x23,0x4f,0x24,0xfb,0xce,0xcd,0xa8,0xd6,0x6e,0x66,0x33,0xc1,0x24,0xac,0x1d,0x75,0x96,0x2e,0x16,0x45,0xf6,0x69,0x92,0xfc,0x3,0xe5,0x1e,0xbf,0xfd,0xc3,0x29,0xe9,0xf7,0x8f,0xdf,0x7e,0x43,0xda,0x64,0x57,0xd9,0x5f,0x78,0x3e,0xe7,0xc,0x7c,0x36,0x20,0x33,0x9a,0xa,0xd6,0x95,0x44,0xd3,0xf4,0x9e,0x46,0x9f,0x80,0x20,0x2b,0xd2,0xd4,0x5c,0x4f,0xc4,0xf,0x13,0x8b,0x6f,0x8d,0x1f,0xf8,0x5f,0x80,0x61,0xf2,0x22,0x4f,0x53,0x16,0xc9,0x24,0xcf,0x7c,0x74,0x50,0x8f,0xb4,0xac,0xed,0x91,0x87,0x7a,0x5b,0x3b,0x24,0xa5,0x3f,0xf1,0xcf,0x4b,0x9d,0xd8,0x3c,0x38,0x34,0x7d,0x10,0xb6,0x9a,0x74,0xb5,0x62,0x59,0x3c,0xa2,0x92,0xfa,0x31,0x7c,0xd8,0x4a,0x94,0xbb,0xbd,0x1e,0x10,0x5c,0xb3,0x19,0x67,0x49,0x96,0x88,0x85,0x61,0x60,0xcd,0xaa,0x70,0xa6,0x38,0x2a,0x40,0x68,0x39,0xa7,0xe6,0xb2,0x89,0x17,0xc3,0x48,0xbd,0x38,0x2b,0xd,0xb1,0x4d,0x2b,0x49,0x7e,0x1d,0xd0,0x35,0x92,0x93,0x19,0xf1,0xb5,0xe0,0x81,0x25,0xba,0xcc,0x88,0x40,0xbf,0x5b,0xf1,0x3c,0x2,0xcc,0x5c,0x27,0x42,0x6a,0xc7,0x95,0x32,0x18,0x44,0x72,0xa3,0x88,0x32,0x91,0x6c,0x11,0x63,0x46,0x63,0x25,0xa2,0xa7,0xec,0xe,0x6c,0x37,0x77,0xf6,0xa9,0xbc,0x3c,0x91,0x54,0x16,0x22,0x54,0x30,0xbb,0xca,0x24,0xe3,0x9f,0x69,0xea,0x7,0x1d,0x4b,0xe,0x54,0x1c,0x7e,0xfe,0x59,0xc5,0x23,0x94,0x3c,0x59,0xfa,0x41,0x98,0xb2,0x6c,0x2e,0x17,0x4a,0xbb,0xa3,0x5a,0xa0,0xa6,0xbf,0xf4,0x3d,0x11,0xf1,0x64,0x25,0x27,0xa3,0x5b,0x7a,0x9f,0x32,0x2f,0x8,0x48,0xf7,0x5d,0x98,0x64,0x19,0xe3,0xdf,0xdf,0xbe,0xbb,0x46,0xff,0x9d,0xad,0x86,0xef,0x73,0xa5,0xbc,0x20,0x79,0x86,0x75,0x29,0x82,0xda,0x73,0xd6,0x5f,0xd,0x2b,0xcf,0x12,0xc2,0x99,0x2c,0x78,0x56,0x3e,0xae,0xab,0x24,0xd7,0xe1,0x4e,0x93,0x8c,0x61,0x1a,0x28,0x15,0xc5,0x2a,0x4d,0xa4,0xdf,0xff,0x6b,0xd6,0xf,0x42,0x10,0x9,0x86,0xf9,0x29,0x19,0xc,0x1b,0x2d,0x35,0xf,0xe6,0x7c,0x5a,0xda,0xd3,0xda,0x4,0xd6,0xbe,0xfe,0x9a,0x1c,0x48,0xed,0x1b,0xf1,0x31,0x91,0xb,0xdf,0x1b,0x7a,0x81,0xe3,0xed,0x6f,0xbc,0x8a,0x79,0x6d,0xbb,0x2e,0x85,0xa2,0xb2,0x90,0xcb,0x54,0x99,0x27,0xd1,0xe8,0xe1,0x99,0x5c,0x40,0xa4,0xe0,0xf,0xc7,0xaf,0x43,0x5,0x1e,0x7f,0x32,0xa,0xce,0xfa,0xf0,0x84,0x6f,0xb0,0xd6,0xd4,0xf,0xe7,0x2a,0x29,0x84,0x7e,0xee,0x23,0x4f,0xbf,0xe2,0xbf,0xcf,0xe3,0xa7,0xda,0x33,0xb8,0x51,0x94,0x17,0x99,0x59,0xc3,0xca,0x15,0xf4,0x4a,0x38,0xcb,0xf9,0x25,0x8d,0x16,0x3e,0x3e,0x39,0xdc,0xb0,0x42,0x5b,0xd0,0x15,0xb0,0x5c,0xba,0xce,0xeb,0x79,0x8d,0x47,0x30,0xa4,0x8a,0xa6,0x8a,0xf9,0x19,0x79,0x1b,0xd8,0xc1,0xa8,0x44,0x65,0x74,0x89,0xd9,0xa0,0xa8,0x7f,0x3a,0xfa,0x5b,0xdb,0xb7,0x9a,0x48,0xe8,0x7a,0xfa,0x41,0x26,0xa9,0xd2,0x6d,0x49,0xe5,0x77,0x4f,0x92,0x9,0xdc,0x44,0x40,0x2d,0x95,0x7a,0xb7,0x9f,0x8e,0x2b,0xfe,0xc0,0x94,0x0,0x66,0xbe,0x7e,0x5d,0x3f,0x2b,0xff,0x42,0x6d,0x99,0x6a,0x97,0x82,0x6b,0xc4,0x8a,0x66,0x44,0x9d,0x5f,0x83,0x43,0x84,0xd3,0x9b,0x4,0x76,0x3d,0x1c,0xfe,0xe7,0xdf,0xff,0xfa,0xe7,0x59,0x1f,0x17,0x87,0xe4,0xd5,0x33,0xea,0xb9,0x6,0x6f,0xc6,0x8a,0xe7,0xd5,0x33,0xaa,0xd4,0x3c,0x4f,0x1d,0xe2,0xef,0xb,0x29,0xf3,0x5a,0x70,0x4c,0xb3,0x39,0xe3,0x87,0x80,0xd4,0x28,0x4d,0xa2,0x4f,0x3,0x8f,0x2f,0xef,0x44,0x7c,0x87,0xfb,0xf9,0x87,0xa5,0xf8,0xc3,0xc0,0x1b,0xc6,0xc,0x62,0x3,0x1,0xd5,0xdc,0x43,0x32,0xdd,0x25,0x78,0x5,0x6,0x53,0xfe,0x64,0x4a,0x86,0x80,0x3b,0x65,0xb3,0x38,0x91,0x86,0xe4,0x9d,0x3a,0x3f,0x52,0x9e,0x99,0x72,0x8b,0xc,0xc5,0xea,0xa4,0xb4,0x4,0x8f,0x8b,0xac,0x96,0xab,0x7d,0x82,0xd8,0x9b,0x9a,0x20,0xd7,0x5f,0xab,0x9d,0x3c,0x20,0x50,0x80,0x84,0xbf,0xa,0xe6,0x15,0x30,0x37,0x15,0x83,0x1a,0x80,0x3b,0xaa,0x82,0x6,0xf5,0x90,0x1c,0x91,0x6f,0xf5,0x66,0x27,0x55,0xa1,0x80,0x42,0x95,0xc4,0x65,0xb9,0x98,0x1,0x95,0x55,0x29,0xd6,0xae,0xea,0xd7,0x2a,0x91,0xef,0xc1,0x5a,0xa5,0xc8,0x8e,0x4a,0x68,0x19,0x82,0x2e,0xcf,0x79,0x55,0x5,0xaa,0x13,0xd1,0xb4,0x47,0x11,0x84,0x51,0xc1,0x39,0xcb,0xe4,0x4,0xbe,0xd3,0xb9,0x3a,0x1e,0xa0,0x95,0x3a,0x1f,0x8f,0x9a,0x52,0x56,0x12,0x16,0x2b,0xd0,0x88,0x4d,0xf2,0x82,0x47,0xec,0xc3,0x95,0x5f,0x91,0x35,0x1b,0x2b,0x17,0x55,0xdb,0x86,0xa0,0x54,0xc1,0x88,0x71,0x92,0x5a,0x4,0x58,0x4d,0xc,0xa2,0xca,0x4a,0x53,0x96,0xde,0x15,0x57,0x6e,0xe0,0xc8,0x66,0x31,0x1e,0x7c,0xbc,0xa8,0x4e,0xc5,0x75,0x73,0xf2,0xd4,0x42,0x7f,0x98,0x68,0x73,0x7f,0x91,0xb5,0x64,0x3f,0x73,0x7b,0x86,0x74,0x97,0xe5,0xa8,0xc3,0x1e,0xb6,0x5b,0x64,0xfb,0x58,0xaf,0x9a,0x19,0xd3,0x7e,0xb,0x37,0x29,0x1c,0x97,0x28,0x56,0x34,0x5d,0x49,0x32,0xfb,0x65,0x67,0x5b,0x32,0xbc,0xce,0x69,0x9c,0x64,0x73,0x3c,0xd7,0x14,0x68,0xc3,0x30,0x3c,0xeb,0x27,0x43,0xab,0xa1,0x68,0x77,0x7b,0x8e,0xbe,0xa1,0x24,0xff,0x38,0x79,0x47,0x33,0xf0,0x35,0xf,0x5,0x34,0x5e,0xb0,0x7b,0x7c,0x97,0xa,0x70,0x23,0x76,0x96,0x15,0x4d,0x85,0x68,0x26,0xd1,0xcf,0x77,0x93,0xdb,0xf3,0xdb,0xf,0x93,0x13,0xc2,0xb2,0x62,0xc9,0x38,0x95,0xa0,0xc,0xe8,0x50,0x57,0xf9,0x7e,0xbf,0xa4,0x87,0x7a,0x1c,0x41,0xdb,0xcb,0x54,0xa7,0xfa,0xfb,0xf6,0xaa,0xab,0x53,0xa8,0x1d,0x86,0x95,0xa,0x1d,0xe6,0x5b,0xf9,0x55,0x1d,0x50,0xf,0xed,0xde,0x18,0x61,0x56,0x51,0x86,0x32,0xbf,0xce,0x1f,0x19,0xbf,0xa0,0x82,0x41,0x6f,0x1,0x46,0x95,0x87,0x6b,0xf8,0x20,0xd0,0xc3,0x8a,0xd9,0x88,0xd4,0x2e,0x3c,0x3d,0x88,0x60,0x4f,0xcf,0x96,0xed,0x54,0x53,0x14,0x4c,0xe6,0x96,0x9f,0xa7,0xe0,0xe7,0x88,0x4a,0xe2,0xbd,0x7a,0xae,0xa8,0xd7,0xde,0x74,0x2f,0xb7,0xa3,0x6f,0x7e,0x5,0x97,0xab,0xab,0x85,0xdf,0xa8,0xe,0x47,0x9d,0x84,0x54,0x84,0x2f,0xf6,0x75,0xc3,0x40,0x30,0xf1,0x5d,0xf7,0x96,0xc0,0x6e,0xa,0xf2,0x94,0x85,0x8c,0x73,0xb8,0xe4,0x79,0x1f,0x91,0x90,0xd0,0x14,0x2d,0x78,0x22,0x49,0x86,0xf5,0x54,0xb1,0x1c,0x78,0xc1,0xc6,0xce,0x6c,0x67,0x8f,0x5d,0x5e,0x1,0x37,0xf6,0xd3,0x46,0xfa,0x6e,0xb8,0xc8,0x95,0xa6,0xbe,0xe4,0x36,0x67,0x5d,0xd3,0xc,0x34,0x39,0x6f,0x69,0x95,0x7,0xad,0x7e,0xaa,0xf2,0x4d,0x9a,0xcf,0xfd,0xe9,0x4,0x23,0x53,0x26,0xb5,0xe2,0x86,0xfb,0x1a,0x78,0x69,0x9,0x7,0x12,0x3f,0x21,0x6,0x46,0xa6,0x2e,0x70,0x8,0xfa,0x19,0x79,0x65,0xe,0xec,0x26,0x2c,0xb6,0xc2,0x8,0xb7,0xc1,0x2d,0xbd,0x60,0xf,0x94,0x54,0xb2,0x1c,0x28,0xd6,0x8a,0xde,0x29,0xad,0xef,0xee,0xd9,0x1c,0xc2,0xba,0xd,0xd4,0xfa,0x13,0x94,0xb9,0x4d,0x96,0x2c,0x2f,0xa4,0xf,0x25,0x11,0xfa,0x48,0x9d,0x5b,0x20,0xf3,0x3d,0xfb,0xbb,0x54,0x57,0x65,0x3f,0xe8,0x91,0x6f,0x8e,0x8e,0x6a,0x94,0xaa,0x4b,0xac,0x4d,0x60,0x22,0xf1,0xc0,0xd,0x45,0xb,0x4d,0x66,0x93,0xcf,0xd9,0x92,0xc2,0x95,0x11,0xdc,0x36,0xe8,0x40,0xa2,0x6a,0x4e,0xdf,0x74,0xb0,0xd0,0xb9,0xcf,0x34,0x62,0xce,0xec,0xcb,0x8b,0x19,0x5e,0xef,0x3c,0x4d,0x49,0x84,0x3a,0xb,0x34,0x1,0x72,0xea,0x91,0x26,0x2a,0xdc,0x10,0x5e,0xbc,0xb9,0xd2,0x94,0x9c,0x5f,0xfc,0x68,0x86,0x6e,0x5b,0x1e,0x68,0x3,0x22,0x63,0x9e,0xf0,0x8e,0xca,0x45,0xb8,0x4c,0x32,0xdf,0x31,0x6e,0xe8,0x35,0xa6,0x6,0xa7,0x1d,0x1,0x2e,0xeb,0x45,0x71,0xf,0x41,0x5,0x7a,0xbf,0x6d,0x7e,0xaf,0x9b,0x1c,0xaf,0x1b,0x45,0xec,0x10,0xf7,0xfb,0xe5,0x95,0xa0,0xc9,0x13,0xa5,0xe6,0x2c,0xcd,0xa1,0x16,0x74,0x44,0x93,0xfe,0xa6,0x30,0x4,0xe4,0xb7,0xe4,0xb8,0x2,0x82,0x89,0x53,0x0,0xf4,0xb4,0x5,0x7d,0x48,0x95,0x6a,0xbf,0xf5,0x57,0xd3,0x60,0x4b,0xc2,0x1,0x92,0x90,0x51,0x3b,0xe1,0xd5,0x73,0x5b,0x9d,0xf5,0x9b,0xee,0x3b,0xd3,0xd6,0x35,0xc9,0x67,0x16,0x9b,0xa5,0x72,0x93,0xa6,0xe6,0xa6,0x8a,0xb9,0xe9,0x4a,0xec,0x5c,0x1a,0xd3,0xc7,0x4e,0x3a,0xc1,0x6,0x8a,0x67,0xed,0xcc,0xa1,0xae,0x7a,0x83,0x46,0x3f,0xbb,0xb6,0x2f,0xd4,0xdc,0x4d,0x95,0xdf,0xf3,0xe8,0x93,0x2f,0x8a,0x28,0x32,0xb,0xf5,0xcb,0xf2,0x47,0x51,0xb7,0x45,0x6c,0xa8,0xf5,0x80,0x6a,0x38,0xa8,0xa1,0x16,0xc4,0x66,0x89,0x57,0x5b,0xe9,0x81,0x8d,0x22,0xf3,0xbd,0xcb,0xf1,0xf8,0x66,0xfc,0x2,0xf0,0xff,0xdf,0xb3,0x77,0x68,0x25,0xaf,0xab,0x1a,0xd9,0x8d,0xed,0xe6,0x3c,0x57,0x3,0xe,0x9d,0xe5,0x51,0x9a,0xb,0x14,0xae,0x63,0x6a,0xa7,0xb7,0xa3,0xef,0x12,0x32,0x5f,0xb5,0x3a,0x2f,0x97,0xaf,0x6e,0x7e,0x6c,0xa6,0x4,0x8e,0x11,0x98,0xa6,0x12,0x2a,0x47,0xac,0x19,0x58,0x8d,0x7d,0x1d,0x1a,0x4d,0xd,0x7d,0xfb,0x23,0x74,0x47,0x44,0xd3,0xe3,0x51,0xa3,0xbf,0xad,0xa7,0x9b,0xc0,0xb6,0x7d,0x40,0xb9,0x75,0x4,0x66,0x46,0xb0,0x4,0x10,0xd0,0xea,0xd,0xd5,0xf4,0x7,0x6d,0xeb,0x4,0xa9,0xb,0xb5,0xd6,0xd9,0x7,0x36,0xa8,0xfc,0x37,0x21,0x46,0x61,0xcc,0xc,0xe5,0x41,0xb5,0x0,0x5e,0x99,0xa7,0x4d,0x57,0xb0,0xf6,0x88,0xe6,0x2b,0x65,0xcf,0xc0,0xe5,0x4f,0x5a,0x88,0x9a,0x15,0x1d,0x4c,0x1b,0x49,0xee,0xa3,0xca,0xe8,0xe8,0x8d,0x63,0xaa,0xb,0xf,0xfb,0xf0,0x2d,0xcf,0x76,0x95,0x22,0xe,0x6d,0x2f,0xf1,0x3d,0x29,0x4b,0x9a,0x1a,0x3a,0x36,0x2a,0xb9,0x42,0xb3,0x63,0xea,0xb6,0x76,0x7,0xf0,0xe5,0xf3,0xeb,0x5d,0xe3,0xc9,0x6e,0xd3,0xd3,0xce,0x25,0x6b,0xb1,0x8e,0xe8,0xe9,0x66,0x1a,0x7b,0xb6,0xbd,0xde,0xda,0x3b,0xd4,0x4e,0xc8,0x57,0x8d,0xf,0x7a,0x78,0x66,0xd8,0xdd,0x3,0x8c,0x29,0x26,0x7a,0x44,0xd1,0xb9,0x55,0xbc,0xe4,0x2,0xf1,0x6c,0x47,0xcd,0xbb,0xcd,0x51,0x32,0xa1,0x4,0xee,0x80,0x28,0xa3,0x47,0x9e,0xf2,0x2,0xbe,0x71,0x40,0xf9,0x2,0x50,0x86,0x41,0xc4,0x8e,0x17,0xac,0x64,0x3a,0xaa,0x50,0x8d,0xf1,0x1,0xfb,0x5f,0x4c,0x1,0x7c,0x8f,0x12,0xca,0x19,0xb,0x34,0x50,0xf8,0x6,0xa4,0x29,0x6b,0x80,0x6,0x3e,0x77,0x75,0x6,0x8e,0xc6,0xc,0x45,0xee,0x71,0xbd,0x70,0x5e,0x19,0xb6,0x5f,0x18,0xf4,0xef,0x9,0xf9,0x6a,0x12,0x23,0x32,0xdb,0x93,0x76,0x50,0xf8,0xf3,0x9d,0x55,0x97,0x9b,0x92,0xe1,0xf8,0x39,0xc5,0x59,0x4f,0x5a,0xd8,0x72,0xd,0xaf,0xb1,0xae,0x4,0x3b,0xaa,0x29,0xfa,0xa0,0x55,0x51,0x55,0x7a,0xee,0x5f,0x84,0xf7,0x29,0x6d,0xff,0x83,0x3b,0x1b,0x3b,0x95,0xd7,0xba,0xe0,0xc2,0x5a,0x5d,0x36,0x38,0x8,0x8a,0xb2,0x18,0x28,0xef,0xaf,0x58,0xdc,0x39,0x8,0x14,0xcc,0x97,0xee,0x9b,0x33,0xee,0x2,0x11,0x2,0x60,0x2e,0xfd,0xe9,0x39,0x67,0xa,0xa6,0xa2,0x28,0xbf,0x3c,0x52,0x18,0x8f,0xc1,0x2e,0x7a,0xcc,0x68,0x3,0x87,0xcc,0x78,0xbe,0xac,0x7e,0xdf,0xfb,0x76,0x6a,0xe6,0x80,0xb,0x77,0xcb,0xe,0xec,0xfc,0xa5,0x98,0x7,0xd6,0xb8,0xd8,0x91,0xc6,0xc6,0x1a,0xe9,0x14,0xd9,0x53,0x73,0xb1,0x2c,0x97,0x23,0xa5,0x6a,0x5c,0x69,0xe7,0xbe,0x27,0x29,0xef,0xf4,0xc8,0x1f,0x9b,0x12,0x6d,0xcd,0x1d,0xb7,0xc7,0x6d,0x9f,0x2,0xb,0x1f,0xca,0xf1,0x1a,0xfc,0xfa,0x77,0x4e,0xac,0x5e,0xec,0xd1,0xfe,0xd1,0xb3,0x8c,0x77,0xd5,0xbf,0xa4,0xb9,0x9e,0xc5,0xa2,0x8d,0x40,0x5e,0x56,0x32,0xc5,0xd0,0xb2,0xbb,0xe2,0x68,0x66,0xb7,0x48,0x9f,0xa9,0xd0,0x36,0x3c,0xf5,0xc4,0x44,0x2d,0x34,0x6c,0xe6,0x68,0xd6,0xc9,0x57,0x17,0x45,0x9b,0x51,0xdf,0xe7,0x5a,0x1b,0xd6,0x53,0x1,0x53,0x82,0x1e,0x1c,0xd8,0xcb,0xcd,0xfe,0xcb,0xad,0x4a,0x2f,0x1d,0x2a,0xab,0xc4,0x15,0x71,0xdb,0x29,0x66,0xc1,0x39,0xfd,0x2f,0x61,0x8e,0x6,0x98,0x75,0x1e,0x0,0x0 };
+const uint8_t sd_handler_js[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0x3,0xad,0x59,0xeb,0x72,0xdb,0xb8,0x15,0xfe,0xef,0xa7,0x80,0xd9,0x74,0x4d,0x36,0xa,0x25,0xa7,0xdd,0xb6,0x63,0x5b,0xda,0xd1,0x5a,0xde,0xae,0x77,0x9d,0xb8,0x23,0x29,0x93,0x1f,0xdb,0x8e,0x5,0x91,0x90,0x44,0x9b,0x22,0x35,0x0,0x18,0xd7,0xf5,0xea,0x5f,0xdf,0xa0,0xf,0xd0,0x57,0xec,0x23,0xf4,0x1c,0x0,0x24,0xc1,0x8b,0x24,0x27,0x4d,0xc6,0xb1,0x45,0xe2,0xe0,0xe0,0x5c,0xbe,0x73,0x83,0xba,0x5d,0xd2,0xc7,0x7f,0x64,0x32,0x22,0x97,0x94,0x87,0xe4,0x47,0x9a,0x84,0x31,0xe3,0xfa,0xed,0x51,0x10,0x53,0x21,0x60,0xd,0x97,0xf2,0x95,0xe7,0x23,0x42,0x82,0x34,0x11,0x92,0x67,0x81,0x4c,0xb9,0xeb,0xa9,0x37,0x84,0xc8,0x55,0x24,0xfc,0x77,0xb7,0xa3,0xab,0x9,0xe9,0x93,0x67,0x72,0x3d,0xba,0xb9,0x3a,0x23,0xbd,0xe,0xb9,0xb9,0x9e,0x4c,0xaf,0xdf,0xff,0xe5,0x8c,0x9c,0x76,0xc8,0xf8,0x6a,0x38,0x52,0x9f,0xdf,0x76,0xc8,0xc7,0xf1,0xb5,0x7e,0xff,0x7b,0xb2,0x3d,0x2f,0x39,0xac,0xd3,0x90,0x1,0x83,0x92,0x9b,0x8f,0x9c,0x2c,0x82,0x79,0xb6,0x58,0xa0,0x80,0xc4,0x71,0xac,0xb7,0x92,0xf2,0x25,0x93,0x3f,0x44,0x31,0x33,0x2b,0xe5,0xd2,0x23,0x8f,0x24,0xfb,0x3e,0xdf,0x95,0xb0,0x47,0xf2,0x21,0x4a,0xe4,0x9f,0x87,0x9c,0xd3,0x27,0xb7,0xe7,0x9d,0xd7,0x28,0x6f,0x17,0xb,0xc1,0x24,0x50,0xf6,0xea,0x2b,0x97,0xab,0x2c,0x79,0x98,0x44,0xff,0xc4,0x23,0x4e,0xdf,0xfe,0xf1,0x9c,0x74,0xbb,0xa7,0x6f,0xbf,0x25,0x35,0xaa,0xeb,0xe4,0xaf,0x3c,0x5d,0x72,0x6,0x86,0xeb,0x93,0x5,0x8d,0x5,0x6b,0xf0,0xa1,0x71,0x3c,0xa7,0xc1,0x3,0x4a,0x93,0xc5,0xb1,0xb5,0x1c,0x89,0x9f,0x26,0xf6,0xae,0x2d,0xfc,0x87,0x1f,0x1,0xda,0xc9,0xcb,0x34,0x8e,0x59,0x20,0xa3,0x34,0x71,0xd1,0x46,0x1d,0x52,0x53,0xb9,0x43,0xee,0x8b,0x13,0x2b,0x3e,0x31,0x16,0xc5,0x3f,0x9f,0x67,0xc6,0xf2,0xa1,0x29,0xe2,0xbd,0xb0,0xe4,0xa3,0x9b,0xd,0x4b,0xc2,0x11,0x95,0xd4,0xd,0xe1,0x57,0xe5,0x74,0x73,0xce,0xeb,0x3e,0xc1,0x25,0x6b,0xd3,0x22,0x4a,0x22,0xb1,0xb2,0xb4,0xca,0xb7,0x29,0x70,0x29,0xea,0x1c,0x7,0x9a,0xc7,0xb9,0xb5,0x6a,0xa3,0xa4,0x54,0x4c,0xaf,0x2d,0x8c,0xf4,0x55,0x7d,0x34,0xc5,0xd7,0xc7,0x59,0xc1,0x35,0x5a,0x10,0x57,0x33,0xed,0x57,0xd8,0x1a,0xfc,0x7b,0xfa,0xdd,0x86,0xa7,0x1,0x40,0xe3,0x26,0x12,0x52,0xdb,0x4a,0x73,0x60,0xe0,0xb4,0x9d,0x1c,0x4c,0xd4,0x54,0x39,0x8c,0x19,0xd,0x15,0x87,0x8e,0x52,0xd8,0xb3,0x2c,0xdb,0x38,0xc3,0x18,0x76,0x22,0xa9,0xcc,0x84,0xaf,0xd0,0x74,0x9d,0x48,0xc6,0x3f,0xd1,0xd8,0xf5,0x6a,0x2a,0x1c,0x2b,0xc3,0xff,0xfa,0xab,0x72,0x80,0x2f,0x79,0xb4,0x76,0x3d,0x3f,0x66,0xc9,0x52,0xae,0x94,0x5c,0xbd,0x9c,0x9b,0x26,0xbf,0x72,0x1d,0x11,0xf0,0x68,0x23,0x27,0xa3,0x29,0x9d,0xc7,0xcc,0xf1,0x3c,0xd2,0x7c,0xe7,0x47,0x49,0xc2,0xf8,0x8f,0xd3,0x77,0x37,0x68,0xb5,0x8b,0xcd,0xe0,0x7d,0xaa,0xa4,0x16,0x24,0x4d,0x30,0xf5,0x4,0x90,0x5f,0x2e,0xba,0x9b,0x81,0xb1,0x27,0x21,0x9c,0xc9,0x8c,0x27,0xfa,0x69,0x7b,0x64,0x39,0x37,0x8e,0x12,0x86,0x30,0x57,0xd2,0x89,0x4d,0x1c,0x49,0xb7,0xfb,0xb7,0xa4,0xeb,0xf9,0xc0,0xe,0x34,0x72,0x63,0xd2,0x1f,0x14,0x2,0xea,0x2d,0x18,0xcb,0xb1,0xd1,0xa4,0xca,0x1f,0x96,0xbe,0xf9,0x86,0x1c,0x4b,0x6d,0x12,0xf1,0x31,0x92,0x2b,0xd7,0x19,0x38,0x5e,0xcb,0xdb,0xdf,0x38,0x66,0xef,0xd6,0x36,0x58,0xc,0x89,0x62,0x25,0xd7,0xb1,0xd2,0x4a,0xa2,0xae,0x83,0xb,0xb9,0x2,0xcf,0xc0,0x1f,0x8e,0x1f,0x7,0xa,0x29,0xee,0x64,0xe4,0x5d,0x74,0xe1,0x9,0xdf,0x60,0x2,0x29,0x1e,0x86,0xa,0xfa,0x42,0x3f,0x77,0x71,0x4f,0x37,0xdf,0x3f,0x4f,0xc3,0xa7,0xdc,0x20,0x78,0x4e,0x90,0x66,0x89,0x95,0x96,0xf4,0x7b,0xb4,0x86,0xbf,0x48,0xf9,0x15,0xd,0x56,0x2e,0x3e,0x35,0xd5,0xdf,0xa0,0x12,0x68,0x2,0x58,0x35,0x16,0x73,0x3a,0x4e,0x61,0x9,0x74,0xa2,0x22,0xc9,0x9d,0x7c,0x41,0xde,0x7a,0x15,0xfb,0xe7,0x8c,0x12,0xba,0x46,0xd0,0x2b,0xe2,0x5f,0x7a,0x7f,0xaf,0x59,0x54,0xd3,0x8,0x9d,0x1d,0x3f,0xc8,0x28,0x56,0x72,0xad,0xa9,0xfc,0xfe,0x49,0x32,0x81,0x47,0x8,0x48,0x8d,0x52,0x9f,0xf5,0xcb,0x69,0xbe,0xdd,0xb3,0x18,0x80,0x7e,0xaf,0x5f,0xe7,0x8f,0xca,0xac,0x90,0x35,0x66,0xda,0x92,0x60,0x11,0xb1,0xa1,0x9,0x51,0x15,0xa9,0x7f,0x82,0xe0,0x79,0x13,0xc1,0x99,0x27,0x83,0xff,0xfe,0xe7,0xdf,0xff,0xba,0xe8,0xe2,0xe2,0x80,0xbc,0x7a,0x46,0x21,0xb7,0x60,0xc4,0x50,0xed,0x79,0xf5,0x8c,0x2,0x95,0xcf,0xb3,0x26,0xf7,0x79,0x26,0x65,0x5a,0xf0,0xd,0x69,0xb2,0x64,0xfc,0x4,0x60,0x19,0xc4,0x51,0xf0,0xd0,0x77,0xf8,0xfa,0x4e,0x84,0x77,0x78,0x9c,0x7b,0x62,0xb8,0x9f,0x78,0xce,0x20,0x64,0xe0,0x12,0x70,0xa3,0xde,0x3d,0x20,0xb3,0x3,0x7c,0x37,0xa0,0x2c,0xe5,0x4f,0x36,0x63,0xf0,0x72,0x2b,0x6b,0x16,0x46,0xd2,0x62,0x7c,0x48,0xe2,0x47,0xca,0x13,0x9b,0x6d,0x96,0x20,0x57,0x1d,0x7f,0x15,0xbe,0xe3,0x2c,0x29,0xd8,0x6a,0x83,0x20,0xde,0x66,0x25,0xaa,0x8f,0xec,0x63,0x1c,0x58,0x55,0x8,0x84,0xbf,0xa,0xd7,0x6,0x89,0xbb,0x62,0x3e,0xc7,0xdc,0x81,0xd8,0xd7,0x20,0x1e,0x90,0x1e,0xf9,0x4e,0x1f,0x75,0x96,0xa7,0x3,0xc8,0x45,0x51,0x68,0x92,0xc2,0x2,0xa8,0xec,0x7c,0xb0,0x6d,0xe4,0xb6,0x5a,0xf6,0x7b,0xf,0x4a,0xa2,0xc,0x7b,0xd3,0x9c,0x2d,0x3f,0x1a,0x39,0xe5,0x79,0xa4,0xe7,0x75,0xcd,0x52,0x43,0xad,0xfb,0x41,0xc6,0x39,0x4b,0xe4,0x4,0x3e,0xd3,0xa5,0xca,0xf8,0xd0,0xb,0xd,0xc7,0xa3,0x22,0x4f,0x19,0xba,0x6c,0x3,0xb2,0xb0,0x49,0x9a,0xf1,0x80,0x7d,0xb8,0x76,0x73,0xaa,0xfc,0x50,0x65,0x96,0xfc,0x48,0x1f,0xc4,0xc9,0x18,0x29,0xeb,0x61,0x65,0x1d,0xf3,0x85,0x45,0x93,0x2b,0x57,0x32,0xd2,0x7,0xe2,0xfb,0x5b,0x28,0xba,0x2c,0xc4,0x1a,0xc6,0x33,0x53,0xde,0xb6,0x65,0x21,0x29,0x38,0xfe,0x34,0xd1,0x6a,0x7e,0x89,0x96,0xe4,0x45,0x6a,0x76,0x2c,0xde,0x4d,0x8d,0xf1,0xfc,0xc3,0x3a,0x57,0xa8,0xe,0x6b,0xad,0x7a,0x10,0x4b,0xef,0x12,0x20,0x31,0x54,0x3d,0x64,0x28,0x8a,0x7e,0x22,0x5a,0x7c,0x59,0x95,0x8a,0x6,0x37,0x29,0xd,0xa3,0x64,0x89,0x15,0x4a,0x1,0xd3,0xf7,0xfd,0x8b,0x6e,0x34,0xb0,0xfb,0x81,0x7a,0x6b,0xd6,0x52,0xf8,0x35,0xf5,0xc7,0xc9,0x3b,0x9a,0x80,0x79,0xb9,0x2f,0xa0,0x57,0x82,0xb3,0xc3,0xbb,0x58,0x80,0xe9,0xb0,0x3,0x34,0x24,0x39,0x70,0x99,0x44,0xd3,0xde,0x4d,0xa6,0xc3,0xe9,0x87,0xc9,0x19,0x61,0x49,0xb6,0x66,0x9c,0x4a,0x90,0x4,0x4,0xc8,0x33,0x77,0xb7,0x6b,0xc8,0x21,0xcb,0x6,0xd0,0x9a,0x32,0xd5,0x4f,0xfe,0xa1,0xb6,0xd8,0x52,0xeb,0x8d,0x9d,0x30,0xff,0xa0,0x9d,0x5c,0x3b,0x7e,0xf2,0x5a,0x73,0x5f,0xeb,0x5d,0x11,0x50,0x39,0x9d,0x2f,0xd3,0x9b,0xf4,0x91,0xf1,0x4b,0x2a,0x18,0xb4,0x6,0xa0,0x8c,0x29,0x91,0xfe,0xbd,0x40,0xbb,0xaa,0xbd,0xa5,0x6b,0xe,0x41,0xe7,0x5e,0x78,0x2f,0x33,0xa7,0xe9,0x82,0xca,0x80,0xb7,0xf6,0xd6,0x8c,0x3b,0x3,0xe3,0x6,0x54,0x12,0xe7,0xd5,0x73,0x4e,0xbc,0x75,0x66,0x2f,0xb1,0x35,0x5a,0xe5,0xeb,0xda,0x59,0x75,0xfc,0x6e,0x29,0x33,0xd4,0x2c,0x9,0xc1,0x6,0x1f,0xaa,0x53,0x40,0x89,0x56,0xe2,0xb6,0xd,0x13,0x5e,0xa5,0xac,0xa7,0x31,0xf3,0x19,0xe7,0x30,0x7e,0x39,0x1f,0x91,0x8e,0xd0,0x18,0x45,0x7f,0x22,0x51,0x82,0x29,0x52,0xed,0x38,0x76,0xbc,0xf6,0x76,0xea,0x50,0x23,0x6c,0x26,0xb3,0x5d,0x5d,0x6f,0x19,0x9d,0xda,0x4,0x64,0x2,0xfa,0x10,0x2a,0xc8,0x3c,0x4a,0xa0,0xc6,0x91,0x5,0x87,0x45,0x81,0x49,0x81,0x61,0xd3,0xf1,0x80,0xdd,0x1d,0x8f,0x20,0xad,0xd3,0xe4,0x89,0xcc,0xa1,0x1b,0xd8,0x37,0x9a,0x4d,0xd9,0x3f,0xe4,0x55,0x12,0x80,0x4c,0x5c,0x81,0xb,0x3f,0xb9,0xc6,0x66,0x9f,0x31,0xaa,0x55,0x86,0xb0,0x12,0x8c,0xad,0x33,0x58,0xee,0x8,0xab,0xaf,0xca,0x4d,0x1c,0xa7,0x4b,0x77,0x36,0x41,0xdf,0x9a,0x34,0xa0,0xf6,0xc2,0x3c,0x6,0xc6,0x5e,0x43,0x99,0xe2,0x67,0xc4,0x82,0xd8,0xac,0x5,0x5b,0x82,0x7e,0xc2,0xad,0x32,0x85,0xdd,0x16,0xaa,0xf6,0x61,0x10,0xcf,0xc0,0xf3,0x1c,0xef,0x20,0xc6,0xc,0x23,0xf0,0xc1,0x14,0x8c,0xd,0x3c,0x86,0x97,0x3f,0x83,0x92,0x0,0x7d,0x9a,0x8,0x88,0x51,0x41,0x22,0xf4,0xcc,0x3,0x96,0x54,0xae,0x1c,0xb2,0x88,0x38,0xb4,0x69,0x1,0x4e,0xb2,0x1d,0x22,0x18,0x23,0x2b,0x35,0xd6,0x2b,0x10,0xd,0x83,0x7,0xd7,0xdb,0x15,0x4f,0x5a,0xe7,0x3b,0x65,0x80,0xbb,0x39,0x5b,0x2,0xd0,0x76,0x86,0x97,0xea,0xd8,0x71,0xe7,0x7b,0xf0,0xa6,0x9a,0x9a,0x5d,0x1b,0xde,0xc7,0xed,0xf8,0xb6,0x41,0x6a,0x75,0xfc,0x9c,0xad,0x29,0x8c,0x8a,0x60,0xc4,0x7e,0x3,0x34,0x79,0xcf,0xfa,0xa6,0x1,0x8a,0xda,0x54,0x53,0x32,0xb9,0xa8,0x8c,0x30,0xb6,0xa3,0x9d,0x61,0x1c,0x6b,0xcb,0x8,0x14,0x1e,0x42,0xf4,0x91,0x46,0xca,0xf1,0x68,0x3c,0x18,0x57,0x69,0x4c,0xc0,0xbe,0x96,0x17,0x77,0x6,0x96,0x96,0x3c,0xb0,0xee,0xb,0xde,0x51,0xb9,0xf2,0xd7,0x51,0xe2,0xb6,0x5c,0x27,0x74,0x4a,0x1d,0xbd,0xf3,0xfa,0xfe,0x36,0xad,0x45,0x36,0xa7,0xea,0xf6,0xa2,0xae,0x75,0xa7,0x19,0x1c,0xaf,0x4b,0x31,0xaa,0x90,0x31,0xd3,0x41,0x19,0x26,0x4a,0xc4,0x45,0x9c,0x42,0x52,0x69,0x30,0x26,0xdd,0x5d,0xb6,0xf7,0xc8,0xef,0xc8,0x69,0xaf,0x57,0xcf,0x96,0x8,0xea,0x59,0xd,0xfc,0x10,0x2b,0xf9,0x71,0xdb,0xdf,0xce,0xbc,0x9d,0xf1,0x6,0xc0,0xc1,0x6d,0x5a,0xfd,0x57,0xcf,0x75,0x59,0xb6,0x6f,0x9a,0xef,0x6c,0x35,0xb7,0x24,0x5d,0x54,0xb6,0x55,0xe4,0x55,0x51,0xda,0x2,0xf2,0x31,0x7d,0x74,0x4d,0x58,0x58,0x65,0xa2,0x3d,0xe1,0x40,0x7f,0x5c,0x9c,0x66,0xa5,0xfa,0x5a,0x28,0x89,0x2c,0x8,0xac,0xc4,0xfd,0x39,0xc8,0x57,0xb4,0xb5,0xfd,0x3b,0x12,0x3f,0x46,0xfc,0x82,0x42,0x18,0x86,0x56,0xbe,0x57,0xc7,0xe8,0xb,0x16,0x45,0xe5,0x3a,0x57,0xe3,0xf1,0xed,0xf8,0x85,0xb8,0xfd,0xca,0x11,0x37,0xb0,0x3,0x4e,0x57,0xf9,0x6a,0x6a,0xa8,0xf4,0xae,0x3b,0x23,0x53,0xdd,0x4b,0xe8,0xb8,0xc,0xe2,0x54,0x20,0x67,0x9d,0x93,0x2a,0x1,0xd9,0xd2,0x66,0x9,0x99,0x6e,0xaa,0x8d,0x56,0x9b,0x81,0x6e,0x7f,0x2e,0x26,0xfc,0xfa,0x1d,0x95,0xa6,0x10,0xa,0xd8,0xf6,0x25,0x55,0x81,0x58,0xed,0x9,0x4d,0xc,0x1d,0xf9,0x23,0xb4,0x43,0x44,0x93,0x63,0x7d,0xd0,0x9f,0xb6,0xb3,0x76,0x48,0xed,0xbd,0x2e,0xdc,0x77,0x49,0x65,0x39,0xcc,0x20,0x5,0x28,0xf5,0x59,0xea,0xa2,0x6,0x35,0xaa,0xf9,0xa4,0x81,0xa8,0x5a,0xa5,0x2,0xd9,0x55,0xac,0x5a,0x48,0xa2,0x31,0xe3,0x10,0xc9,0xaa,0xf4,0x3b,0x26,0xa8,0xca,0x6e,0x60,0xeb,0x10,0xbd,0xcd,0x70,0x5e,0x80,0x8d,0x9f,0x34,0xf,0x75,0xa7,0x73,0x3c,0x2b,0x18,0xc1,0x19,0xd3,0x68,0xcd,0xd2,0x4c,0xba,0x50,0xc,0xfa,0x3,0xad,0x94,0xd5,0xad,0x77,0xc8,0xb7,0x45,0x1a,0xa9,0x61,0xa1,0x5a,0x28,0x4d,0x11,0x56,0x51,0xd0,0x94,0xf4,0xa,0x5f,0x13,0x93,0x79,0xd4,0x55,0x60,0x29,0x4e,0x8b,0x37,0xf6,0xdf,0x8a,0x6d,0xdb,0x3c,0xf6,0x7f,0x5e,0x25,0xef,0xbf,0x41,0x6c,0x76,0x28,0xb5,0xd8,0xa9,0xac,0x15,0x1e,0x3d,0xdf,0x49,0x52,0xb9,0x64,0xb6,0xf4,0x69,0xf8,0xa3,0xb0,0x43,0xba,0x29,0xcd,0xd0,0xc1,0xdc,0xde,0x2b,0x8b,0x3a,0xcf,0x92,0x89,0xbe,0x5a,0xa8,0x8f,0xd,0x9f,0x33,0x22,0x3c,0x57,0x5c,0xe6,0x4c,0x53,0xe4,0x4b,0x28,0x81,0xa9,0xe,0x59,0x74,0xc8,0x53,0x9a,0x99,0x4e,0x65,0x5,0xf0,0x42,0xf,0x62,0x77,0x6b,0x1a,0x18,0x30,0x1c,0x24,0x5a,0x7c,0xc0,0x5e,0x17,0x71,0x8f,0xef,0x91,0x83,0xb9,0x19,0x81,0xd6,0x4,0xdf,0x0,0x37,0xa5,0x8,0xd0,0xc0,0xef,0xbd,0x45,0xbb,0xa5,0xdf,0x41,0x7e,0x87,0xe7,0x87,0xb6,0xa1,0x60,0xdf,0x48,0xa0,0x2e,0xf3,0xd3,0xcd,0x24,0x44,0x38,0xd6,0x6e,0xbc,0x41,0xce,0x4f,0x77,0x95,0x94,0x5b,0xe6,0x86,0xc6,0xf7,0x19,0x6d,0x69,0xa3,0xa,0xa2,0xb6,0x9b,0x64,0xcc,0x1e,0xde,0xfe,0x4c,0x89,0x8a,0x57,0xb3,0xa5,0xa,0xc5,0x97,0xa6,0xd7,0xc3,0xb9,0xeb,0x4b,0xcd,0x57,0x68,0xa7,0xec,0xd4,0x0,0x11,0xe6,0x60,0xd3,0x6c,0x48,0xd5,0xb,0xab,0x88,0x57,0xd6,0xde,0xb0,0xb0,0x9a,0xdb,0x11,0xc8,0xeb,0xd6,0xe1,0x17,0xf9,0x83,0x37,0x0,0x7b,0x6b,0x77,0x36,0xe4,0x4c,0x21,0x51,0x64,0xe6,0xc3,0x23,0x85,0x41,0x7,0xe,0xd0,0xb7,0x7f,0x55,0x78,0xc0,0xd8,0x93,0xae,0xf3,0xaf,0xd1,0xbe,0x9b,0x59,0x28,0x6f,0x3,0xd7,0xba,0x81,0x2d,0x77,0x2d,0x96,0x9e,0x7d,0x7b,0xdb,0x12,0xa2,0xe5,0x12,0x69,0xa4,0xcf,0x73,0x6b,0xcd,0xa4,0xc2,0x91,0x12,0x33,0xcc,0x25,0x6b,0x9d,0x55,0x94,0x51,0x3a,0xe4,0x4f,0x45,0xea,0xb5,0xee,0x2,0xf7,0xba,0xe9,0x70,0xe2,0xdc,0x1e,0x81,0xa5,0x35,0xb4,0xf5,0x37,0x88,0x26,0x65,0x56,0xbe,0x4e,0x54,0x9e,0xcd,0xdb,0x8e,0x38,0xd5,0x77,0xa2,0xa8,0x16,0x10,0x9b,0xbc,0xa4,0xc8,0xab,0xaa,0xe6,0x1b,0xca,0x2b,0x54,0x24,0x4f,0x94,0x23,0xcb,0x2d,0xc5,0x15,0x87,0x5a,0x28,0x76,0xd9,0x37,0xa4,0xad,0xdb,0x8a,0x1c,0x57,0xd9,0xa7,0x27,0x9f,0xda,0x71,0xc5,0x3c,0x6f,0x33,0xd0,0x23,0x7f,0x75,0xb9,0x38,0x7d,0xbd,0x57,0xe2,0x75,0x53,0x5e,0x15,0x94,0x22,0xac,0xdb,0xc3,0x4e,0x23,0xe7,0xff,0x3,0x45,0xba,0x27,0x70,0xc7,0x1d,0x0,0x0 };
 
 const uint8_t settings_html[] PROGMEM = { 0x1f,0x8b,0x8,0x0,0x0,0x0,0x0,0x0,0x2,0xff,0x9d,0x56,0x4b,0x6f,0xe3,0x36,0x10,0x3e,0x6f,0x80,0xfc,0x87,0x59,0xf5,0xe0,0x16,0x58,0x59,0x9b,0x4,0x28,0xd2,0x40,0x36,0x10,0x38,0xbb,0x6d,0x8a,0x2e,0x12,0xd4,0xe,0x8a,0x9e,0x2,0x5a,0x9c,0x58,0xec,0x52,0xa4,0x40,0x52,0xf6,0x1a,0xe8,0x8f,0xef,0x90,0x94,0x64,0xb9,0xb1,0x9b,0x34,0x3e,0xc8,0xe4,0x70,0x1e,0xdf,0xbc,0x38,0xcc,0xdf,0xa7,0xe9,0xe9,0x9,0x0,0x2c,0x4a,0x61,0xc1,0xea,0x27,0xb7,0x61,0x6,0x81,0xd6,0x52,0x14,0xa8,0x2c,0x72,0x68,0x14,0x47,0x3,0xae,0x44,0xf8,0x72,0xbb,0x80,0xdf,0x22,0x79,0xc,0x73,0xc4,0x40,0x6c,0xf9,0xe0,0x49,0x48,0xfa,0x68,0x3,0x1c,0x1d,0x13,0xd2,0x8e,0x83,0xda,0xb9,0x6e,0x4c,0x81,0x57,0x50,0x3a,0x57,0xdb,0xab,0x2c,0x5b,0x9,0x57,0x36,0xcb,0x71,0xa1,0xab,0xcc,0xd6,0xac,0xc0,0xb2,0x29,0x95,0xc3,0xa2,0xcc,0xfe,0x10,0x9f,0xc5,0x4d,0x53,0x7c,0x3d,0x3d,0x49,0xd3,0xe9,0xe9,0x49,0xfe,0xfe,0xe6,0x6e,0xb6,0xf8,0xf3,0xfe,0x13,0x49,0x56,0xd2,0x13,0xda,0x7f,0xd2,0x9,0x79,0x89,0x8c,0xb7,0xeb,0xb0,0xaf,0xc8,0x24,0x14,0x25,0x33,0x16,0xdd,0x24,0x79,0x58,0x7c,0x4e,0x2f,0x93,0x67,0xe7,0x8a,0x55,0x38,0x49,0xd6,0x2,0x37,0xb5,0x36,0x2e,0x81,0x42,0x93,0x65,0x45,0xfc,0x1b,0xc1,0x5d,0x39,0xe1,0xb8,0x26,0x4f,0xd2,0xb0,0xf9,0x0,0x42,0x9,0x27,0x98,0x4c,0x6d,0xc1,0x24,0x4e,0x3e,0x8e,0x2f,0x3f,0x40,0x45,0xb4,0x8a,0x48,0x8d,0x38,0xa6,0x9b,0xc2,0x51,0x61,0x5a,0x68,0xa9,0xcd,0x40,0xfd,0x77,0x17,0x3f,0x5e,0xfc,0x74,0xf1,0xc9,0xb,0x1d,0x16,0xe3,0x68,0xb,0x23,0x6a,0x27,0xb4,0x1a,0x88,0xf9,0x80,0x80,0x8f,0xc8,0x9e,0x35,0x27,0x9c,0xc4,0x69,0x7f,0x6,0x7f,0x53,0x1e,0x9c,0x13,0x6a,0x65,0xf3,0x2c,0x9e,0xed,0x59,0x91,0x42,0x7d,0x5,0x83,0x72,0x92,0x58,0xb7,0x95,0x68,0x4b,0x44,0xf2,0xdc,0x6d,0x6b,0x8f,0x16,0xbf,0xb9,0xac,0xb0,0x36,0x81,0xd2,0xe0,0x53,0xcb,0x31,0xf6,0x84,0xa1,0xc1,0x8,0xd,0xac,0x29,0x88,0x23,0xac,0xc7,0x7f,0x11,0x47,0x9e,0xc5,0xcd,0x51,0xd6,0x16,0xd5,0x21,0xe6,0x3c,0xeb,0xf3,0xf7,0x2e,0x5f,0x6a,0xbe,0x1d,0x2a,0x51,0x6c,0x3d,0xd8,0x6,0x52,0x23,0xa1,0x90,0xcc,0xda,0x49,0x52,0xa1,0x6a,0x92,0x7f,0x1d,0xb7,0x7e,0x4e,0x73,0xd6,0xfa,0x21,0xa8,0x5e,0xbf,0x8d,0x7d,0xb9,0x24,0xbb,0x40,0xe5,0x19,0x23,0x18,0xc4,0x76,0x7a,0xf2,0x8e,0x7e,0x7b,0x2,0xbf,0xdc,0xde,0xcc,0x28,0xea,0x46,0xcb,0x56,0x8a,0x8,0xd0,0x52,0x6,0x72,0xff,0x69,0xb4,0xf7,0x37,0x6a,0xd8,0x25,0xe5,0x75,0xe2,0xe,0xd,0x95,0x17,0xeb,0x0,0x2c,0xda,0xed,0x6b,0xc5,0xb,0x83,0x5c,0xb8,0xce,0xf8,0xf5,0x52,0x37,0xee,0x88,0x68,0x9e,0x35,0x72,0x18,0xee,0x2c,0xc6,0x9b,0x22,0xc2,0xc5,0x1a,0x4,0xf7,0x65,0xc0,0x5c,0x13,0x92,0x46,0x94,0x78,0x54,0x31,0xa1,0x62,0xe0,0x72,0x8b,0x85,0xaf,0xd3,0x2e,0x8c,0xe5,0x59,0x8,0x31,0x65,0xf4,0xac,0x23,0x79,0x3d,0x6d,0xba,0x7c,0x2d,0x93,0x28,0x52,0x37,0x78,0xcd,0x1b,0xf1,0x24,0xba,0xc0,0x24,0x2d,0xfb,0xbb,0xbc,0x9e,0xfe,0x8e,0x64,0xd3,0xb8,0x70,0x9b,0xc4,0x2e,0x4,0xa7,0x81,0xd5,0xb5,0xdc,0x82,0xc2,0xd,0xf4,0xb1,0xcd,0xb3,0xba,0x17,0x73,0x6c,0x19,0x8a,0xbd,0xdd,0x99,0x6e,0x49,0x6b,0x3e,0x9d,0xcf,0x6f,0x6f,0xae,0xa8,0x21,0xf8,0x90,0x1a,0xbd,0xb3,0x82,0x7b,0xdf,0xf6,0x8f,0xa6,0xf9,0xb2,0x71,0x4e,0xab,0xe,0x78,0x6d,0xa8,0xd3,0xcd,0x36,0xc2,0xf6,0xa1,0x7d,0x8c,0x72,0x7e,0x99,0x67,0x91,0x77,0x4f,0x9,0xad,0xcd,0x31,0x30,0xf7,0xa4,0x72,0xa3,0xd,0x3f,0xc,0xa8,0x6e,0x4f,0xdf,0x2,0x6a,0x27,0xfb,0x26,0x60,0xb3,0x92,0x29,0x85,0xf2,0x30,0xae,0x22,0x1e,0xbe,0x5,0x56,0x2f,0xfa,0x26,0x54,0xd7,0x8d,0xd3,0xa6,0x51,0x30,0xf,0x57,0xc6,0x61,0x70,0x2c,0xf2,0xbc,0xc,0x8e,0x86,0x99,0x8a,0xc8,0xb8,0xb0,0xbe,0x62,0x1e,0x7b,0xd1,0x96,0xf0,0x32,0xbe,0x6c,0xbf,0xd4,0xf6,0xd,0x70,0xa6,0x56,0x5d,0x7d,0x1b,0xa4,0x4a,0x4d,0x7c,0x39,0xa3,0xeb,0x8b,0xb6,0xd7,0xdf,0xb6,0x47,0xdf,0x55,0xb4,0xdc,0x6b,0xa6,0x3,0xad,0xf5,0x50,0x73,0xe6,0xf0,0x75,0xcd,0xd5,0x4,0xde,0xbb,0xc5,0xf5,0xb0,0xb3,0xba,0xc8,0xfc,0xac,0x7d,0x47,0xf5,0xd7,0xc5,0xab,0x87,0x71,0x46,0xa3,0x3,0x99,0x45,0x9a,0x11,0xd4,0xa1,0x2b,0x3f,0x5c,0x1f,0x97,0x92,0x29,0x9a,0x49,0xbe,0x99,0x39,0xb1,0x4,0xe9,0x8e,0xcd,0x5f,0x3a,0x9d,0x4d,0x32,0x58,0x94,0x48,0x23,0xca,0xbf,0x9,0x22,0x3a,0xea,0xe0,0xa5,0xa1,0xbb,0x51,0x92,0xa7,0xc0,0x60,0xbc,0x14,0x2a,0x3e,0x1b,0x98,0xe2,0x50,0x53,0xf8,0x2c,0x31,0x4a,0xcd,0xb8,0x47,0x1b,0x45,0x6,0x97,0x42,0x10,0xee,0x93,0x12,0x9c,0xeb,0x76,0x64,0xa2,0x2,0x9a,0xa8,0xa5,0xe6,0x93,0xd1,0xfd,0xdd,0x7c,0x31,0x2,0x16,0x82,0x39,0x19,0x65,0x51,0xcf,0x8,0x50,0x15,0x61,0xee,0x8d,0xaa,0x46,0x3a,0x51,0xd3,0x85,0x93,0x79,0xb1,0x94,0x4e,0xd9,0xa8,0xd7,0x2b,0x54,0xdd,0xb8,0x38,0x20,0x47,0x1e,0xda,0x28,0xce,0xe8,0x51,0xab,0xe5,0x20,0x9f,0x6d,0x96,0x95,0x70,0xa3,0xfd,0x9a,0x5b,0x33,0xd9,0xd0,0xd9,0x43,0xf0,0x67,0x27,0x17,0x6c,0xbe,0x5c,0xb,0x4f,0x5a,0xd3,0x48,0xe8,0xf8,0xfe,0x77,0xde,0x9e,0xa7,0xeb,0xce,0x88,0x95,0x9f,0x28,0xf4,0xc4,0xf3,0xf,0xb2,0x5d,0xa2,0xa8,0x3e,0xcd,0x34,0x7c,0x5e,0x36,0x76,0x83,0x86,0x12,0x7a,0x79,0x96,0xcd,0x7e,0xfd,0x32,0x7b,0x48,0x2f,0xce,0xcf,0xce,0xd3,0xe3,0x26,0x67,0x9a,0x53,0x66,0x39,0xab,0x1d,0x3d,0x22,0x7d,0x11,0xf8,0x54,0xee,0x24,0x7,0x10,0x3c,0x82,0x1d,0x0,0x72,0x49,0x85,0x92,0x5e,0xa3,0xb1,0xfe,0x4d,0xe4,0xdf,0xf,0x44,0x1b,0xf0,0xcc,0x74,0xbd,0x25,0x87,0x4a,0x7,0xdf,0x17,0x3f,0xc0,0xf9,0xc7,0xf3,0x33,0x98,0x77,0x81,0x80,0x5,0x45,0x42,0xd1,0x1b,0x6c,0x25,0xa8,0x20,0x8f,0xfb,0xd5,0x47,0xce,0xbb,0xf6,0x1c,0xfd,0xde,0x71,0x8f,0xd5,0xe7,0xaf,0xcb,0xc,0x5,0x2d,0xbe,0x5d,0xa8,0x41,0xfd,0xdb,0xf4,0x1f,0xf8,0xc3,0xe5,0x33,0x4b,0xb,0x0,0x0 };
 
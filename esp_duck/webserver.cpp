@@ -88,6 +88,20 @@ namespace webserver {
                 }, false);
                 currentClient = nullptr;
             }
+
+            #ifdef USE_SD_CARD
+            // Binary frames are chunks of an SD card write, they may hold any byte
+            else if ((info->opcode == WS_BINARY) && info->final && (info->index == 0) && (info->len == len)) {
+                debugf("Binary from %u [%llu byte]\n", client->id(), info->len);
+
+                currentClient = client;
+                cli::write_sd(data, len, [](const char* str) {
+                    webserver::send(str);
+                    debugf("%s\n", str);
+                });
+                currentClient = nullptr;
+            }
+            #endif
         }
     }
 
@@ -0,0 +1,185 @@
+/*!
+    \file host/bench/bench.h
+    \brief Payloads and helpers shared by the host benchmarks
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <stdio.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "../../atmega_duck/src/duckparser/duckparser.h"
+#include "../../atmega_duck/src/sdcard/script_runner.h"
+
+namespace bench {
+    /*! CPU time of a pass through the ATmega's loop() with nothing to do, as in sim::default_config() */
+    #define IDLE_LOOP_US 20
+
+    /**
+     * @brief Runs a started script to the end, the way loop() does on the board
+     *
+     * While a DELAY runs, script_runner returns at once and loop() comes
+     * around again IDLE_LOOP_US later. Those passes are not counted.
+     *
+     * @param max_steps Upper bound of execute_next_line() calls that did work
+     * @return Number of execute_next_line() calls that did work
+     */
+    inline unsigned long run_script(unsigned long max_steps) {
+        unsigned long steps = 0;
+
+        while (steps < max_steps) {
+            if (duckparser::getDelayTime() != 0) host::advance_us(IDLE_LOOP_US);
+            else if (script_runner::execute_next_line()) ++steps;
+            else break;
+        }
+
+        return steps;
+    }
+
+    /**
+     * @brief Host CPU time of this process in microseconds
+     */
+    inline double cpu_now_us() {
+        struct timespec ts;
+
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+        return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+    }
+
+    /**
+     * @brief Counts keyboard reports that press at least one new key
+     *
+     * A character typed with the default engine shows up as a press report
+     * followed by a release report, so this is the number of characters the
+     * host machine would receive.
+     */
+    inline size_t count_keystrokes(const std::vector<host::hid_record>& trace) {
+        uint8_t prev[6] = { 0 };
+        size_t  n       = 0;
+
+        for (const host::hid_record& r : trace) {
+            if (r.id != 2) continue;
+
+            const uint8_t* keys = &r.data[2];
+
+            for (uint8_t i = 0; i < 6; ++i) {
+                if (keys[i] && !memchr(prev, keys[i], 6)) {
+                    ++n;
+                    break;
+                }
+            }
+
+            memcpy(prev, keys, 6);
+        }
+
+        return n;
+    }
+
+    /**
+     * @brief Reads a whole file from the host file system
+     */
+    inline bool load(const char* path, std::string* out) {
+        FILE* f = fopen(path, "rb");
+
+        if (!f) return false;
+
+        char   tmp[4096];
+        size_t n;
+
+        out->clear();
+
+        while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) out->append(tmp, n);
+
+        fclose(f);
+        return true;
+    }
+
+    /**
+     * @brief File name part of a path, for result tables
+     */
+    inline const char* basename(const char* path) {
+        const char* name = strrchr(path, '/');
+
+        return name ? name + 1 : path;
+    }
+
+    // ===== Synthetic payloads ===== //
+
+    static const char* ascii_text = "The quick brown fox jumps over the lazy dog 0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~ THE END";
+
+    static const char* key_combos[] = {
+        "CTRL ALT DELETE", "GUI r", "F12", "NUM_PLUS", "SHIFT TAB",
+        "ALT F4", "CTRL c", "ENTER", "PAGEDOWN", "PRINTSCREEN",
+    };
+
+    inline std::string synthetic_string() {
+        std::string s = "DEFAULT_DELAY 0\n";
+
+        for (int i = 0; i < 200; ++i) s += std::string("STRING ") + ascii_text + "\n";
+
+        return s;
+    }
+
+    inline std::string synthetic_lstring() {
+        std::string s = "DEFAULT_DELAY 0\nLSTRING_BEGIN\n";
+
+        for (int i = 0; i < 200; ++i) s += std::string(ascii_text) + "\n";
+
+        return s + "LSTRING_END\n";
+    }
+
+    inline std::string synthetic_keys() {
+        std::string s = "DEFAULT_DELAY 0\n";
+
+        for (int i = 0; i < 1000; ++i) s += std::string(key_combos[i % 10]) + "\n";
+
+        return s;
+    }
+
+    inline std::string synthetic_utf8() {
+        std::string s = "DEFAULT_DELAY 0\nLOCALE ES\n";
+
+        for (int i = 0; i < 200; ++i) s += "STRING ñÑçÇ¿¡áéíóúÁÉÍÓÚ€ºª·¨ Año Señor Ángel\n";
+
+        return s;
+    }
+
+    inline std::string synthetic_mixed() {
+        std::string s = "DEFAULT_DELAY 5\n";
+
+        for (int i = 0; i < 50; ++i) {
+            s += "REM iteration\n";
+            s += "GUI r\n";
+            s += "STRING powershell -NoProfile -Command \"Get-ChildItem C:\\\\Users\"\n";
+            s += "ENTER\n";
+            s += "DELAY 20\n";
+            s += "CTRL SHIFT ESC\n";
+            s += "STRINGLN echo hello\n";
+            s += "DOWN\n";
+            s += "REPEAT 3\n";
+        }
+
+        s += "LOOP_BEGIN 5\nSTRING loop body\nTAB\nLOOP_END\n";
+
+        return s;
+    }
+
+    typedef struct payload_t {
+        const char* name;
+        std::string (* make)();
+    } payload_t;
+
+    static const payload_t synthetic[] = {
+        { "string_ascii", synthetic_string },
+        { "lstring_ascii", synthetic_lstring },
+        { "key_combos", synthetic_keys },
+        { "string_utf8_es", synthetic_utf8 },
+        { "mixed", synthetic_mixed },
+    };
+}
@@ -0,0 +1,216 @@
+/*!
+    \file host/bench/delay_bench.cpp
+    \brief How exact DELAY is, and how long it keeps the ATmega's loop() busy
+    \copyright MIT License
+
+    Types "a", runs DELAY N and types "b", for a range of N. The delay the
+    USB host sees is the time between the report that releases a and the
+    report that presses b. Both ways a script can take are measured:
+
+      - sd    script_runner reads the script from the SD card, loop() is
+              modelled as one execute_next_line() per pass plus the CPU
+              time of an idle pass
+      - link  the ESP sends the script line by line over the serial link
+              (see host/sim/sim.h), so the next line's trip over the wire
+              is part of the delay
+
+    Reported per delay: the measured gap, its error against the requested
+    time and the longest single pass through loop(). Nothing else on the
+    ATmega runs during a pass, com::update() included. The rate the link
+    negotiated is printed above the table.
+
+    Usage: delay_bench [--poll US]
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/include/config.h"
+#include "../../atmega_duck/src/hid/keyboard.h"
+#include "../../atmega_duck/src/locale/locale.h"
+#include "../../atmega_duck/src/locale/usb_hid_keys.h"
+#include "../../atmega_duck/src/sdcard/sdcard.h"
+#include "../../atmega_duck/src/sdcard/script_runner.h"
+
+#include "../sim/sim.h"
+#include "../sim/nodes.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! Name the script is stored under on the SD card and in SPIFFS */
+    #define SD_FILE "DELAY.DS"
+    #define FLASH_FILE "/delay.ds"
+
+    /*! Virtual time both boards need to get through setup() */
+    #define SETTLE_US 3500000ULL
+
+    /*! Upper bound of loop() passes per SD run */
+    #define MAX_PASSES 10000000UL
+
+    /*! Upper bound of virtual time per link run */
+    #define LIMIT_US 60000000ULL
+
+    static const unsigned long delays[] = { 0, 1, 5, 10, 20, 50, 100, 500, 1000, 5000 };
+
+    #define NUM_DELAYS (sizeof(bench::delays) / sizeof(bench::delays[0]))
+
+    uint8_t buffer[BUFFER_SIZE];
+
+    std::string script(unsigned long ms) {
+        return "DEFAULT_DELAY 0\nSTRING a\nDELAY " + std::to_string(ms) + "\nSTRING b\n";
+    }
+
+    bool pressed(const host::hid_record& r, uint8_t key) {
+        return r.id == 2 && memchr(&r.data[2], key, 6) != NULL;
+    }
+
+    /**
+     * @brief Time from the release of a to the press of b, false if the trace has neither
+     */
+    bool gap(const std::vector<host::hid_record>& trace, uint64_t* gap_us) {
+        size_t i = 0;
+
+        while (i < trace.size() && !pressed(trace[i], KEY_A)) ++i;
+        while (i < trace.size() && (trace[i].id != 2 || pressed(trace[i], KEY_A))) ++i;
+
+        if (i == trace.size()) return false;
+
+        uint64_t released = trace[i].time_us;
+
+        while (i < trace.size() && !pressed(trace[i], KEY_B)) ++i;
+
+        if (i == trace.size()) return false;
+
+        *gap_us = trace[i].time_us - released;
+
+        return true;
+    }
+
+    typedef struct delay_result_t {
+        bool     ok;       // !< Both keys showed up in the trace
+        uint64_t gap_us;   // !< What the USB host saw
+        uint64_t stall_us; // !< Longest single pass through loop()
+    } delay_result_t;
+
+    /**
+     * @brief Runs the script from the SD card, on the ATmega's clock (see sd_step())
+     */
+    delay_result_t run_sd(unsigned long ms) {
+        delay_result_t res = { false, 0, 0 };
+
+        host::sd_insert(true);
+        sdcard::begin();
+        host::sd_put(SD_FILE, script(ms));
+
+        host::hid_clear();
+
+        keyboard::setLocale(locale::get_default());
+
+        if (!script_runner::start(SD_FILE, buffer)) return res;
+
+        sim::config_t  cfg    = sim::default_config();
+        unsigned long  passes = 0;
+        bool           more   = true;
+
+        while (more && passes < MAX_PASSES) {
+            uint64_t start = host::now_us();
+
+            more = script_runner::execute_next_line();
+
+            if (host::now_us() - start > res.stall_us) res.stall_us = host::now_us() - start;
+
+            host::advance_us(cfg.atmega_loop_us);
+            ++passes;
+        }
+
+        script_runner::stop();
+
+        res.ok = gap(host::hid_trace(), &res.gap_us);
+
+        return res;
+    }
+
+    unsigned long  sd_ms;
+    delay_result_t sd_res;
+
+    /**
+     * @brief run_sd() for sim::on_atmega()
+     *
+     * The HID endpoint model of the shim keeps its own timestamps, so
+     * everything that sends reports has to run on the same clock.
+     */
+    void sd_step() {
+        sd_res = run_sd(sd_ms);
+    }
+
+    void start_link() {
+        esp_node::run(FLASH_FILE);
+    }
+
+    delay_result_t run_link(unsigned long ms) {
+        delay_result_t res = { false, 0, 0 };
+
+        host::flash_put(FLASH_FILE, script(ms));
+        host::hid_clear();
+        esp_node::clear();
+        sim::reset_longest_loop();
+
+        uint64_t t0 = sim::esp_us();
+
+        sim::on_esp(start_link);
+
+        while (esp_node::running() && sim::esp_us() - t0 < LIMIT_US) sim::step();
+        while (sim::atmega_us() < sim::esp_us()) sim::step();
+
+        res.ok       = gap(host::hid_trace(), &res.gap_us);
+        res.stall_us = sim::longest_atmega_loop_us();
+
+        return res;
+    }
+
+    void print_result(const delay_result_t& r, unsigned long ms) {
+        if (!r.ok) {
+            printf(" %10s %10s %10s", "-", "-", "-");
+            return;
+        }
+
+        printf(" %10.2f %+10.2f %10.2f", r.gap_us / 1e3, r.gap_us / 1e3 - (double)ms, r.stall_us / 1e3);
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t poll_us = 1;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--poll") == 0) && (i + 1 < argc)) poll_us = atol(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--poll US]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // By default the USB host reads every report at once, only the delay is measured
+    host::hid_poll_us(poll_us);
+
+    sim::begin(sim::default_config());
+
+    while (sim::now_us() < SETTLE_US) sim::step();
+
+    printf("link at %lu baud\n", Serial.baud());
+    printf("%-8s %10s %10s %10s %10s %10s %10s\n",
+           "delay", "sd ms", "sd error", "sd stall", "link ms", "link error", "link stall");
+
+    for (size_t i = 0; i < NUM_DELAYS; ++i) {
+        unsigned long ms = bench::delays[i];
+
+        printf("%-8lu", ms);
+        bench::sd_ms = ms;
+        sim::on_atmega(bench::sd_step);
+
+        bench::print_result(bench::sd_res, ms);
+        bench::print_result(bench::run_link(ms), ms);
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*!
+    \file host/bench/i2c_sim.cpp
+    \brief End-to-end benchmark of the ESP8266 -> ATmega32u4 I2C link
+    \copyright MIT License
+
+    link_sim's scripts over I2C instead of the serial line: both sketches
+    are built with ENABLE_I2C (see the Makefile) and the ESP's Wire is the
+    master of the bus in host/shim/i2c_host.cpp, the ATmega's the slave.
+    The ESP sends every line in writes of up to PACKET_SIZE bytes and polls
+    the ATmega for its status, see i2c_update() in esp_duck/com.cpp.
+
+    Reported per script:
+      - lat avg/p95  time from the callback that sent a line to the status
+                     that acknowledged it
+      - bus %        how busy the bus was
+      - writes       transactions that carried lines
+      - polls        status reads, and read B the bytes they took
+      - nacks        writes the ATmega took only part of
+      - cb           done, ready, repeat and loop callbacks com fired
+      - clock        rate of the bus, I2C_CLOCK_SPEED unless --clock is given
+
+    --overhead is the time every transaction takes on top of its bits, the
+    ESP8266 runs the bus in software. The keystrokes are the same as over
+    the serial line, compare the --trace of link_sim.
+
+    Usage: i2c_sim [--clock HZ] [--overhead US] [--limit S] [--trace FILE]
+                   [--synthetic] [script ...]
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+
+#include "../sim/sim.h"
+#include "../sim/nodes.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! Path the payload is stored under in SPIFFS */
+    #define SIM_FILE "/sim.ds"
+
+    /*! Virtual time both boards need to get through setup() */
+    #define SETTLE_US 3500000ULL
+
+    typedef struct i2c_result_t {
+        size_t   lines;      // !< Packets duckscript sent
+        uint64_t virt_us;    // !< Virtual time from run() to the last acknowledgement
+        size_t   keystrokes; // !< Characters the USB host received
+        double   lat_avg_us;
+        double   lat_p95_us;
+        double   bus_util;   // !< Share of the time the bus was busy
+        host::i2c_stats bus; // !< Transactions and bytes on the bus
+        uint64_t callbacks;  // !< Callbacks com fired on the ESP
+        bool     stalled;    // !< Limit hit before the script finished
+    } i2c_result_t;
+
+    double percentile(std::vector<double> v, double p) {
+        if (v.empty()) return 0;
+
+        std::sort(v.begin(), v.end());
+        return v[(size_t)(p * (v.size() - 1) + 0.5)];
+    }
+
+    double average(const std::vector<double>& v) {
+        double sum = 0;
+
+        for (double d : v) sum += d;
+        return v.empty() ? 0 : sum / v.size();
+    }
+
+    void start() {
+        esp_node::run(SIM_FILE);
+    }
+
+    i2c_result_t run(const std::string& script, uint64_t limit_us) {
+        i2c_result_t res;
+
+        host::flash_put(SIM_FILE, script);
+        host::hid_clear();
+        host::i2c_reset_stats();
+        esp_node::clear();
+        atmega_node::clear();
+
+        uint64_t t0 = sim::esp_us();
+
+        sim::on_esp(start);
+
+        while (esp_node::running() && sim::esp_us() - t0 < limit_us) sim::step();
+
+        res.stalled = esp_node::running();
+
+        // Let the ATmega catch up so the trace holds the last keystrokes
+        while (sim::atmega_us() < sim::esp_us()) sim::step();
+
+        std::vector<double> lat;
+        uint64_t end = t0;
+
+        for (const esp_node::line_record& r : esp_node::lines()) {
+            if (!r.done_us) continue;
+
+            lat.push_back(r.done_us - r.start_us);
+            if (r.done_us > end) end = r.done_us;
+        }
+
+        if (res.stalled) end = sim::esp_us();
+
+        res.lines      = esp_node::lines().size();
+        res.virt_us    = end - t0;
+        res.keystrokes = count_keystrokes(host::hid_trace());
+        res.lat_avg_us = average(lat);
+        res.lat_p95_us = percentile(lat, 0.95);
+        res.bus        = host::i2c_get_stats();
+        res.bus_util   = res.virt_us ? (double)res.bus.busy_us / res.virt_us : 0;
+        res.callbacks  = esp_node::callbacks();
+
+        return res;
+    }
+
+    void print_header() {
+        printf("%-16s %6s %10s %8s %8s %8s %8s %7s %7s %7s %8s %6s %6s %7s\n",
+               "payload", "lines", "virt ms", "lines/s", "chars/s", "lat avg", "lat p95",
+               "bus %", "writes", "polls", "read B", "nacks", "cb", "clock");
+    }
+
+    void print_result(const char* name, const i2c_result_t& r) {
+        double virt_s = r.virt_us / 1e6;
+
+        printf("%-16s %6zu %10.1f %8.1f %8.1f %8.2f %8.2f %7.1f %7llu %7llu %8llu %6llu %6llu %7lu%s\n",
+               name, r.lines, r.virt_us / 1e3,
+               virt_s > 0 ? r.lines / virt_s : 0.0,
+               virt_s > 0 ? r.keystrokes / virt_s : 0.0,
+               r.lat_avg_us / 1e3, r.lat_p95_us / 1e3, r.bus_util * 100,
+               (unsigned long long)r.bus.writes, (unsigned long long)r.bus.reads,
+               (unsigned long long)r.bus.read, (unsigned long long)r.bus.nacked,
+               (unsigned long long)r.callbacks, host::i2c_clock(), r.stalled ? " STALLED" : "");
+    }
+}
+
+int main(int argc, char** argv) {
+    sim::config_t cfg      = sim::default_config();
+    double limit_s         = 600;
+    const char* trace_path = NULL;
+    bool synthetic         = false;
+
+    std::vector<const char*> scripts;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--clock") == 0) && (i + 1 < argc)) cfg.i2c.clock = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--overhead") == 0) && (i + 1 < argc)) cfg.i2c.overhead_us = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--limit") == 0) && (i + 1 < argc)) limit_s = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--trace") == 0) && (i + 1 < argc)) trace_path = argv[++i];
+        else if (strcmp(argv[i], "--synthetic") == 0) synthetic = true;
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--clock HZ] [--overhead US] [--limit S] [--trace FILE] [--synthetic] [script ...]\n", argv[0]);
+            return 2;
+        } else scripts.push_back(argv[i]);
+    }
+
+    if (scripts.empty()) synthetic = true;
+
+    uint64_t limit_us = (uint64_t)(limit_s * 1e6);
+
+    sim::begin(cfg);
+
+    while (sim::now_us() < SETTLE_US) sim::step();
+
+    FILE* trace = trace_path ? fopen(trace_path, "w") : NULL;
+
+    bench::print_header();
+
+    for (const char* path : scripts) {
+        std::string script;
+
+        if (!bench::load(path, &script)) {
+            fprintf(stderr, "can't read %s\n", path);
+            return 1;
+        }
+
+        bench::print_result(bench::basename(path), bench::run(script, limit_us));
+
+        if (trace) {
+            fprintf(trace, "# %s\n", path);
+            host::hid_dump(trace);
+        }
+    }
+
+    if (synthetic) {
+        for (const bench::payload_t& p : bench::synthetic) {
+            bench::print_result(p.name, bench::run(p.make(), limit_us));
+
+            if (trace) {
+                fprintf(trace, "# %s\n", p.name);
+                host::hid_dump(trace);
+            }
+        }
+    }
+
+    if (trace) fclose(trace);
+
+    return 0;
+}
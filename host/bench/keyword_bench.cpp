@@ -0,0 +1,152 @@
+/*!
+    \file host/bench/keyword_bench.cpp
+    \brief Lookup cost of every key name duckparser::press() knows
+    \copyright MIT License
+
+    Times keywords::find() against the compare() chain press() used before,
+    which is rebuilt here from the same names in the same order. The chain
+    gets slower the further down a name is, the table should cost the same
+    for all of them. Words that are no key name (UTF-8 characters, typos)
+    went through the whole chain and are listed as well.
+
+    Usage: keyword_bench [--reps N]
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/src/duckparser/keywords.h"
+
+extern "C" {
+ #include "../../atmega_duck/src/duckparser/parser.h" // compare
+}
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! Order of the former compare() chain in duckparser::press() */
+    const char* names[] = {
+        "ENTER", "MENU", "DELETE", "BACKSPACE", "HOME", "INSERT", "PAGEUP", "PAGEDOWN",
+        "UP", "DOWN", "LEFT", "RIGHT", "TAB", "END", "ESC",
+        "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "F10", "F11", "F12",
+        "SPACE", "PAUSE", "BREAK", "CAPSLOCK", "NUMLOCK", "PRINTSCREEN", "SCROLLLOCK",
+        "NUM_0", "NUM_1", "NUM_2", "NUM_3", "NUM_4", "NUM_5", "NUM_6", "NUM_7", "NUM_8", "NUM_9",
+        "NUM_ASTERIX", "NUM_ENTER", "NUM_MINUS", "NUM_DOT", "NUM_PLUS",
+        "CTRL", "CONTROL", "SHIFT", "ALT", "WINDOWS", "GUI",
+    };
+
+    /*! Words press() hands on to keyboard::press() */
+    const char* misses[] = { "\xC3\xA4", "\xE2\x82\xAC", "enter", "F13", "NUM_" };
+
+    #define NUM_NAMES (sizeof(bench::names) / sizeof(bench::names[0]))
+    #define NUM_MISSES (sizeof(bench::misses) / sizeof(bench::misses[0]))
+
+    /*! Lookups per timing */
+    #define LOOKUPS 200000
+
+    volatile uint8_t sink;
+
+    uint8_t chain(const char* str, size_t len) {
+        for (size_t i = 0; i < NUM_NAMES; ++i) {
+            if (compare(str, len, names[i], COMPARE_CASE_SENSETIVE)) return i + 1;
+        }
+        return 0;
+    }
+
+    uint8_t table(const char* str, size_t len) {
+        uint8_t code = 0;
+
+        return keywords::find(str, len, &code) + code;
+    }
+
+    /**
+     * @brief Fastest of reps timings of one word, in nanoseconds per lookup
+     */
+    double measure(uint8_t (* lookup)(const char*, size_t), const char* word, unsigned reps) {
+        size_t len  = strlen(word);
+        double best = 0;
+
+        for (unsigned r = 0; r < reps; ++r) {
+            double t = cpu_now_us();
+
+            for (unsigned i = 0; i < LOOKUPS; ++i) sink = lookup(word, len);
+
+            t = (cpu_now_us() - t) * 1e3 / LOOKUPS;
+
+            if ((r == 0) || (t < best)) best = t;
+        }
+
+        return best;
+    }
+
+    typedef struct spread_t {
+        double min;
+        double max;
+        double sum;
+        size_t n;
+    } spread_t;
+
+    void add(spread_t* s, double ns) {
+        if (!s->n || (ns < s->min)) s->min = ns;
+        if (!s->n || (ns > s->max)) s->max = ns;
+
+        s->sum += ns;
+        ++s->n;
+    }
+
+    void print_spread(const char* name, const spread_t& s) {
+        printf("%-14s %8.1f %8.1f %8.1f %8.2f\n", name, s.min, s.sum / s.n, s.max, s.max / s.min);
+    }
+
+    bool run(const char* word, bool hit, unsigned reps, spread_t* c, spread_t* t) {
+        size_t  len = strlen(word);
+        uint8_t code;
+
+        bool found = keywords::find(word, len, &code) != KEYWORD_NONE;
+
+        if ((found != hit) || ((chain(word, len) != 0) != hit)) {
+            fprintf(stderr, "%s: table and chain disagree\n", word);
+            return false;
+        }
+
+        double chain_ns = measure(chain, word, reps);
+        double table_ns = measure(table, word, reps);
+
+        add(c, chain_ns);
+        add(t, table_ns);
+
+        printf("%-14s %5s %10.1f %10.1f\n", word, hit ? "" : "miss", chain_ns, table_ns);
+
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned reps = 5;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--reps") == 0) && (i + 1 < argc)) reps = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--reps N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    bench::spread_t chain = { 0, 0, 0, 0 };
+    bench::spread_t table = { 0, 0, 0, 0 };
+
+    printf("%-14s %5s %10s %10s\n", "word", "", "chain ns", "table ns");
+
+    for (size_t i = 0; i < NUM_NAMES; ++i) {
+        if (!bench::run(bench::names[i], true, reps, &chain, &table)) return 1;
+    }
+
+    for (size_t i = 0; i < NUM_MISSES; ++i) {
+        if (!bench::run(bench::misses[i], false, reps, &chain, &table)) return 1;
+    }
+
+    printf("\n%-14s %8s %8s %8s %8s\n", "lookup", "min ns", "avg ns", "max ns", "max/min");
+    bench::print_spread("chain", chain);
+    bench::print_spread("table", table);
+
+    return 0;
+}
@@ -0,0 +1,513 @@
+/*!
+    \file host/bench/link_sim.cpp
+    \brief End-to-end benchmark of the ESP8266 -> ATmega32u4 serial link
+    \copyright MIT License
+
+    Runs esp_duck's com and duckscript against atmega_duck's com, parser and
+    keyboard over a modeled UART (see host/sim/sim.h). Scripts are stored in
+    the ESP's SPIFFS and started through duckscript::run(), so every line goes
+    the real way: nextLine() -> com::send() -> wire -> com::update() ->
+    duckparser::parse() -> status -> wire -> done or ready callback ->
+    nextLine() or sendAhead(). Lines the ESP sends ahead wait on the ATmega
+    while the one before them executes.
+
+    Reported per script:
+      - lat avg/p95  time from the callback that sent a line to the status
+                     that acknowledged it
+      - wire avg     share of that spent getting the line onto the ATmega
+      - tx/rx util   how busy the ESP->ATmega and ATmega->ESP lines were
+      - gap avg/p95/max  idle time on the ESP->ATmega line between bursts
+      - idle avg/p95/sum line gaps: time the ATmega sat idle waiting for the
+                     next line, see host/sim/atmega_node.cpp
+      - stall        longest single ATmega loop(), com is not serviced
+                     while it runs
+      - lost         bytes dropped or overrun in either direction
+      - flips        bytes that arrived with a bit flipped, either direction
+      - retx         bytes the ESP sent on top of the lines: packets sent
+                     again and probes, see esp_duck/com.cpp
+      - status       bytes the ATmega sent, its statuses and nothing else
+                     while a script runs
+      - cb           done, ready, repeat and loop callbacks com fired
+      - wait %       share of the time the ESP had packets in flight,
+                     link_stats' wait_ms
+      - drops        packets the ATmega dropped damaged or broken off
+      - uart/rx peak most bytes waiting in the ATmega's UART receive buffer
+                     and held in com's rx_buf, see atmega_duck/src/com/com.cpp
+      - ovr          packets the ATmega dropped because rx_buf was full
+      - baud         rate the two boards ended up at
+
+    After the scripts a file of --upload KB (64 by default, 0 skips it) is
+    written to the ATmega's SD card the way the web UI does it, one chunk
+    per SD_ACK (see host/sim/esp_node.cpp). Reported are the time from
+    sd_stream_write_begin to the SD_ACK of the last chunk, the throughput
+    and whether the file on the card matches. Writing to the card itself
+    takes no time on the host.
+
+    Then a text file of --cat KB (64 by default, 0 skips it) is read back
+    like sd_cat does, once waiting for every chunk to be acknowledged and
+    once with SD_READ_WINDOW chunks in flight. Reported are the time from
+    the request to SD_END, the throughput and whether the text matches.
+
+    Last --ls N payloads (200 by default, 0 skips them) are put on the card
+    and the root directory is listed like sd_ls does. Reported are the time
+    from the request to SD_END, the files per second and whether every
+    payload was listed once with its size.
+
+    --baud caps the rate the line carries, bytes sent faster arrive garbled
+    and the boards have to settle for a slower rate. --drop and --flip lose
+    bytes or flip a bit in them, at the given rate per byte. The keystrokes
+    must not change, compare the --trace of a run without them.
+
+    Usage: link_sim [--baud N] [--latency US] [--jitter US] [--drop P] [--flip P]
+                    [--seed N] [--limit S] [--trace FILE] [--upload KB] [--cat KB]
+                    [--ls N] [--synthetic] [script ...]
+ */
+
+#include "bench.h"
+
+#include <algorithm>
+
+#include "../../atmega_duck/src/com/com.h"
+
+#include "../sim/sim.h"
+#include "../sim/nodes.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! Path the payload is stored under in SPIFFS */
+    #define SIM_FILE "/sim.ds"
+
+    /*! Name the upload is written to on the SD card */
+    #define UPLOAD_FILE "UPLOAD.BIN"
+
+    /*! Name of the file sd_cat reads */
+    #define CAT_FILE "CAT.TXT"
+
+    /*! Names of the payloads sd_ls lists, with their number */
+    #define LS_FILE "PAYLOAD_%04zu.DS"
+
+    /*! Virtual time both boards need to get through setup() */
+    #define SETTLE_US 3500000ULL
+
+    typedef struct link_result_t {
+        size_t   lines;      // !< Packets duckscript sent
+        uint64_t virt_us;    // !< Virtual time from run() to the last acknowledgement
+        size_t   keystrokes; // !< Characters the USB host received
+        double   lat_avg_us;
+        double   lat_p95_us;
+        double   wire_avg_us;
+        double   tx_util;    // !< ESP -> ATmega busy share
+        double   rx_util;    // !< ATmega -> ESP busy share
+        double   gap_avg_us;
+        double   gap_p95_us;
+        double   gap_max_us;
+        double   idle_avg_us;
+        double   idle_p95_us;
+        double   idle_sum_us;
+        uint64_t stall_us;   // !< Longest ATmega loop()
+        uint64_t lost;       // !< Bytes dropped or overrun in either direction
+        uint64_t flips;      // !< Bytes with a flipped bit in either direction
+        uint64_t retx;       // !< Bytes the ESP sent that aren't part of a line
+        uint64_t status;     // !< Bytes the ATmega sent
+        uint64_t callbacks;  // !< Callbacks com fired on the ESP
+        double   wait;       // !< Share of the time packets were in flight
+        rx_stats_t rx_stats; // !< Fill levels and overruns of the ATmega's receive path
+        unsigned long baud;  // !< Rate of the ESP's port
+        bool     stalled;    // !< Limit hit before the script finished
+    } link_result_t;
+
+    double percentile(std::vector<double> v, double p) {
+        if (v.empty()) return 0;
+
+        std::sort(v.begin(), v.end());
+        return v[(size_t)(p * (v.size() - 1) + 0.5)];
+    }
+
+    double average(const std::vector<double>& v) {
+        double sum = 0;
+
+        for (double d : v) sum += d;
+        return v.empty() ? 0 : sum / v.size();
+    }
+
+    void start() {
+        esp_node::run(SIM_FILE);
+    }
+
+    link_result_t run(const std::string& script, uint64_t limit_us) {
+        link_result_t res;
+
+        host::flash_put(SIM_FILE, script);
+        host::hid_clear();
+        host::uart_reset_stats();
+        esp_node::clear();
+        atmega_node::clear();
+        com::resetStats();
+        sim::reset_longest_loop();
+
+        uint64_t t0 = sim::esp_us();
+
+        sim::on_esp(start);
+
+        while (esp_node::running() && sim::esp_us() - t0 < limit_us) sim::step();
+
+        res.stalled = esp_node::running();
+
+        // Let the ATmega catch up so the trace holds the last keystrokes
+        while (sim::atmega_us() < sim::esp_us()) sim::step();
+
+        const std::vector<esp_node::line_record>& lines = esp_node::lines();
+
+        std::vector<double> lat;
+        std::vector<double> wire;
+        uint64_t end = t0;
+        uint64_t sent = 0;
+
+        for (const esp_node::line_record& r : lines) {
+            if (r.done_us) {
+                lat.push_back(r.done_us - r.start_us);
+                if (r.done_us > end) end = r.done_us;
+            }
+            wire.push_back(r.delivered_us - r.start_us);
+            sent += r.bytes;
+        }
+
+        if (res.stalled) end = sim::esp_us();
+
+        const host::uart_stats& tx = host::uart_tx_stats(Serial);
+        const host::uart_stats& rx = host::uart_tx_stats(Serial1);
+
+        std::vector<double> gaps(tx.gaps_us.begin(), tx.gaps_us.end());
+        std::vector<double> idle(atmega_node::gaps().begin(), atmega_node::gaps().end());
+
+        res.lines       = lines.size();
+        res.virt_us     = end - t0;
+        res.keystrokes  = count_keystrokes(host::hid_trace());
+        res.lat_avg_us  = average(lat);
+        res.lat_p95_us  = percentile(lat, 0.95);
+        res.wire_avg_us = average(wire);
+        res.tx_util     = res.virt_us ? (double)tx.busy_us / res.virt_us : 0;
+        res.rx_util     = res.virt_us ? (double)rx.busy_us / res.virt_us : 0;
+        res.gap_avg_us  = average(gaps);
+        res.gap_p95_us  = percentile(gaps, 0.95);
+        res.gap_max_us  = gaps.empty() ? 0 : *std::max_element(gaps.begin(), gaps.end());
+        res.idle_avg_us = average(idle);
+        res.idle_p95_us = percentile(idle, 0.95);
+        res.idle_sum_us = average(idle) * idle.size();
+        res.stall_us    = sim::longest_atmega_loop_us();
+        res.lost        = tx.dropped + tx.overruns + rx.dropped + rx.overruns;
+        res.flips       = tx.flipped + rx.flipped;
+        res.retx        = tx.bytes - sent;
+        res.status      = rx.bytes;
+        res.callbacks   = esp_node::callbacks();
+        res.wait        = res.virt_us ? esp_node::wait_ms() * 1e3 / res.virt_us : 0;
+        res.rx_stats    = com::getStats();
+        res.baud        = Serial.baud();
+
+        return res;
+    }
+
+    typedef struct upload_result_t {
+        size_t   bytes;
+        uint64_t virt_us;  // !< From sd_stream_write_begin to the last SD_ACK
+        uint64_t lost;     // !< Bytes dropped or overrun in either direction
+        bool     ok;       // !< The card holds exactly what was sent
+        bool     stalled;  // !< Limit hit before the last chunk was acknowledged
+    } upload_result_t;
+
+    std::string upload_data;
+
+    void start_upload() {
+        esp_node::upload(UPLOAD_FILE, upload_data);
+    }
+
+    /**
+     * @brief Writes bytes of every value to the SD card, see esp_node::upload()
+     */
+    upload_result_t run_upload(size_t bytes, uint64_t limit_us) {
+        upload_result_t res;
+        std::string     written;
+        uint32_t        x = 1;
+
+        upload_data.resize(bytes);
+
+        for (size_t i = 0; i < bytes; ++i) {
+            x              = x * 1103515245 + 12345;
+            upload_data[i] = (char)(x >> 16);
+        }
+
+        host::sd_put(UPLOAD_FILE, "");
+        host::uart_reset_stats();
+
+        uint64_t t0 = sim::esp_us();
+
+        sim::on_esp(start_upload);
+
+        while (esp_node::uploading() && sim::esp_us() - t0 < limit_us) sim::step();
+
+        const host::uart_stats& tx = host::uart_tx_stats(Serial);
+        const host::uart_stats& rx = host::uart_tx_stats(Serial1);
+
+        res.bytes   = bytes;
+        res.virt_us = sim::esp_us() - t0;
+        res.stalled = esp_node::uploading();
+        res.lost    = tx.dropped + tx.overruns + rx.dropped + rx.overruns;
+
+        // The sd_stop that closes the file
+        uint64_t end = sim::esp_us() + 10000;
+
+        while (sim::now_us() < end) sim::step();
+
+        res.ok = host::sd_get(UPLOAD_FILE, &written) && (written == upload_data);
+
+        return res;
+    }
+
+    void print_upload(const upload_result_t& r) {
+        double virt_s = r.virt_us / 1e6;
+
+        printf("upload %zu B to the SD card: %.1f ms, %.0f B/s, lost %llu, %s%s\n",
+               r.bytes, r.virt_us / 1e3, virt_s > 0 ? r.bytes / virt_s : 0.0,
+               (unsigned long long)r.lost, r.ok ? "ok" : "CORRUPT", r.stalled ? " STALLED" : "");
+    }
+
+    typedef struct cat_result_t {
+        size_t   bytes;
+        uint8_t  window;   // !< Chunks the ATmega sent ahead
+        uint64_t virt_us;  // !< From the request to SD_END
+        uint64_t lost;     // !< Bytes dropped or overrun in either direction
+        bool     ok;       // !< SD_END:OK and the text printed is the file
+        bool     stalled;  // !< Limit hit before SD_END
+    } cat_result_t;
+
+    uint8_t cat_window;
+
+    void start_cat() {
+        cat_window = esp_node::cat(CAT_FILE, cat_window);
+    }
+
+    /**
+     * @brief Reads a text file of bytes back like sd_cat, see esp_node::cat()
+     *
+     * @param window Chunks in flight, 0 for SD_READ_WINDOW
+     */
+    cat_result_t run_cat(size_t bytes, uint8_t window, uint64_t limit_us) {
+        cat_result_t res;
+        std::string  text;
+        std::string  printed;
+
+        while (text.size() < bytes) text += "STRING The quick brown fox jumps over the lazy dog " + std::to_string(text.size()) + "\n";
+
+        text.resize(bytes);
+
+        host::sd_put(CAT_FILE, text);
+        host::uart_reset_stats();
+
+        uint64_t t0 = sim::esp_us();
+
+        cat_window = window;
+        sim::on_esp(start_cat);
+
+        while (esp_node::catting() && sim::esp_us() - t0 < limit_us) sim::step();
+
+        const host::uart_stats& tx = host::uart_tx_stats(Serial);
+        const host::uart_stats& rx = host::uart_tx_stats(Serial1);
+
+        res.bytes   = bytes;
+        res.window  = cat_window;
+        res.virt_us = sim::esp_us() - t0;
+        res.stalled = esp_node::catting();
+        res.lost    = tx.dropped + tx.overruns + rx.dropped + rx.overruns;
+        res.ok      = esp_node::cat_result(&printed) && (printed == text);
+
+        return res;
+    }
+
+    void print_cat(const cat_result_t& r) {
+        double virt_s = r.virt_us / 1e6;
+
+        printf("sd_cat %zu B, window %u: %.1f ms, %.0f B/s, lost %llu, %s%s\n",
+               r.bytes, r.window, r.virt_us / 1e3, virt_s > 0 ? r.bytes / virt_s : 0.0,
+               (unsigned long long)r.lost, r.ok ? "ok" : "CORRUPT", r.stalled ? " STALLED" : "");
+    }
+
+    typedef struct ls_result_t {
+        size_t   files;    // !< Payloads put on the card
+        size_t   listed;   // !< Lines printed, other files on the card included
+        uint64_t virt_us;  // !< From the request to SD_END
+        uint64_t lost;     // !< Bytes dropped or overrun in either direction
+        bool     ok;       // !< SD_END:OK and every payload listed once with its size
+        bool     stalled;  // !< Limit hit before SD_END
+    } ls_result_t;
+
+    void start_ls() {
+        esp_node::ls();
+    }
+
+    /**
+     * @brief Puts files payloads on the card and lists them like sd_ls, see esp_node::ls()
+     */
+    ls_result_t run_ls(size_t files, uint64_t limit_us) {
+        ls_result_t res;
+        std::string printed;
+        std::vector<std::string> expected;
+
+        for (size_t i = 0; i < files; ++i) {
+            char name[MAX_NAME + 1];
+
+            snprintf(name, sizeof(name), LS_FILE, i);
+            host::sd_put(name, std::string(i * 37 % 4096, 'a'));
+            expected.push_back(std::string(name) + "," + std::to_string(i * 37 % 4096));
+        }
+
+        host::uart_reset_stats();
+
+        uint64_t t0 = sim::esp_us();
+
+        sim::on_esp(start_ls);
+
+        while (esp_node::catting() && sim::esp_us() - t0 < limit_us) sim::step();
+
+        const host::uart_stats& tx = host::uart_tx_stats(Serial);
+        const host::uart_stats& rx = host::uart_tx_stats(Serial1);
+
+        res.files   = files;
+        res.virt_us = sim::esp_us() - t0;
+        res.stalled = esp_node::catting();
+        res.lost    = tx.dropped + tx.overruns + rx.dropped + rx.overruns;
+        res.ok      = esp_node::cat_result(&printed);
+        res.listed  = std::count(printed.begin(), printed.end(), '\n');
+
+        std::vector<std::string> lines;
+        size_t start = 0;
+
+        for (size_t end; (end = printed.find('\n', start)) != std::string::npos; start = end + 1) {
+            lines.push_back(printed.substr(start, end - start));
+        }
+
+        std::sort(lines.begin(), lines.end());
+
+        for (const std::string& e : expected) {
+            auto range = std::equal_range(lines.begin(), lines.end(), e);
+
+            if (range.second - range.first != 1) res.ok = false;
+        }
+
+        return res;
+    }
+
+    void print_ls(const ls_result_t& r) {
+        double virt_s = r.virt_us / 1e6;
+
+        printf("sd_ls %zu files (%zu listed): %.1f ms, %.0f files/s, lost %llu, %s%s\n",
+               r.files, r.listed, r.virt_us / 1e3, virt_s > 0 ? r.listed / virt_s : 0.0,
+               (unsigned long long)r.lost, r.ok ? "ok" : "CORRUPT", r.stalled ? " STALLED" : "");
+    }
+
+    void print_header() {
+        printf("%-16s %6s %10s %8s %8s %8s %8s %9s %7s %7s %8s %8s %8s %8s %8s %8s %8s %6s %6s %6s %7s %6s %6s %6s %5s %7s %4s %7s\n",
+               "payload", "lines", "virt ms", "lines/s", "chars/s", "lat avg", "lat p95", "wire avg",
+               "tx %", "rx %", "gap avg", "gap p95", "gap max", "idle avg", "idle p95", "idle sum",
+               "stall", "lost", "flips", "retx", "status", "cb", "wait %", "drops", "uart", "rx peak", "ovr", "baud");
+    }
+
+    void print_result(const char* name, const link_result_t& r) {
+        double virt_s = r.virt_us / 1e6;
+
+        printf("%-16s %6zu %10.1f %8.1f %8.1f %8.2f %8.2f %9.2f %7.1f %7.1f %8.2f %8.2f %8.2f %8.3f %8.3f %8.1f %8.2f %6llu %6llu %6llu %7llu %6llu %6.1f %6lu %5u %7u %4lu %7lu%s\n",
+               name, r.lines, r.virt_us / 1e3,
+               virt_s > 0 ? r.lines / virt_s : 0.0,
+               virt_s > 0 ? r.keystrokes / virt_s : 0.0,
+               r.lat_avg_us / 1e3, r.lat_p95_us / 1e3, r.wire_avg_us / 1e3,
+               r.tx_util * 100, r.rx_util * 100,
+               r.gap_avg_us / 1e3, r.gap_p95_us / 1e3, r.gap_max_us / 1e3,
+               r.idle_avg_us / 1e3, r.idle_p95_us / 1e3, r.idle_sum_us / 1e3, r.stall_us / 1e3,
+               (unsigned long long)r.lost, (unsigned long long)r.flips, (unsigned long long)r.retx,
+               (unsigned long long)r.status, (unsigned long long)r.callbacks, r.wait * 100, r.rx_stats.dropped, r.rx_stats.uart_peak, r.rx_stats.peak, r.rx_stats.overruns, r.baud, r.stalled ? " STALLED" : "");
+    }
+}
+
+int main(int argc, char** argv) {
+    sim::config_t cfg      = sim::default_config();
+    double limit_s         = 600;
+    const char* trace_path = NULL;
+    bool synthetic         = false;
+    size_t upload_kb       = 64;
+    size_t cat_kb          = 64;
+    size_t ls_files        = 200;
+
+    std::vector<const char*> scripts;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--baud") == 0) && (i + 1 < argc)) cfg.uart.max_baud = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--latency") == 0) && (i + 1 < argc)) cfg.uart.latency_us = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--jitter") == 0) && (i + 1 < argc)) cfg.uart.jitter_us = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--drop") == 0) && (i + 1 < argc)) cfg.uart.drop_rate = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--flip") == 0) && (i + 1 < argc)) cfg.uart.flip_rate = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--seed") == 0) && (i + 1 < argc)) cfg.uart.seed = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--limit") == 0) && (i + 1 < argc)) limit_s = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--trace") == 0) && (i + 1 < argc)) trace_path = argv[++i];
+        else if ((strcmp(argv[i], "--upload") == 0) && (i + 1 < argc)) upload_kb = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--cat") == 0) && (i + 1 < argc)) cat_kb = atol(argv[++i]);
+        else if ((strcmp(argv[i], "--ls") == 0) && (i + 1 < argc)) ls_files = atol(argv[++i]);
+        else if (strcmp(argv[i], "--synthetic") == 0) synthetic = true;
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--baud N] [--latency US] [--jitter US] [--drop P] [--flip P] [--seed N]"
+                            " [--limit S] [--trace FILE] [--upload KB] [--cat KB] [--ls N] [--synthetic] [script ...]\n", argv[0]);
+            return 2;
+        } else scripts.push_back(argv[i]);
+    }
+
+    if (scripts.empty()) synthetic = true;
+
+    uint64_t limit_us = (uint64_t)(limit_s * 1e6);
+
+    sim::begin(cfg);
+
+    while (sim::now_us() < SETTLE_US) sim::step();
+
+    FILE* trace = trace_path ? fopen(trace_path, "w") : NULL;
+
+    bench::print_header();
+
+    for (const char* path : scripts) {
+        std::string script;
+
+        if (!bench::load(path, &script)) {
+            fprintf(stderr, "can't read %s\n", path);
+            return 1;
+        }
+
+        bench::print_result(bench::basename(path), bench::run(script, limit_us));
+
+        if (trace) {
+            fprintf(trace, "# %s\n", path);
+            host::hid_dump(trace);
+        }
+    }
+
+    if (synthetic) {
+        for (const bench::payload_t& p : bench::synthetic) {
+            bench::print_result(p.name, bench::run(p.make(), limit_us));
+
+            if (trace) {
+                fprintf(trace, "# %s\n", p.name);
+                host::hid_dump(trace);
+            }
+        }
+    }
+
+    if (trace) fclose(trace);
+
+    if (upload_kb > 0) bench::print_upload(bench::run_upload(upload_kb * 1024, limit_us));
+
+    if (cat_kb > 0) {
+        bench::print_cat(bench::run_cat(cat_kb * 1024, 1, limit_us));
+        bench::print_cat(bench::run_cat(cat_kb * 1024, 0, limit_us));
+    }
+
+    if (ls_files > 0) bench::print_ls(bench::run_ls(ls_files, limit_us));
+
+    return 0;
+}
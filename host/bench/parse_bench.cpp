@@ -0,0 +1,263 @@
+/*!
+    \file host/bench/parse_bench.cpp
+    \brief Line throughput of duckparser::parse() alone, and of the same lines as bytecode
+    \copyright MIT License
+
+    Hands every line of a script to duckparser::parse() the way
+    atmega_duck.ino does with a received packet, without the SD card,
+    script_runner or the serial link around it. REPEAT and LOOP only set
+    their counters, nothing is executed twice. What is left is line
+    splitting, command dispatch and the keyboard, so changes to the parser
+    show up here long before they are visible in typing_bench.
+
+    The same packets then go through esp_duck's compiler the way duckscript
+    sends them and are run with duckparser::exec(), the lines the compiler
+    leaves as text still with parse(). The compiler only turns STRING text
+    into keys once the script has set its layout, so the ASCII payloads run
+    once more behind a LOCALE US line.
+
+    Reported per payload, host CPU time is the fastest of all rounds:
+      - lines/s, ns/line  parse() of the text packets
+      - text B, code B    bytes of all packets as text and with the lines
+                          compiled, what goes over the link besides framing
+      - compiled          share of the packets that are bytecode
+      - exec ns/line      the packets with the lines compiled
+
+    Usage: parse_bench [--reps N] [script ...]
+    The built-in payloads always run, scripts given as arguments first.
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/include/config.h"
+#include "../../atmega_duck/src/duckparser/duckparser.h"
+#include "../../atmega_duck/src/hid/keyboard.h"
+#include "../../atmega_duck/src/locale/locale.h"
+
+#include "../../esp_duck/compiler.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! Lines parsed per round */
+    #define ROUND_LINES 50000UL
+
+    /**
+     * @brief One line of every command the parser knows, and a few key combinations
+     */
+    std::string synthetic_commands() {
+        std::string s = "DEFAULT_DELAY 0\n";
+
+        for (int i = 0; i < 20; ++i) {
+            s += "REM every command once\n";
+            s += "LOCALE US\n";
+            s += "DELAY 1\n";
+            s += "STRING a\n";
+            s += "STRINGLN b\n";
+            s += "LSTRING_BEGIN\nc\nLSTRING_END\n";
+            s += "LED 0 0 0\n";
+            s += "M_MOVE 1 -1\n";
+            s += "M_CLICK 1\n";
+            s += "M_PRESS 1\n";
+            s += "M_RELEASE 1\n";
+            s += "M_SCROLL 1\n";
+            s += "KEYCODE 0 4\n";
+            s += "LOOP_BEGIN 1\n";
+            s += "CTRL ALT DELETE\n";
+            s += "LOOP_END\n";
+            s += "GUI r\n";
+            s += "ENTER\n";
+            s += "REPEAT 1\n";
+        }
+
+        return s;
+    }
+
+    /**
+     * @brief Splits a script into the packets the ESP would send
+     *
+     * One line per packet, longer lines are cut into BUFFER_SIZE - 1 byte
+     * pieces on a character boundary, like duckscript does.
+     */
+    std::vector<std::string> packets(const std::string& script) {
+        std::vector<std::string> res;
+
+        size_t i = 0;
+
+        while (i < script.size()) {
+            size_t end = script.find('\n', i);
+
+            end = (end == std::string::npos) ? script.size() : end + 1;
+
+            while (i < end) {
+                size_t n = end - i;
+
+                if (n > BUFFER_SIZE - 1) {
+                    n = BUFFER_SIZE - 1;
+
+                    while (n > 0 && ((uint8_t)script[i + n] & 0xC0) == 0x80) --n;
+                }
+
+                res.push_back(script.substr(i, n));
+                i += n;
+            }
+        }
+
+        return res;
+    }
+
+    /**
+     * @brief The packets with every line compiled, in the order duckscript sends them
+     *
+     * @param compiled Receives the number of packets that are bytecode
+     */
+    std::vector<std::string> compile(const std::vector<std::string>& p, size_t* compiled) {
+        std::vector<std::string> res;
+        uint8_t out[BUFFER_SIZE];
+
+        compiler::reset(0);
+        *compiled = 0;
+
+        for (const std::string& line : p) {
+            size_t len = compiler::compile(line.data(), line.size(), out);
+
+            if (len) {
+                res.push_back(std::string((const char*)out, len));
+                ++*compiled;
+            } else {
+                res.push_back(line);
+            }
+        }
+
+        return res;
+    }
+
+    size_t bytes(const std::vector<std::string>& p) {
+        size_t n = 0;
+
+        for (const std::string& line : p) n += line.size();
+        return n;
+    }
+
+    /**
+     * @brief Fastest time per packet, like atmega_duck.ino runs a received packet
+     */
+    double time(const std::vector<std::string>& p, unsigned int reps) {
+        double res = 0;
+
+        if (p.empty()) return res;
+
+        // parse() needs the line in a writable buffer, like com's
+        char buffer[BUFFER_SIZE + 1];
+
+        for (unsigned int r = 0; r < reps; ++r) {
+            size_t parsed = 0;
+
+            duckparser::reset();
+            keyboard::setLocale(locale::get_default());
+
+            double start = cpu_now_us();
+
+            while (parsed < ROUND_LINES) {
+                for (const std::string& line : p) {
+                    memcpy(buffer, line.data(), line.size());
+                    buffer[line.size()] = '\0';
+
+                    if (buffer[0] == CMD_BYTECODE) duckparser::exec((const uint8_t*)buffer + 1, line.size() - 1);
+                    else duckparser::parse(buffer, line.size());
+                }
+
+                parsed += p.size();
+
+                // Keep the trace from growing over the whole run
+                host::hid_clear();
+            }
+
+            double ns = (cpu_now_us() - start) * 1e3 / parsed;
+
+            if ((r == 0) || (ns < res)) res = ns;
+        }
+
+        return res;
+    }
+
+    typedef struct parse_result_t {
+        size_t lines;    // !< Packets per pass over the script
+        size_t text;     // !< Bytes of the text packets
+        size_t code;     // !< Bytes of the packets with the lines compiled
+        size_t compiled; // !< Packets that are bytecode
+        double ns_line;  // !< Host CPU time per parse() call
+        double ns_exec;  // !< Host CPU time per packet with the lines compiled
+    } parse_result_t;
+
+    parse_result_t run(const std::string& script, unsigned int reps) {
+        std::vector<std::string> p = packets(script);
+        parse_result_t res;
+
+        std::vector<std::string> c = compile(p, &res.compiled);
+
+        res.lines   = p.size();
+        res.text    = bytes(p);
+        res.code    = bytes(c);
+        res.ns_line = time(p, reps);
+        res.ns_exec = time(c, reps);
+
+        return res;
+    }
+
+    void print_header() {
+        printf("%-16s %8s %12s %10s %9s %9s %9s %10s\n",
+               "payload", "lines", "lines/s", "ns/line", "text B", "code B", "compiled", "exec ns");
+    }
+
+    void print_result(const char* name, const parse_result_t& r) {
+        printf("%-16s %8zu %12.0f %10.1f %9zu %9zu %8.1f%% %10.1f\n",
+               name, r.lines, r.ns_line > 0 ? 1e9 / r.ns_line : 0.0, r.ns_line,
+               r.text, r.code, r.lines ? 100.0 * r.compiled / r.lines : 0.0, r.ns_exec);
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned int reps = 5;
+
+    std::vector<const char*> scripts;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--reps") == 0) && (i + 1 < argc)) reps = atoi(argv[++i]);
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--reps N] [script ...]\n", argv[0]);
+            return 2;
+        } else scripts.push_back(argv[i]);
+    }
+
+    if (reps == 0) reps = 1;
+
+    keyboard::begin();
+
+    // The USB host reads every report at once, only the parser is timed here
+    host::hid_poll_us(1);
+
+    bench::print_header();
+
+    for (const char* path : scripts) {
+        std::string script;
+
+        if (!bench::load(path, &script)) {
+            fprintf(stderr, "can't read %s\n", path);
+            return 1;
+        }
+
+        bench::print_result(bench::basename(path), bench::run(script, reps));
+    }
+
+    bench::print_result("commands", bench::run(bench::synthetic_commands(), reps));
+
+    for (const bench::payload_t& p : bench::synthetic) {
+        bench::print_result(p.name, bench::run(p.make(), reps));
+    }
+
+    bench::print_result("string_ascii_us", bench::run("LOCALE US\n" + bench::synthetic_string(), reps));
+    bench::print_result("lstring_ascii_us", bench::run("LOCALE US\n" + bench::synthetic_lstring(), reps));
+
+    return 0;
+}
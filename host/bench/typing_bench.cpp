@@ -0,0 +1,187 @@
+/*!
+    \file host/bench/typing_bench.cpp
+    \brief Typing throughput benchmark for the ATmega parser, keyboard and locale modules
+    \copyright MIT License
+
+    Runs DuckyScript through the real script_runner -> duckparser -> keyboard
+    path against the host shim and reports:
+      - reports/s    HID reports per second of virtual (board) time
+      - chars/s      keystrokes per second of virtual time
+      - cpu us/line  host CPU time spent per parse() call
+      - lines/s      parse() calls per second of host CPU time
+      - wait us      average and longest time a report was held back by
+                     keyboard pacing (endpoint not read yet, TYPING_RATE)
+      - hits, misses LOOP_END and REPEAT jumps back that found their lines
+                     in script_runner's cache, and the ones that read the
+                     card again
+
+    --poll sets how often the virtual USB host reads the HID endpoint.
+
+    Usage: typing_bench [--reps N] [--poll US] [--trace FILE] [--synthetic] [script ...]
+    Without arguments the synthetic payloads are run.
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/include/config.h"
+#include "../../atmega_duck/src/hid/keyboard.h"
+#include "../../atmega_duck/src/locale/locale.h"
+#include "../../atmega_duck/src/sdcard/sdcard.h"
+#include "../../atmega_duck/src/sdcard/script_runner.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    /*! Name the payload is stored under on the in-memory SD card */
+    #define BENCH_FILE "BENCH.DS"
+
+    /*! Upper bound of parse() calls per run, stops runaway infinite loops */
+    #define MAX_STEPS 2000000UL
+
+    /*! Line buffer handed to script_runner, same size as com's data buffer */
+    uint8_t buffer[BUFFER_SIZE];
+
+    typedef struct result_t {
+        unsigned long steps;     // !< parse() calls (lines and line fragments)
+        size_t        reports;   // !< HID reports in the trace
+        size_t        keystrokes;// !< Reports that pressed a key which was not down before
+        uint64_t      virt_us;   // !< Virtual time the script took on the board
+        double        cpu_us;    // !< Host CPU time of the fastest repetition
+        keyboard::pacing_stats pacing; // !< Report waits of the last repetition
+        cache_stats_t cache;     // !< Jumps back of the last repetition
+    } result_t;
+
+    /**
+     * @brief Executes a script once, from a clean parser and trace
+     *
+     * The clock is never reset, the parser keeps absolute millis() deadlines
+     * across scripts just like on the board.
+     *
+     * @return Number of parse() calls
+     */
+    unsigned long run_once(const std::string& script) {
+        host::sd_insert(true);
+        sdcard::begin();
+        host::sd_put(BENCH_FILE, script);
+
+        host::hid_clear();
+
+        keyboard::resetStats();
+        script_runner::resetStats();
+        keyboard::setLocale(locale::get_default());
+
+        if (!script_runner::start(BENCH_FILE, buffer)) return 0;
+
+        unsigned long steps = run_script(MAX_STEPS);
+
+        script_runner::stop();
+
+        return steps;
+    }
+
+    /**
+     * @brief Executes a script reps times and keeps the fastest CPU time
+     */
+    result_t run(const std::string& script, unsigned int reps) {
+        result_t res;
+
+        res.cpu_us = 0;
+
+        for (unsigned int i = 0; i < reps; ++i) {
+            double start = cpu_now_us();
+
+            res.virt_us = host::now_us();
+            res.steps   = run_once(script);
+            res.virt_us = host::now_us() - res.virt_us;
+
+            double t = cpu_now_us() - start;
+
+            if ((i == 0) || (t < res.cpu_us)) res.cpu_us = t;
+        }
+
+        res.reports    = host::hid_trace().size();
+        res.keystrokes = count_keystrokes(host::hid_trace());
+        res.pacing     = keyboard::getStats();
+        res.cache      = script_runner::getStats();
+
+        return res;
+    }
+
+    void print_header() {
+        printf("%-16s %8s %8s %8s %10s %10s %9s %11s %10s %9s %9s %7s %7s\n",
+               "payload", "lines", "reports", "chars", "virt ms", "reports/s", "chars/s", "cpu us/line", "lines/s",
+               "wait us", "max wait", "hits", "misses");
+    }
+
+    void print_result(const char* name, const result_t& r) {
+        double virt_s = r.virt_us / 1e6;
+
+        printf("%-16s %8lu %8zu %8zu %10.1f %10.1f %9.1f %11.2f %10.0f %9.1f %9lu %7lu %7lu\n",
+               name, r.steps, r.reports, r.keystrokes, r.virt_us / 1e3,
+               virt_s > 0 ? r.reports / virt_s : 0.0,
+               virt_s > 0 ? r.keystrokes / virt_s : 0.0,
+               r.steps ? r.cpu_us / r.steps : 0.0,
+               r.cpu_us > 0 ? r.steps / (r.cpu_us / 1e6) : 0.0,
+               r.pacing.reports ? (double)r.pacing.wait_us / r.pacing.reports : 0.0,
+               (unsigned long)r.pacing.max_wait_us, r.cache.hits, r.cache.misses);
+    }
+}
+
+int main(int argc, char** argv) {
+    unsigned int reps       = 5;
+    const char*  trace_path = NULL;
+    bool synthetic          = false;
+
+    std::vector<const char*> scripts;
+
+    for (int i = 1; i < argc; ++i) {
+        if ((strcmp(argv[i], "--reps") == 0) && (i + 1 < argc)) reps = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--trace") == 0) && (i + 1 < argc)) trace_path = argv[++i];
+        else if ((strcmp(argv[i], "--poll") == 0) && (i + 1 < argc)) host::hid_poll_us(atoi(argv[++i]));
+        else if (strcmp(argv[i], "--synthetic") == 0) synthetic = true;
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--reps N] [--poll US] [--trace FILE] [--synthetic] [script ...]\n", argv[0]);
+            return 2;
+        } else scripts.push_back(argv[i]);
+    }
+
+    if (scripts.empty()) synthetic = true;
+    if (reps == 0) reps = 1;
+
+    keyboard::begin();
+
+    FILE* trace = trace_path ? fopen(trace_path, "w") : NULL;
+
+    bench::print_header();
+
+    for (const char* path : scripts) {
+        std::string script;
+
+        if (!bench::load(path, &script)) {
+            fprintf(stderr, "can't read %s\n", path);
+            return 1;
+        }
+
+        bench::print_result(bench::basename(path), bench::run(script, reps));
+
+        if (trace) {
+            fprintf(trace, "# %s\n", path);
+            host::hid_dump(trace);
+        }
+    }
+
+    if (synthetic) {
+        for (const bench::payload_t& p : bench::synthetic) {
+            bench::print_result(p.name, bench::run(p.make(), reps));
+
+            if (trace) {
+                fprintf(trace, "# %s\n", p.name);
+                host::hid_dump(trace);
+            }
+        }
+    }
+
+    if (trace) fclose(trace);
+
+    return 0;
+}
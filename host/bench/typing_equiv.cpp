@@ -0,0 +1,238 @@
+/*!
+    \file host/bench/typing_equiv.cpp
+    \brief Checks that the coalescing typing engine types what the plain one types
+    \copyright MIT License
+
+    Runs every script twice through script_runner -> duckparser -> keyboard,
+    once per engine (keyboard::setCoalescing), and replays both HID traces
+    on a model of the USB host: a key is typed when it shows up in a report
+    it was not in before, with the modifiers of that report. Mouse reports
+    are passed on unchanged, in order. The two event lists must match event
+    for event, and the last report of a trace must leave nothing pressed.
+
+    Reports and virtual time of both engines are printed next to each other.
+    Exits with 1 on the first difference.
+
+    Usage: typing_equiv [script ...]
+    The built-in payloads always run, scripts given as arguments first.
+ */
+
+#include "bench.h"
+
+#include "../../atmega_duck/include/config.h"
+#include "../../atmega_duck/src/hid/keyboard.h"
+#include "../../atmega_duck/src/locale/locale.h"
+#include "../../atmega_duck/src/sdcard/sdcard.h"
+#include "../../atmega_duck/src/sdcard/script_runner.h"
+
+namespace bench {
+    // ========== PRIVATE ========== //
+
+    #define EQUIV_FILE "EQUIV.DS"
+
+    /*! Upper bound of parse() calls per run, stops runaway infinite loops */
+    #define MAX_STEPS 2000000UL
+
+    uint8_t buffer[BUFFER_SIZE];
+
+    /**
+     * @brief Text that needs every rule of the coalescing engine
+     *
+     * Runs of the same key, case changes, modifiers that come and go,
+     * characters the US layout can't type and dead keys on the Spanish
+     * layout, including a dead key followed by the key it was typed with.
+     */
+    std::string synthetic_edges() {
+        std::string s = "DEFAULT_DELAY 0\n";
+
+        s += "STRING aaa AAA aAaA Aa bookkeeper MISSISSIPPI\n";
+        s += "STRING !1!1 @2 ## $$4 {[}] ~`~ \"'\" |\\|\n";
+        s += "STRINGLN x\n";
+        s += "STRING \xC3\xA4\xE2\x82\xAC \x01\x7F end\n";
+        s += "LSTRING_BEGIN\nMixed Case Line\n\n  two spaces\nLSTRING_END\n";
+        s += "CTRL ALT DELETE\n";
+        s += "STRING after a key combination\n";
+        s += "LOCALE ES\n";
+        s += "STRING \xC3\xA1\xC3\xA0\xC3\xA2\xC3\xA4 \xC3\x81\xC3\x80\xC3\x82\xC3\x84 ^^ ``a ~~ \xC3\xB1\xC3\x91\n";
+        s += "STRING \xC2\xBF\xC2\xA1 \xC3\xA7\xC3\x87 \xE2\x82\xAC\xE2\x82\xAC \xC2\xBA\xC2\xAA\n";
+        s += "LOCALE US\n";
+        s += "M_MOVE 5 5\nSTRING mouse\nM_CLICK 1\n";
+
+        return s;
+    }
+
+    typedef struct event_t {
+        uint8_t id;        // !< 2 for a typed key, else the report ID of a mouse report
+        uint8_t modifiers;
+        uint8_t key;
+        uint8_t data[8];
+    } event_t;
+
+    /**
+     * @brief What the USB host makes of a trace
+     *
+     * @param released Set to false if a key or modifier is still down at the end
+     */
+    std::vector<event_t> replay(const std::vector<host::hid_record>& trace, bool* released) {
+        std::vector<event_t> res;
+
+        uint8_t prev_keys[6] = { 0 };
+        uint8_t prev_mods    = 0;
+
+        for (const host::hid_record& r : trace) {
+            event_t e;
+
+            memset(&e, 0, sizeof(e));
+
+            if (r.id != 2) {
+                e.id = r.id;
+                memcpy(e.data, r.data, r.len);
+                res.push_back(e);
+                continue;
+            }
+
+            const uint8_t* keys = &r.data[2];
+
+            for (uint8_t i = 0; i < 6; ++i) {
+                if (keys[i] && !memchr(prev_keys, keys[i], 6)) {
+                    e.id        = 2;
+                    e.modifiers = r.data[0];
+                    e.key       = keys[i];
+                    res.push_back(e);
+                }
+            }
+
+            memcpy(prev_keys, keys, 6);
+            prev_mods = r.data[0];
+        }
+
+        static const uint8_t none[6] = { 0 };
+
+        *released = (prev_mods == 0) && (memcmp(prev_keys, none, 6) == 0);
+
+        return res;
+    }
+
+    typedef struct run_t {
+        std::vector<event_t> events;
+        bool                 released;
+        size_t               reports;
+        uint64_t             virt_us;
+    } run_t;
+
+    run_t run(const std::string& script, bool coalescing) {
+        run_t res;
+
+        host::sd_insert(true);
+        sdcard::begin();
+        host::sd_put(EQUIV_FILE, script);
+
+        host::hid_clear();
+
+        keyboard::setCoalescing(coalescing);
+        keyboard::setLocale(locale::get_default());
+
+        res.virt_us = host::now_us();
+
+        if (script_runner::start(EQUIV_FILE, buffer)) {
+            run_script(MAX_STEPS);
+            script_runner::stop();
+        }
+
+        res.virt_us = host::now_us() - res.virt_us;
+        res.reports = host::hid_trace().size();
+        res.events  = replay(host::hid_trace(), &res.released);
+
+        return res;
+    }
+
+    bool same(const event_t& a, const event_t& b) {
+        return a.id == b.id && a.modifiers == b.modifiers && a.key == b.key &&
+               memcmp(a.data, b.data, sizeof(a.data)) == 0;
+    }
+
+    void print_event(const char* engine, const std::vector<event_t>& events, size_t i) {
+        if (i >= events.size()) {
+            printf("  %-9s <end>\n", engine);
+            return;
+        }
+
+        const event_t& e = events[i];
+
+        if (e.id == 2) printf("  %-9s key 0x%02X modifiers 0x%02X\n", engine, e.key, e.modifiers);
+        else printf("  %-9s report %u\n", engine, e.id);
+    }
+
+    /**
+     * @brief Runs both engines on a script and compares what the host typed
+     */
+    bool check(const char* name, const std::string& script) {
+        run_t plain      = run(script, false);
+        run_t coalescing = run(script, true);
+
+        size_t n = plain.events.size() < coalescing.events.size() ? plain.events.size() : coalescing.events.size();
+        size_t i = 0;
+
+        while (i < n && same(plain.events[i], coalescing.events[i])) ++i;
+
+        bool equal = (i == n) && (plain.events.size() == coalescing.events.size());
+
+        printf("%-16s %8zu %9zu %9zu %10.1f %10.1f %6s\n",
+               name, plain.events.size(), plain.reports, coalescing.reports,
+               plain.virt_us / 1e3, coalescing.virt_us / 1e3,
+               equal && coalescing.released ? "ok" : "FAIL");
+
+        if (!equal) {
+            printf("  first difference at event %zu\n", i);
+            print_event("plain", plain.events, i);
+            print_event("coalesce", coalescing.events, i);
+        } else if (!coalescing.released) {
+            printf("  keys still down after the last report\n");
+        }
+
+        return equal && coalescing.released;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<const char*> scripts;
+
+    for (int i = 1; i < argc; ++i) {
+        if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [script ...]\n", argv[0]);
+            return 2;
+        }
+        scripts.push_back(argv[i]);
+    }
+
+    keyboard::begin();
+
+    printf("%-16s %8s %9s %9s %10s %10s %6s\n",
+           "payload", "events", "reports", "reports", "virt ms", "virt ms", "");
+    printf("%-16s %8s %9s %9s %10s %10s %6s\n",
+           "", "", "plain", "coalesce", "plain", "coalesce", "");
+
+    bool ok = true;
+
+    for (const char* path : scripts) {
+        std::string script;
+
+        if (!bench::load(path, &script)) {
+            fprintf(stderr, "can't read %s\n", path);
+            return 1;
+        }
+
+        ok = bench::check(bench::basename(path), script) && ok;
+    }
+
+    ok = bench::check("edges", bench::synthetic_edges()) && ok;
+
+    for (const bench::payload_t& p : bench::synthetic) {
+        ok = bench::check(p.name, p.make()) && ok;
+    }
+
+    // Leave the keyboard as configured for whoever runs next
+    keyboard::setCoalescing(HID_COALESCE);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,68 @@
+/*!
+    \file host/shim/Arduino.h
+    \brief Minimal Arduino core for host builds of the firmware modules
+    \copyright MIT License
+
+    Only what the ATmega and ESP sources actually use is provided. Time is virtual:
+    delay() and delayMicroseconds() advance a counter instead of sleeping,
+    so a script that would take minutes on a real board runs in milliseconds
+    while millis() still reports what the board would have seen.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "host.h"
+
+#ifdef __cplusplus
+#include "WString.h"
+#include "HardwareSerial.h"
+#endif
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+// ===== PROGMEM ===== //
+// Flash and RAM share one address space on the host
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+
+// ===== GPIO ===== //
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define BIN 2
+#define HEX 16
+#define DEC 10
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+
+// ===== TIME ===== //
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Interrupt guards are no-ops, the host build is single threaded
+#define noInterrupts()
+#define interrupts()
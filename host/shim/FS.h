@@ -0,0 +1,99 @@
+/*!
+    \file host/shim/FS.h
+    \brief ESP8266 file system API backed by host memory
+    \copyright MIT License
+
+    SPIFFS is a map of absolute paths to byte strings, filled by the
+    simulators through host::flash_put(). Files opened with "a+" read from
+    the start and append on write, like SPIFFS on the ESP8266.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "WString.h"
+
+enum SeekMode {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+typedef struct FSInfo {
+    size_t totalBytes;
+    size_t usedBytes;
+} FSInfo;
+
+class File {
+    public:
+        File() {}
+        File(const std::string& path, std::shared_ptr<std::string> data) : path(path), data(data) {}
+
+        int available();
+        int peek();
+        int read();
+        size_t read(uint8_t* buffer, size_t len);
+
+        size_t write(uint8_t b);
+        size_t write(const uint8_t* buffer, size_t len);
+        size_t print(const char* str);
+        size_t println(const char* str);
+        void flush() {}
+
+        bool seek(uint32_t pos, SeekMode mode = SeekSet);
+        size_t position() const;
+        size_t size() const;
+
+        const char* name() const;
+        void close();
+
+        operator bool() const {
+            return data != nullptr;
+        }
+
+    private:
+        std::string path;
+        std::shared_ptr<std::string> data;
+        size_t pos = 0;
+};
+
+class Dir {
+    public:
+        Dir() {}
+        Dir(const std::string& path) : prefix(path) {}
+
+        bool next();
+        String fileName();
+        size_t fileSize();
+
+    private:
+        std::string prefix;
+        std::string current;
+        bool started = false;
+};
+
+class FS {
+    public:
+        bool begin() {
+            return true;
+        }
+        bool format();
+        bool info(FSInfo& info);
+
+        File open(const String& path, const char* mode);
+        bool exists(const String& path);
+        bool remove(const String& path);
+        bool rename(const String& from, const String& to);
+        Dir openDir(const String& path);
+
+        /*! Every file, keyed by absolute path */
+        std::map<std::string, std::shared_ptr<std::string> > files;
+};
+
+extern FS SPIFFS;
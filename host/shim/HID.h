@@ -0,0 +1,36 @@
+/*!
+    \file host/shim/HID.h
+    \brief PluggableUSB HID shim that records every report into host::hid_trace()
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+// Endpoint numbering of the AVR core's USBDesc.h, HID() sits right after CDC
+#define CDC_FIRST_ENDPOINT 1
+#define CDC_ENPOINT_COUNT 3
+#define USB_EP_SIZE 64
+
+/*!
+   Free bytes in an IN endpoint, 0 until the host has read the last report.
+   The host reads the HID endpoint once per poll interval, see host::hid_poll_us().
+ */
+uint8_t USB_SendSpace(uint8_t ep);
+
+class HIDSubDescriptor {
+    public:
+        HIDSubDescriptor(const void* d, uint16_t l) : data(d), length(l) {}
+
+        const void* data;
+        uint16_t    length;
+};
+
+class HID_ {
+    public:
+        void AppendDescriptor(HIDSubDescriptor* node);
+        int SendReport(uint8_t id, const void* data, int len);
+};
+
+HID_& HID();
@@ -0,0 +1,68 @@
+/*!
+    \file host/shim/HardwareSerial.h
+    \brief UART ports of the host shim
+    \copyright MIT License
+
+    A port on its own swallows what is written to it and never receives
+    anything. host::uart_connect() joins two ports with a modeled serial line
+    that runs on the virtual clock, see host.h.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace host {
+    struct uart_line;
+}
+
+class HardwareSerial {
+    public:
+        void begin(unsigned long baud);
+        void end();
+
+        /*! Rate passed to the last begin(), 0 while the port is closed */
+        unsigned long baud();
+
+        int available();
+        int peek();
+        int read();
+
+        size_t readBytes(char* buffer, size_t len);
+        size_t readBytes(uint8_t* buffer, size_t len) {
+            return readBytes((char*)buffer, len);
+        }
+
+        size_t write(uint8_t b);
+        size_t write(const uint8_t* buffer, size_t len);
+        size_t write(const char* buffer, size_t len) {
+            return write((const uint8_t*)buffer, len);
+        }
+
+        void flush();
+
+        void setTimeout(unsigned long ms) {
+            timeout = ms;
+        }
+
+        /*! ESP8266 core: bytes the port holds before it overruns */
+        size_t setRxBufferSize(size_t size) {
+            rx_buffer = size;
+            return size;
+        }
+
+        operator bool() {
+            return true;
+        }
+
+        // ===== Host side ===== //
+        unsigned long     rate      = 0;       // !< Baud rate the port was opened with
+        unsigned long     timeout   = 1000;    // !< readBytes() timeout in ms, as in Stream
+        size_t            rx_buffer = 0;       // !< Set by setRxBufferSize(), 0 = rx_buffer of the line's uart_model
+        host::uart_line* tx        = nullptr; // !< Line this port transmits on
+        host::uart_line* rx        = nullptr; // !< Line this port receives from
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
@@ -0,0 +1,32 @@
+/*!
+    \file host/shim/Mouse.h
+    \brief Mouse library shim, reports go through HID() like the real library
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <HID.h>
+
+#define MOUSE_LEFT   1
+#define MOUSE_RIGHT  2
+#define MOUSE_MIDDLE 4
+#define MOUSE_ALL    (MOUSE_LEFT | MOUSE_RIGHT | MOUSE_MIDDLE)
+
+class Mouse_ {
+    private:
+        uint8_t _buttons = 0;
+
+        void buttons(uint8_t b);
+
+    public:
+        void begin() {}
+        void end() {}
+        void click(uint8_t b = MOUSE_LEFT);
+        void move(signed char x, signed char y, signed char wheel = 0);
+        void press(uint8_t b = MOUSE_LEFT);
+        void release(uint8_t b = MOUSE_LEFT);
+        bool isPressed(uint8_t b = MOUSE_LEFT);
+};
+
+extern Mouse_ Mouse;
@@ -0,0 +1,17 @@
+/*!
+    \file host/shim/SdFat.h
+    \brief Placeholder for SdFat, the host build replaces sdcard.cpp with sdcard_host.cpp
+    \copyright MIT License
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#define SD_SCK_MHZ(maxMhz) (1000000UL*(maxMhz))
+
+#define O_RDONLY 0x00
+#define O_WRONLY 0x01
+#define O_CREAT  0x40
+#define O_TRUNC  0x200
+#define O_APPEND 0x400
@@ -0,0 +1,131 @@
+/*!
+    \file host/shim/WString.h
+    \brief Arduino String on top of std::string
+    \copyright MIT License
+
+    Covers the members the ESP sources use. Numbers are formatted in decimal
+    like the Arduino implementation, a single char is appended as a character.
+ */
+
+#pragma once
+
+#include <string>
+
+class String {
+    public:
+        String() {}
+        String(const char* s) : str(s ? s : "") {}
+        String(const std::string& s) : str(s) {}
+        String(char c) : str(1, c) {}
+        String(unsigned char v) : str(std::to_string(v)) {}
+        String(int v) : str(std::to_string(v)) {}
+        String(unsigned int v) : str(std::to_string(v)) {}
+        String(long v) : str(std::to_string(v)) {}
+        String(unsigned long v) : str(std::to_string(v)) {}
+
+        const char* c_str() const {
+            return str.c_str();
+        }
+
+        unsigned int length() const {
+            return str.length();
+        }
+
+        unsigned char reserve(unsigned int size) {
+            str.reserve(size);
+            return 1;
+        }
+
+        char operator[](unsigned int i) const {
+            return i < str.length() ? str[i] : 0;
+        }
+
+        bool operator==(const String& s) const {
+            return str == s.str;
+        }
+
+        bool operator==(const char* s) const {
+            return str == (s ? s : "");
+        }
+
+        bool operator!=(const String& s) const {
+            return str != s.str;
+        }
+
+        String& operator+=(const String& s) {
+            str += s.str;
+            return *this;
+        }
+
+        String& operator+=(const char* s) {
+            if (s) str += s;
+            return *this;
+        }
+
+        String& operator+=(char c) {
+            str += c;
+            return *this;
+        }
+
+        String& operator+=(unsigned char v) {
+            return *this += String(v);
+        }
+
+        String& operator+=(int v) {
+            return *this += String(v);
+        }
+
+        String& operator+=(unsigned int v) {
+            return *this += String(v);
+        }
+
+        String& operator+=(long v) {
+            return *this += String(v);
+        }
+
+        String& operator+=(unsigned long v) {
+            return *this += String(v);
+        }
+
+        friend String operator+(const String& a, const String& b) {
+            return String(a.str + b.str);
+        }
+
+        friend String operator+(const char* a, const String& b) {
+            return String(a) + b;
+        }
+
+        bool startsWith(const String& s) const {
+            return str.compare(0, s.str.length(), s.str) == 0;
+        }
+
+        bool endsWith(const String& s) const {
+            return str.length() >= s.str.length() &&
+                   str.compare(str.length() - s.str.length(), s.str.length(), s.str) == 0;
+        }
+
+        int indexOf(char c, unsigned int from = 0) const {
+            size_t i = str.find(c, from);
+
+            return i == std::string::npos ? -1 : (int)i;
+        }
+
+        String substring(unsigned int from, unsigned int to = (unsigned int)-1) const {
+            if (from > str.length()) return String();
+            return String(str.substr(from, to == (unsigned int)-1 ? std::string::npos : to - from));
+        }
+
+        long toInt() const {
+            return strtol(str.c_str(), NULL, 10);
+        }
+
+        void trim() {
+            size_t b = str.find_first_not_of(" \t\r\n");
+            size_t e = str.find_last_not_of(" \t\r\n");
+
+            str = b == std::string::npos ? std::string() : str.substr(b, e - b + 1);
+        }
+
+    private:
+        std::string str;
+};
@@ -0,0 +1,43 @@
+/*!
+    \file host/shim/Wire.h
+    \brief I2C interface of the host shim
+    \copyright MIT License
+
+    One Wire object is the bus: the ESP calls the master side, the ATmega
+    registers as slave with begin(address). Until host::i2c_connect() was
+    called nothing answers on the bus: transmissions end with an address
+    NACK and reads return no bytes. See host/shim/i2c_host.cpp.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*! Bytes the master buffers per transaction, I2C_BUFFER_LENGTH of the ESP8266 core */
+#define BUFFER_LENGTH 128
+
+class TwoWire {
+    public:
+        void begin();
+        void begin(uint8_t address);
+        void begin(int sda, int scl);
+        void setClock(uint32_t clock);
+
+        void beginTransmission(uint8_t address);
+        uint8_t endTransmission(bool stop = true);
+
+        uint8_t requestFrom(int address, size_t quantity, bool stop = true);
+
+        size_t write(uint8_t b);
+        size_t write(const uint8_t* buffer, size_t len);
+
+        int available();
+        int read();
+        size_t readBytes(char* buffer, size_t len);
+
+        void onReceive(void (* cb)(int));
+        void onRequest(void (* cb)());
+};
+
+extern TwoWire Wire;
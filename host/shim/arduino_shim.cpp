@@ -0,0 +1,200 @@
+/*!
+    \file host/shim/arduino_shim.cpp
+    \brief Virtual clock, GPIO, HID and Mouse implementation of the host shim
+    \copyright MIT License
+ */
+
+#include <Arduino.h>
+#include <HID.h>
+#include <Mouse.h>
+
+#include <stdio.h>
+
+namespace host {
+    // ========== PRIVATE ========== //
+
+    /** Virtual time in microseconds since the last reset_clock() */
+    uint64_t clock_us = 0;
+
+    /** Counter the time functions run on, see use_clock() */
+    uint64_t* clock = &clock_us;
+
+    /** Called after every delay(), see on_delay() */
+    void (* delay_hook)() = NULL;
+
+    /** Every report sent through HID().SendReport */
+    std::vector<hid_record> trace;
+
+    /** Interval the USB host reads the HID endpoint at */
+    uint32_t hid_poll = 1000;
+
+    /** Time the last report is read by the host, the endpoint is busy until then */
+    uint64_t hid_read_us = 0;
+
+    /** Output level of each GPIO pin, only kept so digitalRead() is consistent */
+    uint8_t pins[32];
+
+    // ========== PUBLIC ========== //
+
+    uint64_t now_us() {
+        return *clock;
+    }
+
+    void advance_us(uint64_t us) {
+        *clock += us;
+    }
+
+    void reset_clock() {
+        *clock      = 0;
+        hid_read_us = 0;
+    }
+
+    uint64_t* use_clock(uint64_t* c) {
+        uint64_t* prev = clock;
+
+        clock = c ? c : &clock_us;
+
+        return prev == &clock_us ? NULL : prev;
+    }
+
+    void on_delay(void (* hook)()) {
+        delay_hook = hook;
+    }
+
+    const std::vector<hid_record>& hid_trace() {
+        return trace;
+    }
+
+    void hid_clear() {
+        trace.clear();
+    }
+
+    void hid_poll_us(uint32_t us) {
+        hid_poll = us ? us : 1;
+    }
+
+    void hid_dump(FILE* out) {
+        for (const hid_record& r : trace) {
+            fprintf(out, "%llu %u", (unsigned long long)r.time_us, r.id);
+
+            for (uint8_t i = 0; i < r.len; ++i) fprintf(out, " %02x", r.data[i]);
+
+            fputc('\n', out);
+        }
+    }
+}
+
+// ===== TIME ===== //
+unsigned long millis() {
+    return (unsigned long)(*host::clock / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)*host::clock;
+}
+
+void delay(unsigned long ms) {
+    *host::clock += (uint64_t)ms * 1000;
+
+    if (host::delay_hook) host::delay_hook();
+}
+
+void delayMicroseconds(unsigned int us) {
+    *host::clock += us;
+
+    if (host::delay_hook) host::delay_hook();
+}
+
+// ===== GPIO ===== //
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    if (pin < sizeof(host::pins)) host::pins[pin] = val;
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < sizeof(host::pins) ? host::pins[pin] : LOW;
+}
+
+void analogWrite(uint8_t pin, int val) {
+    digitalWrite(pin, val > 127 ? HIGH : LOW);
+}
+
+// ===== HID ===== //
+void HID_::AppendDescriptor(HIDSubDescriptor* node) {}
+
+uint8_t USB_SendSpace(uint8_t ep) {
+    return *host::clock < host::hid_read_us ? 0 : USB_EP_SIZE;
+}
+
+int HID_::SendReport(uint8_t id, const void* data, int len) {
+    // USB_Send() waits for the endpoint in steps of 1 ms, interrupts
+    // keep running meanwhile
+    if (*host::clock < host::hid_read_us) {
+        while (*host::clock < host::hid_read_us) *host::clock += 1000;
+
+        if (host::delay_hook) host::delay_hook();
+    }
+
+    host::hid_record r;
+
+    r.time_us = *host::clock;
+    r.id      = id;
+    r.len     = len > (int)sizeof(r.data) ? sizeof(r.data) : (uint8_t)len;
+
+    memset(r.data, 0, sizeof(r.data));
+    memcpy(r.data, data, r.len);
+
+    host::trace.push_back(r);
+
+    // Read at the next poll of the host
+    host::hid_read_us = (*host::clock / host::hid_poll + 1) * host::hid_poll;
+
+    return len;
+}
+
+HID_& HID() {
+    static HID_ obj;
+
+    return obj;
+}
+
+// ===== MOUSE ===== //
+Mouse_ Mouse;
+
+void Mouse_::buttons(uint8_t b) {
+    if (b != _buttons) {
+        _buttons = b;
+        move(0, 0, 0);
+    }
+}
+
+void Mouse_::click(uint8_t b) {
+    _buttons = b;
+    move(0, 0, 0);
+    _buttons = 0;
+    move(0, 0, 0);
+}
+
+void Mouse_::move(signed char x, signed char y, signed char wheel) {
+    uint8_t m[4];
+
+    m[0] = _buttons;
+    m[1] = x;
+    m[2] = y;
+    m[3] = wheel;
+
+    HID().SendReport(1, m, 4);
+}
+
+void Mouse_::press(uint8_t b) {
+    buttons(_buttons | b);
+}
+
+void Mouse_::release(uint8_t b) {
+    buttons(_buttons & ~b);
+}
+
+bool Mouse_::isPressed(uint8_t b) {
+    return (b & _buttons) > 0;
+}
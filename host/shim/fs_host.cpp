@@ -0,0 +1,185 @@
+/*!
+    \file host/shim/fs_host.cpp
+    \brief In-memory SPIFFS for the ESP sources
+    \copyright MIT License
+ */
+
+#include <Arduino.h>
+#include <FS.h>
+
+/*! Flash size of the ESP-01/ESP-12 partition layout the board ships with */
+#define FS_TOTAL_BYTES (1024UL * 1024UL)
+
+FS SPIFFS;
+
+namespace host {
+    // ========== PRIVATE ========== //
+
+    /**
+     * @brief Adds the leading slash so "/a.ds" and "a.ds" name the same file
+     */
+    std::string flash_name(const char* n) {
+        std::string s(n ? n : "");
+
+        if (s.empty() || (s[0] != '/')) s = "/" + s;
+        return s;
+    }
+
+    // ========== PUBLIC ========== //
+
+    void flash_put(const char* name, const std::string& content) {
+        SPIFFS.files[flash_name(name)] = std::make_shared<std::string>(content);
+    }
+
+    bool flash_get(const char* name, std::string* content) {
+        auto it = SPIFFS.files.find(flash_name(name));
+
+        if (it == SPIFFS.files.end()) return false;
+        if (content) *content = *it->second;
+
+        return true;
+    }
+}
+
+// ===== File ===== //
+int File::available() {
+    return data && pos < data->size() ? data->size() - pos : 0;
+}
+
+int File::peek() {
+    return available() ? (uint8_t)(*data)[pos] : -1;
+}
+
+int File::read() {
+    return available() ? (uint8_t)(*data)[pos++] : -1;
+}
+
+size_t File::read(uint8_t* buffer, size_t len) {
+    size_t n = available();
+
+    if (len > n) len = n;
+    if (len) memcpy(buffer, data->data() + pos, len);
+    pos += len;
+
+    return len;
+}
+
+size_t File::write(uint8_t b) {
+    return write(&b, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t len) {
+    if (!data) return 0;
+
+    data->append((const char*)buffer, len);
+    return len;
+}
+
+size_t File::print(const char* str) {
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t File::println(const char* str) {
+    return print(str) + print("\r\n");
+}
+
+bool File::seek(uint32_t p, SeekMode mode) {
+    if (!data) return false;
+
+    if (mode == SeekCur) p += pos;
+    else if (mode == SeekEnd) p = data->size() - p;
+
+    if (p > data->size()) return false;
+
+    pos = p;
+    return true;
+}
+
+size_t File::position() const {
+    return pos;
+}
+
+size_t File::size() const {
+    return data ? data->size() : 0;
+}
+
+const char* File::name() const {
+    return path.c_str();
+}
+
+void File::close() {
+    data = nullptr;
+    pos  = 0;
+}
+
+// ===== Dir ===== //
+bool Dir::next() {
+    auto it = started ? SPIFFS.files.upper_bound(current) : SPIFFS.files.lower_bound(prefix);
+
+    started = true;
+
+    if ((it == SPIFFS.files.end()) || (it->first.compare(0, prefix.size(), prefix) != 0)) return false;
+
+    current = it->first;
+    return true;
+}
+
+String Dir::fileName() {
+    return String(current);
+}
+
+size_t Dir::fileSize() {
+    auto it = SPIFFS.files.find(current);
+
+    return it == SPIFFS.files.end() ? 0 : it->second->size();
+}
+
+// ===== FS ===== //
+bool FS::format() {
+    files.clear();
+    return true;
+}
+
+bool FS::info(FSInfo& info) {
+    info.totalBytes = FS_TOTAL_BYTES;
+    info.usedBytes  = 0;
+
+    for (auto& f : files) info.usedBytes += f.second->size();
+
+    return true;
+}
+
+File FS::open(const String& path, const char* mode) {
+    auto it = files.find(path.c_str());
+
+    if (it == files.end()) {
+        if (mode[0] == 'r') return File();
+        it = files.emplace(path.c_str(), std::make_shared<std::string>()).first;
+    } else if (mode[0] == 'w') {
+        it->second->clear();
+    }
+
+    return File(it->first, it->second);
+}
+
+bool FS::exists(const String& path) {
+    return files.count(path.c_str()) > 0;
+}
+
+bool FS::remove(const String& path) {
+    return files.erase(path.c_str()) > 0;
+}
+
+bool FS::rename(const String& from, const String& to) {
+    auto it = files.find(from.c_str());
+
+    if (it == files.end()) return false;
+
+    files[to.c_str()] = it->second;
+    files.erase(it);
+    return true;
+}
+
+Dir FS::openDir(const String& path) {
+    return Dir(path.c_str());
+}
@@ -0,0 +1,175 @@
+/*!
+    \file host/shim/host.h
+    \brief Control surface of the host shim (virtual clock, HID trace, SD card, UART, I2C)
+    \copyright MIT License
+
+    The firmware modules only see the Arduino API. Benchmarks and simulators
+    use the functions in here to drive the clock and inspect what the
+    firmware did.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+class HardwareSerial;
+
+namespace host {
+    // ===== Virtual clock ===== //
+
+    /*! Current virtual time in microseconds */
+    uint64_t now_us();
+
+    /*! Moves the virtual clock forward */
+    void advance_us(uint64_t us);
+
+    /*! Sets the virtual clock back to zero */
+    void reset_clock();
+
+    /*!
+       Selects the counter millis(), micros() and delay() run on.
+       Every simulated board owns one so a blocking delay() on one side does
+       not stall the other. NULL selects the default counter again.
+       Returns the counter that was selected before.
+     */
+    uint64_t* use_clock(uint64_t* clock);
+
+    /*!
+       Called at the end of every delay() and delayMicroseconds(), so a
+       simulator can let the other boards catch up while one is blocked.
+       NULL removes it.
+     */
+    void on_delay(void (* hook)());
+
+    // ===== HID trace ===== //
+
+    /*! One HID().SendReport call as seen by the USB host */
+    typedef struct hid_record {
+        uint64_t time_us; // !< Virtual time the report was handed to the endpoint
+        uint8_t  id;      // !< Report ID (1 = mouse, 2 = keyboard)
+        uint8_t  len;     // !< Number of valid bytes in data
+        uint8_t  data[8]; // !< Report payload
+    } hid_record;
+
+    /*! Every report sent since the last hid_clear() */
+    const std::vector<hid_record>& hid_trace();
+
+    /*! Drops all recorded reports */
+    void hid_clear();
+
+    /*! Writes the trace as one line per report: time, id and payload in hex */
+    void hid_dump(FILE* out);
+
+    /*!
+       Sets how often the USB host reads the HID endpoint, 1000 us by default
+       (full speed, bInterval 1). A report sent before the previous one was
+       read waits for the next poll, like USB_Send() on the board.
+     */
+    void hid_poll_us(uint32_t us);
+
+    // ===== SD card ===== //
+
+    /*! Mounts or removes the in-memory SD card */
+    void sd_insert(bool present);
+
+    /*! Creates or replaces a file on the in-memory SD card */
+    void sd_put(const char* name, const std::string& content);
+
+    /*! Reads a file from the in-memory SD card */
+    bool sd_get(const char* name, std::string* content);
+
+    // ===== SPIFFS ===== //
+
+    /*! Creates or replaces a file in the ESP's in-memory SPIFFS */
+    void flash_put(const char* name, const std::string& content);
+
+    /*! Reads a file from the ESP's in-memory SPIFFS */
+    bool flash_get(const char* name, std::string* content);
+
+    // ===== UART ===== //
+
+    /*! Electrical model of a serial line between two HardwareSerial ports */
+    typedef struct uart_model {
+        unsigned long baud;       // !< Line rate, 0 = whatever begin() was called with
+        unsigned long max_baud;   // !< Fastest rate that gets through, faster bytes arrive garbled, 0 = any
+        uint32_t      latency_us; // !< Fixed extra delay per byte (level shifters, cable)
+        uint32_t      jitter_us;  // !< Random extra delay per byte, uniform in [0, jitter_us]
+        double        drop_rate;  // !< Probability that a byte is lost on the wire
+        double        flip_rate;  // !< Probability that a byte arrives with one bit flipped
+        uint16_t      tx_buffer;  // !< Bytes the sender queues before write() blocks
+        uint16_t      rx_buffer;  // !< Bytes the receiver holds before it overruns
+        uint32_t      seed;       // !< Seed of the jitter, drop and flip generator
+    } uart_model;
+
+    /*! What happened on one direction of a link */
+    typedef struct uart_stats {
+        uint64_t              bytes;           // !< Bytes handed to write()
+        uint64_t              dropped;         // !< Bytes lost on the wire
+        uint64_t              flipped;         // !< Bytes that arrived with a bit flipped
+        uint64_t              garbled;         // !< Bytes received at the wrong baud rate
+        uint64_t              overruns;        // !< Bytes lost because the receive buffer was full
+        uint64_t              busy_us;         // !< Time the line spent shifting bits
+        uint64_t              first_us;        // !< Start of the first byte
+        uint64_t              last_arrival_us; // !< Arrival of the latest byte at the receiver
+        std::vector<uint32_t> gaps_us;         // !< Idle time before every burst but the first
+    } uart_stats;
+
+    /*! Model used by uart_connect() when none is given: 9600 8N1, no errors */
+    uart_model uart_default_model();
+
+    /*!
+       Wires the TX of a to the RX of b and the other way around.
+       Ports that are not connected swallow everything written to them.
+     */
+    void uart_connect(HardwareSerial& a, HardwareSerial& b, const uart_model& m);
+
+    /*! Statistics of the direction port transmits on */
+    const uart_stats& uart_tx_stats(HardwareSerial& port);
+
+    /*! Zeroes the statistics of both directions of every link */
+    void uart_reset_stats();
+
+    // ===== I2C ===== //
+
+    /*! Electrical model of the I2C bus between the master and one slave */
+    typedef struct i2c_model {
+        unsigned long clock;       // !< Bus rate in Hz, 0 = whatever setClock() was called with
+        uint32_t      overhead_us; // !< Time per transaction on top of its bits: start, stop, the master's software
+        uint16_t      buffer;      // !< Bytes the slave's Wire buffers per transaction, it NACKs the rest of a write
+    } i2c_model;
+
+    /*! What happened on the bus */
+    typedef struct i2c_stats {
+        uint64_t writes;  // !< Transactions the master wrote in
+        uint64_t reads;   // !< Transactions the master read in
+        uint64_t written; // !< Bytes the slave took
+        uint64_t read;    // !< Bytes the master read
+        uint64_t nacked;  // !< Writes the slave NACKed a byte of
+        uint64_t busy_us; // !< Time the bus was busy
+    } i2c_stats;
+
+    /*! 100 kHz unless the master sets another rate, 10 us per transaction, 32 bytes like the AVR core's Wire */
+    i2c_model i2c_default_model();
+
+    /*!
+       Puts the slave on the bus. Its onReceive() and onRequest() callbacks
+       run through slave(f), so a simulator can run them on the slave's
+       clock. They run once the transaction is over, the master waits for
+       its bits on its own clock.
+     */
+    void i2c_connect(const i2c_model& m, void (* slave)(void (* f)()));
+
+    /*! Rate the bus runs at: the model's or the one the master set */
+    unsigned long i2c_clock();
+
+    /*! Statistics of the bus */
+    const i2c_stats& i2c_get_stats();
+
+    /*! Zeroes the statistics of the bus */
+    void i2c_reset_stats();
+}
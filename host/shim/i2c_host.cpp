@@ -0,0 +1,213 @@
+/*!
+    \file host/shim/i2c_host.cpp
+    \brief Wire and the modeled I2C bus between the master and one slave
+    \copyright MIT License
+
+    A transaction takes 9 bit times per byte, the address included, plus
+    the overhead of the model. The master blocks for that long on its own
+    clock, then the slave's callback runs: onReceive() with the bytes its
+    buffer took, onRequest() before the master reads what it wrote. Like
+    the AVR core's Wire, the slave NACKs bytes beyond its buffer and the
+    master reads 0xFF past the end of the reply.
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <vector>
+
+TwoWire Wire;
+
+namespace host {
+    // ========== PRIVATE ========== //
+
+    i2c_model bus;
+    i2c_stats stats;
+
+    /** Runs the slave's callbacks, NULL while no slave is connected */
+    void (* slave_run)(void (* f)()) = NULL;
+
+    /** Address the slave listens on, set by begin(address) */
+    int slave_addr = -1;
+
+    void (* on_receive)(int) = NULL;
+    void (* on_request)()    = NULL;
+
+    /** Rate the master set with setClock() */
+    uint32_t master_clock = 100000;
+
+    /** Address and bytes of the transaction the master is writing */
+    uint8_t              tx_addr = 0;
+    std::vector<uint8_t> tx;
+
+    /** What the slave wrote from onRequest() */
+    std::vector<uint8_t> reply;
+    bool                 replying = false;
+
+    /** What read() returns: the master's reply or the bytes onReceive() takes */
+    std::vector<uint8_t> rx;
+    size_t               rx_pos = 0;
+
+    /**
+     * @brief Occupies the bus for bytes bytes after the address and moves the master's clock past them
+     */
+    void transfer(size_t bytes) {
+        uint64_t us = (uint64_t)((bytes + 1) * 9 * 1e6 / i2c_clock() + 0.5) + bus.overhead_us;
+
+        stats.busy_us += us;
+        advance_us(us);
+    }
+
+    void receive() {
+        if (on_receive) on_receive((int)rx.size());
+    }
+
+    void request() {
+        if (on_request) on_request();
+    }
+
+    // ========== PUBLIC ========== //
+
+    i2c_model i2c_default_model() {
+        i2c_model m;
+
+        m.clock       = 0;
+        m.overhead_us = 10;
+        m.buffer      = 32;
+
+        return m;
+    }
+
+    void i2c_connect(const i2c_model& m, void (* slave)(void (* f)())) {
+        bus       = m;
+        slave_run = slave;
+    }
+
+    unsigned long i2c_clock() {
+        return bus.clock ? bus.clock : master_clock;
+    }
+
+    const i2c_stats& i2c_get_stats() {
+        return stats;
+    }
+
+    void i2c_reset_stats() {
+        stats = i2c_stats();
+    }
+}
+
+// ===== TwoWire ===== //
+void TwoWire::begin() {}
+
+void TwoWire::begin(uint8_t address) {
+    host::slave_addr = address;
+}
+
+void TwoWire::begin(int sda, int scl) {}
+
+void TwoWire::setClock(uint32_t clock) {
+    host::master_clock = clock;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    host::tx_addr = address;
+    host::tx.clear();
+}
+
+uint8_t TwoWire::endTransmission(bool stop) {
+    // Address NACK
+    if (!host::slave_run || (host::tx_addr != host::slave_addr)) {
+        host::transfer(0);
+        return 2;
+    }
+
+    size_t taken = host::tx.size() < host::bus.buffer ? host::tx.size() : host::bus.buffer;
+    bool   nack  = taken < host::tx.size();
+
+    // The master stops at the byte the slave NACKed
+    host::transfer(taken + (nack ? 1 : 0));
+
+    ++host::stats.writes;
+    host::stats.written += taken;
+    if (nack) ++host::stats.nacked;
+
+    host::rx.assign(host::tx.begin(), host::tx.begin() + taken);
+    host::rx_pos = 0;
+
+    host::slave_run(host::receive);
+
+    host::rx.clear();
+    host::rx_pos = 0;
+
+    return nack ? 3 : 0;
+}
+
+uint8_t TwoWire::requestFrom(int address, size_t quantity, bool stop) {
+    host::rx.clear();
+    host::rx_pos = 0;
+
+    if (!host::slave_run || (address != host::slave_addr)) {
+        host::transfer(0);
+        return 0;
+    }
+
+    host::reply.clear();
+    host::replying = true;
+    host::slave_run(host::request);
+    host::replying = false;
+
+    host::transfer(quantity);
+
+    ++host::stats.reads;
+    host::stats.read += quantity;
+
+    for (size_t i = 0; i < quantity; ++i) host::rx.push_back(i < host::reply.size() ? host::reply[i] : 0xFF);
+
+    return (uint8_t)quantity;
+}
+
+size_t TwoWire::write(uint8_t b) {
+    if (host::replying) {
+        if (host::reply.size() >= host::bus.buffer) return 0;
+        host::reply.push_back(b);
+        return 1;
+    }
+
+    if (host::tx.size() >= BUFFER_LENGTH) return 0;
+
+    host::tx.push_back(b);
+
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* buffer, size_t len) {
+    size_t n = 0;
+
+    while ((n < len) && write(buffer[n])) ++n;
+
+    return n;
+}
+
+int TwoWire::available() {
+    return (int)(host::rx.size() - host::rx_pos);
+}
+
+int TwoWire::read() {
+    return host::rx_pos < host::rx.size() ? host::rx[host::rx_pos++] : -1;
+}
+
+size_t TwoWire::readBytes(char* buffer, size_t len) {
+    size_t n = 0;
+
+    while ((n < len) && available()) buffer[n++] = (char)read();
+
+    return n;
+}
+
+void TwoWire::onReceive(void (* cb)(int)) {
+    host::on_receive = cb;
+}
+
+void TwoWire::onRequest(void (* cb)()) {
+    host::on_request = cb;
+}
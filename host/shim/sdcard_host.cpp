@@ -0,0 +1,355 @@
+/*!
+    \file host/shim/sdcard_host.cpp
+    \brief In-memory replacement for atmega_duck/src/sdcard/sdcard.cpp
+    \copyright MIT License
+
+    Implements the sdcard namespace on top of a map of file names to byte
+    strings, so script_runner and sd_handler run unchanged on the host. The
+    status transitions mirror sdcard.cpp one to one.
+ */
+
+#include "../../atmega_duck/src/sdcard/sdcard.h"
+
+#include <map>
+
+namespace host {
+    // ========== PRIVATE ========== //
+
+    /** Contents of the card, keyed by name without the leading slash */
+    std::map<std::string, std::string> files;
+
+    /** When each file was last modified, a counter instead of a FAT date and time */
+    std::map<std::string, uint32_t> modified;
+
+    /** Value of the next modification */
+    uint32_t sd_clock = 0;
+
+    /** True while a card is "inserted" */
+    bool sd_present = true;
+
+    /**
+     * @brief Strips the leading slash so "/A.DS" and "A.DS" name the same file
+     */
+    std::string sd_name(const char* n) {
+        while (n && *n == '/') ++n;
+        return std::string(n ? n : "");
+    }
+
+    // ========== PUBLIC ========== //
+
+    void sd_insert(bool present) {
+        sd_present = present;
+    }
+
+    /**
+     * @brief Replaces the file, it counts as modified if its content changes
+     */
+    void sd_put(const char* name, const std::string& content) {
+        std::string n = sd_name(name);
+        auto it       = files.find(n);
+
+        if ((it != files.end()) && (it->second == content)) return;
+
+        files[n]    = content;
+        modified[n] = ++sd_clock;
+    }
+
+    bool sd_get(const char* name, std::string* content) {
+        auto it = files.find(sd_name(name));
+
+        if (it == files.end()) return false;
+        if (content) *content = it->second;
+
+        return true;
+    }
+}
+
+namespace sdcard {
+    // ========== PRIVATE ========== //
+
+    /** File that is open for reading or writing */
+    static std::string* file = nullptr;
+
+    /** Read/write position inside file */
+    static uint32_t pos = 0;
+
+    /** Name of the file open for reading, for modified() */
+    static std::string name;
+
+    /** Index that is open, see beginIndex() */
+    static std::string* idx = nullptr;
+
+    /** Read/write position inside idx */
+    static uint32_t idx_pos = 0;
+
+    /** Next directory entry returned by getNextFile() */
+    static std::map<std::string, std::string>::iterator entry;
+
+    /** Directory entry returned last, see ungetFile() */
+    static std::map<std::string, std::string>::iterator last;
+
+    static bool r;
+    static bool w;
+
+    static SDStatus currentStatus = SD_NOT_PRESENT;
+
+    // ========== PUBLIC ========== //
+
+    bool begin() {
+        if (!host::sd_present) return false;
+
+        currentStatus = SD_IDLE;
+        return true;
+    }
+
+    bool available() {
+        if (host::sd_present && currentStatus != SD_NOT_PRESENT) return true;
+
+        currentStatus = SD_NOT_PRESENT;
+        return false;
+    }
+
+    void setStatus(SDStatus s) {
+        currentStatus = s;
+    }
+
+    SDStatus getStatus() {
+        return currentStatus;
+    }
+
+    // ===== READ ===== //
+
+    bool beginFileRead(const char* n, uint32_t* s) {
+        if (r || !available()) return false;
+
+        auto it = host::files.find(host::sd_name(n));
+
+        if (it == host::files.end()) {
+            currentStatus = SD_ERROR;
+            return false;
+        }
+
+        file = &it->second;
+        pos  = 0;
+        name = it->first;
+
+        if (s) *s = file->size();
+        r             = true;
+        currentStatus = SD_READING;
+        return true;
+    }
+
+    int16_t readFileChunk(uint8_t* b, uint16_t m) {
+        if (!r || !file) return 0;
+
+        uint32_t left = file->size() - pos;
+
+        if (m > left) m = left;
+
+        memcpy(b, file->data() + pos, m);
+        pos += m;
+
+        return m;
+    }
+
+    void endFileRead() {
+        if (r) {
+            file          = nullptr;
+            r             = false;
+            currentStatus = SD_IDLE;
+        }
+    }
+
+    int peek() {
+        if (!r || !file || pos >= file->size()) return -1;
+        return (uint8_t)(*file)[pos];
+    }
+
+    uint32_t tell() {
+        return r ? pos : 0;
+    }
+
+    bool seek(uint32_t p) {
+        if (!r || !file || p > file->size()) return false;
+
+        pos = p;
+        return true;
+    }
+
+    uint32_t modified() {
+        return r ? host::modified[name] : 0;
+    }
+
+    // ===== INDEX ===== //
+
+#ifdef USE_SCRIPT_INDEX
+
+    bool beginIndex(const char* n, bool write) {
+        if (idx || w || !available()) return false;
+
+        std::string key = host::sd_name(n);
+
+        if (write) {
+            idx = &host::files[key];
+            idx->clear();
+            host::modified[key] = ++host::sd_clock;
+        } else {
+            auto it = host::files.find(key);
+
+            if (it == host::files.end()) return false;
+
+            idx = &it->second;
+        }
+
+        idx_pos = 0;
+        return true;
+    }
+
+    int16_t readIndex(uint8_t* b, uint16_t m) {
+        if (!idx) return 0;
+
+        uint32_t left = idx_pos < idx->size() ? idx->size() - idx_pos : 0;
+
+        if (m > left) m = left;
+
+        memcpy(b, idx->data() + idx_pos, m);
+        idx_pos += m;
+
+        return m;
+    }
+
+    uint16_t writeIndex(const uint8_t* b, uint16_t len) {
+        if (!idx) return 0;
+
+        if (idx->size() < idx_pos + len) idx->resize(idx_pos + len);
+
+        memcpy(&(*idx)[idx_pos], b, len);
+        idx_pos += len;
+
+        return len;
+    }
+
+    bool seekIndex(uint32_t p) {
+        if (!idx || p > idx->size()) return false;
+
+        idx_pos = p;
+        return true;
+    }
+
+    void endIndex() {
+        idx = nullptr;
+    }
+#endif // USE_SCRIPT_INDEX
+
+    // ===== WRITE ===== //
+
+    bool beginFileWrite(const char* n, bool append) {
+        if (r || w || !available()) return false;
+
+        file = &host::files[host::sd_name(n)];
+
+        host::modified[host::sd_name(n)] = ++host::sd_clock;
+
+        if (!append) file->clear();
+        pos = file->size();
+
+        w             = true;
+        currentStatus = SD_WRITING;
+        return true;
+    }
+
+    uint16_t writeFileChunk(const uint8_t* b, uint16_t len) {
+        if (!w || !file) return 0;
+
+        file->append((const char*)b, len);
+        pos += len;
+
+        return len;
+    }
+
+    bool syncFile() {
+        return w;
+    }
+
+    void endFileWrite() {
+        if (w) {
+            file          = nullptr;
+            w             = false;
+            currentStatus = SD_IDLE;
+        }
+    }
+
+    // ===== DELETE ===== //
+
+    bool removeFile(const char* n) {
+        if (r || w || !available()) return false;
+        host::modified.erase(host::sd_name(n));
+        return host::files.erase(host::sd_name(n)) > 0;
+    }
+
+    bool removeDir(const char* n) {
+        return false;
+    }
+
+    // ===== LIST ===== //
+
+    bool beginList(const char* dir) {
+        if (r || w || !available()) return false;
+
+        entry         = host::files.begin();
+        r             = true;
+        currentStatus = SD_LISTING;
+        return true;
+    }
+
+    bool getNextFile(char* name, uint8_t maxLen, uint32_t* size) {
+        if (!r) return false;
+
+        while (entry != host::files.end()) {
+            const std::string& n = entry->first;
+            uint32_t s           = entry->second.size();
+
+            last = entry++;
+
+            // Same extension filter as sdcard.cpp
+            size_t len = n.size();
+
+            if ((len >= 4) && (len <= MAX_NAME) && (len < maxLen)) {
+                const char* e = &n[len - 4];
+
+                if (((e[0] == '.') && (e[1] == 't' || e[1] == 'T') && (e[2] == 'x' || e[2] == 'X') && (e[3] == 't' || e[3] == 'T')) ||
+                    ((e[1] == '.') && (e[2] == 'd' || e[2] == 'D') && (e[3] == 's' || e[3] == 'S')) ||
+                    ((e[1] == '.') && (e[2] == 'j' || e[2] == 'J') && (e[3] == 's' || e[3] == 'S'))) {
+                    memcpy(name, n.c_str(), len + 1);
+                    *size = s;
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void ungetFile() {
+        if (r) entry = last;
+    }
+
+    uint32_t tellList() {
+        return r ? std::distance(host::files.begin(), entry) : 0;
+    }
+
+    void seekList(uint32_t p) {
+        if (!r) return;
+
+        entry = host::files.begin();
+
+        while ((p-- > 0) && (entry != host::files.end())) ++entry;
+    }
+
+    void endList() {
+        if (r) {
+            r             = false;
+            currentStatus = SD_IDLE;
+        }
+    }
+}
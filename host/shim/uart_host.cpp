@@ -0,0 +1,259 @@
+/*!
+    \file host/shim/uart_host.cpp
+    \brief Serial ports and the modeled line between them
+    \copyright MIT License
+
+    Every byte written to a connected port gets an arrival time on the
+    virtual clock: it waits for the transmitter to finish the bytes queued
+    before it, takes 10 bit times on the wire (8N1) and is then held back by
+    the latency and jitter of the model. The receiver only sees bytes whose
+    arrival time is not in its future. Both ends may run on different clocks
+    (see host::use_clock), the times are absolute so that works out.
+ */
+
+#include <Arduino.h>
+
+#include <deque>
+#include <memory>
+#include <random>
+
+HardwareSerial Serial;
+HardwareSerial Serial1;
+
+namespace host {
+    // ========== PRIVATE ========== //
+
+    /*! A byte on its way to the receiver */
+    typedef struct uart_byte {
+        uint64_t arrival_us;
+        uint8_t  b;
+    } uart_byte;
+
+    /*! One direction of a link */
+    struct uart_line {
+        uart_model            m;
+        HardwareSerial*       from;
+        HardwareSerial*       to;
+        std::deque<uart_byte> wire;    // !< Sent, not yet arrived at the receiver
+        std::deque<uint8_t>   fifo;    // !< Arrived, not yet read
+        double                tx_free; // !< Time the transmitter finishes its last byte
+        uint64_t              arrival; // !< Arrival time of the last byte put on the wire
+        uart_stats            stats;
+        std::mt19937          rng;
+    };
+
+    /** Every line created by uart_connect() */
+    std::vector<std::unique_ptr<uart_line> > lines;
+
+    /** Statistics returned for ports that are not connected */
+    uart_stats no_stats;
+
+    /**
+     * @brief Duration of one 8N1 frame in microseconds
+     */
+    double byte_us(unsigned long baud) {
+        return 10e6 / baud;
+    }
+
+    /**
+     * @brief Line rate of a connection, 0 while the sending port is closed
+     */
+    unsigned long line_baud(const uart_line* l) {
+        return l->m.baud ? l->m.baud : l->from->rate;
+    }
+
+    /**
+     * @brief Moves every byte that has arrived by now into the receive buffer
+     *
+     * A full buffer drops the byte, just like the UART ISR does when the
+     * sketch does not read fast enough.
+     */
+    void sync(uart_line* l) {
+        uint64_t now  = now_us();
+        size_t   size = l->to->rx_buffer ? l->to->rx_buffer : l->m.rx_buffer;
+
+        while (!l->wire.empty() && l->wire.front().arrival_us <= now) {
+            if (l->fifo.size() < size) l->fifo.push_back(l->wire.front().b);
+            else ++l->stats.overruns;
+
+            l->wire.pop_front();
+        }
+    }
+
+    uart_line* make_line(HardwareSerial* from, HardwareSerial* to, const uart_model& m, uint32_t seed) {
+        uart_line* l = new uart_line();
+
+        l->m       = m;
+        l->from    = from;
+        l->to      = to;
+        l->tx_free = 0;
+        l->arrival = 0;
+        l->rng.seed(seed);
+        l->stats   = uart_stats();
+
+        lines.emplace_back(l);
+
+        from->tx = l;
+        to->rx   = l;
+
+        return l;
+    }
+
+    // ========== PUBLIC ========== //
+
+    uart_model uart_default_model() {
+        uart_model m;
+
+        m.baud       = 0;
+        m.max_baud   = 0;
+        m.latency_us = 0;
+        m.jitter_us  = 0;
+        m.drop_rate  = 0;
+        m.flip_rate  = 0;
+        m.tx_buffer  = 64;
+        m.rx_buffer  = 64;
+        m.seed       = 1;
+
+        return m;
+    }
+
+    void uart_connect(HardwareSerial& a, HardwareSerial& b, const uart_model& m) {
+        make_line(&a, &b, m, m.seed);
+        make_line(&b, &a, m, m.seed * 2654435761U + 1);
+    }
+
+    const uart_stats& uart_tx_stats(HardwareSerial& port) {
+        return port.tx ? port.tx->stats : no_stats;
+    }
+
+    void uart_reset_stats() {
+        for (auto& l : lines) l->stats = uart_stats();
+    }
+}
+
+// ===== HardwareSerial ===== //
+void HardwareSerial::begin(unsigned long baud) {
+    rate = baud;
+}
+
+void HardwareSerial::end() {
+    rate = 0;
+}
+
+unsigned long HardwareSerial::baud() {
+    return rate;
+}
+
+int HardwareSerial::available() {
+    if (!rx) return 0;
+
+    host::sync(rx);
+    return rx->fifo.size();
+}
+
+int HardwareSerial::peek() {
+    if (!available()) return -1;
+    return rx->fifo.front();
+}
+
+int HardwareSerial::read() {
+    if (!available()) return -1;
+
+    uint8_t b = rx->fifo.front();
+
+    rx->fifo.pop_front();
+    return b;
+}
+
+size_t HardwareSerial::readBytes(char* buffer, size_t len) {
+    uint64_t deadline = host::now_us() + (uint64_t)timeout * 1000;
+    size_t   n        = 0;
+
+    // Stream::readBytes() blocks until len bytes are in or the timeout hit
+    while (n < len) {
+        if (available()) {
+            buffer[n++] = read();
+            continue;
+        }
+
+        uint64_t next = (rx && !rx->wire.empty()) ? rx->wire.front().arrival_us : deadline;
+
+        if (next > deadline) next = deadline;
+        if (next <= host::now_us()) break;
+
+        host::advance_us(next - host::now_us());
+    }
+
+    return n;
+}
+
+size_t HardwareSerial::write(uint8_t b) {
+    host::uart_line* l = tx;
+
+    if (!l || !rate) return 1;
+
+    unsigned long baud = host::line_baud(l);
+    double frame       = host::byte_us(baud);
+    double now         = host::now_us();
+
+    // Line idle: the byte starts right away, remember the gap before it
+    if (l->tx_free < now) {
+        if (l->stats.bytes) l->stats.gaps_us.push_back((uint32_t)(now - l->tx_free));
+        else l->stats.first_us = host::now_us();
+        l->tx_free = now;
+    }
+
+    // TX buffer full: write() blocks until there is room again
+    double backlog = l->tx_free - now - l->m.tx_buffer * frame;
+
+    if (backlog > 0) host::advance_us((uint64_t)ceil(backlog));
+
+    l->tx_free += frame;
+
+    ++l->stats.bytes;
+    l->stats.busy_us += (uint64_t)(frame + 0.5);
+
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    if ((l->m.drop_rate > 0) && (uniform(l->rng) < l->m.drop_rate)) {
+        ++l->stats.dropped;
+        return 1;
+    }
+
+    if ((l->m.flip_rate > 0) && (uniform(l->rng) < l->m.flip_rate)) {
+        b ^= (uint8_t)(1 << (l->rng() % 8));
+        ++l->stats.flipped;
+    }
+
+    // Receiver listening at another rate, or a line too slow for this one: it samples noise
+    if ((!l->m.baud && (l->to->rate != baud)) || (l->m.max_baud && (baud > l->m.max_baud))) {
+        b = (uint8_t)l->rng();
+        ++l->stats.garbled;
+    }
+
+    uint64_t arrival = (uint64_t)ceil(l->tx_free) + l->m.latency_us;
+
+    if (l->m.jitter_us) arrival += l->rng() % (l->m.jitter_us + 1);
+
+    // Bytes never overtake each other on a single wire
+    if (arrival < l->arrival) arrival = l->arrival;
+
+    l->arrival               = arrival;
+    l->stats.last_arrival_us = arrival;
+    l->wire.push_back({ arrival, b });
+
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t len) {
+    for (size_t i = 0; i < len; ++i) write(buffer[i]);
+    return len;
+}
+
+void HardwareSerial::flush() {
+    if (!tx) return;
+
+    double now = host::now_us();
+
+    if (tx->tx_free > now) host::advance_us((uint64_t)ceil(tx->tx_free - now));
+}
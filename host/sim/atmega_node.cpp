@@ -0,0 +1,58 @@
+/*!
+    \file host/sim/atmega_node.cpp
+    \brief The ATmega32u4 sketch, compiled as is
+    \copyright MIT License
+
+    Passes through loop() that take no time and leave nothing to do are
+    idle: the ATmega waits for the next line. A run of them ends in a gap
+    as soon as a pass does something again.
+ */
+
+#include "nodes.h"
+
+#define setup atmega_duck_setup
+#define loop atmega_duck_loop
+
+#include "../../atmega_duck/atmega_duck.ino"
+
+#undef setup
+#undef loop
+
+namespace atmega_node {
+    // ========== PRIVATE ========== //
+
+    std::vector<uint64_t> idle_gaps;
+
+    /** Start of the first idle pass in a row */
+    uint64_t idle_since = 0;
+    bool     idle       = false;
+
+    // ========== PUBLIC ========== //
+
+    void setup() {
+        atmega_duck_setup();
+    }
+
+    void loop() {
+        uint64_t start = host::now_us();
+
+        atmega_duck_loop();
+
+        bool busy = (host::now_us() != start) || com::hasData() ||
+                    duckparser::pending() || (duckparser::getDelayTime() > 0);
+
+        if (busy && idle) idle_gaps.push_back(start - idle_since);
+        else if (!busy && !idle) idle_since = start;
+
+        idle = !busy;
+    }
+
+    const std::vector<uint64_t>& gaps() {
+        return idle_gaps;
+    }
+
+    void clear() {
+        idle_gaps.clear();
+        idle = false;
+    }
+}
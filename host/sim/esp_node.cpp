@@ -0,0 +1,294 @@
+/*!
+    \file host/sim/esp_node.cpp
+    \brief The ESP8266 side of the link: com, duckscript and SPIFFS
+    \copyright MIT License
+
+    The done, ready and repeat callbacks are wrapped so every line
+    duckscript sends is timed from the callback that produced it to the
+    status that acknowledges it. Acknowledged packets leave com in the order
+    they were sent, so com::in_flight() is all it takes to tell which. The
+    wrappers and the one around the loop callback also count how often com
+    fires them. The firmware itself is not touched.
+
+    upload() and cat() stand in for the web UI and cli.cpp, which are not
+    part of the host build: upload() sends the packets sd_stream_write_begin,
+    sd_stream_write and sd_stop would, and the next chunk as soon as com
+    prints SD_ACK:OK. cat() and ls() send what sd_cat and sd_ls would and
+    collect what com prints until SD_END, the way web/script.js does.
+ */
+
+#include "nodes.h"
+
+#include "../../esp_duck/config.h"
+#include "../../esp_duck/com.h"
+#include "../../esp_duck/duckscript.h"
+#include "../../esp_duck/spiffs.h"
+
+namespace esp_node {
+    // ========== PRIVATE ========== //
+
+    std::vector<line_record> records;
+
+    /** First record that isn't acknowledged yet */
+    size_t open = 0;
+
+    /** Packets sent by callbacks during the current com::update() */
+    unsigned int sent = 0;
+
+    /** Callbacks com fired since the last clear() */
+    unsigned long fired = 0;
+
+    /** Chunk size of web/sd_handler.js */
+    #define UPLOAD_CHUNK 126
+
+    /** File the current upload writes and what is left of it */
+    std::string upload_data;
+    size_t      upload_pos  = 0;
+    bool        upload_busy = false;
+    bool        upload_ack  = false;
+
+    /** SD packet to send */
+    uint8_t sd_buf[BUFFER_SIZE];
+
+    /** What the current sd_cat or sd_ls printed so far and how it ended */
+    std::string cat_data;
+    bool        cat_busy = false;
+    bool        cat_ok   = false;
+
+    /**
+     * @brief The browser's side of an SD write or read
+     *
+     * SD_ACK:OK asks for the next chunk of a write, the answer is sent from
+     * loop(), com::update() is still running here.
+     */
+    void on_print(const char* str) {
+        if (cat_busy) {
+            if (strncmp(str, "SD_CAT:", 7) == 0) {
+                cat_data += &str[7];
+            } else if (strncmp(str, "SD_LS:", 6) == 0) {
+                cat_data += &str[6];
+                cat_data += '\n';
+            } else if (strncmp(str, "SD_END:", 7) == 0) {
+                cat_ok   = strcmp(str, "SD_END:OK") == 0;
+                cat_busy = false;
+            }
+        }
+
+        if (!upload_busy) return;
+
+        if (strcmp(str, "SD_ACK:OK") == 0) upload_ack = true;
+        else if ((strncmp(str, "SD_ACK:", 7) == 0) || (strncmp(str, "SD_END:", 7) == 0)) upload_busy = false;
+    }
+
+    /**
+     * @brief Sends the next chunk of the upload like cli.cpp's sendSDData(), or sd_stop after the last
+     */
+    void upload_next() {
+        upload_ack = false;
+
+        if (upload_pos >= upload_data.size()) {
+            uint8_t stop_cmd = SD_CMD_STOP;
+
+            com::send_sd(&stop_cmd, 1);
+            upload_busy = false;
+            return;
+        }
+
+        size_t len = std::min(upload_data.size() - upload_pos, (size_t)UPLOAD_CHUNK);
+
+        sd_buf[0] = SD_CMD_WRITE;
+        memcpy(&sd_buf[1], upload_data.data() + upload_pos, len);
+
+        com::send_sd(sd_buf, len + 1);
+        upload_pos += len;
+    }
+
+    /**
+     * @brief Runs a duckscript callback and records the packets it sent
+     *
+     * Packets sent in one go share the time the last of their bytes arrived.
+     */
+    void timed(void (* f)()) {
+        uint64_t start = host::now_us();
+
+        const host::uart_stats& tx = host::uart_tx_stats(SERIAL_PORT);
+        uint64_t bytes             = tx.bytes;
+        uint8_t  in_flight         = com::in_flight();
+
+        f();
+
+        if (com::in_flight() <= in_flight) return;
+
+        unsigned int n     = com::in_flight() - in_flight;
+        uint64_t     total = tx.bytes - bytes;
+
+        for (unsigned int i = 0; i < n; ++i) {
+            line_record r;
+
+            r.start_us     = start;
+            r.delivered_us = tx.last_arrival_us;
+            r.done_us      = 0;
+            r.bytes        = total / n + (i < total % n ? 1 : 0);
+
+            records.push_back(r);
+        }
+
+        sent += n;
+    }
+
+    void on_done() {
+        ++fired;
+        timed(duckscript::nextLine);
+    }
+
+    void on_ready() {
+        ++fired;
+        timed(duckscript::sendAhead);
+    }
+
+    void on_repeat() {
+        ++fired;
+        timed(duckscript::repeat);
+    }
+
+    void on_loop() {
+        ++fired;
+        duckscript::check_loop_block();
+    }
+
+    // ========== PUBLIC ========== //
+
+    void setup() {
+        delay(2500);
+
+        com::begin();
+
+        spiffs::begin();
+
+        com::onDone(on_done);
+        com::onError(duckscript::stopAll);
+        com::onRepeat(on_repeat);
+        com::onLoop(on_loop);
+        com::onReady(on_ready);
+
+        com::set_print_callback(on_print);
+
+        if (spiffs::freeBytes() > 0) com::send(MSG_STARTED);
+
+        delay(10);
+        com::update();
+    }
+
+    void loop() {
+        uint64_t now       = host::now_us();
+        uint8_t  in_flight = com::in_flight();
+
+        sent = 0;
+
+        com::update();
+
+        if (upload_busy && upload_ack) upload_next();
+
+        unsigned int acked = in_flight + sent - com::in_flight();
+
+        for (; acked > 0 && open < records.size(); --acked) records[open++].done_us = now;
+    }
+
+    void run(const char* name) {
+        static const char* script;
+
+        script = name;
+        timed([]() {
+            duckscript::run(script);
+        });
+    }
+
+    bool running() {
+        return duckscript::isRunning();
+    }
+
+    void upload(const char* name, const std::string& content) {
+        size_t len = std::min(strlen(name), (size_t)MAX_NAME);
+
+        upload_data = content;
+        upload_pos  = 0;
+        upload_busy = true;
+        upload_ack  = false;
+
+        com::set_mode(sdcard::SD_WRITING);
+
+        sd_buf[0] = SD_CMD_WRITE;
+        sd_buf[1] = 0;
+        memcpy(&sd_buf[2], name, len);
+        sd_buf[len + 2] = '\0';
+
+        com::send_sd(sd_buf, len + 3);
+    }
+
+    bool uploading() {
+        return upload_busy;
+    }
+
+    uint8_t cat(const char* name, uint8_t window) {
+        size_t len = std::min(strlen(name), (size_t)MAX_NAME);
+
+        if (window == 0) window = SD_READ_WINDOW;
+
+        cat_data.clear();
+        cat_busy = true;
+        cat_ok   = false;
+
+        com::set_mode(sdcard::SD_READING);
+
+        sd_buf[0] = SD_CMD_READ;
+        memcpy(&sd_buf[1], name, len);
+        sd_buf[len + 1] = '\0';
+        sd_buf[len + 2] = window;
+
+        com::send_sd(sd_buf, len + 3);
+
+        return window;
+    }
+
+    void ls() {
+        cat_data.clear();
+        cat_busy = true;
+        cat_ok   = false;
+
+        com::set_mode(sdcard::SD_LISTING);
+
+        sd_buf[0] = SD_CMD_LS;
+        sd_buf[1] = '/';
+        sd_buf[2] = '\0';
+
+        com::send_sd(sd_buf, 3);
+    }
+
+    bool catting() {
+        return cat_busy;
+    }
+
+    bool cat_result(std::string* content) {
+        *content = cat_data;
+        return cat_ok;
+    }
+
+    const std::vector<line_record>& lines() {
+        return records;
+    }
+
+    unsigned long callbacks() {
+        return fired;
+    }
+
+    unsigned long wait_ms() {
+        return com::get_link_stats().wait_ms;
+    }
+
+    void clear() {
+        records.clear();
+        open  = 0;
+        fired = 0;
+        com::reset_link_stats();
+    }
+}
@@ -0,0 +1,88 @@
+/*!
+    \file host/sim/nodes.h
+    \brief The two boards of the WiFi Duck as seen by the link simulator
+    \copyright MIT License
+
+    Each node wraps the setup() and loop() of one sketch. Both are linked into
+    one program, so the ESP sources are compiled with com renamed to esp_com
+    (see the Makefile) to keep the two com namespaces apart.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include <string>
+#include <vector>
+
+namespace esp_node {
+    /*! One packet duckscript handed to com::send() */
+    typedef struct line_record {
+        uint64_t start_us;     // !< ESP time the callback that sent it fired
+        uint64_t delivered_us; // !< Arrival of the last byte at the ATmega
+        uint64_t done_us;      // !< ESP time the status acknowledging it arrived, 0 while open
+        uint32_t bytes;        // !< Bytes on the wire including framing
+    } line_record;
+
+    /*! Mirrors esp_duck.ino setup() without WiFi, web server and settings */
+    void setup();
+
+    /*! Mirrors esp_duck.ino loop() */
+    void loop();
+
+    /*! Starts a script from SPIFFS through duckscript::run() */
+    void run(const char* name);
+
+    /*! True while duckscript is running a script */
+    bool running();
+
+    /*!
+       Writes content to name on the ATmega's SD card the way the web UI
+       does: sd_stream_write_begin, then one chunk per SD_ACK, then sd_stop
+     */
+    void upload(const char* name, const std::string& content);
+
+    /*! True while an upload is waiting for the ATmega */
+    bool uploading();
+
+    /*!
+       Reads name from the ATmega's SD card like sd_cat, window chunks ahead
+       or SD_READ_WINDOW if it is 0. Returns the window.
+     */
+    uint8_t cat(const char* name, uint8_t window);
+
+    /*! Lists the root of the ATmega's SD card like sd_ls, a "name,size" line per file */
+    void ls();
+
+    /*! True until com printed SD_END for the last cat() or ls() */
+    bool catting();
+
+    /*! What the last cat() or ls() printed, false unless it ended with SD_END:OK */
+    bool cat_result(std::string* content);
+
+    /*! Every packet sent since the last clear() */
+    const std::vector<line_record>& lines();
+
+    /*! Done, ready, repeat and loop callbacks com fired since the last clear() */
+    unsigned long callbacks();
+
+    /*! Time packets were in flight since the last clear(), see com::get_link_stats() */
+    unsigned long wait_ms();
+
+    /*! Forgets the recorded packets and callbacks, starts com's link counters over */
+    void clear();
+}
+
+namespace atmega_node {
+    /*! atmega_duck.ino setup() */
+    void setup();
+
+    /*! atmega_duck.ino loop() */
+    void loop();
+
+    /*! Time the ATmega sat idle before each packet since the last clear() */
+    const std::vector<uint64_t>& gaps();
+
+    /*! Forgets the recorded gaps */
+    void clear();
+}
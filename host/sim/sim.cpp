@@ -0,0 +1,140 @@
+/*!
+    \file host/sim/sim.cpp
+    \brief Scheduler of the two board simulation
+    \copyright MIT License
+ */
+
+#include "sim.h"
+#include "nodes.h"
+
+namespace sim {
+    // ========== PRIVATE ========== //
+
+    config_t cfg;
+
+    uint64_t esp_clock    = 0;
+    uint64_t atmega_clock = 0;
+
+    /*! Longest time one ATmega loop() blocked, see longest_atmega_loop_us() */
+    uint64_t atmega_longest = 0;
+
+    /*! Clock of the board that is running right now, NULL between steps */
+    uint64_t* running = NULL;
+
+    /*! Set once the ATmega is through setup(), the ESP may wait for it from then on */
+    bool started = false;
+
+    /*! True while catch_up() runs, the board catching up must not yield back */
+    bool yielding = false;
+
+    void esp_loop() {
+        on_esp(esp_node::loop);
+        esp_clock += cfg.esp_loop_us;
+    }
+
+    void atmega_loop() {
+        uint64_t start = atmega_clock;
+
+        on_atmega(atmega_node::loop);
+
+        if (atmega_clock - start > atmega_longest) atmega_longest = atmega_clock - start;
+
+        atmega_clock += cfg.atmega_loop_us;
+    }
+
+    /**
+     * @brief Runs the other board up to the time of the one that is in delay()
+     *
+     * On the hardware both boards keep running while one of them waits, so
+     * a board that polls the serial port between delays sees the reply of
+     * the other one. Only one level deep: a delay() of the board that is
+     * catching up just moves its clock.
+     */
+    void catch_up() {
+        if (!started || yielding || !running) return;
+
+        yielding = true;
+
+        if (running == &esp_clock) {
+            while (atmega_clock < esp_clock) atmega_loop();
+        } else {
+            while (esp_clock < atmega_clock) esp_loop();
+        }
+
+        yielding = false;
+    }
+
+    // ========== PUBLIC ========== //
+
+    config_t default_config() {
+        config_t c;
+
+        c.uart           = host::uart_default_model();
+        c.i2c            = host::i2c_default_model();
+        c.esp_loop_us    = 50;
+        c.atmega_loop_us = 20;
+
+        return c;
+    }
+
+    void begin(const config_t& c) {
+        cfg = c;
+
+        host::uart_connect(Serial, Serial1, cfg.uart);
+        host::i2c_connect(cfg.i2c, on_atmega);
+        host::on_delay(catch_up);
+
+        on_atmega(atmega_node::setup);
+
+        started = true;
+
+        on_esp(esp_node::setup);
+    }
+
+    void step() {
+        if (esp_clock <= atmega_clock) esp_loop();
+        else atmega_loop();
+    }
+
+    uint64_t now_us() {
+        return esp_clock < atmega_clock ? esp_clock : atmega_clock;
+    }
+
+    uint64_t esp_us() {
+        return esp_clock;
+    }
+
+    uint64_t atmega_us() {
+        return atmega_clock;
+    }
+
+    uint64_t longest_atmega_loop_us() {
+        return atmega_longest;
+    }
+
+    void reset_longest_loop() {
+        atmega_longest = 0;
+    }
+
+    void on_esp(void (* f)()) {
+        uint64_t* prev  = running;
+        uint64_t* clock = host::use_clock(&esp_clock);
+
+        running = &esp_clock;
+        f();
+        running = prev;
+
+        host::use_clock(clock);
+    }
+
+    void on_atmega(void (* f)()) {
+        uint64_t* prev  = running;
+        uint64_t* clock = host::use_clock(&atmega_clock);
+
+        running = &atmega_clock;
+        f();
+        running = prev;
+
+        host::use_clock(clock);
+    }
+}
@@ -0,0 +1,61 @@
+/*!
+    \file host/sim/sim.h
+    \brief Runs the ESP8266 and the ATmega32u4 side by side on virtual time
+    \copyright MIT License
+
+    Every board has its own clock. step() always runs one loop() of the board
+    that is behind, so a board blocked in Serial.flush() simply falls ahead
+    in time while the other one catches up. A board in delay() lets the
+    other one catch up right away, so code that waits for a reply in a
+    delay() loop gets it, like setup() on the ESP does. Bytes carry absolute
+    arrival times (see host/shim/uart_host.cpp), so a board never sees data
+    before it was sent. A board can only notice data at the end of a blocking
+    call, exactly like on the hardware.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace sim {
+    typedef struct config_t {
+        host::uart_model uart;           // !< Serial line between Serial (ESP) and Serial1 (ATmega)
+        host::i2c_model  i2c;            // !< I2C bus between Wire on the ESP (master) and on the ATmega (slave)
+        uint32_t         esp_loop_us;    // !< CPU time of one ESP loop() on top of its delays
+        uint32_t         atmega_loop_us; // !< CPU time of one ATmega loop() on top of its delays
+    } config_t;
+
+    /*! 9600 baud, no errors, host::i2c_default_model(), 50 us per ESP loop, 20 us per ATmega loop */
+    config_t default_config();
+
+    /*! Connects the ports and runs setup() on both boards */
+    void begin(const config_t& c);
+
+    /*! Runs one loop() of the board that is behind */
+    void step();
+
+    /*! Time of the board that is behind */
+    uint64_t now_us();
+
+    /*! Current time of the ESP */
+    uint64_t esp_us();
+
+    /*! Current time of the ATmega */
+    uint64_t atmega_us();
+
+    /*!
+       Longest time a single ATmega loop() spent in blocking calls since
+       reset_longest_loop(). Nothing on the ATmega, com included, runs
+       while loop() is blocked.
+     */
+    uint64_t longest_atmega_loop_us();
+
+    /*! Starts a new measurement for longest_atmega_loop_us() */
+    void reset_longest_loop();
+
+    /*! Runs f on the ESP, e.g. to start a script */
+    void on_esp(void (* f)());
+
+    /*! Runs f on the ATmega */
+    void on_atmega(void (* f)());
+}
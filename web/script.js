@@ -85,7 +85,7 @@ class StatusManager {
     this.current = mode;
     const statusEl = E("status");
     
-    if (mode === "connected") statusEl.style.backgroundColor = "#3c5";
+    if (mode.startsWith("connected")) statusEl.style.backgroundColor = "#3c5";
     else if (mode === "disconnected") statusEl.style.backgroundColor = "#d33";
     else if (mode.includes("problem") || mode.includes("error")) statusEl.style.backgroundColor = "#ffc107";
     else if (mode.includes("SD_STATUS: ")) statusEl.style.backgroundColor = "#7207ff";
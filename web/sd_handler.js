@@ -6,7 +6,7 @@ class SDCardHandler {
     this.buffer = "";
     this.targetFile = "";
 
-    this.writeBuffer = "";
+    this.writeBuffer = new Uint8Array(0);
     this.writeOffset = 0;
     this.writeChunkSize = 126; //125 
     this.writeInProgress = false;
@@ -123,7 +123,8 @@ class SDCardHandler {
     
     this.mode = this.MODES.WRITING;
     this.targetFile = fileName;
-    this.writeBuffer = content;
+    // Sent as binary frames, the link carries any byte
+    this.writeBuffer = new TextEncoder().encode(content);
     this.writeOffset = 0;
     this.writeInProgress = true;
     this.writeCallback = callback;
@@ -134,9 +135,8 @@ class SDCardHandler {
     Status.set("SD_STATUS: writting")
     //Status.startInterval();
     
+    // The SD_ACK that answers it asks for the first chunk, see handleWriteAck()
     WSManager.send(`sd_stream_write_begin "${fileName}"`, null);
-    
-    setTimeout(() => this.sendNextChunk(), 500);
   }
 
   sendNextChunk() {
@@ -150,15 +150,14 @@ class SDCardHandler {
     }
     
     const chunkSize = Math.min(this.writeChunkSize, remaining);
-    const chunk = this.writeBuffer.substring(this.writeOffset, this.writeOffset + chunkSize);
+    const chunk = this.writeBuffer.subarray(this.writeOffset, this.writeOffset + chunkSize);
     
     //const progress = Math.floor((this.writeOffset / this.writeBuffer.length) * 100);
     //Status.set(`saving to SD... ${progress}%`);
     
     console.log(`Sending chunk ${this.writeOffset}-${this.writeOffset + chunkSize} of ${this.writeBuffer.length}`);
-    console.log(chunk);
 
-    WSManager.sendRaw(`sd_stream_write ${chunk}`, null);
+    WSManager.sendRaw(chunk, null);
     
     this.writeOffset += chunkSize;
   }
@@ -201,7 +200,7 @@ class SDCardHandler {
       Status.startInterval();
     }
     
-    this.writeBuffer = "";
+    this.writeBuffer = new Uint8Array(0);
     this.writeOffset = 0;
     this.targetFile = "";
     